@@ -30,6 +30,13 @@ export type AudioLevelObserverOptions<AudioLevelObserverAppData extends AppData
 	 */
 	interval?: number;
 
+	/**
+	 * If greater than 0, just RTP packets of the loudest lastN audio Producers
+	 * are forwarded to their Consumers (with some hysteresis so they don't
+	 * flap). Default 0 (all of them are forwarded).
+	 */
+	lastN?: number;
+
 	/**
 	 * Custom application data.
 	 */
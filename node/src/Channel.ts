@@ -4,8 +4,8 @@ import * as flatbuffers from 'flatbuffers';
 import { Logger } from './Logger';
 import { EnhancedEventEmitter } from './EnhancedEventEmitter';
 import { InvalidStateError } from './errors';
-import { Body as RequestBody, Method, Request } from './fbs/request';
-import { Response } from './fbs/response';
+import { BatchRequest, Body as RequestBody, Method, Request } from './fbs/request';
+import { BatchResponse, Response } from './fbs/response';
 import { Message, Body as MessageBody } from './fbs/message';
 import { Notification, Body as NotificationBody, Event } from './fbs/notification';
 import { Log } from './fbs/log';
@@ -23,6 +23,14 @@ type Sent =
 	close: () => void;
 };
 
+export type BatchRequestItem =
+{
+	method: Method;
+	bodyType?: RequestBody;
+	bodyOffset?: number;
+	handlerId?: string;
+};
+
 // Binary length for a 4194304 bytes payload.
 const MESSAGE_MAX_LEN = 4194308;
 const PAYLOAD_MAX_LEN = 4194304;
@@ -50,6 +58,9 @@ export class Channel extends EnhancedEventEmitter
 	// flatbuffers builder.
 	#bufferBuilder:flatbuffers.Builder = new flatbuffers.Builder(1024);
 
+	// Compact handles assigned by the worker to entities, indexed by entity id.
+	readonly #handlerHandles: Map<string, number> = new Map();
+
 	/**
 	 * @private
 	 */
@@ -229,6 +240,8 @@ export class Channel extends EnhancedEventEmitter
 			sent.close();
 		}
 
+		this.#handlerHandles.clear();
+
 		// Remove event listeners but leave a fake 'error' hander to avoid
 		// propagation.
 		this.#consumerSocket.removeAllListeners('end');
@@ -249,6 +262,34 @@ export class Channel extends EnhancedEventEmitter
 		}, 200);
 	}
 
+	/**
+	 * Store the handle the worker assigned to the given entity so requests
+	 * and notifications addressed to it carry it and the worker can resolve
+	 * the target entity without looking up its id.
+	 *
+	 * @private
+	 */
+	setHandlerHandle(handlerId: string, handle: number): void
+	{
+		// 0 means that the worker did not assign a handle.
+		if (!handle)
+		{
+			return;
+		}
+
+		this.#handlerHandles.set(handlerId, handle);
+	}
+
+	/**
+	 * Forget the handle of the given entity once it is closed.
+	 *
+	 * @private
+	 */
+	deleteHandlerHandle(handlerId: string): void
+	{
+		this.#handlerHandles.delete(handlerId);
+	}
+
 	/**
 	 * @private
 	 */
@@ -267,18 +308,24 @@ export class Channel extends EnhancedEventEmitter
 		}
 
 		const handlerIdOffset = this.#bufferBuilder.createString(handlerId);
+		const handlerHandle = this.getHandlerHandle(handlerId);
 
 		let notificationOffset: number;
 
 		if (bodyType && bodyOffset)
 		{
 			notificationOffset = Notification.createNotification(
-				this.#bufferBuilder, handlerIdOffset, event, bodyType, bodyOffset);
+				this.#bufferBuilder, handlerIdOffset, event, bodyType, bodyOffset, handlerHandle);
 		}
 		else
 		{
 			notificationOffset = Notification.createNotification(
-				this.#bufferBuilder, handlerIdOffset, event, NotificationBody.NONE, 0);
+				this.#bufferBuilder,
+				handlerIdOffset,
+				event,
+				NotificationBody.NONE,
+				0,
+				handlerHandle);
 		}
 
 		const messageOffset = Message.createMessage(
@@ -331,18 +378,31 @@ export class Channel extends EnhancedEventEmitter
 		const id = this.#nextId;
 
 		const handlerIdOffset = this.#bufferBuilder.createString(handlerId ?? '');
+		const handlerHandle = this.getHandlerHandle(handlerId);
 
 		let requestOffset: number;
 
 		if (bodyType && bodyOffset)
 		{
 			requestOffset = Request.createRequest(
-				this.#bufferBuilder, id, method, handlerIdOffset, bodyType, bodyOffset);
+				this.#bufferBuilder,
+				id,
+				method,
+				handlerIdOffset,
+				bodyType,
+				bodyOffset,
+				handlerHandle);
 		}
 		else
 		{
 			requestOffset = Request.createRequest(
-				this.#bufferBuilder, id, method, handlerIdOffset, RequestBody.NONE, 0);
+				this.#bufferBuilder,
+				id,
+				method,
+				handlerIdOffset,
+				RequestBody.NONE,
+				0,
+				handlerHandle);
 		}
 
 		const messageOffset = Message.createMessage(
@@ -404,6 +464,83 @@ export class Channel extends EnhancedEventEmitter
 		});
 	}
 
+	/**
+	 * Send several requests in a single WORKER_BATCH request. The worker runs
+	 * them in order within the same loop iteration. Bodies must have been
+	 * built into the channel buffer builder before calling this method.
+	 *
+	 * Resolves with the Response of each request (in the same order), or with
+	 * an Error (or TypeError) for each request that failed.
+	 */
+	async requestBatch(requests: BatchRequestItem[]): Promise<(Response | Error)[]>
+	{
+		const requestOffsets: number[] = [];
+
+		for (let idx = 0; idx < requests.length; ++idx)
+		{
+			const { method, bodyType, bodyOffset, handlerId } = requests[idx];
+			const handlerIdOffset = this.#bufferBuilder.createString(handlerId ?? '');
+
+			requestOffsets.push(Request.createRequest(
+				this.#bufferBuilder,
+				idx,
+				method,
+				handlerIdOffset,
+				bodyType && bodyOffset ? bodyType : RequestBody.NONE,
+				bodyType && bodyOffset ? bodyOffset : 0,
+				this.getHandlerHandle(handlerId)));
+		}
+
+		const requestsOffset =
+			BatchRequest.createRequestsVector(this.#bufferBuilder, requestOffsets);
+		const batchRequestOffset =
+			BatchRequest.createBatchRequest(this.#bufferBuilder, requestsOffset);
+
+		const response = await this.request(
+			Method.WORKER_BATCH,
+			RequestBody.Worker_BatchRequest,
+			batchRequestOffset
+		);
+
+		/* Decode Response. */
+		const batchResponse = new BatchResponse();
+
+		response.body(batchResponse);
+
+		const results: (Response | Error)[] = [];
+
+		for (let idx = 0; idx < batchResponse.responsesLength(); ++idx)
+		{
+			const data = batchResponse.responses(idx)!.dataArray()!;
+			const subResponse = Response.getRootAsResponse(new flatbuffers.ByteBuffer(data));
+
+			if (subResponse.accepted())
+			{
+				results.push(subResponse);
+			}
+			else if (subResponse.error() === 'TypeError')
+			{
+				results.push(new TypeError(subResponse.reason()!));
+			}
+			else
+			{
+				results.push(new Error(subResponse.reason()!));
+			}
+		}
+
+		return results;
+	}
+
+	private getHandlerHandle(handlerId?: string): number
+	{
+		if (!handlerId)
+		{
+			return 0;
+		}
+
+		return this.#handlerHandles.get(handlerId) ?? 0;
+	}
+
 	private processResponse(response: Response): void
 	{
 		const sent = this.#sents.get(response.id());
@@ -75,6 +75,15 @@ export type ConsumerOptions<ConsumerAppData extends AppData = AppData> =
 	 */
 	enableRtx?: boolean;
 
+	/**
+	 * Whether this Consumer should send FlexFEC packets if the remote Consumer
+	 * supports the 'flexfec' codec. Then FEC is sent while the RTT is high
+	 * (NACK based retransmissions would take too long) and its protection is
+	 * adapted to the reported packet loss and the available bitrate. Default
+	 * false.
+	 */
+	enableFec?: boolean;
+
 	/**
 	 * Whether this Consumer should ignore DTX packets (only valid for Opus codec).
 	 * If set, DTX packets are not forwarded to the remote Consumer.
@@ -517,6 +526,7 @@ export class Consumer<ConsumerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.consumerId);
+		this.#channel.deleteHandlerHandle(this.#internal.consumerId);
 
 		/* Build Request. */
 		const requestOffset = new FbsTransport.CloseConsumerRequestT(
@@ -554,6 +564,7 @@ export class Consumer<ConsumerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.consumerId);
+		this.#channel.deleteHandlerHandle(this.#internal.consumerId);
 
 		this.safeEmit('transportclose');
 
@@ -836,6 +847,7 @@ export class Consumer<ConsumerAppData extends AppData = AppData>
 
 					// Remove notification subscriptions.
 					this.#channel.removeAllListeners(this.#internal.consumerId);
+					this.#channel.deleteHandlerHandle(this.#internal.consumerId);
 
 					this.emit('@producerclose');
 					this.safeEmit('producerclose');
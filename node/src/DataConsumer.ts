@@ -312,6 +312,7 @@ export class DataConsumer<DataConsumerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.dataConsumerId);
+		this.#channel.deleteHandlerHandle(this.#internal.dataConsumerId);
 
 		/* Build Request. */
 		const requestOffset = new FbsTransport.CloseDataConsumerRequestT(
@@ -349,6 +350,7 @@ export class DataConsumer<DataConsumerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.dataConsumerId);
+		this.#channel.deleteHandlerHandle(this.#internal.dataConsumerId);
 
 		this.safeEmit('transportclose');
 
@@ -658,6 +660,7 @@ export class DataConsumer<DataConsumerAppData extends AppData = AppData>
 
 					// Remove notification subscriptions.
 					this.#channel.removeAllListeners(this.#internal.dataConsumerId);
+					this.#channel.deleteHandlerHandle(this.#internal.dataConsumerId);
 
 					this.emit('@dataproducerclose');
 					this.safeEmit('dataproducerclose');
@@ -247,6 +247,7 @@ export class DataProducer<DataProducerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.dataProducerId);
+		this.#channel.deleteHandlerHandle(this.#internal.dataProducerId);
 
 		/* Build Request. */
 		const requestOffset = new FbsTransport.CloseDataProducerRequestT(
@@ -284,6 +285,7 @@ export class DataProducer<DataProducerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.dataProducerId);
+		this.#channel.deleteHandlerHandle(this.#internal.dataProducerId);
 
 		this.safeEmit('transportclose');
 
@@ -98,6 +98,24 @@ export type PipeTransportOptions<PipeTransportAppData extends AppData = AppData>
 	 */
 	enableSrtp?: boolean;
 
+	/**
+	 * Send RTP and RTCP packets through a shared memory ring instead of UDP.
+	 * Useful if both Routers are located in different Workers of the same host.
+	 * For this to work, connect() must be called with the remote shmName. Cannot
+	 * be used with enableSrtp. Not supported on Windows. Default false.
+	 */
+	enableShm?: boolean;
+
+	/**
+	 * Coalesce RTP packets sent within the same event loop iteration into
+	 * datagrams of up to this size (in bytes, SRTP trailer included). Useful
+	 * for links carrying many small packets if the network supports jumbo
+	 * frames. The remote PipeTransport must enable it too, since aggregated
+	 * datagrams are just recognized if enabled. Must be between 1500 and 65000.
+	 * Default 0 (disabled).
+	 */
+	aggregationMaxSize?: number;
+
 	/**
 	 * Custom application data.
 	 */
@@ -108,6 +126,20 @@ export type PipeTransportStat = BaseTransportStats &
 {
 	type: string;
 	tuple: TransportTuple;
+	shmPacketsSent: number;
+	shmPacketsReceived: number;
+	aggregatedPacketsSent: number;
+	aggregatedDatagramsSent: number;
+	aggregatedPacketsReceived: number;
+	aggregatedDatagramsReceived: number;
+	/**
+	 * Average number of RTP packets per aggregated datagram sent.
+	 */
+	aggregatedPacketsPerDatagram: number;
+	/**
+	 * Number of UDP sends (and SRTP operations) saved by aggregation.
+	 */
+	aggregationSavedSends: number;
 };
 
 export type PipeConsumerOptions<ConsumerAppData> =
@@ -146,6 +178,10 @@ export type PipeTransportData =
 	sctpState?: SctpState;
 	rtx: boolean;
 	srtpParameters?: SrtpParameters;
+	shmName?: string;
+	aggregationMaxSize: number;
+	aggregatedPacketsSent: number;
+	aggregatedDatagramsSent: number;
 };
 
 export type PipeTransportDump = BaseTransportDump &
@@ -153,6 +189,7 @@ export type PipeTransportDump = BaseTransportDump &
 	tuple: TransportTuple;
 	rtx: boolean;
 	srtpParameters?: SrtpParameters;
+	shmName?: string;
 };
 
 const logger = new Logger('PipeTransport');
@@ -180,7 +217,8 @@ export class PipeTransport<PipeTransportAppData extends AppData = AppData>
 			sctpParameters : data.sctpParameters,
 			sctpState      : data.sctpState,
 			rtx            : data.rtx,
-			srtpParameters : data.srtpParameters
+			srtpParameters : data.srtpParameters,
+			shmName        : data.shmName
 		};
 
 		this.handleWorkerNotifications();
@@ -218,6 +256,14 @@ export class PipeTransport<PipeTransportAppData extends AppData = AppData>
 		return this.#data.srtpParameters;
 	}
 
+	/**
+	 * Name of the shared memory ring (if enabled).
+	 */
+	get shmName(): string | undefined
+	{
+		return this.#data.shmName;
+	}
+
 	/**
 	 * Close the PipeTransport.
 	 *
@@ -292,12 +338,14 @@ export class PipeTransport<PipeTransportAppData extends AppData = AppData>
 		{
 			ip,
 			port,
-			srtpParameters
+			srtpParameters,
+			shmName
 		}:
 		{
 			ip: string;
 			port: number;
 			srtpParameters?: SrtpParameters;
+			shmName?: string;
 		}
 	): Promise<void>
 	{
@@ -307,7 +355,8 @@ export class PipeTransport<PipeTransportAppData extends AppData = AppData>
 			builder : this.channel.bufferBuilder,
 			ip,
 			port,
-			srtpParameters
+			srtpParameters,
+			shmName
 		});
 
 		// Wait for response.
@@ -495,9 +544,13 @@ export function parsePipeTransportDumpResponse(
 
 	return {
 		...baseTransportDump,
-		tuple          : tuple,
-		rtx            : binary.rtx(),
-		srtpParameters : srtpParameters
+		tuple                   : tuple,
+		rtx                     : binary.rtx(),
+		srtpParameters          : srtpParameters,
+		shmName                 : binary.shmName() ?? undefined,
+		aggregationMaxSize      : binary.aggregationMaxSize(),
+		aggregatedPacketsSent   : Number(binary.aggregatedPacketsSent()),
+		aggregatedDatagramsSent : Number(binary.aggregatedDatagramsSent())
 	};
 }
 
@@ -506,11 +559,24 @@ function parseGetStatsResponse(
 ):PipeTransportStat
 {
 	const base = parseBaseTransportStats(binary.base()!);
+	const aggregatedPacketsSent = Number(binary.aggregatedPacketsSent());
+	const aggregatedDatagramsSent = Number(binary.aggregatedDatagramsSent());
+	const aggregatedPacketsPerDatagram = aggregatedDatagramsSent > 0
+		? aggregatedPacketsSent / aggregatedDatagramsSent
+		: 0;
 
 	return {
 		...base,
-		type  : 'pipe-transport',
-		tuple : parseTuple(binary.tuple()!)
+		type                         : 'pipe-transport',
+		tuple                        : parseTuple(binary.tuple()!),
+		shmPacketsSent               : Number(binary.shmPacketsSent()),
+		shmPacketsReceived           : Number(binary.shmPacketsReceived()),
+		aggregatedPacketsSent        : aggregatedPacketsSent,
+		aggregatedDatagramsSent      : aggregatedDatagramsSent,
+		aggregatedPacketsReceived    : Number(binary.aggregatedPacketsReceived()),
+		aggregatedDatagramsReceived  : Number(binary.aggregatedDatagramsReceived()),
+		aggregatedPacketsPerDatagram : aggregatedPacketsPerDatagram,
+		aggregationSavedSends        : aggregatedPacketsSent - aggregatedDatagramsSent
 	};
 }
 
@@ -563,24 +629,32 @@ function createConnectRequest(
 		builder,
 		ip,
 		port,
-		srtpParameters
+		srtpParameters,
+		shmName
 	}:
 	{
 		builder: flatbuffers.Builder;
 		ip?: string;
 		port?: number;
 		srtpParameters?: SrtpParameters;
+		shmName?: string;
 	}
 ): number
 {
 	let ipOffset = 0;
 	let srtpParametersOffset = 0;
+	let shmNameOffset = 0;
 
 	if (ip)
 	{
 		ipOffset = builder.createString(ip);
 	}
 
+	if (shmName)
+	{
+		shmNameOffset = builder.createString(shmName);
+	}
+
 	// Serialize SrtpParameters.
 	if (srtpParameters)
 	{
@@ -601,6 +675,10 @@ function createConnectRequest(
 			builder, srtpParametersOffset
 		);
 	}
+	if (shmName)
+	{
+		FbsPipeTransport.ConnectRequest.addShmName(builder, shmNameOffset);
+	}
 
 	return FbsPipeTransport.ConnectRequest.endConnectRequest(builder);
 }
@@ -43,6 +43,13 @@ export type ProducerOptions<ProducerAppData extends AppData = AppData> =
 	 */
 	keyFrameRequestDelay?: number;
 
+	/**
+	 * Just for video. Whether the most recent key frame (and following frames)
+	 * of each stream must be cached so new Consumers can start rendering it
+	 * without requesting a new key frame to the sender. Default false.
+	 */
+	keyFrameCache?: boolean;
+
 	/**
 	 * Custom application data.
 	 */
@@ -351,6 +358,7 @@ export class Producer<ProducerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.producerId);
+		this.#channel.deleteHandlerHandle(this.#internal.producerId);
 
 		/* Build Request. */
 		const requestOffset = new FbsTransport.CloseProducerRequestT(
@@ -388,6 +396,7 @@ export class Producer<ProducerAppData extends AppData = AppData>
 
 		// Remove notification subscriptions.
 		this.#channel.removeAllListeners(this.#internal.producerId);
+		this.#channel.deleteHandlerHandle(this.#internal.producerId);
 
 		this.safeEmit('transportclose');
 
@@ -0,0 +1,292 @@
+import { Logger } from './Logger';
+import { UnsupportedError } from './errors';
+import {
+	BaseTransportDump,
+	BaseTransportStats,
+	parseBaseTransportDump,
+	parseBaseTransportStats,
+	parseTransportTraceEventData,
+	Transport,
+	TransportEvents,
+	TransportObserverEvents,
+	TransportConstructorOptions
+} from './Transport';
+import { AppData } from './types';
+import { Event, Notification } from './fbs/notification';
+import * as FbsRecordingTransport from './fbs/recording-transport';
+import * as FbsTransport from './fbs/transport';
+import * as FbsRequest from './fbs/request';
+
+export type RecordingTransportOptions<RecordingTransportAppData extends AppData = AppData> =
+{
+	/**
+	 * Path of the file in which RTP and RTCP packets of the consumers of the
+	 * transport are recorded (in rtpdump format). It is created (or truncated)
+	 * by the worker.
+	 */
+	filePath: string;
+
+	/**
+	 * Custom application data.
+	 */
+	appData?: RecordingTransportAppData;
+};
+
+export type RecordingStats =
+{
+	filePath: string;
+	recordedRtpPackets: number;
+	recordedRtcpPackets: number;
+	droppedPackets: number;
+	writtenBytes: number;
+	pendingBytes: number;
+	writeErrors: number;
+};
+
+export type RecordingTransportDump = BaseTransportDump &
+{
+	recording: RecordingStats;
+};
+
+export type RecordingTransportStat = BaseTransportStats &
+{
+	type: string;
+	recording: RecordingStats;
+};
+
+export type RecordingTransportEvents = TransportEvents;
+
+export type RecordingTransportObserverEvents = TransportObserverEvents;
+
+type RecordingTransportConstructorOptions<RecordingTransportAppData> =
+	TransportConstructorOptions<RecordingTransportAppData> &
+	{
+		data: RecordingTransportData;
+	};
+
+export type RecordingTransportData =
+{
+	filePath: string;
+};
+
+const logger = new Logger('RecordingTransport');
+
+export class RecordingTransport<RecordingTransportAppData extends AppData = AppData>
+	extends Transport<
+		RecordingTransportAppData, RecordingTransportEvents, RecordingTransportObserverEvents
+	>
+{
+	// RecordingTransport data.
+	readonly #data: RecordingTransportData;
+
+	/**
+	 * @private
+	 */
+	constructor(options: RecordingTransportConstructorOptions<RecordingTransportAppData>)
+	{
+		super(options);
+
+		logger.debug('constructor()');
+
+		const { data } = options;
+
+		this.#data =
+		{
+			filePath : data.filePath
+		};
+
+		this.handleWorkerNotifications();
+	}
+
+	/**
+	 * Recording file path.
+	 */
+	get filePath(): string
+	{
+		return this.#data.filePath;
+	}
+
+	/**
+	 * Close the RecordingTransport. Pending packets are still written by the
+	 * worker.
+	 *
+	 * @override
+	 */
+	close(): void
+	{
+		if (this.closed)
+		{
+			return;
+		}
+
+		super.close();
+	}
+
+	/**
+	 * Router was closed.
+	 *
+	 * @private
+	 * @override
+	 */
+	routerClosed(): void
+	{
+		if (this.closed)
+		{
+			return;
+		}
+
+		super.routerClosed();
+	}
+
+	/**
+	 * Dump Transport.
+	 */
+	async dump(): Promise<RecordingTransportDump>
+	{
+		logger.debug('dump()');
+
+		const response = await this.channel.request(
+			FbsRequest.Method.TRANSPORT_DUMP,
+			undefined,
+			undefined,
+			this.internal.transportId
+		);
+
+		/* Decode Response. */
+		const data = new FbsRecordingTransport.DumpResponse();
+
+		response.body(data);
+
+		return parseRecordingTransportDumpResponse(data);
+	}
+
+	/**
+	 * Get RecordingTransport stats.
+	 *
+	 * @override
+	 */
+	async getStats(): Promise<RecordingTransportStat[]>
+	{
+		logger.debug('getStats()');
+
+		const response = await this.channel.request(
+			FbsRequest.Method.TRANSPORT_GET_STATS,
+			undefined,
+			undefined,
+			this.internal.transportId
+		);
+
+		/* Decode Response. */
+		const data = new FbsRecordingTransport.GetStatsResponse();
+
+		response.body(data);
+
+		return [ parseGetStatsResponse(data) ];
+	}
+
+	/**
+	 * NO-OP method in RecordingTransport.
+	 *
+	 * @override
+	 */
+	async connect(): Promise<void>
+	{
+		logger.debug('connect()');
+	}
+
+	/**
+	 * @override
+	 */
+	// eslint-disable-next-line @typescript-eslint/no-unused-vars
+	async setMaxIncomingBitrate(bitrate: number): Promise<void>
+	{
+		throw new UnsupportedError(
+			'setMaxIncomingBitrate() not implemented in RecordingTransport');
+	}
+
+	/**
+	 * @override
+	 */
+	// eslint-disable-next-line @typescript-eslint/no-unused-vars
+	async setMaxOutgoingBitrate(bitrate: number): Promise<void>
+	{
+		throw new UnsupportedError(
+			'setMaxOutgoingBitrate() not implemented in RecordingTransport');
+	}
+
+	/**
+	 * @override
+	 */
+	// eslint-disable-next-line @typescript-eslint/no-unused-vars
+	async setMinOutgoingBitrate(bitrate: number): Promise<void>
+	{
+		throw new UnsupportedError(
+			'setMinOutgoingBitrate() not implemented in RecordingTransport');
+	}
+
+	private handleWorkerNotifications(): void
+	{
+		this.channel.on(this.internal.transportId, (event: Event, data?: Notification) =>
+		{
+			switch (event)
+			{
+				case Event.TRANSPORT_TRACE:
+				{
+					const notification = new FbsTransport.TraceNotification();
+
+					data!.body(notification);
+
+					const trace = parseTransportTraceEventData(notification);
+
+					this.safeEmit('trace', trace);
+
+					// Emit observer event.
+					this.observer.safeEmit('trace', trace);
+
+					break;
+				}
+
+				default:
+				{
+					logger.error('ignoring unknown event "%s"', event);
+				}
+			}
+		});
+	}
+}
+
+export function parseRecordingTransportDumpResponse(
+	binary: FbsRecordingTransport.DumpResponse
+): RecordingTransportDump
+{
+	return {
+		...parseBaseTransportDump(binary.base()!),
+		recording : parseRecording(binary.recording()!)
+	};
+}
+
+function parseGetStatsResponse(
+	binary: FbsRecordingTransport.GetStatsResponse
+): RecordingTransportStat
+{
+	const base = parseBaseTransportStats(binary.base()!);
+
+	return {
+		...base,
+		type      : 'recording-transport',
+		recording : parseRecording(binary.recording()!)
+	};
+}
+
+function parseRecording(binary: FbsRecordingTransport.Recording): RecordingStats
+{
+	return {
+		filePath            : binary.filePath()!,
+		recordedRtpPackets  : Number(binary.recordedRtpPackets()),
+		recordedRtcpPackets : Number(binary.recordedRtcpPackets()),
+		droppedPackets      : Number(binary.droppedPackets()),
+		writtenBytes        : Number(binary.writtenBytes()),
+		pendingBytes        : Number(binary.pendingBytes()),
+		writeErrors         : Number(binary.writeErrors())
+	};
+}
@@ -13,6 +13,7 @@ import { WebRtcTransport, WebRtcTransportOptions, parseWebRtcTransportDumpRespon
 import { PlainTransport, PlainTransportOptions, parsePlainTransportDumpResponse } from './PlainTransport';
 import { PipeTransport, PipeTransportOptions, parsePipeTransportDumpResponse } from './PipeTransport';
 import { DirectTransport, DirectTransportOptions, parseDirectTransportDumpResponse } from './DirectTransport';
+import { RecordingTransport, RecordingTransportOptions, parseRecordingTransportDumpResponse } from './RecordingTransport';
 import { Producer } from './Producer';
 import { Consumer } from './Consumer';
 import { DataProducer } from './DataProducer';
@@ -36,6 +37,7 @@ import * as FbsWebRtcTransport from './fbs/web-rtc-transport';
 import * as FbsPlainTransport from './fbs/plain-transport';
 import * as FbsPipeTransport from './fbs/pipe-transport';
 import * as FbsDirectTransport from './fbs/direct-transport';
+import * as FbsRecordingTransport from './fbs/recording-transport';
 import * as FbsSctpParameters from './fbs/sctp-parameters';
 
 export type RouterOptions<RouterAppData extends AppData = AppData> =
@@ -103,6 +105,12 @@ export type PipeToRouterOptions =
 	 * Enable SRTP.
 	 */
 	enableSrtp?: boolean;
+
+	/**
+	 * Send RTP and RTCP packets through shared memory rings (when both Routers
+	 * live in different Workers of this host). Cannot be used with enableSrtp.
+	 */
+	enableShm?: boolean;
 } & PipeToRouterListen;
 
 export type PipeToRouterResult =
@@ -162,6 +170,12 @@ export type RouterDump =
 	 * Array of DataConsumer id and its DataProducer id.
 	 */
 	mapDataConsumerIdDataProducerId: {key: string; value: string}[];
+	/**
+	 * Worker loop time spent in packet handling by the Router and its
+	 * Transports, including closed ones (in microseconds). It is estimated
+	 * from a sample of the packets.
+	 */
+	cpuTimeUs: number;
 };
 
 type PipeTransportPair =
@@ -333,6 +347,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		this.#closed = true;
 
+		this.#channel.deleteHandlerHandle(this.#internal.routerId);
+
 		const requestOffset = new FbsWorker.CloseRouterRequestT(
 			this.#internal.routerId).pack(this.#channel.bufferBuilder);
 
@@ -384,6 +400,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		this.#closed = true;
 
+		this.#channel.deleteHandlerHandle(this.#internal.routerId);
+
 		// Close every Transport.
 		for (const transport of this.#transports.values())
 		{
@@ -447,6 +465,7 @@ export class Router<RouterAppData extends AppData = AppData>
 			preferUdp = false,
 			preferTcp = false,
 			initialAvailableOutgoingBitrate = 600000,
+			probeWithRtx = false,
 			enableSctp = false,
 			numSctpStreams = { OS: 1024, MIS: 1024 },
 			maxSctpMessageSize = 262144,
@@ -587,7 +606,8 @@ export class Router<RouterAppData extends AppData = AppData>
 			new FbsSctpParameters.NumSctpStreamsT(numSctpStreams.OS, numSctpStreams.MIS),
 			maxSctpMessageSize,
 			sctpSendBufferSize,
-			true /* isDataChannel */
+			true /* isDataChannel */,
+			probeWithRtx
 		);
 
 		const webRtcTransportOptions = new FbsWebRtcTransport.WebRtcTransportOptionsT(
@@ -620,6 +640,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		response.body(data);
 
+		this.#channel.setHandlerHandle(transportId, data.base()!.handle());
+
 		const webRtcTransportData = parseWebRtcTransportDumpResponse(data);
 
 		const transport = new WebRtcTransport<WebRtcTransportAppData>(
@@ -784,6 +806,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		response.body(data);
 
+		this.#channel.setHandlerHandle(transportId, data.base()!.handle());
+
 		const plainTransportData = parsePlainTransportDumpResponse(data);
 
 		const transport = new PlainTransport<PlainTransportAppData>(
@@ -837,6 +861,8 @@ export class Router<RouterAppData extends AppData = AppData>
 			sctpSendBufferSize = 268435456,
 			enableRtx = false,
 			enableSrtp = false,
+			enableShm = false,
+			aggregationMaxSize = 0,
 			appData
 		}: PipeTransportOptions<PipeTransportAppData>
 	): Promise<PipeTransport<PipeTransportAppData>>
@@ -901,7 +927,9 @@ export class Router<RouterAppData extends AppData = AppData>
 				listenInfo!.recvBufferSize
 			),
 			enableRtx,
-			enableSrtp
+			enableSrtp,
+			enableShm,
+			aggregationMaxSize
 		);
 
 		const requestOffset = new FbsRouter.CreatePipeTransportRequestT(
@@ -920,6 +948,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		response.body(data);
 
+		this.#channel.setHandlerHandle(transportId, data.base()!.handle());
+
 		const plainTransportData = parsePipeTransportDumpResponse(data);
 
 		const transport = new PipeTransport<PipeTransportAppData>(
@@ -1017,6 +1047,8 @@ export class Router<RouterAppData extends AppData = AppData>
 
 		response.body(data);
 
+		this.#channel.setHandlerHandle(transportId, data.base()!.handle());
+
 		const directTransportData = parseDirectTransportDumpResponse(data);
 
 		const transport = new DirectTransport<DirectTransportAppData>(
@@ -1056,6 +1088,104 @@ export class Router<RouterAppData extends AppData = AppData>
 		return transport;
 	}
 
+	/**
+	 * Create a RecordingTransport. RTP and RTCP packets sent to its Consumers
+	 * are written by the worker into the given file.
+	 */
+	async createRecordingTransport<RecordingTransportAppData extends AppData = AppData>(
+		{
+			filePath,
+			appData
+		}: RecordingTransportOptions<RecordingTransportAppData>
+	): Promise<RecordingTransport<RecordingTransportAppData>>
+	{
+		logger.debug('createRecordingTransport()');
+
+		if (typeof filePath !== 'string' || !filePath)
+		{
+			throw new TypeError('missing filePath');
+		}
+		else if (appData && typeof appData !== 'object')
+		{
+			throw new TypeError('if given, appData must be an object');
+		}
+
+		const transportId = generateUUIDv4();
+
+		/* Build Request. */
+		const baseTransportOptions = new FbsTransport.OptionsT(
+			false /* direct */,
+			undefined /* maxMessageSize */,
+			undefined /* initialAvailableOutgoingBitrate */,
+			undefined /* enableSctp */,
+			undefined /* numSctpStreams */,
+			undefined /* maxSctpMessageSize */,
+			undefined /* sctpSendBufferSize */,
+			undefined /* isDataChannel */
+		);
+
+		const recordingTransportOptions = new FbsRecordingTransport.RecordingTransportOptionsT(
+			baseTransportOptions,
+			filePath
+		);
+
+		const requestOffset = new FbsRouter.CreateRecordingTransportRequestT(
+			transportId, recordingTransportOptions
+		).pack(this.#channel.bufferBuilder);
+
+		const response = await this.#channel.request(
+			FbsRequest.Method.ROUTER_CREATE_RECORDINGTRANSPORT,
+			FbsRequest.Body.Router_CreateRecordingTransportRequest,
+			requestOffset,
+			this.#internal.routerId
+		);
+
+		/* Decode Response. */
+		const data = new FbsRecordingTransport.DumpResponse();
+
+		response.body(data);
+
+		this.#channel.setHandlerHandle(transportId, data.base()!.handle());
+
+		const recordingTransportData = parseRecordingTransportDumpResponse(data);
+
+		const transport = new RecordingTransport<RecordingTransportAppData>(
+			{
+				internal :
+				{
+					...this.#internal,
+					transportId : transportId
+				},
+				data                     : { filePath: recordingTransportData.recording.filePath },
+				channel                  : this.#channel,
+				appData,
+				getRouterRtpCapabilities : (): RtpCapabilities => this.#data.rtpCapabilities,
+				getProducerById          : (producerId: string): Producer | undefined => (
+					this.#producers.get(producerId)
+				),
+				getDataProducerById : (dataProducerId: string): DataProducer | undefined => (
+					this.#dataProducers.get(dataProducerId)
+				)
+			});
+
+		this.#transports.set(transport.id, transport);
+		transport.on('@close', () => this.#transports.delete(transport.id));
+		transport.on('@listenserverclose', () => this.#transports.delete(transport.id));
+		transport.on('@newproducer', (producer: Producer) => this.#producers.set(producer.id, producer));
+		transport.on('@producerclose', (producer: Producer) => this.#producers.delete(producer.id));
+		transport.on('@newdataproducer', (dataProducer: DataProducer) => (
+			this.#dataProducers.set(dataProducer.id, dataProducer)
+		));
+		transport.on('@dataproducerclose', (dataProducer: DataProducer) => (
+			this.#dataProducers.delete(dataProducer.id)
+		));
+
+		// Emit observer event.
+		this.#observer.safeEmit('newtransport', transport);
+
+		return transport;
+	}
+
 	/**
 	 * Pipes the given Producer or DataProducer into another Router in same host.
 	 */
@@ -1069,7 +1199,8 @@ export class Router<RouterAppData extends AppData = AppData>
 			enableSctp = true,
 			numSctpStreams = { OS: 1024, MIS: 1024 },
 			enableRtx = false,
-			enableSrtp = false
+			enableSrtp = false,
+			enableShm = false
 		}: PipeToRouterOptions
 	): Promise<PipeToRouterResult>
 	{
@@ -1169,7 +1300,8 @@ export class Router<RouterAppData extends AppData = AppData>
 								enableSctp,
 								numSctpStreams,
 								enableRtx,
-								enableSrtp
+								enableSrtp,
+								enableShm
 							}),
 						router.createPipeTransport(
 							{
@@ -1177,7 +1309,8 @@ export class Router<RouterAppData extends AppData = AppData>
 								enableSctp,
 								numSctpStreams,
 								enableRtx,
-								enableSrtp
+								enableSrtp,
+								enableShm
 							})
 					])
 					.then((pipeTransports) =>
@@ -1193,13 +1326,15 @@ export class Router<RouterAppData extends AppData = AppData>
 									{
 										ip             : remotePipeTransport.tuple.localIp,
 										port           : remotePipeTransport.tuple.localPort,
-										srtpParameters : remotePipeTransport.srtpParameters
+										srtpParameters : remotePipeTransport.srtpParameters,
+										shmName        : remotePipeTransport.shmName
 									}),
 								remotePipeTransport.connect(
 									{
 										ip             : localPipeTransport.tuple.localIp,
 										port           : localPipeTransport.tuple.localPort,
-										srtpParameters : localPipeTransport.srtpParameters
+										srtpParameters : localPipeTransport.srtpParameters,
+										shmName        : localPipeTransport.shmName
 									})
 							]);
 					})
@@ -1496,6 +1631,7 @@ export class Router<RouterAppData extends AppData = AppData>
 			maxEntries = 1,
 			threshold = -80,
 			interval = 1000,
+			lastN = 0,
 			appData
 		}: AudioLevelObserverOptions<AudioLevelObserverAppData> = {}
 	): Promise<AudioLevelObserver<AudioLevelObserverAppData>>
@@ -1514,6 +1650,10 @@ export class Router<RouterAppData extends AppData = AppData>
 		{
 			throw new TypeError('if given, interval must be an number');
 		}
+		if (typeof lastN !== 'number' || lastN < 0)
+		{
+			throw new TypeError('if given, lastN must be a non negative number');
+		}
 		if (appData && typeof appData !== 'object')
 		{
 			throw new TypeError('if given, appData must be an object');
@@ -1526,7 +1666,8 @@ export class Router<RouterAppData extends AppData = AppData>
 			new FbsAudioLevelObserver.AudioLevelObserverOptionsT(
 				maxEntries,
 				threshold,
-				interval
+				interval,
+				lastN
 			);
 
 		const requestOffset = new FbsRouter.CreateAudioLevelObserverRequestT(
@@ -1616,6 +1757,7 @@ export function parseRouterDumpResponse(
 		mapConsumerIdProducerId          : parseStringStringVector(binary, 'mapConsumerIdProducerId'),
 		mapProducerIdObserverIds         : parseStringStringArrayVector(binary, 'mapProducerIdObserverIds'),
 		mapDataProducerIdDataConsumerIds : parseStringStringArrayVector(binary, 'mapDataProducerIdDataConsumerIds'),
-		mapDataConsumerIdDataProducerId  : parseStringStringVector(binary, 'mapDataConsumerIdDataProducerId')
+		mapDataConsumerIdDataProducerId  : parseStringStringVector(binary, 'mapDataConsumerIdDataProducerId'),
+		cpuTimeUs                        : Number(binary.cpuTimeUs())
 	};
 }
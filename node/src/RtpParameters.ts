@@ -2,6 +2,7 @@ import * as flatbuffers from 'flatbuffers';
 import {
 	Boolean as FbsBoolean,
 	Double as FbsDouble,
+	Fec as FbsFec,
 	Integer32 as FbsInteger32,
 	Integer32Array as FbsInteger32Array,
 	String as FbsString,
@@ -292,6 +293,12 @@ export type RtpEncodingParameters =
 	 */
 	rtx?: { ssrc: number };
 
+	/**
+	 * FlexFEC stream information. It must contain a numeric ssrc field
+	 * indicating the FEC SSRC.
+	 */
+	fec?: { ssrc: number };
+
 	/**
 	 * It indicates whether discontinuous RTP transmission will be used. Useful
 	 * for audio (if the codec supports it) and for video screen sharing (when
@@ -482,6 +489,14 @@ export function serializeRtpEncodingParameters(
 			rtxOffset = FbsRtx.createRtx(builder, encoding.rtx.ssrc);
 		}
 
+		// Prepare Fec.
+		let fecOffset: number | undefined;
+
+		if (encoding.fec)
+		{
+			fecOffset = FbsFec.createFec(builder, encoding.fec.ssrc);
+		}
+
 		// Prepare scalability mode.
 		let scalabilityModeOffset: number | undefined;
 
@@ -532,6 +547,12 @@ export function serializeRtpEncodingParameters(
 			FbsRtpEncodingParameters.addMaxBitrate(builder, encoding.maxBitrate);
 		}
 
+		// Add FEC.
+		if (fecOffset)
+		{
+			FbsRtpEncodingParameters.addFec(builder, fecOffset);
+		}
+
 		// End serialization.
 		encodings.push(FbsRtpEncodingParameters.endRtpEncodingParameters(builder));
 	}
@@ -787,6 +808,9 @@ export function parseRtpEncodingParameters(
 		rtx : data.rtx() ?
 			{ ssrc: data.rtx()!.ssrc()! } :
 			undefined,
+		fec : data.fec() ?
+			{ ssrc: data.fec()!.ssrc()! } :
+			undefined,
 		dtx             : data.dtx(),
 		scalabilityMode : data.scalabilityMode() ?? undefined,
 		maxBitrate      : data.maxBitrate() !== null ? data.maxBitrate()! : undefined
@@ -9,6 +9,8 @@ export type RtpStreamRecvStats = BaseRtpStreamStats &
 	byteCount: number;
 	bitrate: number;
 	bitrateByLayer?: any;
+	keyFrameCacheHits: number;
+	keyFrameCacheMisses: number;
 };
 
 export type RtpStreamSendStats = BaseRtpStreamStats &
@@ -66,12 +68,14 @@ export function parseRtpStreamRecvStats(binary: FbsRtpStream.Stats): RtpStreamRe
 
 	return {
 		...base,
-		type           : 'inbound-rtp',
-		jitter         : recvStats.jitter(),
-		byteCount      : Number(recvStats.byteCount()),
-		packetCount    : Number(recvStats.packetCount()),
-		bitrate        : Number(recvStats.bitrate()),
-		bitrateByLayer : parseBitrateByLayer(recvStats)
+		type                : 'inbound-rtp',
+		jitter              : recvStats.jitter(),
+		byteCount           : Number(recvStats.byteCount()),
+		packetCount         : Number(recvStats.packetCount()),
+		bitrate             : Number(recvStats.bitrate()),
+		bitrateByLayer      : parseBitrateByLayer(recvStats),
+		keyFrameCacheHits   : Number(recvStats.keyFrameCacheHits()),
+		keyFrameCacheMisses : Number(recvStats.keyFrameCacheMisses())
 	};
 }
 
@@ -8,6 +8,7 @@ import { WebRtcTransportData } from './WebRtcTransport';
 import { PlainTransportData } from './PlainTransport';
 import { PipeTransportData } from './PipeTransport';
 import { DirectTransportData } from './DirectTransport';
+import { RecordingTransportData } from './RecordingTransport';
 import { Producer, ProducerOptions, producerTypeFromFbs, producerTypeToFbs } from './Producer';
 import { Consumer, ConsumerLayers, ConsumerOptions, ConsumerType } from './Consumer';
 import {
@@ -228,6 +229,9 @@ export type BaseTransportStats =
 	rtxSendBitrate: number;
 	probationBytesSent: number;
 	probationSendBitrate: number;
+	rtxProbationBytesSent: number;
+	rtxProbationSendBitrate: number;
+	cpuTimeUs: number;
 	availableOutgoingBitrate?: number;
 	availableIncomingBitrate?: number;
 	maxIncomingBitrate?: number;
@@ -237,7 +241,8 @@ type TransportData =
   | WebRtcTransportData
   | PlainTransportData
   | PipeTransportData
-  | DirectTransportData;
+  | DirectTransportData
+  | RecordingTransportData;
 
 type RtpListenerDump =
 {
@@ -414,6 +419,7 @@ export class Transport
 
 		// Remove notification subscriptions.
 		this.channel.removeAllListeners(this.internal.transportId);
+		this.channel.deleteHandlerHandle(this.internal.transportId);
 
 		/* Build Request. */
 		const requestOffset = new FbsRouter.CloseTransportRequestT(
@@ -486,6 +492,7 @@ export class Transport
 
 		// Remove notification subscriptions.
 		this.channel.removeAllListeners(this.internal.transportId);
+		this.channel.deleteHandlerHandle(this.internal.transportId);
 
 		// Close every Producer.
 		for (const producer of this.#producers.values())
@@ -546,6 +553,7 @@ export class Transport
 
 		// Remove notification subscriptions.
 		this.channel.removeAllListeners(this.internal.transportId);
+		this.channel.deleteHandlerHandle(this.internal.transportId);
 
 		// Close every Producer.
 		for (const producer of this.#producers.values())
@@ -695,6 +703,7 @@ export class Transport
 			rtpParameters,
 			paused = false,
 			keyFrameRequestDelay,
+			keyFrameCache = false,
 			appData
 		}: ProducerOptions<ProducerAppData>
 	): Promise<Producer<ProducerAppData>>
@@ -767,6 +776,7 @@ export class Transport
 			rtpParameters,
 			rtpMapping,
 			keyFrameRequestDelay,
+			keyFrameCache,
 			paused
 		});
 
@@ -784,6 +794,8 @@ export class Transport
 
 		const status = produceResponse.unpack();
 
+		this.channel.setHandlerHandle(producerId, status.handle);
+
 		const data =
 		{
 			kind,
@@ -834,6 +846,7 @@ export class Transport
 			preferredLayers,
 			ignoreDtx = false,
 			enableRtx,
+			enableFec = false,
 			pipe = false,
 			appData
 		}: ConsumerOptions<ConsumerAppData>
@@ -876,7 +889,8 @@ export class Transport
 				consumableRtpParameters : producer.consumableRtpParameters,
 				remoteRtpCapabilities   : rtpCapabilities!,
 				pipe,
-				enableRtx
+				enableRtx,
+				enableFec
 			}
 		);
 
@@ -928,6 +942,8 @@ export class Transport
 
 		const status = consumeResponse.unpack();
 
+		this.channel.setHandlerHandle(consumerId, status.handle);
+
 		const data =
 		{
 			producerId,
@@ -1039,6 +1055,8 @@ export class Transport
 
 		response.body(produceDataResponse);
 
+		this.channel.setHandlerHandle(dataProducerId, produceDataResponse.handle());
+
 		const dump = parseDataProducerDumpResponse(produceDataResponse);
 
 		const dataProducer = new DataProducer<DataProducerAppData>(
@@ -1185,6 +1203,8 @@ export class Transport
 
 		response.body(consumeDataResponse);
 
+		this.channel.setHandlerHandle(dataConsumerId, consumeDataResponse.handle());
+
 		const dump = parseDataConsumerDumpResponse(consumeDataResponse);
 
 		const dataConsumer = new DataConsumer<DataConsumerAppData>(
@@ -1479,6 +1499,9 @@ export function parseBaseTransportStats(
 		rtxSendBitrate           : Number(binary.rtxSendBitrate()),
 		probationBytesSent       : Number(binary.probationBytesSent()),
 		probationSendBitrate     : Number(binary.probationSendBitrate()),
+		rtxProbationBytesSent    : Number(binary.rtxProbationBytesSent()),
+		rtxProbationSendBitrate  : Number(binary.rtxProbationSendBitrate()),
+		cpuTimeUs                : Number(binary.cpuTimeUs()),
 		availableOutgoingBitrate : Number(binary.availableOutgoingBitrate()),
 		availableIncomingBitrate : Number(binary.availableIncomingBitrate()),
 		maxIncomingBitrate       : binary.maxIncomingBitrate() ?
@@ -1645,6 +1668,7 @@ function createProduceRequest({
 	rtpParameters,
 	rtpMapping,
 	keyFrameRequestDelay,
+	keyFrameCache,
 	paused
 } : {
 	builder : flatbuffers.Builder;
@@ -1653,6 +1677,7 @@ function createProduceRequest({
 	rtpParameters: RtpParameters;
 	rtpMapping: ortc.RtpMapping;
 	keyFrameRequestDelay?: number;
+	keyFrameCache: boolean;
 	paused: boolean;
 }): number
 {
@@ -1668,6 +1693,7 @@ function createProduceRequest({
 	FbsTransport.ProduceRequest.addRtpMapping(builder, rtpMappingOffset);
 	FbsTransport.ProduceRequest.addKeyFrameRequestDelay(builder, keyFrameRequestDelay ?? 0);
 	FbsTransport.ProduceRequest.addPaused(builder, paused);
+	FbsTransport.ProduceRequest.addKeyFrameCache(builder, keyFrameCache);
 
 	return FbsTransport.ProduceRequest.endProduceRequest(builder);
 }
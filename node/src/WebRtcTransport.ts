@@ -101,6 +101,13 @@ export type WebRtcTransportOptionsBase<WebRtcTransportAppData> =
 	 */
 	initialAvailableOutgoingBitrate?: number;
 
+	/**
+	 * Probe the available bandwidth with RTX of recently sent packets instead
+	 * of padding only packets, so probation also protects against losses.
+	 * Default false.
+	 */
+	probeWithRtx?: boolean;
+
 	/**
 	 * Create a SCTP association. Default false.
 	 */
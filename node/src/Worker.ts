@@ -80,6 +80,28 @@ export type WorkerSettings<WorkerAppData extends AppData = AppData> =
 	 */
 	libwebrtcFieldTrials?: string;
 
+	/**
+	 * Number of threads that SRTP protect and send RTP and RTCP packets of
+	 * WebRtcTransports over UDP. Default 0 (everything runs in the worker main
+	 * thread).
+	 */
+	sendThreads?: number;
+
+	/**
+	 * Maximum egress bitrate (bps) of all the transports of the worker. If
+	 * exceeded, consumers with lower priority step down their layers first.
+	 * Only applies to transports with bandwidth estimation. Default 0 (no
+	 * limit).
+	 */
+	egressBitrateBudget?: number;
+
+	/**
+	 * Number of bound UDP sockets the worker keeps ready for every listen IP, so
+	 * creating transports (i.e. when many peers join at once) does not have to
+	 * search for a free port. Default 0 (sockets are bound on demand).
+	 */
+	udpSocketPoolSize?: number;
+
 	/**
 	 * Custom application data.
 	 */
@@ -182,6 +204,35 @@ export type WorkerResourceUsage =
 	/* eslint-enable camelcase */
 };
 
+/**
+ * Durations (in nanoseconds) of a stage of the RTP pipeline. Just one in every
+ * sampleInterval calls is measured.
+ */
+export type WorkerProfileStage =
+{
+	name: string;
+	calls: number;
+	samples: number;
+	minNs: number;
+	maxNs: number;
+	meanNs: number;
+	p50Ns: number;
+	p90Ns: number;
+	p99Ns: number;
+	p999Ns: number;
+};
+
+export type WorkerProfile =
+{
+	/**
+	 * Whether the worker was built with the ms_profiling option. If not, stages
+	 * is empty.
+	 */
+	enabled: boolean;
+	sampleInterval: number;
+	stages: WorkerProfileStage[];
+};
+
 export type WorkerDump =
 {
 	pid : number;
@@ -198,6 +249,23 @@ export type WorkerDump =
 		sqeMissCount: number;
 		userDataMissCount: number;
 	};
+	usrsctp? :
+	{
+		timerWakeups: number;
+		timerIdleStops: number;
+	};
+	udpSocketPool? :
+	{
+		size: number;
+		available: number;
+		hits: number;
+		misses: number;
+	};
+	sendOffloadPool? :
+	{
+		numThreads: number;
+		sendFallbacks: number;
+	};
 };
 
 export type WorkerEvents =
@@ -270,6 +338,9 @@ export class Worker<WorkerAppData extends AppData = AppData>
 			dtlsCertificateFile,
 			dtlsPrivateKeyFile,
 			libwebrtcFieldTrials,
+			sendThreads,
+			egressBitrateBudget,
+			udpSocketPoolSize,
 			appData
 		}: WorkerSettings<WorkerAppData>)
 	{
@@ -330,6 +401,21 @@ export class Worker<WorkerAppData extends AppData = AppData>
 			spawnArgs.push(`--libwebrtcFieldTrials=${libwebrtcFieldTrials}`);
 		}
 
+		if (typeof sendThreads === 'number' && !Number.isNaN(sendThreads))
+		{
+			spawnArgs.push(`--sendThreads=${sendThreads}`);
+		}
+
+		if (typeof egressBitrateBudget === 'number' && !Number.isNaN(egressBitrateBudget))
+		{
+			spawnArgs.push(`--egressBitrateBudget=${egressBitrateBudget}`);
+		}
+
+		if (typeof udpSocketPoolSize === 'number' && !Number.isNaN(udpSocketPoolSize))
+		{
+			spawnArgs.push(`--udpSocketPoolSize=${udpSocketPoolSize}`);
+		}
+
 		logger.debug(
 			'spawning worker process: %s %s', spawnBin, spawnArgs.join(' '));
 
@@ -646,6 +732,57 @@ export class Worker<WorkerAppData extends AppData = AppData>
 		/* eslint-enable camelcase */
 	}
 
+	/**
+	 * Get per stage profiling of the RTP pipeline. If reset is true, collected
+	 * samples are cleared once returned.
+	 */
+	async getProfile({ reset = false }: { reset?: boolean } = {}): Promise<WorkerProfile>
+	{
+		logger.debug('getProfile()');
+
+		// Build the request.
+		const requestOffset = new FbsWorker.GetProfileRequestT(reset)
+			.pack(this.#channel.bufferBuilder);
+
+		const response = await this.#channel.request(
+			FbsRequest.Method.WORKER_GET_PROFILE,
+			FbsRequest.Body.Worker_GetProfileRequest,
+			requestOffset
+		);
+
+		/* Decode Response. */
+		const profile = new FbsWorker.ProfileResponse();
+
+		response.body(profile);
+
+		const stages: WorkerProfileStage[] = [];
+
+		for (let i = 0; i < profile.stagesLength(); ++i)
+		{
+			const stage = profile.stages(i)!;
+
+			stages.push(
+				{
+					name    : stage.name()!,
+					calls   : Number(stage.calls()),
+					samples : Number(stage.samples()),
+					minNs   : Number(stage.minNs()),
+					maxNs   : Number(stage.maxNs()),
+					meanNs  : Number(stage.meanNs()),
+					p50Ns   : Number(stage.p50Ns()),
+					p90Ns   : Number(stage.p90Ns()),
+					p99Ns   : Number(stage.p99Ns()),
+					p999Ns  : Number(stage.p999Ns())
+				});
+		}
+
+		return {
+			enabled        : profile.enabled(),
+			sampleInterval : profile.sampleInterval(),
+			stages
+		};
+	}
+
 	/**
 	 * Update settings.
 	 */
@@ -756,8 +893,17 @@ export class Worker<WorkerAppData extends AppData = AppData>
 		const createRouterRequestOffset =
 			new FbsWorker.CreateRouterRequestT(routerId).pack(this.#channel.bufferBuilder);
 
-		await this.#channel.request(FbsRequest.Method.WORKER_CREATE_ROUTER,
-			FbsRequest.Body.Worker_CreateRouterRequest, createRouterRequestOffset);
+		const response = await this.#channel.request(
+			FbsRequest.Method.WORKER_CREATE_ROUTER,
+			FbsRequest.Body.Worker_CreateRouterRequest,
+			createRouterRequestOffset);
+
+		/* Decode Response. */
+		const createRouterResponse = new FbsWorker.CreateRouterResponse();
+
+		response.body(createRouterResponse);
+
+		this.#channel.setHandlerHandle(routerId, createRouterResponse.handle());
 
 		const data = { rtpCapabilities };
 		const router = new Router<RouterAppData>(
@@ -841,5 +987,34 @@ export function parseWorkerDumpResponse(
 		};
 	}
 
+	if (binary.usrsctp())
+	{
+		dump.usrsctp =
+		{
+			timerWakeups   : Number(binary.usrsctp()!.timerWakeups()),
+			timerIdleStops : Number(binary.usrsctp()!.timerIdleStops())
+		};
+	}
+
+	if (binary.udpSocketPool())
+	{
+		dump.udpSocketPool =
+		{
+			size      : binary.udpSocketPool()!.size(),
+			available : binary.udpSocketPool()!.available(),
+			hits      : Number(binary.udpSocketPool()!.hits()),
+			misses    : Number(binary.udpSocketPool()!.misses())
+		};
+	}
+
+	if (binary.sendOffloadPool())
+	{
+		dump.sendOffloadPool =
+		{
+			numThreads    : binary.sendOffloadPool()!.numThreads(),
+			sendFallbacks : Number(binary.sendOffloadPool()!.sendFallbacks())
+		};
+	}
+
 	return dump;
 }
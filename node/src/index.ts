@@ -53,6 +53,9 @@ export async function createWorker<WorkerAppData extends types.AppData = types.A
 		dtlsCertificateFile,
 		dtlsPrivateKeyFile,
 		libwebrtcFieldTrials,
+		sendThreads,
+		egressBitrateBudget,
+		udpSocketPoolSize,
 		appData
 	}: WorkerSettings<WorkerAppData> = {}
 ): Promise<Worker<WorkerAppData>>
@@ -73,6 +76,9 @@ export async function createWorker<WorkerAppData extends types.AppData = types.A
 			dtlsCertificateFile,
 			dtlsPrivateKeyFile,
 			libwebrtcFieldTrials,
+			sendThreads,
+			egressBitrateBudget,
+			udpSocketPoolSize,
 			appData
 		});
 
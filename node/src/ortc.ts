@@ -533,6 +533,20 @@ export function validateRtpEncodingParameters(encoding: RtpEncodingParameters):
 		}
 	}
 
+	// fec is optional.
+	if (encoding.fec && typeof encoding.fec !== 'object')
+	{
+		throw new TypeError('invalid encoding.fec');
+	}
+	else if (encoding.fec)
+	{
+		// FEC ssrc is mandatory if fec is present.
+		if (typeof encoding.fec.ssrc !== 'number')
+		{
+			throw new TypeError('missing encoding.fec.ssrc');
+		}
+	}
+
 	// dtx is optional. If unset set it to false.
 	if (!encoding.dtx || typeof encoding.dtx !== 'boolean')
 	{
@@ -1110,20 +1124,22 @@ export function canConsume(
  *
  * It reduces encodings to just one and takes into account given RTP capabilities
  * to reduce codecs, codecs' RTCP feedback and header extensions, and also enables
- * or disables RTX.
+ * or disables RTX and FlexFEC.
  */
 export function getConsumerRtpParameters(
 	{
 		consumableRtpParameters,
 		remoteRtpCapabilities,
 		pipe,
-		enableRtx
+		enableRtx,
+		enableFec = false
 	}:
 	{
 		consumableRtpParameters: RtpParameters;
 		remoteRtpCapabilities: RtpCapabilities;
 		pipe: boolean;
 		enableRtx: boolean;
+		enableFec?: boolean;
 	}
 ): RtpParameters
 {
@@ -1196,6 +1212,35 @@ export function getConsumerRtpParameters(
 		throw new UnsupportedError('no compatible media codecs');
 	}
 
+	let fecSupported = false;
+
+	// Add the FlexFEC codec if requested and supported by the remote.
+	if (enableFec && !pipe)
+	{
+		const kind = consumerParams.codecs[0].mimeType.split('/')[0].toLowerCase();
+		const capFecCodec = remoteRtpCapabilities.codecs!
+			.find((capCodec) => (
+				capCodec.kind === kind &&
+				isFecCodec(capCodec) &&
+				!consumerParams.codecs
+					.some((codec) => codec.payloadType === capCodec.preferredPayloadType)
+			));
+
+		if (capFecCodec)
+		{
+			consumerParams.codecs.push(
+				{
+					mimeType     : capFecCodec.mimeType,
+					payloadType  : capFecCodec.preferredPayloadType!,
+					clockRate    : capFecCodec.clockRate,
+					parameters   : utils.clone(capFecCodec.parameters) ?? {},
+					rtcpFeedback : []
+				});
+
+			fecSupported = true;
+		}
+	}
+
 	consumerParams.headerExtensions = consumableRtpParameters.headerExtensions!
 		.filter((ext) => (
 			remoteRtpCapabilities.headerExtensions!
@@ -1254,6 +1299,11 @@ export function getConsumerRtpParameters(
 			consumerEncoding.rtx = { ssrc: consumerEncoding.ssrc! + 1 };
 		}
 
+		if (fecSupported)
+		{
+			consumerEncoding.fec = { ssrc: consumerEncoding.ssrc! + 2 };
+		}
+
 		// If any of the consumableRtpParameters.encodings has scalabilityMode,
 		// process it (assume all encodings have the same value).
 		const encodingWithScalabilityMode =
@@ -1406,6 +1456,11 @@ function isRtxCodec(codec: RtpCodecCapability | RtpCodecParameters): boolean
 	return /.+\/rtx$/i.test(codec.mimeType);
 }
 
+function isFecCodec(codec: RtpCodecCapability | RtpCodecParameters): boolean
+{
+	return /.+\/flexfec$/i.test(codec.mimeType);
+}
+
 function matchCodecs(
 	aCodec: RtpCodecCapability | RtpCodecParameters,
 	bCodec: RtpCodecCapability | RtpCodecParameters,
@@ -1027,7 +1027,8 @@ test('Consumer emits "score"', async () =>
 		builder.createString(audioConsumer.id),
 		Event.CONSUMER_SCORE,
 		NotificationBody.Consumer_ScoreNotification,
-		consumerScoreNotification.pack(builder)
+		consumerScoreNotification.pack(builder),
+		0 /* handlerHandle */
 	);
 
 	builder.finish(notificationOffset);
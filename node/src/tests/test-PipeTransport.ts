@@ -769,6 +769,23 @@ test('router.createPipeTransport() with fixed port succeeds', async () =>
 	pipeTransport.close();
 }, 2000);
 
+test('router.createPipeTransport() with aggregationMaxSize succeeds', async () =>
+{
+	const pipeTransport = await router1.createPipeTransport(
+		{
+			listenInfo         : { protocol: 'udp', ip: '127.0.0.1' },
+			aggregationMaxSize : 9000
+		});
+
+	const dump = await pipeTransport.dump();
+
+	expect(dump.aggregationMaxSize).toBe(9000);
+	expect(dump.aggregatedPacketsSent).toBe(0);
+	expect(dump.aggregatedDatagramsSent).toBe(0);
+
+	pipeTransport.close();
+}, 2000);
+
 test('transport.consume() for a pipe Producer succeeds', async () =>
 {
 	videoConsumer = await transport2.consume(
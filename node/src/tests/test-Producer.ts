@@ -795,7 +795,8 @@ test('Producer emits "score"', async () =>
 		builder.createString(videoProducer.id),
 		Event.PRODUCER_SCORE,
 		NotificationBody.Producer_ScoreNotification,
-		producerScoreNotification.pack(builder)
+		producerScoreNotification.pack(builder),
+		0 /* handlerHandle */
 	);
 
 	builder.finish(notificationOffset);
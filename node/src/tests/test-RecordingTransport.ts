@@ -0,0 +1,141 @@
+import * as fs from 'node:fs';
+import * as os from 'node:os';
+import * as path from 'node:path';
+import * as mediasoup from '../';
+
+let worker: mediasoup.types.Worker;
+let router: mediasoup.types.Router;
+let transport: mediasoup.types.RecordingTransport;
+let filePath: string;
+
+beforeAll(async () =>
+{
+	worker = await mediasoup.createWorker();
+	router = await worker.createRouter();
+});
+
+afterAll(() => worker.close());
+
+beforeEach(async () =>
+{
+	filePath = path.join(
+		os.tmpdir(), `mediasoup-test-${Math.random().toString(36).slice(2)}.rtpdump`);
+
+	transport = await router.createRecordingTransport({ filePath });
+});
+
+afterEach(async () =>
+{
+	transport.close();
+
+	await fs.promises.rm(filePath, { force: true });
+});
+
+test('router.createRecordingTransport() succeeds', async () =>
+{
+	await expect(router.dump())
+		.resolves
+		.toMatchObject({ transportIds: [ transport.id ] });
+
+	const onObserverNewTransport = jest.fn();
+
+	router.observer.once('newtransport', onObserverNewTransport);
+
+	const filePath1 = `${filePath}.1`;
+
+	// Create a separate transport here.
+	const transport1 = await router.createRecordingTransport(
+		{
+			filePath : filePath1,
+			appData  : { foo: 'bar' }
+		});
+
+	expect(onObserverNewTransport).toHaveBeenCalledTimes(1);
+	expect(onObserverNewTransport).toHaveBeenCalledWith(transport1);
+	expect(typeof transport1.id).toBe('string');
+	expect(transport1.closed).toBe(false);
+	expect(transport1.filePath).toBe(filePath1);
+	expect(transport1.appData).toEqual({ foo: 'bar' });
+
+	const data1 = await transport1.dump();
+
+	expect(data1.id).toBe(transport1.id);
+	expect(data1.direct).toBe(false);
+	expect(data1.producerIds).toEqual([]);
+	expect(data1.consumerIds).toEqual([]);
+	expect(data1.recording.filePath).toBe(filePath1);
+	expect(data1.recording.recordedRtpPackets).toBe(0);
+	expect(data1.recording.droppedPackets).toBe(0);
+
+	transport1.close();
+	expect(transport1.closed).toBe(true);
+
+	await fs.promises.rm(filePath1, { force: true });
+}, 2000);
+
+test('router.createRecordingTransport() with wrong arguments rejects with TypeError', async () =>
+{
+	// @ts-ignore
+	await expect(router.createRecordingTransport({}))
+		.rejects
+		.toThrow(TypeError);
+
+	await expect(router.createRecordingTransport({ filePath: '' }))
+		.rejects
+		.toThrow(TypeError);
+}, 2000);
+
+test('router.createRecordingTransport() with a non writable path does not crash', async () =>
+{
+	const transport1 = await router.createRecordingTransport(
+		{
+			filePath : path.join(os.tmpdir(), 'mediasoup-non-existing-dir', 'file.rtpdump')
+		});
+
+	transport1.close();
+	expect(transport1.closed).toBe(true);
+}, 2000);
+
+test('recordingTransport.getStats() succeeds', async () =>
+{
+	const data = await transport.getStats();
+
+	expect(Array.isArray(data)).toBe(true);
+	expect(data.length).toBe(1);
+	expect(data[0].type).toBe('recording-transport');
+	expect(data[0].transportId).toBe(transport.id);
+	expect(data[0].recording.filePath).toBe(filePath);
+	expect(data[0].recording.writeErrors).toBe(0);
+}, 2000);
+
+test('recordingTransport writes the rtpdump file header', async () =>
+{
+	transport.close();
+
+	// The file is written and closed in background by the worker.
+	await new Promise((resolve) => setTimeout(resolve, 200));
+
+	const data = await fs.promises.readFile(filePath);
+
+	expect(data.toString('latin1').startsWith('#!rtpplay1.0 0.0.0.0/0\n')).toBe(true);
+}, 2000);
+
+test('RecordingTransport emits "routerclose" if Router is closed', async () =>
+{
+	const router2 = await worker.createRouter();
+	const filePath2 = `${filePath}.2`;
+	const transport2 = await router2.createRecordingTransport({ filePath: filePath2 });
+	const onObserverClose = jest.fn();
+
+	transport2.observer.once('close', onObserverClose);
+
+	const promise = new Promise<void>((resolve) => transport2.on('routerclose', resolve));
+
+	router2.close();
+	await promise;
+
+	expect(onObserverClose).toHaveBeenCalledTimes(1);
+	expect(transport2.closed).toBe(true);
+
+	await fs.promises.rm(filePath2, { force: true });
+}, 2000);
@@ -88,7 +88,8 @@ test('worker.createRouter() succeeds', async () =>
 				mapConsumerIdProducerId          : {},
 				mapProducerIdObserverIds         : {},
 				mapDataProducerIdDataConsumerIds : {},
-				mapDataConsumerIdDataProducerId  : {}
+				mapDataConsumerIdDataProducerId  : {},
+				cpuTimeUs                        : 0
 			});
 
 	// Private API.
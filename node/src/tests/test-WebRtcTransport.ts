@@ -260,6 +260,9 @@ test('webRtcTransport.getStats() succeeds', async () =>
 	expect(data[0].rtxSendBitrate).toBe(0);
 	expect(data[0].probationBytesSent).toBe(0);
 	expect(data[0].probationSendBitrate).toBe(0);
+	expect(data[0].rtxProbationBytesSent).toBe(0);
+	expect(data[0].rtxProbationSendBitrate).toBe(0);
+	expect(typeof data[0].cpuTimeUs).toBe('number');
 	expect(data[0].iceSelectedTuple).toBeUndefined();
 	expect(data[0].maxIncomingBitrate).toBeUndefined();
 }, 2000);
@@ -505,7 +508,8 @@ test('WebRtcTransport events succeed', async () =>
 		builder.createString(transport.id),
 		Event.WEBRTCTRANSPORT_ICE_STATE_CHANGE,
 		NotificationBody.WebRtcTransport_IceStateChangeNotification,
-		iceStateChangeNotification.pack(builder)
+		iceStateChangeNotification.pack(builder),
+		0 /* handlerHandle */
 	);
 
 	builder.finish(notificationOffset);
@@ -549,7 +553,8 @@ test('WebRtcTransport events succeed', async () =>
 		builder.createString(transport.id),
 		Event.WEBRTCTRANSPORT_ICE_SELECTED_TUPLE_CHANGE,
 		NotificationBody.WebRtcTransport_IceSelectedTupleChangeNotification,
-		iceSelectedTupleChangeNotification.pack(builder)
+		iceSelectedTupleChangeNotification.pack(builder),
+		0 /* handlerHandle */
 	);
 
 	builder.finish(notificationOffset);
@@ -579,7 +584,8 @@ test('WebRtcTransport events succeed', async () =>
 		builder.createString(transport.id),
 		Event.WEBRTCTRANSPORT_DTLS_STATE_CHANGE,
 		NotificationBody.WebRtcTransport_DtlsStateChangeNotification,
-		dtlsStateChangeNotification.pack(builder)
+		dtlsStateChangeNotification.pack(builder),
+		0 /* handlerHandle */
 	);
 
 	builder.finish(notificationOffset);
@@ -3,6 +3,10 @@ import * as process from 'node:process';
 import * as path from 'node:path';
 import * as mediasoup from '../';
 import { InvalidStateError } from '../errors';
+import { Method as FbsMethod } from '../fbs/request';
+import { Body as FbsResponseBody, Response as FbsResponse } from '../fbs/response';
+import * as FbsDirectTransport from '../fbs/direct-transport';
+import * as FbsRouter from '../fbs/router';
 
 let worker: mediasoup.types.Worker;
 
@@ -88,6 +92,10 @@ test('createWorker() with wrong settings rejects with TypeError', async () =>
 		.rejects
 		.toThrow(TypeError);
 
+	await expect(mediasoup.createWorker({ udpSocketPoolSize: 2000 }))
+		.rejects
+		.toThrow(TypeError);
+
 	// @ts-ignore
 	await expect(mediasoup.createWorker({ appData: 'NOT-AN-OBJECT' }))
 		.rejects
@@ -150,6 +158,54 @@ test('worker.dump() succeeds', async () =>
 	worker.close();
 }, 2000);
 
+test('worker.dump() with udpSocketPoolSize reports pool hits and misses', async () =>
+{
+	worker = await mediasoup.createWorker({ udpSocketPoolSize: 4 });
+
+	const router = await worker.createRouter();
+	const listenInfos: mediasoup.types.TransportListenInfo[] =
+		[ { protocol: 'udp', ip: '127.0.0.1' } ];
+
+	// The pool of 127.0.0.1 is created (and refilled) when first used.
+	const transport1 = await router.createWebRtcTransport({ listenInfos });
+	const transport2 = await router.createWebRtcTransport({ listenInfos });
+
+	expect(transport2.iceCandidates[0].port)
+		.not.toBe(transport1.iceCandidates[0].port);
+
+	await expect(worker.dump())
+		.resolves
+		.toMatchObject(
+			{
+				udpSocketPool :
+				{
+					size   : 4,
+					hits   : 1,
+					misses : 1
+				}
+			});
+
+	worker.close();
+}, 2000);
+
+test('worker.dump() with sendThreads reports the send offload pool', async () =>
+{
+	worker = await mediasoup.createWorker({ sendThreads: 2 });
+
+	await expect(worker.dump())
+		.resolves
+		.toMatchObject(
+			{
+				sendOffloadPool :
+				{
+					numThreads    : 2,
+					sendFallbacks : 0
+				}
+			});
+
+	worker.close();
+}, 2000);
+
 test('worker.dump() rejects with InvalidStateError if closed', async () =>
 {
 	worker = await mediasoup.createWorker();
@@ -173,6 +229,107 @@ test('worker.getResourceUsage() succeeds', async () =>
 	worker.close();
 }, 2000);
 
+test('worker.getProfile() succeeds', async () =>
+{
+	worker = await mediasoup.createWorker();
+
+	const profile = await worker.getProfile({ reset: true });
+
+	expect(typeof profile.enabled).toBe('boolean');
+	expect(profile.sampleInterval).toBeGreaterThan(0);
+	expect(Array.isArray(profile.stages)).toBe(true);
+
+	worker.close();
+}, 2000);
+
+test('channel.requestBatch() resolves responses in order', async () =>
+{
+	worker = await mediasoup.createWorker();
+
+	const router = await worker.createRouter();
+	const transport = await router.createDirectTransport();
+	const results = await transport.channelForTesting.requestBatch(
+		[
+			{ method: FbsMethod.WORKER_DUMP },
+			{ method: FbsMethod.ROUTER_DUMP, handlerId: router.id },
+			{ method: FbsMethod.TRANSPORT_DUMP, handlerId: transport.id }
+		]);
+
+	expect(results.length).toBe(3);
+
+	results.forEach((result, idx) =>
+	{
+		expect(result).toBeInstanceOf(FbsResponse);
+		expect((result as FbsResponse).id()).toBe(idx);
+	});
+
+	const routerResponse = results[1] as FbsResponse;
+	const routerDump = new FbsRouter.DumpResponse();
+
+	expect(routerResponse.bodyType()).toBe(FbsResponseBody.Router_DumpResponse);
+	routerResponse.body(routerDump);
+	expect(routerDump.id()).toBe(router.id);
+
+	const transportResponse = results[2] as FbsResponse;
+	const transportDump = new FbsDirectTransport.DumpResponse();
+
+	expect(transportResponse.bodyType()).toBe(FbsResponseBody.DirectTransport_DumpResponse);
+	transportResponse.body(transportDump);
+	expect(transportDump.base()!.id()).toBe(transport.id);
+
+	worker.close();
+}, 2000);
+
+test('channel.requestBatch() keeps running after a failing request', async () =>
+{
+	worker = await mediasoup.createWorker();
+
+	const router = await worker.createRouter();
+	const transport = await router.createDirectTransport();
+	const results = await transport.channelForTesting.requestBatch(
+		[
+			{ method: FbsMethod.ROUTER_DUMP, handlerId: router.id },
+			{ method: FbsMethod.TRANSPORT_DUMP, handlerId: 'non-existing-id' },
+			{ method: FbsMethod.TRANSPORT_DUMP, handlerId: transport.id }
+		]);
+
+	expect(results.length).toBe(3);
+	expect(results[0]).toBeInstanceOf(FbsResponse);
+	expect(results[1]).toBeInstanceOf(Error);
+	expect(results[2]).toBeInstanceOf(FbsResponse);
+	expect((results[2] as FbsResponse).id()).toBe(2);
+
+	worker.close();
+}, 2000);
+
+test('channel.requestBatch() rejects unknown and forbidden methods in place', async () =>
+{
+	worker = await mediasoup.createWorker();
+
+	const router = await worker.createRouter();
+	const transport = await router.createDirectTransport();
+	const results = await transport.channelForTesting.requestBatch(
+		[
+			{ method: FbsMethod.WORKER_DUMP },
+			{ method: 255 as FbsMethod },
+			{ method: FbsMethod.WORKER_CLOSE },
+			{ method: FbsMethod.ROUTER_DUMP, handlerId: router.id }
+		]);
+
+	expect(results.length).toBe(4);
+	expect(results[0]).toBeInstanceOf(FbsResponse);
+	expect(results[1]).toBeInstanceOf(Error);
+	expect((results[1] as Error).message).toMatch(/unknown method/);
+	expect(results[2]).toBeInstanceOf(TypeError);
+	expect(results[3]).toBeInstanceOf(FbsResponse);
+	expect((results[3] as FbsResponse).id()).toBe(3);
+
+	// The worker is still alive.
+	await expect(worker.dump()).resolves.toBeDefined();
+
+	worker.close();
+}, 2000);
+
 test('worker.close() succeeds', async () =>
 {
 	worker = await mediasoup.createWorker({ logLevel: 'warn' });
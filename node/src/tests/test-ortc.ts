@@ -506,6 +506,43 @@ test('getProducerRtpParametersMapping(), getConsumableRtpParameters(), getConsum
 			reducedSize : true
 		});
 
+	const fecConsumerRtpParameters = ortc.getConsumerRtpParameters(
+		{
+			consumableRtpParameters,
+			remoteRtpCapabilities :
+			{
+				...remoteRtpCapabilities,
+				codecs :
+				[
+					...remoteRtpCapabilities.codecs!,
+					{
+						mimeType             : 'video/flexfec',
+						kind                 : 'video',
+						preferredPayloadType : 110,
+						clockRate            : 90000,
+						parameters           : { 'repair-window': 10000000 },
+						rtcpFeedback         : []
+					}
+				]
+			},
+			pipe      : false,
+			enableRtx : true,
+			enableFec : true
+		}
+	);
+
+	expect(fecConsumerRtpParameters.codecs.length).toEqual(3);
+	expect(fecConsumerRtpParameters.codecs[2]).toEqual(
+		{
+			mimeType     : 'video/flexfec',
+			payloadType  : 110,
+			clockRate    : 90000,
+			parameters   : { 'repair-window': 10000000 },
+			rtcpFeedback : []
+		});
+	expect(fecConsumerRtpParameters.encodings?.[0].fec?.ssrc)
+		.toBe(fecConsumerRtpParameters.encodings![0].ssrc! + 2);
+
 	const pipeConsumerRtpParameters = ortc.getPipeConsumerRtpParameters(
 		{
 			consumableRtpParameters,
@@ -6,6 +6,7 @@ export * from './WebRtcTransport';
 export * from './PlainTransport';
 export * from './PipeTransport';
 export * from './DirectTransport';
+export * from './RecordingTransport';
 export * from './Producer';
 export * from './Consumer';
 export * from './DataProducer';
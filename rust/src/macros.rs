@@ -51,5 +51,11 @@ macro_rules! uuid_based_wrapper_type {
                 Self::Uuid(id.0)
             }
         }
+
+        impl $crate::worker::HandlerKey for $struct_name {
+            fn handler_key(&self) -> Option<::uuid::Uuid> {
+                Some(self.0)
+            }
+        }
     };
 }
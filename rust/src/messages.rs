@@ -29,7 +29,10 @@ use crate::webrtc_server::{
 use crate::webrtc_transport::{
     WebRtcTransportListen, WebRtcTransportListenInfos, WebRtcTransportOptions,
 };
-use crate::worker::{ChannelMessageHandlers, LibUringDump, WorkerDump, WorkerUpdateSettings};
+use crate::worker::{
+    ChannelMessageHandlers, LibUringDump, SendOffloadPoolDump, UdpSocketPoolDump, UsrSctpDump,
+    WorkerDump, WorkerUpdateSettings,
+};
 use mediasoup_sys::fbs::{
     active_speaker_observer, audio_level_observer, consumer, data_consumer, data_producer,
     direct_transport, message, notification, pipe_transport, plain_transport, producer, request,
@@ -53,7 +56,9 @@ where
     type Response;
 
     /// Get a serialized message out of this request.
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8>;
+    ///
+    /// `handler_handle` is the compact handle of the target entity (0 if unknown).
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8>;
 
     /// Default response to return in case of soft error, such as channel already closed, entity
     /// doesn't exist on worker during closing.
@@ -73,7 +78,9 @@ pub(crate) trait Notification: Debug {
     type HandlerId: Display;
 
     /// Get a serialized message out of this notification.
-    fn into_bytes(self, handler_id: Self::HandlerId) -> Vec<u8>;
+    ///
+    /// `handler_handle` is the compact handle of the target entity (0 if unknown).
+    fn into_bytes(self, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8>;
 }
 
 #[derive(Debug)]
@@ -84,7 +91,7 @@ impl Request for WorkerCloseRequest {
     type HandlerId = &'static str;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -93,6 +100,7 @@ impl Request for WorkerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -115,7 +123,7 @@ impl Request for WorkerDumpRequest {
     type HandlerId = &'static str;
     type Response = WorkerDump;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -124,6 +132,7 @@ impl Request for WorkerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -170,6 +179,20 @@ impl Request for WorkerDumpRequest {
                 sqe_miss_count: liburing.sqe_miss_count,
                 user_data_miss_count: liburing.user_data_miss_count,
             }),
+            usrsctp: data.usrsctp.map(|usrsctp| UsrSctpDump {
+                timer_wakeups: usrsctp.timer_wakeups,
+                timer_idle_stops: usrsctp.timer_idle_stops,
+            }),
+            udp_socket_pool: data.udp_socket_pool.map(|pool| UdpSocketPoolDump {
+                size: pool.size,
+                available: pool.available,
+                hits: pool.hits,
+                misses: pool.misses,
+            }),
+            send_offload_pool: data.send_offload_pool.map(|pool| SendOffloadPoolDump {
+                num_threads: pool.num_threads,
+                send_fallbacks: pool.send_fallbacks,
+            }),
         })
     }
 }
@@ -184,7 +207,7 @@ impl Request for WorkerUpdateSettingsRequest {
     type HandlerId = &'static str;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = worker::UpdateSettingsRequest::create(
             &mut builder,
@@ -206,6 +229,7 @@ impl Request for WorkerUpdateSettingsRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -231,7 +255,7 @@ impl Request for WorkerCreateWebRtcServerRequest {
     type HandlerId = &'static str;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = worker::CreateWebRtcServerRequest::create(
             &mut builder,
@@ -246,6 +270,7 @@ impl Request for WorkerCreateWebRtcServerRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -270,7 +295,7 @@ impl Request for WebRtcServerCloseRequest {
     type HandlerId = &'static str;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = worker::CloseWebRtcServerRequest::create(
@@ -285,6 +310,7 @@ impl Request for WebRtcServerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -307,7 +333,7 @@ impl Request for WebRtcServerDumpRequest {
     type HandlerId = WebRtcServerId;
     type Response = WebRtcServerDump;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -316,6 +342,7 @@ impl Request for WebRtcServerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -383,12 +410,17 @@ pub(crate) struct WorkerCreateRouterRequest {
     pub(crate) router_id: RouterId,
 }
 
+#[derive(Debug)]
+pub(crate) struct WorkerCreateRouterResponse {
+    pub(crate) handle: u32,
+}
+
 impl Request for WorkerCreateRouterRequest {
     const METHOD: request::Method = request::Method::WorkerCreateRouter;
     type HandlerId = &'static str;
-    type Response = ();
+    type Response = WorkerCreateRouterResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = worker::CreateRouterRequest::create(&mut builder, self.router_id.to_string());
         let request_body = request::Body::create_worker_create_router_request(&mut builder, data);
@@ -398,6 +430,7 @@ impl Request for WorkerCreateRouterRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -406,9 +439,17 @@ impl Request for WorkerCreateRouterRequest {
     }
 
     fn convert_response(
-        _response: Option<response::BodyRef<'_>>,
+        response: Option<response::BodyRef<'_>>,
     ) -> Result<Self::Response, Box<dyn Error>> {
-        Ok(())
+        let Some(response::BodyRef::WorkerCreateRouterResponse(data)) = response else {
+            panic!("Wrong message from worker: {response:?}");
+        };
+
+        let data = worker::CreateRouterResponse::try_from(data)?;
+
+        Ok(WorkerCreateRouterResponse {
+            handle: data.handle,
+        })
     }
 }
 
@@ -422,7 +463,7 @@ impl Request for RouterCloseRequest {
     type HandlerId = &'static str;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = worker::CloseRouterRequest::create(&mut builder, self.router_id.to_string());
@@ -433,6 +474,7 @@ impl Request for RouterCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -455,7 +497,7 @@ impl Request for RouterDumpRequest {
     type HandlerId = RouterId;
     type Response = RouterDump;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -464,6 +506,7 @@ impl Request for RouterDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -579,6 +622,7 @@ impl RouterCreateDirectTransportData {
                 max_sctp_message_size: 0,
                 sctp_send_buffer_size: 0,
                 is_data_channel: false,
+                probe_with_rtx: false,
             }),
         }
     }
@@ -592,9 +636,10 @@ pub(crate) struct RouterCreateDirectTransportRequest {
 impl Request for RouterCreateDirectTransportRequest {
     const METHOD: request::Method = request::Method::RouterCreateDirecttransport;
     type HandlerId = RouterId;
-    type Response = ();
+    /// Handle of the created transport.
+    type Response = u32;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = router::CreateDirectTransportRequest::create(
             &mut builder,
@@ -609,6 +654,7 @@ impl Request for RouterCreateDirectTransportRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -617,9 +663,15 @@ impl Request for RouterCreateDirectTransportRequest {
     }
 
     fn convert_response(
-        _response: Option<response::BodyRef<'_>>,
+        response: Option<response::BodyRef<'_>>,
     ) -> Result<Self::Response, Box<dyn Error>> {
-        Ok(())
+        let Some(response::BodyRef::DirectTransportDumpResponse(data)) = response else {
+            panic!("Wrong message from worker: {response:?}");
+        };
+
+        let data = direct_transport::DumpResponse::try_from(data)?;
+
+        Ok(data.base.handle)
     }
 }
 
@@ -674,6 +726,7 @@ pub(crate) struct RouterCreateWebrtcTransportData {
     max_sctp_message_size: u32,
     sctp_send_buffer_size: u32,
     is_data_channel: bool,
+    probe_with_rtx: bool,
 }
 
 impl RouterCreateWebrtcTransportData {
@@ -706,6 +759,7 @@ impl RouterCreateWebrtcTransportData {
             max_sctp_message_size: webrtc_transport_options.max_sctp_message_size,
             sctp_send_buffer_size: webrtc_transport_options.sctp_send_buffer_size,
             is_data_channel: true,
+            probe_with_rtx: webrtc_transport_options.probe_with_rtx,
         }
     }
 
@@ -720,6 +774,7 @@ impl RouterCreateWebrtcTransportData {
                 max_sctp_message_size: self.max_sctp_message_size,
                 sctp_send_buffer_size: self.sctp_send_buffer_size,
                 is_data_channel: true,
+                probe_with_rtx: self.probe_with_rtx,
             }),
             listen: self.listen.to_fbs(),
             enable_udp: self.enable_udp,
@@ -743,6 +798,7 @@ pub(crate) struct WebRtcTransportData {
     pub(crate) dtls_remote_cert: Mutex<Option<String>>,
     pub(crate) sctp_parameters: Option<SctpParameters>,
     pub(crate) sctp_state: Mutex<Option<SctpState>>,
+    pub(crate) handle: u32,
 }
 
 #[derive(Debug)]
@@ -755,7 +811,7 @@ impl Request for RouterCreateWebRtcTransportRequest {
     type HandlerId = RouterId;
     type Response = WebRtcTransportData;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let RouterCreateWebrtcTransportListen::Individual { listen_infos: _ } = self.data.listen
         else {
             panic!("RouterCreateWebrtcTransportListen variant must be Individual");
@@ -775,6 +831,7 @@ impl Request for RouterCreateWebRtcTransportRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -816,6 +873,7 @@ impl Request for RouterCreateWebRtcTransportRequest {
                     .sctp_state
                     .map(|state| SctpState::from_fbs(&state)),
             ),
+            handle: data.base.handle,
         })
     }
 }
@@ -830,7 +888,7 @@ impl Request for RouterCreateWebRtcTransportWithServerRequest {
     type HandlerId = RouterId;
     type Response = WebRtcTransportData;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let RouterCreateWebrtcTransportListen::Server {
             webrtc_server_id: _,
         } = self.data.listen
@@ -852,6 +910,7 @@ impl Request for RouterCreateWebRtcTransportWithServerRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -893,6 +952,7 @@ impl Request for RouterCreateWebRtcTransportWithServerRequest {
                     .sctp_state
                     .map(|state| SctpState::from_fbs(&state)),
             ),
+            handle: data.base.handle,
         })
     }
 }
@@ -946,6 +1006,7 @@ impl RouterCreatePlainTransportData {
                 max_sctp_message_size: self.max_sctp_message_size,
                 sctp_send_buffer_size: self.sctp_send_buffer_size,
                 is_data_channel: self.is_data_channel,
+                probe_with_rtx: false,
             }),
             listen_info: Box::new(self.listen_info.to_fbs()),
             rtcp_listen_info: self
@@ -969,7 +1030,7 @@ impl Request for RouterCreatePlainTransportRequest {
     type HandlerId = RouterId;
     type Response = PlainTransportData;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = router::CreatePlainTransportRequest::create(
             &mut builder,
@@ -984,6 +1045,7 @@ impl Request for RouterCreatePlainTransportRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1019,6 +1081,7 @@ impl Request for RouterCreatePlainTransportRequest {
                 data.srtp_parameters
                     .map(|parameters| SrtpParameters::from_fbs(parameters.as_ref())),
             ),
+            handle: data.base.handle,
         })
     }
 }
@@ -1032,6 +1095,7 @@ pub(crate) struct PlainTransportData {
     pub(crate) sctp_parameters: Option<SctpParameters>,
     pub(crate) sctp_state: Mutex<Option<SctpState>>,
     pub(crate) srtp_parameters: Mutex<Option<SrtpParameters>>,
+    pub(crate) handle: u32,
 }
 
 #[derive(Debug, Serialize)]
@@ -1045,6 +1109,9 @@ pub(crate) struct RouterCreatePipeTransportData {
     sctp_send_buffer_size: u32,
     enable_rtx: bool,
     enable_srtp: bool,
+    enable_local: bool,
+    enable_shm: bool,
+    aggregation_max_size: u32,
     is_data_channel: bool,
 }
 
@@ -1062,6 +1129,9 @@ impl RouterCreatePipeTransportData {
             sctp_send_buffer_size: pipe_transport_options.sctp_send_buffer_size,
             enable_rtx: pipe_transport_options.enable_rtx,
             enable_srtp: pipe_transport_options.enable_srtp,
+            enable_local: pipe_transport_options.enable_local,
+            enable_shm: pipe_transport_options.enable_shm,
+            aggregation_max_size: pipe_transport_options.aggregation_max_size,
             is_data_channel: false,
         }
     }
@@ -1077,10 +1147,14 @@ impl RouterCreatePipeTransportData {
                 max_sctp_message_size: self.max_sctp_message_size,
                 sctp_send_buffer_size: self.sctp_send_buffer_size,
                 is_data_channel: self.is_data_channel,
+                probe_with_rtx: false,
             }),
             listen_info: Box::new(self.listen_info.to_fbs()),
             enable_rtx: self.enable_rtx,
             enable_srtp: self.enable_srtp,
+            enable_shm: self.enable_shm,
+            aggregation_max_size: self.aggregation_max_size,
+            enable_local: self.enable_local,
         }
     }
 }
@@ -1095,7 +1169,7 @@ impl Request for RouterCreatePipeTransportRequest {
     type HandlerId = RouterId;
     type Response = PipeTransportData;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = router::CreatePipeTransportRequest::create(
             &mut builder,
@@ -1110,6 +1184,7 @@ impl Request for RouterCreatePipeTransportRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1142,6 +1217,9 @@ impl Request for RouterCreatePipeTransportRequest {
                 data.srtp_parameters
                     .map(|parameters| SrtpParameters::from_fbs(parameters.as_ref())),
             ),
+            shm_name: data.shm_name,
+            local_name: data.local_name,
+            handle: data.base.handle,
         })
     }
 }
@@ -1152,6 +1230,9 @@ pub(crate) struct PipeTransportData {
     pub(crate) sctp_state: Mutex<Option<SctpState>>,
     pub(crate) rtx: bool,
     pub(crate) srtp_parameters: Mutex<Option<SrtpParameters>>,
+    pub(crate) shm_name: Option<String>,
+    pub(crate) local_name: Option<String>,
+    pub(crate) handle: u32,
 }
 
 #[derive(Debug, Serialize)]
@@ -1167,6 +1248,7 @@ pub(crate) struct RouterCreateAudioLevelObserverData {
     max_entries: NonZeroU16,
     threshold: i8,
     interval: u16,
+    last_n: u16,
 }
 
 impl RouterCreateAudioLevelObserverData {
@@ -1179,6 +1261,7 @@ impl RouterCreateAudioLevelObserverData {
             max_entries: audio_level_observer_options.max_entries,
             threshold: audio_level_observer_options.threshold,
             interval: audio_level_observer_options.interval,
+            last_n: audio_level_observer_options.last_n,
         }
     }
 }
@@ -1188,7 +1271,7 @@ impl Request for RouterCreateAudioLevelObserverRequest {
     type HandlerId = RouterId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let options = audio_level_observer::AudioLevelObserverOptions::create(
@@ -1196,6 +1279,7 @@ impl Request for RouterCreateAudioLevelObserverRequest {
             u16::from(self.data.max_entries),
             self.data.threshold,
             self.data.interval,
+            self.data.last_n,
         );
         let data = router::CreateAudioLevelObserverRequest::create(
             &mut builder,
@@ -1211,6 +1295,7 @@ impl Request for RouterCreateAudioLevelObserverRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1255,7 +1340,7 @@ impl Request for RouterCreateActiveSpeakerObserverRequest {
     type HandlerId = RouterId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let options = active_speaker_observer::ActiveSpeakerObserverOptions::create(
@@ -1276,6 +1361,7 @@ impl Request for RouterCreateActiveSpeakerObserverRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1298,7 +1384,7 @@ impl Request for TransportDumpRequest {
     type HandlerId = TransportId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -1307,6 +1393,7 @@ impl Request for TransportDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1333,7 +1420,7 @@ impl Request for TransportGetStatsRequest {
     type HandlerId = TransportId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -1342,6 +1429,7 @@ impl Request for TransportGetStatsRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1371,7 +1459,7 @@ impl Request for TransportCloseRequest {
     type HandlerId = RouterId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data =
             router::CloseTransportRequest::create(&mut builder, self.transport_id.to_string());
@@ -1383,6 +1471,7 @@ impl Request for TransportCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1412,7 +1501,7 @@ impl Request for WebRtcTransportConnectRequest {
     type HandlerId = TransportId;
     type Response = WebRtcTransportConnectResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data =
             web_rtc_transport::ConnectRequest::create(&mut builder, self.dtls_parameters.to_fbs());
@@ -1424,6 +1513,7 @@ impl Request for WebRtcTransportConnectRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1456,6 +1546,8 @@ pub(crate) struct PipeTransportConnectRequest {
     pub(crate) ip: IpAddr,
     pub(crate) port: u16,
     pub(crate) srtp_parameters: Option<SrtpParameters>,
+    pub(crate) shm_name: Option<String>,
+    pub(crate) local_name: Option<String>,
 }
 
 impl Request for PipeTransportConnectRequest {
@@ -1463,13 +1555,15 @@ impl Request for PipeTransportConnectRequest {
     type HandlerId = TransportId;
     type Response = PipeTransportConnectResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = pipe_transport::ConnectRequest::create(
             &mut builder,
             self.ip.to_string(),
             self.port,
             self.srtp_parameters.map(|parameters| parameters.to_fbs()),
+            self.shm_name,
+            self.local_name,
         );
         let request_body = request::Body::create_pipe_transport_connect_request(&mut builder, data);
         let request = request::Request::create(
@@ -1478,6 +1572,7 @@ impl Request for PipeTransportConnectRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1520,7 +1615,7 @@ impl Request for TransportConnectPlainRequest {
     type HandlerId = TransportId;
     type Response = PlainTransportConnectResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = plain_transport::ConnectRequest::create(
             &mut builder,
@@ -1537,6 +1632,7 @@ impl Request for TransportConnectPlainRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1575,7 +1671,7 @@ impl Request for TransportSetMaxIncomingBitrateRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = transport::SetMaxIncomingBitrateRequest::create(&mut builder, self.bitrate);
@@ -1587,6 +1683,7 @@ impl Request for TransportSetMaxIncomingBitrateRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1611,7 +1708,7 @@ impl Request for TransportSetMaxOutgoingBitrateRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = transport::SetMaxOutgoingBitrateRequest::create(&mut builder, self.bitrate);
@@ -1623,6 +1720,7 @@ impl Request for TransportSetMaxOutgoingBitrateRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1647,7 +1745,7 @@ impl Request for TransportSetMinOutgoingBitrateRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = transport::SetMinOutgoingBitrateRequest::create(&mut builder, self.bitrate);
@@ -1659,6 +1757,7 @@ impl Request for TransportSetMinOutgoingBitrateRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1681,7 +1780,7 @@ impl Request for TransportRestartIceRequest {
     type HandlerId = TransportId;
     type Response = IceParameters;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let request = request::Request::create(
             &mut builder,
@@ -1689,6 +1788,7 @@ impl Request for TransportRestartIceRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1721,11 +1821,13 @@ pub(crate) struct TransportProduceRequest {
     pub(crate) rtp_mapping: RtpMapping,
     pub(crate) key_frame_request_delay: u32,
     pub(crate) paused: bool,
+    pub(crate) key_frame_cache: bool,
 }
 
 #[derive(Debug)]
 pub(crate) struct TransportProduceResponse {
     pub(crate) r#type: ProducerType,
+    pub(crate) handle: u32,
 }
 
 impl Request for TransportProduceRequest {
@@ -1733,7 +1835,7 @@ impl Request for TransportProduceRequest {
     type HandlerId = TransportId;
     type Response = TransportProduceResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::ProduceRequest::create(
             &mut builder,
@@ -1743,6 +1845,7 @@ impl Request for TransportProduceRequest {
             Box::new(self.rtp_mapping.to_fbs()),
             self.key_frame_request_delay,
             self.paused,
+            self.key_frame_cache,
         );
         let request_body = request::Body::create_transport_produce_request(&mut builder, data);
         let request = request::Request::create(
@@ -1751,6 +1854,7 @@ impl Request for TransportProduceRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1769,6 +1873,7 @@ impl Request for TransportProduceRequest {
 
         Ok(TransportProduceResponse {
             r#type: ProducerType::from_fbs(data.type_),
+            handle: data.handle,
         })
     }
 }
@@ -1792,6 +1897,7 @@ pub(crate) struct TransportConsumeResponse {
     pub(crate) producer_paused: bool,
     pub(crate) score: ConsumerScore,
     pub(crate) preferred_layers: Option<ConsumerLayers>,
+    pub(crate) handle: u32,
 }
 
 impl Request for TransportConsumeRequest {
@@ -1799,7 +1905,7 @@ impl Request for TransportConsumeRequest {
     type HandlerId = TransportId;
     type Response = TransportConsumeResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::ConsumeRequest::create(
             &mut builder,
@@ -1823,6 +1929,7 @@ impl Request for TransportConsumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1846,6 +1953,7 @@ impl Request for TransportConsumeRequest {
             preferred_layers: data
                 .preferred_layers
                 .map(|preferred_layers| ConsumerLayers::from_fbs(*preferred_layers)),
+            handle: data.handle,
         })
     }
 }
@@ -1868,6 +1976,7 @@ pub(crate) struct TransportProduceDataResponse {
     pub(crate) label: String,
     pub(crate) protocol: String,
     pub(crate) paused: bool,
+    pub(crate) handle: u32,
 }
 
 impl Request for TransportProduceDataRequest {
@@ -1875,7 +1984,7 @@ impl Request for TransportProduceDataRequest {
     type HandlerId = TransportId;
     type Response = TransportProduceDataResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::ProduceDataRequest::create(
             &mut builder,
@@ -1905,6 +2014,7 @@ impl Request for TransportProduceDataRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -1932,6 +2042,7 @@ impl Request for TransportProduceDataRequest {
             label: data.label.to_string(),
             protocol: data.protocol.to_string(),
             paused: data.paused,
+            handle: data.handle,
         })
     }
 }
@@ -1957,6 +2068,7 @@ pub(crate) struct TransportConsumeDataResponse {
     pub(crate) paused: bool,
     pub(crate) data_producer_paused: bool,
     pub(crate) subchannels: Vec<u16>,
+    pub(crate) handle: u32,
 }
 
 impl Request for TransportConsumeDataRequest {
@@ -1964,7 +2076,7 @@ impl Request for TransportConsumeDataRequest {
     type HandlerId = TransportId;
     type Response = TransportConsumeDataResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::ConsumeDataRequest::create(
             &mut builder,
@@ -1996,6 +2108,7 @@ impl Request for TransportConsumeDataRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2025,6 +2138,7 @@ impl Request for TransportConsumeDataRequest {
             paused: data.paused,
             data_producer_paused: data.data_producer_paused,
             subchannels: data.subchannels,
+            handle: data.handle,
         })
     }
 }
@@ -2039,7 +2153,7 @@ impl Request for TransportEnableTraceEventRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = transport::EnableTraceEventRequest {
@@ -2057,6 +2171,7 @@ impl Request for TransportEnableTraceEventRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2085,7 +2200,7 @@ impl Notification for TransportSendRtcpNotification {
     const EVENT: notification::Event = notification::Event::TransportSendRtcp;
     type HandlerId = TransportId;
 
-    fn into_bytes(self, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = transport::SendRtcpNotification::create(&mut builder, self.rtcp_packet);
@@ -2097,6 +2212,7 @@ impl Notification for TransportSendRtcpNotification {
             handler_id.to_string(),
             Self::EVENT,
             Some(notification_body),
+            handler_handle,
         );
         let message_body = message::Body::create_notification(&mut builder, notification);
         let message = message::Message::create(&mut builder, message_body);
@@ -2115,7 +2231,7 @@ impl Request for ProducerCloseRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data =
             transport::CloseProducerRequest::create(&mut builder, self.producer_id.to_string());
@@ -2128,6 +2244,7 @@ impl Request for ProducerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2150,7 +2267,7 @@ impl Request for ProducerDumpRequest {
     type HandlerId = ProducerId;
     type Response = ProducerDump;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2159,6 +2276,7 @@ impl Request for ProducerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2185,7 +2303,7 @@ impl Request for ProducerGetStatsRequest {
     type HandlerId = ProducerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2194,6 +2312,7 @@ impl Request for ProducerGetStatsRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2221,7 +2340,7 @@ impl Request for ProducerPauseRequest {
     type HandlerId = ProducerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2230,6 +2349,7 @@ impl Request for ProducerPauseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2252,7 +2372,7 @@ impl Request for ProducerResumeRequest {
     type HandlerId = ProducerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2261,6 +2381,7 @@ impl Request for ProducerResumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2285,7 +2406,7 @@ impl Request for ProducerEnableTraceEventRequest {
     type HandlerId = ProducerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = producer::EnableTraceEventRequest {
@@ -2303,6 +2424,7 @@ impl Request for ProducerEnableTraceEventRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2331,7 +2453,7 @@ impl Notification for ProducerSendNotification {
     const EVENT: notification::Event = notification::Event::ProducerSend;
     type HandlerId = ProducerId;
 
-    fn into_bytes(self, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = producer::SendNotification::create(&mut builder, self.rtp_packet);
@@ -2343,6 +2465,7 @@ impl Notification for ProducerSendNotification {
             handler_id.to_string(),
             Self::EVENT,
             Some(notification_body),
+            handler_handle,
         );
         let message_body = message::Body::create_notification(&mut builder, notification);
         let message = message::Message::create(&mut builder, message_body);
@@ -2361,7 +2484,7 @@ impl Request for ConsumerCloseRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data =
             transport::CloseConsumerRequest::create(&mut builder, self.consumer_id.to_string());
@@ -2374,6 +2497,7 @@ impl Request for ConsumerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2396,7 +2520,7 @@ impl Request for ConsumerDumpRequest {
     type HandlerId = ConsumerId;
     type Response = ConsumerDump;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2405,6 +2529,7 @@ impl Request for ConsumerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2431,7 +2556,7 @@ impl Request for ConsumerGetStatsRequest {
     type HandlerId = ConsumerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2440,6 +2565,7 @@ impl Request for ConsumerGetStatsRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2467,7 +2593,7 @@ impl Request for ConsumerPauseRequest {
     type HandlerId = ConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2476,6 +2602,7 @@ impl Request for ConsumerPauseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2498,7 +2625,7 @@ impl Request for ConsumerResumeRequest {
     type HandlerId = ConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2507,6 +2634,7 @@ impl Request for ConsumerResumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2531,7 +2659,7 @@ impl Request for ConsumerSetPreferredLayersRequest {
     type HandlerId = ConsumerId;
     type Response = Option<ConsumerLayers>;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = consumer::SetPreferredLayersRequest::create(
@@ -2547,6 +2675,7 @@ impl Request for ConsumerSetPreferredLayersRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2585,7 +2714,7 @@ impl Request for ConsumerSetPriorityRequest {
     type HandlerId = ConsumerId;
     type Response = ConsumerSetPriorityResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = consumer::SetPriorityRequest::create(&mut builder, self.priority);
@@ -2597,6 +2726,7 @@ impl Request for ConsumerSetPriorityRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2627,7 +2757,7 @@ impl Request for ConsumerRequestKeyFrameRequest {
     type HandlerId = ConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let request = request::Request::create(
             &mut builder,
@@ -2635,6 +2765,7 @@ impl Request for ConsumerRequestKeyFrameRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2659,7 +2790,7 @@ impl Request for ConsumerEnableTraceEventRequest {
     type HandlerId = ConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = consumer::EnableTraceEventRequest {
@@ -2677,6 +2808,7 @@ impl Request for ConsumerEnableTraceEventRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2705,7 +2837,7 @@ impl Request for DataProducerCloseRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::CloseDataProducerRequest::create(
             &mut builder,
@@ -2720,6 +2852,7 @@ impl Request for DataProducerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2742,7 +2875,7 @@ impl Request for DataProducerDumpRequest {
     type HandlerId = DataProducerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2751,6 +2884,7 @@ impl Request for DataProducerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2778,7 +2912,7 @@ impl Request for DataProducerGetStatsRequest {
     type HandlerId = DataProducerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2787,6 +2921,7 @@ impl Request for DataProducerGetStatsRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2814,7 +2949,7 @@ impl Request for DataProducerPauseRequest {
     type HandlerId = DataProducerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2823,6 +2958,7 @@ impl Request for DataProducerPauseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2845,7 +2981,7 @@ impl Request for DataProducerResumeRequest {
     type HandlerId = DataProducerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2854,6 +2990,7 @@ impl Request for DataProducerResumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2880,7 +3017,7 @@ impl Notification for DataProducerSendNotification {
     const EVENT: notification::Event = notification::Event::DataproducerSend;
     type HandlerId = DataProducerId;
 
-    fn into_bytes(self, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_producer::SendNotification::create(
@@ -2898,6 +3035,7 @@ impl Notification for DataProducerSendNotification {
             handler_id.to_string(),
             Self::EVENT,
             Some(notification_body),
+            handler_handle,
         );
         let message_body = message::Body::create_notification(&mut builder, notification);
         let message = message::Message::create(&mut builder, message_body);
@@ -2916,7 +3054,7 @@ impl Request for DataConsumerCloseRequest {
     type HandlerId = TransportId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data = transport::CloseDataConsumerRequest::create(
             &mut builder,
@@ -2931,6 +3069,7 @@ impl Request for DataConsumerCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2953,7 +3092,7 @@ impl Request for DataConsumerDumpRequest {
     type HandlerId = DataConsumerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2962,6 +3101,7 @@ impl Request for DataConsumerDumpRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -2989,7 +3129,7 @@ impl Request for DataConsumerGetStatsRequest {
     type HandlerId = DataConsumerId;
     type Response = response::Body;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -2998,6 +3138,7 @@ impl Request for DataConsumerGetStatsRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3025,7 +3166,7 @@ impl Request for DataConsumerPauseRequest {
     type HandlerId = DataConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -3034,6 +3175,7 @@ impl Request for DataConsumerPauseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3056,7 +3198,7 @@ impl Request for DataConsumerResumeRequest {
     type HandlerId = DataConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -3065,6 +3207,7 @@ impl Request for DataConsumerResumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3092,7 +3235,7 @@ impl Request for DataConsumerGetBufferedAmountRequest {
     type HandlerId = DataConsumerId;
     type Response = DataConsumerGetBufferedAmountResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let request = request::Request::create(
@@ -3101,6 +3244,7 @@ impl Request for DataConsumerGetBufferedAmountRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3133,7 +3277,7 @@ impl Request for DataConsumerSetBufferedAmountLowThresholdRequest {
     type HandlerId = DataConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_consumer::SetBufferedAmountLowThresholdRequest::create(
@@ -3152,6 +3296,7 @@ impl Request for DataConsumerSetBufferedAmountLowThresholdRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3178,7 +3323,7 @@ impl Request for DataConsumerSendRequest {
     type HandlerId = DataConsumerId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_consumer::SendRequest::create(&mut builder, self.ppid, self.payload);
@@ -3190,6 +3335,7 @@ impl Request for DataConsumerSendRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3225,7 +3371,7 @@ impl Request for DataConsumerSetSubchannelsRequest {
     type HandlerId = DataConsumerId;
     type Response = DataConsumerSetSubchannelsResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_consumer::SetSubchannelsRequest::create(&mut builder, self.subchannels);
@@ -3238,6 +3384,7 @@ impl Request for DataConsumerSetSubchannelsRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3275,7 +3422,7 @@ impl Request for DataConsumerAddSubchannelRequest {
     type HandlerId = DataConsumerId;
     type Response = DataConsumerAddSubchannelResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_consumer::AddSubchannelRequest::create(&mut builder, self.subchannel);
@@ -3288,6 +3435,7 @@ impl Request for DataConsumerAddSubchannelRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3325,7 +3473,7 @@ impl Request for DataConsumerRemoveSubchannelRequest {
     type HandlerId = DataConsumerId;
     type Response = DataConsumerRemoveSubchannelResponse;
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data = data_consumer::RemoveSubchannelRequest::create(&mut builder, self.subchannel);
@@ -3338,6 +3486,7 @@ impl Request for DataConsumerRemoveSubchannelRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3370,7 +3519,7 @@ impl Request for RtpObserverCloseRequest {
     type HandlerId = RouterId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let data =
             router::CloseRtpObserverRequest::create(&mut builder, self.rtp_observer_id.to_string());
@@ -3383,6 +3532,7 @@ impl Request for RtpObserverCloseRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3405,7 +3555,7 @@ impl Request for RtpObserverPauseRequest {
     type HandlerId = RtpObserverId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let request = request::Request::create(
             &mut builder,
@@ -3413,6 +3563,7 @@ impl Request for RtpObserverPauseRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3435,7 +3586,7 @@ impl Request for RtpObserverResumeRequest {
     type HandlerId = RtpObserverId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
         let request = request::Request::create(
             &mut builder,
@@ -3443,6 +3594,7 @@ impl Request for RtpObserverResumeRequest {
             Self::METHOD,
             handler_id.to_string(),
             None::<request::Body>,
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3468,7 +3620,7 @@ impl Request for RtpObserverAddProducerRequest {
     type HandlerId = RtpObserverId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data =
@@ -3482,6 +3634,7 @@ impl Request for RtpObserverAddProducerRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
@@ -3507,7 +3660,7 @@ impl Request for RtpObserverRemoveProducerRequest {
     type HandlerId = RtpObserverId;
     type Response = ();
 
-    fn into_bytes(self, id: u32, handler_id: Self::HandlerId) -> Vec<u8> {
+    fn into_bytes(self, id: u32, handler_id: Self::HandlerId, handler_handle: u32) -> Vec<u8> {
         let mut builder = Builder::new();
 
         let data =
@@ -3521,6 +3674,7 @@ impl Request for RtpObserverRemoveProducerRequest {
             Self::METHOD,
             handler_id.to_string(),
             Some(request_body),
+            handler_handle,
         );
         let message_body = message::Body::create_request(&mut builder, request);
         let message = message::Message::create(&mut builder, message_body);
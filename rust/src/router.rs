@@ -134,6 +134,15 @@ pub struct PipeToRouterOptions {
     ///
     /// Default `false`.
     pub enable_srtp: bool,
+    /// Hand RTP and RTCP to the other Router's worker in-process instead of using UDP.
+    ///
+    /// Default `false`.
+    pub enable_local: bool,
+    /// Send RTP and RTCP packets through shared memory rings (when both Routers live in different
+    /// workers of this host). Cannot be used with `enable_srtp`.
+    ///
+    /// Default `false`.
+    pub enable_shm: bool,
 }
 
 impl PipeToRouterOptions {
@@ -154,6 +163,8 @@ impl PipeToRouterOptions {
             num_sctp_streams: NumSctpStreams::default(),
             enable_rtx: false,
             enable_srtp: false,
+            enable_local: false,
+            enable_shm: false,
         }
     }
 }
@@ -399,6 +410,8 @@ impl Inner {
         if !self.closed.swap(true, Ordering::SeqCst) {
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             {
                 let channel = self.channel.clone();
                 let request = RouterCloseRequest { router_id: self.id };
@@ -562,7 +575,8 @@ impl Router {
 
         let _buffer_guard = self.inner.channel.buffer_messages_for(transport_id.into());
 
-        self.inner
+        let handle = self
+            .inner
             .channel
             .request(
                 self.inner.id,
@@ -575,6 +589,8 @@ impl Router {
             )
             .await?;
 
+        self.inner.channel.set_handler_handle(transport_id, handle);
+
         let transport = DirectTransport::new(
             transport_id,
             Arc::clone(&self.inner.executor),
@@ -658,6 +674,10 @@ impl Router {
             }
         };
 
+        self.inner
+            .channel
+            .set_handler_handle(transport_id, data.handle);
+
         let transport = WebRtcTransport::new(
             transport_id,
             Arc::clone(&self.inner.executor),
@@ -727,6 +747,10 @@ impl Router {
             )
             .await?;
 
+        self.inner
+            .channel
+            .set_handler_handle(transport_id, data.handle);
+
         let transport = PipeTransport::new(
             transport_id,
             Arc::clone(&self.inner.executor),
@@ -792,6 +816,10 @@ impl Router {
             )
             .await?;
 
+        self.inner
+            .channel
+            .set_handler_handle(transport_id, data.handle);
+
         let transport = PlainTransport::new(
             transport_id,
             Arc::clone(&self.inner.executor),
@@ -1451,6 +1479,8 @@ impl Router {
             num_sctp_streams,
             enable_rtx,
             enable_srtp,
+            enable_local,
+            enable_shm,
         } = pipe_to_router_options;
 
         let remote_router_id = router.id();
@@ -1460,6 +1490,8 @@ impl Router {
             num_sctp_streams,
             enable_rtx,
             enable_srtp,
+            enable_local,
+            enable_shm,
             app_data: AppData::default(),
             ..PipeTransportOptions::new(listen_info)
         };
@@ -1477,6 +1509,8 @@ impl Router {
                 ip: tuple.local_ip(),
                 port: tuple.local_port(),
                 srtp_parameters: remote_pipe_transport.srtp_parameters(),
+                shm_name: remote_pipe_transport.shm_name(),
+                local_name: remote_pipe_transport.local_name(),
             }
         });
 
@@ -1487,6 +1521,8 @@ impl Router {
                 ip: tuple.local_ip(),
                 port: tuple.local_port(),
                 srtp_parameters: local_pipe_transport.srtp_parameters(),
+                shm_name: local_pipe_transport.shm_name(),
+                local_name: local_pipe_transport.local_name(),
             }
         });
 
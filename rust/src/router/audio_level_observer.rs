@@ -35,6 +35,10 @@ pub struct AudioLevelObserverOptions {
     /// Interval in ms for checking audio volumes.
     /// Default 1000.
     pub interval: u16,
+    /// If greater than 0, just RTP packets of the loudest `last_n` audio producers are forwarded
+    /// to their consumers (with some hysteresis so they don't flap).
+    /// Default 0 (all of them are forwarded).
+    pub last_n: u16,
     /// Custom application data.
     pub app_data: AppData,
 }
@@ -45,6 +49,7 @@ impl Default for AudioLevelObserverOptions {
             max_entries: NonZeroU16::new(1).unwrap(),
             threshold: -80,
             interval: 1000,
+            last_n: 0,
             app_data: AppData::default(),
         }
     }
@@ -340,6 +340,8 @@ impl Inner {
 
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             if close_request {
                 let channel = self.channel.clone();
                 let transport_id = self.transport.id();
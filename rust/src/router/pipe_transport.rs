@@ -57,6 +57,23 @@ pub struct PipeTransportOptions {
     /// different hosts. For this to work, connect() must be called with remote SRTP parameters.
     /// Default false.
     pub enable_srtp: bool,
+    /// Enable an in-process link with the paired `PipeTransport`. Useful if both Routers live in
+    /// workers of this process. RTP and RTCP are handed to the other worker without sockets nor
+    /// parsing. For this to work, connect() must be called with the remote local name.
+    /// Default false.
+    pub enable_local: bool,
+    /// Send RTP and RTCP packets through a shared memory ring instead of UDP. Useful if both
+    /// Routers are located in different workers of the same host. For this to work, connect() must
+    /// be called with the remote shm name. Cannot be used with `enable_srtp`. Not supported on
+    /// Windows.
+    /// Default false.
+    pub enable_shm: bool,
+    /// Coalesce RTP packets sent within the same event loop iteration into datagrams of up to this
+    /// size (in bytes, SRTP trailer included). The remote `PipeTransport` must enable it too, since
+    /// aggregated datagrams are just recognized if enabled. Must be between 1500 and 65000, or 0 to
+    /// disable it.
+    /// Default 0.
+    pub aggregation_max_size: u32,
     /// Custom application data.
     pub app_data: AppData,
 }
@@ -73,6 +90,9 @@ impl PipeTransportOptions {
             sctp_send_buffer_size: 268_435_456,
             enable_rtx: false,
             enable_srtp: false,
+            enable_local: false,
+            enable_shm: false,
+            aggregation_max_size: 0,
             app_data: AppData::default(),
         }
     }
@@ -103,6 +123,11 @@ pub struct PipeTransportDump {
     pub tuple: TransportTuple,
     pub rtx: bool,
     pub srtp_parameters: Option<SrtpParameters>,
+    pub shm_name: Option<String>,
+    pub local_name: Option<String>,
+    pub aggregation_max_size: u32,
+    pub aggregated_packets_sent: u64,
+    pub aggregated_datagrams_sent: u64,
 }
 
 impl PipeTransportDump {
@@ -176,6 +201,11 @@ impl PipeTransportDump {
             srtp_parameters: dump
                 .srtp_parameters
                 .map(|parameters| SrtpParameters::from_fbs(parameters.as_ref())),
+            shm_name: dump.shm_name,
+            local_name: dump.local_name,
+            aggregation_max_size: dump.aggregation_max_size,
+            aggregated_packets_sent: dump.aggregated_packets_sent,
+            aggregated_datagrams_sent: dump.aggregated_datagrams_sent,
         })
     }
 }
@@ -205,6 +235,8 @@ pub struct PipeTransportStat {
     pub rtx_send_bitrate: u32,
     pub probation_bytes_sent: u64,
     pub probation_send_bitrate: u32,
+    pub rtx_probation_bytes_sent: u64,
+    pub rtx_probation_send_bitrate: u32,
     #[serde(skip_serializing_if = "Option::is_none")]
     pub available_outgoing_bitrate: Option<u32>,
     #[serde(skip_serializing_if = "Option::is_none")]
@@ -218,6 +250,14 @@ pub struct PipeTransportStat {
     pub rtp_packet_loss_sent: Option<f64>,
     // PipeTransport specific.
     pub tuple: TransportTuple,
+    pub shm_packets_sent: u64,
+    pub shm_packets_received: u64,
+    pub aggregated_packets_sent: u64,
+    pub aggregated_datagrams_sent: u64,
+    pub aggregated_packets_received: u64,
+    pub aggregated_datagrams_received: u64,
+    pub local_packets_sent: u64,
+    pub local_packets_received: u64,
 }
 
 impl PipeTransportStat {
@@ -242,6 +282,8 @@ impl PipeTransportStat {
             rtx_send_bitrate: stats.base.rtx_send_bitrate,
             probation_bytes_sent: stats.base.probation_bytes_sent,
             probation_send_bitrate: stats.base.probation_send_bitrate,
+            rtx_probation_bytes_sent: stats.base.rtx_probation_bytes_sent,
+            rtx_probation_send_bitrate: stats.base.rtx_probation_send_bitrate,
             available_outgoing_bitrate: stats.base.available_outgoing_bitrate,
             available_incoming_bitrate: stats.base.available_incoming_bitrate,
             max_incoming_bitrate: stats.base.max_incoming_bitrate,
@@ -251,6 +293,14 @@ impl PipeTransportStat {
             rtp_packet_loss_sent: stats.base.rtp_packet_loss_sent,
             // PlainTransport specific.
             tuple: TransportTuple::from_fbs(stats.tuple.as_ref()),
+            shm_packets_sent: stats.shm_packets_sent,
+            shm_packets_received: stats.shm_packets_received,
+            aggregated_packets_sent: stats.aggregated_packets_sent,
+            aggregated_datagrams_sent: stats.aggregated_datagrams_sent,
+            aggregated_packets_received: stats.aggregated_packets_received,
+            aggregated_datagrams_received: stats.aggregated_datagrams_received,
+            local_packets_sent: stats.local_packets_sent,
+            local_packets_received: stats.local_packets_received,
         })
     }
 }
@@ -265,6 +315,10 @@ pub struct PipeTransportRemoteParameters {
     pub port: u16,
     /// SRTP parameters used by the paired `PipeTransport` to encrypt its RTP and RTCP.
     pub srtp_parameters: Option<SrtpParameters>,
+    /// Shared memory ring name of the paired `PipeTransport` (if it lives in this host).
+    pub shm_name: Option<String>,
+    /// Local name of the paired `PipeTransport` (if it lives in this process).
+    pub local_name: Option<String>,
 }
 
 #[derive(Default)]
@@ -357,6 +411,8 @@ impl Inner {
 
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             if close_request {
                 let channel = self.channel.clone();
                 let router_id = self.router.id();
@@ -697,6 +753,8 @@ impl PipeTransport {
                     ip: remote_parameters.ip,
                     port: remote_parameters.port,
                     srtp_parameters: remote_parameters.srtp_parameters,
+                    shm_name: remote_parameters.shm_name,
+                    local_name: remote_parameters.local_name,
                 },
             )
             .await?;
@@ -747,6 +805,20 @@ impl PipeTransport {
         self.inner.data.srtp_parameters.lock().clone()
     }
 
+    /// Name of the shared memory ring in which this transport writes RTP packets. Or `None` if not
+    /// enabled. It must be given to the paired `PipeTransport` in the `connect()` method.
+    #[must_use]
+    pub fn shm_name(&self) -> Option<String> {
+        self.inner.data.shm_name.clone()
+    }
+
+    /// Name of the in-process link of this transport. Or `None` if not enabled. It must be given
+    /// to the paired `PipeTransport` in the `connect()` method.
+    #[must_use]
+    pub fn local_name(&self) -> Option<String> {
+        self.inner.data.local_name.clone()
+    }
+
     /// Callback is called after the remote RTP origin has been discovered. Only if `comedia` mode
     /// was set.
     pub fn on_tuple<F: Fn(&TransportTuple) + Send + Sync + 'static>(
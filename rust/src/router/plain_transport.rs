@@ -230,6 +230,8 @@ pub struct PlainTransportStat {
     pub rtx_send_bitrate: u32,
     pub probation_bytes_sent: u64,
     pub probation_send_bitrate: u32,
+    pub rtx_probation_bytes_sent: u64,
+    pub rtx_probation_send_bitrate: u32,
     #[serde(skip_serializing_if = "Option::is_none")]
     pub available_outgoing_bitrate: Option<u32>,
     #[serde(skip_serializing_if = "Option::is_none")]
@@ -270,6 +272,8 @@ impl PlainTransportStat {
             rtx_send_bitrate: stats.base.rtx_send_bitrate,
             probation_bytes_sent: stats.base.probation_bytes_sent,
             probation_send_bitrate: stats.base.probation_send_bitrate,
+            rtx_probation_bytes_sent: stats.base.rtx_probation_bytes_sent,
+            rtx_probation_send_bitrate: stats.base.rtx_probation_send_bitrate,
             available_outgoing_bitrate: stats.base.available_outgoing_bitrate,
             available_incoming_bitrate: stats.base.available_incoming_bitrate,
             max_incoming_bitrate: stats.base.max_incoming_bitrate,
@@ -430,6 +434,8 @@ impl Inner {
 
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             if close_request {
                 let channel = self.channel.clone();
                 let router_id = self.router.id();
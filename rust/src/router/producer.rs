@@ -53,6 +53,10 @@ pub struct ProducerOptions {
     /// Just for video. Time (in ms) before asking the sender for a new key frame after having asked
     /// a previous one. If 0 there is no delay.
     pub key_frame_request_delay: u32,
+    /// Just for video. Whether the most recent key frame (and following frames) of each stream
+    /// must be cached so new consumers can start rendering it without requesting a new key frame
+    /// to the sender. Default false.
+    pub key_frame_cache: bool,
     /// Custom application data.
     pub app_data: AppData,
 }
@@ -71,6 +75,7 @@ impl ProducerOptions {
             rtp_parameters,
             paused: false,
             key_frame_request_delay: 0,
+            key_frame_cache: false,
             app_data: AppData::default(),
         }
     }
@@ -84,6 +89,7 @@ impl ProducerOptions {
             rtp_parameters,
             paused: false,
             key_frame_request_delay: 0,
+            key_frame_cache: false,
             app_data: AppData::default(),
         }
     }
@@ -300,6 +306,8 @@ pub struct ProducerStat {
     // RtpStreamRecv specific.
     pub jitter: u32,
     pub bitrate_by_layer: Vec<BitrateByLayer>,
+    pub key_frame_cache_hits: u64,
+    pub key_frame_cache_misses: u64,
 }
 
 impl ProducerStat {
@@ -343,6 +351,8 @@ impl ProducerStat {
                     bitrate: bitrate_by_layer.bitrate,
                 })
                 .collect(),
+            key_frame_cache_hits: stats.key_frame_cache_hits,
+            key_frame_cache_misses: stats.key_frame_cache_misses,
         }
     }
 }
@@ -597,6 +607,8 @@ impl Inner {
 
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             if close_request {
                 let channel = self.channel.clone();
                 let transport_id = self.transport.id();
@@ -497,6 +497,7 @@ pub(super) trait TransportImpl: TransportGeneric {
             mut rtp_parameters,
             paused,
             key_frame_request_delay,
+            key_frame_cache,
             app_data,
         } = producer_options;
 
@@ -557,11 +558,15 @@ pub(super) trait TransportImpl: TransportGeneric {
                     rtp_mapping,
                     key_frame_request_delay,
                     paused,
+                    key_frame_cache,
                 },
             )
             .await
             .map_err(ProduceError::Request)?;
 
+        self.channel()
+            .set_handler_handle(producer_id, response.handle);
+
         let producer_fut = Producer::new(
             producer_id,
             kind,
@@ -666,6 +671,9 @@ pub(super) trait TransportImpl: TransportGeneric {
             .await
             .map_err(ConsumeError::Request)?;
 
+        self.channel()
+            .set_handler_handle(consumer_id, response.handle);
+
         Ok(Consumer::new(
             consumer_id,
             producer,
@@ -738,6 +746,9 @@ pub(super) trait TransportImpl: TransportGeneric {
             .await
             .map_err(ProduceDataError::Request)?;
 
+        self.channel()
+            .set_handler_handle(data_producer_id, response.handle);
+
         Ok(DataProducer::new(
             data_producer_id,
             response.r#type,
@@ -837,6 +848,9 @@ pub(super) trait TransportImpl: TransportGeneric {
             .await
             .map_err(ConsumeDataError::Request)?;
 
+        self.channel()
+            .set_handler_handle(data_consumer_id, response.handle);
+
         let data_consumer = DataConsumer::new(
             data_consumer_id,
             response.r#type,
@@ -140,6 +140,10 @@ pub struct WebRtcTransportOptions {
     /// Maximum SCTP send buffer used by DataConsumers.
     /// Default 262144.
     pub sctp_send_buffer_size: u32,
+    /// Probe the available bandwidth with RTX of recently sent packets instead of padding only
+    /// packets, so probation also protects against losses.
+    /// Default false.
+    pub probe_with_rtx: bool,
     /// Custom application data.
     pub app_data: AppData,
 }
@@ -159,6 +163,7 @@ impl WebRtcTransportOptions {
             num_sctp_streams: NumSctpStreams::default(),
             max_sctp_message_size: 262_144,
             sctp_send_buffer_size: 262_144,
+            probe_with_rtx: false,
             app_data: AppData::default(),
         }
     }
@@ -176,6 +181,7 @@ impl WebRtcTransportOptions {
             num_sctp_streams: NumSctpStreams::default(),
             max_sctp_message_size: 262_144,
             sctp_send_buffer_size: 262_144,
+            probe_with_rtx: false,
             app_data: AppData::default(),
         }
     }
@@ -320,6 +326,8 @@ pub struct WebRtcTransportStat {
     pub rtx_send_bitrate: u32,
     pub probation_bytes_sent: u64,
     pub probation_send_bitrate: u32,
+    pub rtx_probation_bytes_sent: u64,
+    pub rtx_probation_send_bitrate: u32,
     #[serde(skip_serializing_if = "Option::is_none")]
     pub available_outgoing_bitrate: Option<u32>,
     #[serde(skip_serializing_if = "Option::is_none")]
@@ -361,6 +369,8 @@ impl WebRtcTransportStat {
             rtx_send_bitrate: stats.base.rtx_send_bitrate,
             probation_bytes_sent: stats.base.probation_bytes_sent,
             probation_send_bitrate: stats.base.probation_send_bitrate,
+            rtx_probation_bytes_sent: stats.base.rtx_probation_bytes_sent,
+            rtx_probation_send_bitrate: stats.base.rtx_probation_send_bitrate,
             available_outgoing_bitrate: stats.base.available_outgoing_bitrate,
             available_incoming_bitrate: stats.base.available_incoming_bitrate,
             max_incoming_bitrate: stats.base.max_incoming_bitrate,
@@ -536,6 +546,8 @@ impl Inner {
 
             self.handlers.close.call_simple();
 
+            self.channel.remove_handler_handle(self.id);
+
             if close_request {
                 let channel = self.channel.clone();
                 let router_id = self.router.id();
@@ -989,6 +989,7 @@ impl RtpParameters {
                         Some(encoding.scalability_mode.as_str().to_string())
                     },
                     max_bitrate: encoding.max_bitrate,
+                    fec: None,
                 })
                 .collect(),
             rtcp: Box::new(rtp_parameters::RtcpParameters {
@@ -1305,6 +1306,7 @@ impl RtpEncodingParameters {
                 Some(self.scalability_mode.as_str().to_string())
             },
             max_bitrate: self.max_bitrate,
+            fec: None,
         }
     }
 
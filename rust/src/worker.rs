@@ -19,7 +19,7 @@ use crate::worker_manager::WorkerManager;
 use crate::{ortc, uuid_based_wrapper_type};
 use async_executor::Executor;
 pub(crate) use channel::{Channel, NotificationError, NotificationParseError};
-pub(crate) use common::{SubscriptionHandler, SubscriptionTarget};
+pub(crate) use common::{HandlerKey, SubscriptionHandler, SubscriptionTarget};
 use event_listener_primitives::{Bag, BagOnce, HandlerId};
 use futures_lite::FutureExt;
 use log::{debug, error, warn};
@@ -192,6 +192,13 @@ pub struct WorkerSettings {
     /// "WebRTC-Bwe-AlrLimitedBackoff/Enabled/".
     #[doc(hidden)]
     pub libwebrtc_field_trials: Option<String>,
+    /// Number of threads that SRTP protect and send RTP and RTCP packets of WebRTC transports
+    /// over UDP. Default 0 (everything runs in the worker thread).
+    pub send_threads: u8,
+    /// Number of bound UDP sockets the worker keeps ready for every listen IP, so creating
+    /// transports (i.e. when many peers join at once) does not have to search for a free port.
+    /// Must be between 0 and 1024. Default 0 (sockets are bound on demand).
+    pub udp_socket_pool_size: u16,
     /// Function that will be called under worker thread before worker starts, can be used for
     /// pinning worker threads to CPU cores.
     pub thread_initializer: Option<Arc<dyn Fn() + Send + Sync>>,
@@ -221,6 +228,8 @@ impl Default for WorkerSettings {
             rtc_ports_range: 10000..=59999,
             dtls_files: None,
             libwebrtc_field_trials: None,
+            send_threads: 0,
+            udp_socket_pool_size: 0,
             thread_initializer: None,
             app_data: AppData::default(),
         }
@@ -235,6 +244,8 @@ impl fmt::Debug for WorkerSettings {
             rtc_ports_range,
             dtls_files,
             libwebrtc_field_trials,
+            send_threads,
+            udp_socket_pool_size,
             thread_initializer,
             app_data,
         } = self;
@@ -245,6 +256,8 @@ impl fmt::Debug for WorkerSettings {
             .field("rtc_ports_range", &rtc_ports_range)
             .field("dtls_files", &dtls_files)
             .field("libwebrtc_field_trials", &libwebrtc_field_trials)
+            .field("send_threads", &send_threads)
+            .field("udp_socket_pool_size", &udp_socket_pool_size)
             .field(
                 "thread_initializer",
                 &thread_initializer.as_ref().map(|_| "ThreadInitializer"),
@@ -286,6 +299,32 @@ pub struct LibUringDump {
     pub user_data_miss_count: u64,
 }
 
+#[derive(Debug, Clone, Deserialize, Serialize, Eq, PartialEq)]
+#[serde(rename_all = "camelCase")]
+#[doc(hidden)]
+pub struct UsrSctpDump {
+    pub timer_wakeups: u64,
+    pub timer_idle_stops: u64,
+}
+
+#[derive(Debug, Clone, Deserialize, Serialize, Eq, PartialEq)]
+#[serde(rename_all = "camelCase")]
+#[doc(hidden)]
+pub struct UdpSocketPoolDump {
+    pub size: u32,
+    pub available: u32,
+    pub hits: u64,
+    pub misses: u64,
+}
+
+#[derive(Debug, Clone, Deserialize, Serialize, Eq, PartialEq)]
+#[serde(rename_all = "camelCase")]
+#[doc(hidden)]
+pub struct SendOffloadPoolDump {
+    pub num_threads: u32,
+    pub send_fallbacks: u64,
+}
+
 #[derive(Debug, Clone, Deserialize, Serialize)]
 #[serde(rename_all = "camelCase")]
 #[doc(hidden)]
@@ -297,6 +336,9 @@ pub struct WorkerDump {
     pub webrtc_server_ids: Vec<WebRtcServerId>,
     pub channel_message_handlers: ChannelMessageHandlers,
     pub liburing: Option<LibUringDump>,
+    pub usrsctp: Option<UsrSctpDump>,
+    pub udp_socket_pool: Option<UdpSocketPoolDump>,
+    pub send_offload_pool: Option<SendOffloadPoolDump>,
 }
 
 /// Error that caused [`Worker::create_webrtc_server`] to fail.
@@ -356,6 +398,8 @@ impl Inner {
             rtc_ports_range,
             dtls_files,
             libwebrtc_field_trials,
+            send_threads,
+            udp_socket_pool_size,
             thread_initializer,
             app_data,
         }: WorkerSettings,
@@ -404,6 +448,20 @@ impl Inner {
             ));
         }
 
+        if send_threads > 0 {
+            spawn_args.push(format!("--sendThreads={send_threads}"));
+        }
+
+        if udp_socket_pool_size > 1024 {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidInput,
+                "Invalid UDP socket pool size",
+            ));
+        }
+        if udp_socket_pool_size > 0 {
+            spawn_args.push(format!("--udpSocketPoolSize={udp_socket_pool_size}"));
+        }
+
         let id = WorkerId::new();
         debug!(
             "spawning worker with arguments [id:{}]: {}",
@@ -719,12 +777,17 @@ impl Worker {
 
         let _buffer_guard = self.inner.channel.buffer_messages_for(router_id.into());
 
-        self.inner
+        let response = self
+            .inner
             .channel
             .request("", WorkerCreateRouterRequest { router_id })
             .await
             .map_err(CreateRouterError::Request)?;
 
+        self.inner
+            .channel
+            .set_handler_handle(router_id, response.handle);
+
         let router = Router::new(
             router_id,
             Arc::clone(&self.inner.executor),
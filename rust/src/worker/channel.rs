@@ -1,5 +1,5 @@
 use crate::messages::{Notification, Request};
-use crate::worker::common::{EventHandlers, SubscriptionTarget, WeakEventHandlers};
+use crate::worker::common::{EventHandlers, HandlerKey, SubscriptionTarget, WeakEventHandlers};
 use crate::worker::utils;
 use crate::worker::utils::{PreparedChannelRead, PreparedChannelWrite};
 use crate::worker::{RequestError, SubscriptionHandler};
@@ -9,7 +9,7 @@ use log::{debug, error, trace, warn};
 use lru::LruCache;
 use mediasoup_sys::fbs::{message, notification, request, response};
 use mediasoup_sys::UvAsyncT;
-use parking_lot::Mutex;
+use parking_lot::{Mutex, RwLock};
 use planus::ReadAsRoot;
 use serde::Deserialize;
 use std::collections::VecDeque;
@@ -184,6 +184,8 @@ struct Inner {
         WeakEventHandlers<Arc<dyn Fn(notification::NotificationRef<'_>) + Send + Sync + 'static>>,
     worker_closed: Arc<AtomicBool>,
     closed: AtomicBool,
+    /// Compact handles assigned by the worker to entities, indexed by entity id.
+    handler_handles: RwLock<HashedMap<Uuid, u32>>,
 }
 
 impl Drop for Inner {
@@ -318,6 +320,7 @@ impl Channel {
             event_handlers_weak,
             worker_closed,
             closed: AtomicBool::new(false),
+            handler_handles: RwLock::default(),
         });
 
         (
@@ -347,6 +350,45 @@ impl Channel {
         }
     }
 
+    /// Store the compact handle the worker assigned to the given entity so requests and
+    /// notifications addressed to it carry it and the worker can resolve the target entity
+    /// without looking up its id.
+    pub(crate) fn set_handler_handle<HandlerId: Into<Uuid>>(
+        &self,
+        handler_id: HandlerId,
+        handle: u32,
+    ) {
+        // 0 means that the worker did not assign a handle.
+        if handle != 0 {
+            self.inner
+                .handler_handles
+                .write()
+                .insert(handler_id.into(), handle);
+        }
+    }
+
+    /// Forget the handle of the given entity once it is closed.
+    pub(crate) fn remove_handler_handle<HandlerId: Into<Uuid>>(&self, handler_id: HandlerId) {
+        self.inner
+            .handler_handles
+            .write()
+            .remove(&handler_id.into());
+    }
+
+    fn get_handler_handle<HandlerId: HandlerKey>(&self, handler_id: &HandlerId) -> u32 {
+        // Requests addressed to the worker itself carry no handle.
+        let Some(key) = handler_id.handler_key() else {
+            return 0;
+        };
+
+        self.inner
+            .handler_handles
+            .read()
+            .get(&key)
+            .copied()
+            .unwrap_or(0)
+    }
+
     pub(crate) async fn request<R, HandlerId>(
         &self,
         handler_id: HandlerId,
@@ -354,7 +396,7 @@ impl Channel {
     ) -> Result<R::Response, RequestError>
     where
         R: Request<HandlerId = HandlerId> + 'static,
-        HandlerId: Display,
+        HandlerId: Display + HandlerKey,
     {
         let id;
         let (result_sender, result_receiver) = async_oneshot::oneshot();
@@ -376,7 +418,8 @@ impl Channel {
 
         debug!("request() [method:{:?}, id:{}]", R::METHOD, id);
 
-        let data = request.into_bytes(id, handler_id);
+        let handler_handle = self.get_handler_handle(&handler_id);
+        let data = request.into_bytes(id, handler_id, handler_handle);
 
         let buffer = Arc::new(AtomicTake::new(data));
 
@@ -472,11 +515,12 @@ impl Channel {
     ) -> Result<(), NotificationError>
     where
         N: Notification<HandlerId = HandlerId>,
-        HandlerId: Display,
+        HandlerId: Display + HandlerKey,
     {
         debug!("notify() [{notification:?}]");
 
-        let data = notification.into_bytes(handler_id);
+        let handler_handle = self.get_handler_handle(&handler_id);
+        let data = notification.into_bytes(handler_id, handler_handle);
 
         let message = Arc::new(AtomicTake::new(data));
 
@@ -108,6 +108,18 @@ impl<F> WeakEventHandlers<F> {
     }
 }
 
+/// Key under which the channel caches the compact handle the worker assigned to an entity.
+pub(crate) trait HandlerKey {
+    /// Entities are keyed by their UUID, `None` for targets that never get a handle.
+    fn handler_key(&self) -> Option<Uuid>;
+}
+
+impl HandlerKey for &'static str {
+    fn handler_key(&self) -> Option<Uuid> {
+        None
+    }
+}
+
 #[derive(Debug, Clone, Eq, PartialEq, Hash, Deserialize)]
 #[serde(untagged)]
 pub(crate) enum SubscriptionTarget {
@@ -797,6 +797,8 @@ fn create_with_enable_srtp_succeeds() {
                     ip: "127.0.0.2".parse().unwrap(),
                     port: 9999,
                     srtp_parameters: None,
+                    shm_name: None,
+                    local_name: None,
                 })
                 .await,
             Err(RequestError::Response { .. }),
@@ -812,6 +814,8 @@ fn create_with_enable_srtp_succeeds() {
                     key_base64: "YTdjcDBvY2JoMGY5YXNlNDc0eDJsdGgwaWRvNnJsamRrdG16aWVpZHphdHo="
                         .to_string(),
                 }),
+                shm_name: None,
+                local_name: None,
             })
             .await
             .expect("Failed to establish Pipe transport connection");
@@ -846,6 +850,8 @@ fn create_with_invalid_srtp_parameters_fails() {
                         key_base64: "YTdjcDBvY2JoMGY5YXNlNDc0eDJsdGgwaWRvNnJsamRrdG16aWVpZHphdHo="
                             .to_string(),
                     }),
+                    shm_name: None,
+                    local_name: None,
                 })
                 .await,
             Err(RequestError::Response { .. }),
@@ -853,6 +859,158 @@ fn create_with_invalid_srtp_parameters_fails() {
     });
 }
 
+#[test]
+fn create_with_enable_local_succeeds() {
+    future::block_on(async move {
+        let (_worker1, _worker2, router1, router2, _transport1, _transport2) = init().await;
+
+        let listen_info = ListenInfo {
+            protocol: Protocol::Udp,
+            ip: IpAddr::V4(Ipv4Addr::LOCALHOST),
+            announced_ip: None,
+            port: None,
+            send_buffer_size: None,
+            recv_buffer_size: None,
+        };
+
+        let pipe_transport1 = router1
+            .create_pipe_transport({
+                let mut options = PipeTransportOptions::new(listen_info);
+                options.enable_local = true;
+
+                options
+            })
+            .await
+            .expect("Failed to create Pipe transport");
+
+        let pipe_transport2 = router2
+            .create_pipe_transport({
+                let mut options = PipeTransportOptions::new(listen_info);
+                options.enable_local = true;
+
+                options
+            })
+            .await
+            .expect("Failed to create Pipe transport");
+
+        assert!(pipe_transport1.local_name().is_some());
+        assert!(pipe_transport2.local_name().is_some());
+        assert_ne!(pipe_transport1.local_name(), pipe_transport2.local_name());
+
+        // Unknown local name must fail.
+        assert!(matches!(
+            pipe_transport1
+                .connect(PipeTransportRemoteParameters {
+                    ip: "127.0.0.1".parse().unwrap(),
+                    port: pipe_transport2.tuple().local_port(),
+                    srtp_parameters: None,
+                    shm_name: None,
+                    local_name: Some("foo".to_string()),
+                })
+                .await,
+            Err(RequestError::Response { .. }),
+        ));
+
+        pipe_transport1
+            .connect(PipeTransportRemoteParameters {
+                ip: "127.0.0.1".parse().unwrap(),
+                port: pipe_transport2.tuple().local_port(),
+                srtp_parameters: None,
+                shm_name: None,
+                local_name: pipe_transport2.local_name(),
+            })
+            .await
+            .expect("Failed to establish Pipe transport connection");
+    });
+}
+
+#[cfg(not(windows))]
+#[test]
+fn create_with_enable_shm_succeeds() {
+    future::block_on(async move {
+        let (_worker1, _worker2, router1, router2, _transport1, _transport2) = init().await;
+
+        let listen_info = ListenInfo {
+            protocol: Protocol::Udp,
+            ip: IpAddr::V4(Ipv4Addr::LOCALHOST),
+            announced_ip: None,
+            port: None,
+            send_buffer_size: None,
+            recv_buffer_size: None,
+        };
+
+        let pipe_transport1 = router1
+            .create_pipe_transport({
+                let mut options = PipeTransportOptions::new(listen_info);
+                options.enable_shm = true;
+                options.aggregation_max_size = 9000;
+
+                options
+            })
+            .await
+            .expect("Failed to create Pipe transport");
+
+        let pipe_transport2 = router2
+            .create_pipe_transport({
+                let mut options = PipeTransportOptions::new(listen_info);
+                options.enable_shm = true;
+
+                options
+            })
+            .await
+            .expect("Failed to create Pipe transport");
+
+        assert!(pipe_transport1.shm_name().is_some());
+        assert!(pipe_transport2.shm_name().is_some());
+        assert_ne!(pipe_transport1.shm_name(), pipe_transport2.shm_name());
+
+        pipe_transport1
+            .connect(PipeTransportRemoteParameters {
+                ip: "127.0.0.1".parse().unwrap(),
+                port: pipe_transport2.tuple().local_port(),
+                srtp_parameters: None,
+                shm_name: pipe_transport2.shm_name(),
+                local_name: None,
+            })
+            .await
+            .expect("Failed to establish Pipe transport connection");
+
+        let dump = pipe_transport1
+            .dump()
+            .await
+            .expect("Failed to dump Pipe transport");
+
+        assert_eq!(dump.shm_name, pipe_transport1.shm_name());
+    });
+}
+
+#[cfg(not(windows))]
+#[test]
+fn create_with_enable_shm_and_enable_srtp_fails() {
+    future::block_on(async move {
+        let (_worker1, _worker2, router1, _router2, _transport1, _transport2) = init().await;
+
+        let result = router1
+            .create_pipe_transport({
+                let mut options = PipeTransportOptions::new(ListenInfo {
+                    protocol: Protocol::Udp,
+                    ip: IpAddr::V4(Ipv4Addr::LOCALHOST),
+                    announced_ip: None,
+                    port: None,
+                    send_buffer_size: None,
+                    recv_buffer_size: None,
+                });
+                options.enable_shm = true;
+                options.enable_srtp = true;
+
+                options
+            })
+            .await;
+
+        assert!(matches!(result, Err(RequestError::Response { .. })));
+    });
+}
+
 #[test]
 fn consume_for_pipe_producer_succeeds() {
     future::block_on(async move {
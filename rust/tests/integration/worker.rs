@@ -105,6 +105,20 @@ fn create_worker_wrong_settings() {
 
             assert!(matches!(worker_result, Err(io::Error { .. })));
         }
+
+        {
+            let worker_result = worker_manager
+                .create_worker({
+                    let mut settings = WorkerSettings::default();
+
+                    settings.udp_socket_pool_size = 1025;
+
+                    settings
+                })
+                .await;
+
+            assert!(matches!(worker_result, Err(io::Error { .. })));
+        }
     });
 }
 
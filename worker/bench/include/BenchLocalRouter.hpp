@@ -0,0 +1,95 @@
+#ifndef MS_BENCH_LOCAL_ROUTER_HPP
+#define MS_BENCH_LOCAL_ROUTER_HPP
+
+#include "common.hpp"
+#include "Channel/ChannelSocket.hpp"
+#include "RTC/Router.hpp"
+#include "RTC/Shared.hpp"
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+	/**
+	 * A Router driven in process through the same Channel code paths used by
+	 * Node, without Worker nor sockets. Notifications and responses emitted by
+	 * the worker are consumed by a write callback that just counts them.
+	 */
+	class LocalRouter : public Channel::ChannelSocket::Listener, public ::RTC::Router::Listener
+	{
+	public:
+		// Notification serialized once so it can be delivered many times. The
+		// payload bytes can be modified in place between deliveries.
+		struct Notification
+		{
+			std::vector<uint8_t> buffer;
+			uint8_t* data{ nullptr };
+			size_t len{ 0u };
+		};
+
+	public:
+		explicit LocalRouter(const std::string& routerId);
+		~LocalRouter() override;
+
+	public:
+		flatbuffers::FlatBufferBuilder& GetBufferBuilder()
+		{
+			return this->bufferBuilder;
+		}
+		// Sends the request whose body has been built into the buffer builder and
+		// throws if the worker rejects it.
+		void Request(
+		  FBS::Request::Method method,
+		  const std::string& handlerId,
+		  FBS::Request::Body bodyType,
+		  flatbuffers::Offset<void> body);
+		Notification CreateProducerSendNotification(
+		  const std::string& producerId, const uint8_t* data, size_t len);
+		Notification CreateTransportSendRtcpNotification(
+		  const std::string& transportId, const uint8_t* data, size_t len);
+		void Notify(Notification& notification);
+		uint64_t GetConsumerRtpCount() const
+		{
+			return this->consumerRtpCount;
+		}
+
+	private:
+		static void OnChannelWrite(const uint8_t* message, uint32_t messageLen, ChannelWriteCtx ctx);
+		Notification CreateNotification(
+		  FBS::Notification::Event event,
+		  const std::string& handlerId,
+		  FBS::Notification::Body bodyType,
+		  flatbuffers::Offset<void> body);
+
+		/* Pure virtual methods inherited from Channel::ChannelSocket::RequestHandler. */
+	public:
+		void HandleRequest(Channel::ChannelRequest* request) override;
+
+		/* Pure virtual methods inherited from Channel::ChannelSocket::NotificationHandler. */
+	public:
+		void HandleNotification(Channel::ChannelNotification* notification) override;
+
+		/* Pure virtual methods inherited from Channel::ChannelSocket::Listener. */
+	public:
+		void OnChannelClosed(Channel::ChannelSocket* channel) override;
+
+		/* Pure virtual methods inherited from RTC::Router::Listener. */
+	public:
+		::RTC::WebRtcServer* OnRouterNeedWebRtcServer(
+		  ::RTC::Router* router, std::string& webRtcServerId) override;
+
+	private:
+		// Allocated by this.
+		Channel::ChannelSocket* channel{ nullptr };
+		::RTC::Shared* shared{ nullptr };
+		::RTC::Router* router{ nullptr };
+		// Others.
+		flatbuffers::FlatBufferBuilder bufferBuilder{};
+		uint32_t nextRequestId{ 0u };
+		bool lastResponseAccepted{ false };
+		std::string lastResponseReason;
+		uint64_t consumerRtpCount{ 0u };
+	};
+} // namespace Bench
+
+#endif
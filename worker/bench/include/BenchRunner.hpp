@@ -0,0 +1,123 @@
+#ifndef MS_BENCH_RUNNER_HPP
+#define MS_BENCH_RUNNER_HPP
+
+#include "common.hpp"
+#include <algorithm> // std::min(), std::max()
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+	// Number of operator new calls so far (operator new is replaced by the
+	// benchmark binary to count them).
+	uint64_t GetAllocationCount();
+
+	class Runner
+	{
+	private:
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		struct Result
+		{
+			std::string name;
+			uint64_t operations{ 0u };
+			double nsPerOperation{ 0 };
+			double operationsPerSecond{ 0 };
+			double allocationsPerOperation{ 0 };
+			double p50BatchAvgNs{ 0 };
+			double p99BatchAvgNs{ 0 };
+		};
+
+	private:
+		// Batches are timed instead of single operations so the clock does not
+		// dominate the cost of cheap ones.
+		static constexpr uint64_t MinBatchNs{ 2000u };
+		static constexpr size_t MaxBatchSize{ 1024u };
+		static constexpr size_t MinBatches{ 100u };
+		static constexpr size_t MaxBatches{ 1u << 20 };
+
+	public:
+		Runner(std::string filter, uint64_t minTimeMs);
+
+	public:
+		bool IsEnabled(const std::string& name) const;
+		// Runs the given operation repeatedly for at least the minimum time and
+		// records its cost. Nothing is done if the name does not match the filter.
+		template<typename Operation>
+		void Run(const std::string& name, Operation&& operation)
+		{
+			if (!IsEnabled(name))
+			{
+				return;
+			}
+
+			// Warm up and estimate the cost of an operation.
+			uint64_t warmUpOperations{ 0u };
+			const auto warmUpStartedAt = Clock::now();
+			uint64_t warmUpNs{ 0u };
+
+			do
+			{
+				operation();
+
+				++warmUpOperations;
+				warmUpNs = GetNs(warmUpStartedAt, Clock::now());
+			} while (warmUpNs < this->minTimeNs / 10u);
+
+			size_t batchSize = MinBatchNs * warmUpOperations / (warmUpNs + 1u);
+
+			batchSize = std::min(std::max(batchSize, size_t{ 1u }), MaxBatchSize);
+
+			// Reserved upfront so the measurement loop does not allocate.
+			this->batchesNs.clear();
+			this->batchesNs.reserve(MaxBatches);
+
+			const uint64_t allocationCount = GetAllocationCount();
+			const auto startedAt           = Clock::now();
+			uint64_t elapsedNs{ 0u };
+
+			while (
+			  (elapsedNs < this->minTimeNs || this->batchesNs.size() < MinBatches) &&
+			  this->batchesNs.size() < MaxBatches)
+			{
+				const auto batchStartedAt = Clock::now();
+
+				for (size_t idx{ 0u }; idx < batchSize; ++idx)
+				{
+					operation();
+				}
+
+				const auto batchEndedAt = Clock::now();
+
+				this->batchesNs.push_back(GetNs(batchStartedAt, batchEndedAt));
+
+				elapsedNs = GetNs(startedAt, batchEndedAt);
+			}
+
+			AddResult(name, batchSize, GetAllocationCount() - allocationCount);
+		}
+		const std::vector<Result>& GetResults() const
+		{
+			return this->results;
+		}
+		void PrintJson(std::ostream& os) const;
+
+	private:
+		static uint64_t GetNs(Clock::time_point from, Clock::time_point to)
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+		}
+		void AddResult(const std::string& name, size_t batchSize, uint64_t allocations);
+
+	private:
+		std::string filter;
+		uint64_t minTimeNs{ 0u };
+		std::vector<uint64_t> batchesNs;
+		std::vector<Result> results;
+	};
+} // namespace Bench
+
+#endif
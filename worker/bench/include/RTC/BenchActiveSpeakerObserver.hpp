@@ -0,0 +1,18 @@
+#ifndef MS_BENCH_RTC_ACTIVE_SPEAKER_OBSERVER_HPP
+#define MS_BENCH_RTC_ACTIVE_SPEAKER_OBSERVER_HPP
+
+#include "common.hpp"
+#include "BenchRunner.hpp"
+
+namespace Bench
+{
+	namespace RTC
+	{
+		namespace ActiveSpeakerObserver
+		{
+			void Run(Bench::Runner& runner);
+		}
+	} // namespace RTC
+} // namespace Bench
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef MS_BENCH_RTC_CPU_TIME_COUNTER_HPP
+#define MS_BENCH_RTC_CPU_TIME_COUNTER_HPP
+
+#include "common.hpp"
+#include "BenchRunner.hpp"
+
+namespace Bench
+{
+	namespace RTC
+	{
+		namespace CpuTimeCounter
+		{
+			void Run(Bench::Runner& runner);
+		}
+	} // namespace RTC
+} // namespace Bench
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef MS_BENCH_RTC_SEQ_MANAGER_HPP
+#define MS_BENCH_RTC_SEQ_MANAGER_HPP
+
+#include "common.hpp"
+#include "BenchRunner.hpp"
+
+namespace Bench
+{
+	namespace RTC
+	{
+		namespace SeqManager
+		{
+			void Run(Bench::Runner& runner);
+		}
+	} // namespace RTC
+} // namespace Bench
+
+#endif
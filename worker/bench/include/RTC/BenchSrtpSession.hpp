@@ -0,0 +1,18 @@
+#ifndef MS_BENCH_RTC_SRTP_SESSION_HPP
+#define MS_BENCH_RTC_SRTP_SESSION_HPP
+
+#include "common.hpp"
+#include "BenchRunner.hpp"
+
+namespace Bench
+{
+	namespace RTC
+	{
+		namespace SrtpSession
+		{
+			void Run(Bench::Runner& runner);
+		}
+	} // namespace RTC
+} // namespace Bench
+
+#endif
@@ -0,0 +1,286 @@
+#define MS_CLASS "Bench::LocalRouter"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "BenchLocalRouter.hpp"
+#include "ChannelMessageRegistrator.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Channel/ChannelNotifier.hpp"
+
+namespace Bench
+{
+	/* Static methods for Channel callbacks. */
+
+	static ChannelReadFreeFn onChannelRead(
+	  uint8_t** /*message*/,
+	  uint32_t* /*messageLen*/,
+	  size_t* /*messageCtx*/,
+	  const void* /*handle*/,
+	  ChannelReadCtx /*ctx*/)
+	{
+		// Nothing is ever read since messages are delivered by calling the
+		// ChannelSocket directly.
+		return nullptr;
+	}
+
+	/* Class methods. */
+
+	void LocalRouter::OnChannelWrite(
+	  const uint8_t* message, uint32_t /*messageLen*/, ChannelWriteCtx ctx)
+	{
+		auto* localRouter = static_cast<LocalRouter*>(ctx);
+		const auto* msg   = FBS::Message::GetSizePrefixedMessage(message);
+
+		switch (msg->data_type())
+		{
+			case FBS::Message::Body::Response:
+			{
+				const auto* response = msg->data_as<FBS::Response::Response>();
+
+				localRouter->lastResponseAccepted = response->accepted();
+
+				if (!response->accepted() && response->reason())
+				{
+					localRouter->lastResponseReason = response->reason()->str();
+				}
+
+				break;
+			}
+
+			case FBS::Message::Body::Notification:
+			{
+				const auto* notification = msg->data_as<FBS::Notification::Notification>();
+
+				if (notification->event() == FBS::Notification::Event::CONSUMER_RTP)
+				{
+					++localRouter->consumerRtpCount;
+				}
+
+				break;
+			}
+
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	/* Instance methods. */
+
+	LocalRouter::LocalRouter(const std::string& routerId)
+	{
+		MS_TRACE();
+
+		this->channel = new Channel::ChannelSocket(
+		  onChannelRead, nullptr, LocalRouter::OnChannelWrite, static_cast<ChannelWriteCtx>(this));
+
+		this->channel->SetListener(this);
+
+		this->shared = new RTC::Shared(
+		  new ChannelMessageRegistrator(), new Channel::ChannelNotifier(this->channel));
+
+		this->router = new RTC::Router(this->shared, routerId, this);
+	}
+
+	LocalRouter::~LocalRouter()
+	{
+		MS_TRACE();
+
+		delete this->router;
+		delete this->shared;
+
+		this->channel->Close();
+
+		delete this->channel;
+	}
+
+	void LocalRouter::Request(
+	  FBS::Request::Method method,
+	  const std::string& handlerId,
+	  FBS::Request::Body bodyType,
+	  flatbuffers::Offset<void> body)
+	{
+		MS_TRACE();
+
+		auto& builder     = this->bufferBuilder;
+		const auto handle = this->shared->channelMessageRegistrator->GetHandle(handlerId);
+
+		auto request = FBS::Request::CreateRequestDirect(
+		  builder, ++this->nextRequestId, method, handlerId.c_str(), bodyType, body, handle);
+		auto message =
+		  FBS::Message::CreateMessage(builder, FBS::Message::Body::Request, request.Union());
+
+		builder.Finish(message);
+
+		this->lastResponseAccepted = false;
+		this->lastResponseReason.clear();
+
+		this->channel->OnConsumerSocketMessage(
+		  nullptr, reinterpret_cast<char*>(builder.GetBufferPointer()), builder.GetSize());
+
+		builder.Reset();
+
+		if (!this->lastResponseAccepted)
+		{
+			MS_THROW_ERROR(
+			  "request %s rejected: %s",
+			  Channel::ChannelRequest::method2String[method],
+			  this->lastResponseReason.c_str());
+		}
+	}
+
+	LocalRouter::Notification LocalRouter::CreateProducerSendNotification(
+	  const std::string& producerId, const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		auto& builder = this->bufferBuilder;
+		auto body     = FBS::Producer::CreateSendNotification(builder, builder.CreateVector(data, len));
+
+		return CreateNotification(
+		  FBS::Notification::Event::PRODUCER_SEND,
+		  producerId,
+		  FBS::Notification::Body::Producer_SendNotification,
+		  body.Union());
+	}
+
+	LocalRouter::Notification LocalRouter::CreateTransportSendRtcpNotification(
+	  const std::string& transportId, const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		auto& builder = this->bufferBuilder;
+		auto body =
+		  FBS::Transport::CreateSendRtcpNotification(builder, builder.CreateVector(data, len));
+
+		return CreateNotification(
+		  FBS::Notification::Event::TRANSPORT_SEND_RTCP,
+		  transportId,
+		  FBS::Notification::Body::Transport_SendRtcpNotification,
+		  body.Union());
+	}
+
+	void LocalRouter::Notify(Notification& notification)
+	{
+		MS_TRACE();
+
+		this->channel->OnConsumerSocketMessage(
+		  nullptr, reinterpret_cast<char*>(notification.buffer.data()), notification.buffer.size());
+	}
+
+	LocalRouter::Notification LocalRouter::CreateNotification(
+	  FBS::Notification::Event event,
+	  const std::string& handlerId,
+	  FBS::Notification::Body bodyType,
+	  flatbuffers::Offset<void> body)
+	{
+		MS_TRACE();
+
+		auto& builder     = this->bufferBuilder;
+		const auto handle = this->shared->channelMessageRegistrator->GetHandle(handlerId);
+
+		auto notification = FBS::Notification::CreateNotificationDirect(
+		  builder, handlerId.c_str(), event, bodyType, body, handle);
+		auto message = FBS::Message::CreateMessage(
+		  builder, FBS::Message::Body::Notification, notification.Union());
+
+		builder.Finish(message);
+
+		Notification result;
+
+		result.buffer.assign(
+		  builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+		builder.Reset();
+
+		// Locate the payload bytes within the serialized message.
+		const auto* parsed =
+		  FBS::Message::GetMessage(result.buffer.data())->data_as<FBS::Notification::Notification>();
+		const flatbuffers::Vector<uint8_t>* data{ nullptr };
+
+		if (bodyType == FBS::Notification::Body::Producer_SendNotification)
+		{
+			data = parsed->body_as<FBS::Producer::SendNotification>()->data();
+		}
+		else
+		{
+			data = parsed->body_as<FBS::Transport::SendRtcpNotification>()->data();
+		}
+
+		result.data = const_cast<uint8_t*>(data->data());
+		result.len  = data->size();
+
+		return result;
+	}
+
+	void LocalRouter::HandleRequest(Channel::ChannelRequest* request)
+	{
+		MS_TRACE();
+
+		// Same as the default branch of Worker::HandleRequest().
+		Channel::ChannelSocket::RequestHandler* handler{ nullptr };
+
+		if (request->handlerHandle != ChannelMessageRegistrator::NoHandle)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelRequestHandler(
+			  request->handlerHandle,
+			  std::string_view(request->handlerId->c_str(), request->handlerId->size()));
+		}
+
+		if (handler == nullptr)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelRequestHandler(
+			  request->handlerId->str());
+		}
+
+		if (handler == nullptr)
+		{
+			MS_THROW_ERROR("Channel request handler with ID %s not found", request->handlerId->c_str());
+		}
+
+		handler->HandleRequest(request);
+	}
+
+	void LocalRouter::HandleNotification(Channel::ChannelNotification* notification)
+	{
+		MS_TRACE();
+
+		// Same as Worker::HandleNotification().
+		Channel::ChannelSocket::NotificationHandler* handler{ nullptr };
+
+		if (notification->handlerHandle != ChannelMessageRegistrator::NoHandle)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelNotificationHandler(
+			  notification->handlerHandle,
+			  std::string_view(notification->handlerId->c_str(), notification->handlerId->size()));
+		}
+
+		if (handler == nullptr)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelNotificationHandler(
+			  notification->handlerId->str());
+		}
+
+		if (handler == nullptr)
+		{
+			MS_THROW_ERROR(
+			  "Channel notification handler with ID %s not found", notification->handlerId->c_str());
+		}
+
+		handler->HandleNotification(notification);
+	}
+
+	void LocalRouter::OnChannelClosed(Channel::ChannelSocket* /*channel*/)
+	{
+		MS_TRACE();
+	}
+
+	RTC::WebRtcServer* LocalRouter::OnRouterNeedWebRtcServer(
+	  RTC::Router* /*router*/, std::string& /*webRtcServerId*/)
+	{
+		MS_TRACE();
+
+		return nullptr;
+	}
+} // namespace Bench
@@ -0,0 +1,115 @@
+#include "BenchRunner.hpp"
+#include <algorithm> // std::sort()
+#include <atomic>
+#include <cstdlib> // std::malloc(), std::free()
+#include <new>
+
+/* Allocation counting. */
+
+static std::atomic<uint64_t> AllocationCount{ 0u };
+
+// NOTE: The default implementations of the array and nothrow forms call these
+// ones, so replacing them is enough to count all non aligned allocations.
+void* operator new(std::size_t size)
+{
+	AllocationCount.fetch_add(1u, std::memory_order_relaxed);
+
+	void* ptr = std::malloc(size != 0u ? size : 1u);
+
+	if (!ptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+namespace Bench
+{
+	uint64_t GetAllocationCount()
+	{
+		return AllocationCount.load(std::memory_order_relaxed);
+	}
+
+	/* Instance methods. */
+
+	Runner::Runner(std::string filter, uint64_t minTimeMs)
+	  : filter(std::move(filter)), minTimeNs(minTimeMs * 1000000u)
+	{
+	}
+
+	bool Runner::IsEnabled(const std::string& name) const
+	{
+		return this->filter.empty() || name.find(this->filter) != std::string::npos;
+	}
+
+	void Runner::PrintJson(std::ostream& os) const
+	{
+		os << "{\n  \"benchmarks\": [";
+
+		for (size_t idx{ 0u }; idx < this->results.size(); ++idx)
+		{
+			const auto& result = this->results[idx];
+
+			os << (idx == 0u ? "\n" : ",\n");
+			os << "    {\n";
+			os << "      \"name\": \"" << result.name << "\",\n";
+			os << "      \"operations\": " << result.operations << ",\n";
+			os << "      \"nsPerOperation\": " << result.nsPerOperation << ",\n";
+			os << "      \"operationsPerSecond\": " << result.operationsPerSecond << ",\n";
+			os << "      \"allocationsPerOperation\": " << result.allocationsPerOperation << ",\n";
+			os << "      \"p50BatchAvgNs\": " << result.p50BatchAvgNs << ",\n";
+			os << "      \"p99BatchAvgNs\": " << result.p99BatchAvgNs << "\n";
+			os << "    }";
+		}
+
+		os << "\n  ]\n}\n";
+	}
+
+	void Runner::AddResult(const std::string& name, size_t batchSize, uint64_t allocations)
+	{
+		const uint64_t operations = this->batchesNs.size() * batchSize;
+		uint64_t totalNs{ 0u };
+
+		// Time spent between batches (clock reads) is not accounted.
+		for (const auto batchNs : this->batchesNs)
+		{
+			totalNs += batchNs;
+		}
+
+		Result result;
+
+		result.name                    = name;
+		result.operations              = operations;
+		result.nsPerOperation          = static_cast<double>(totalNs) / operations;
+		result.operationsPerSecond     = 1e9 / result.nsPerOperation;
+		result.allocationsPerOperation = static_cast<double>(allocations) / operations;
+
+		// Percentiles of the average operation cost of each batch. Single
+		// operations are not timed, so these are not per operation latencies and
+		// outliers within a batch are averaged out.
+		std::sort(this->batchesNs.begin(), this->batchesNs.end());
+
+		const auto percentile = [this, batchSize](double ratio)
+		{
+			const size_t idx = static_cast<size_t>(ratio * (this->batchesNs.size() - 1u));
+
+			return static_cast<double>(this->batchesNs[idx]) / batchSize;
+		};
+
+		result.p50BatchAvgNs = percentile(0.50);
+		result.p99BatchAvgNs = percentile(0.99);
+
+		this->results.push_back(result);
+	}
+} // namespace Bench
@@ -0,0 +1,66 @@
+#include "RTC/BenchActiveSpeakerObserver.hpp"
+#include "RTC/ActiveSpeakerObserver.hpp"
+#include <algorithm> // std::max()
+#include <memory>
+#include <vector>
+
+void Bench::RTC::ActiveSpeakerObserver::Run(Bench::Runner& runner)
+{
+	using Speaker = ::RTC::ActiveSpeakerObserver::Speaker;
+
+	constexpr size_t NumSpeakers{ 32u };
+
+	std::vector<Speaker> speakers(NumSpeakers);
+	uint64_t now{ 0u };
+
+	for (const auto& speaker : speakers)
+	{
+		now = std::max(now, speaker.lastLevelChangeTime);
+	}
+
+	size_t idx{ 0u };
+
+	// Each operation is an audio level (one every 20 ms per speaker) of one
+	// of the speakers. Some speakers are mostly silent, others talk.
+	runner.Run(
+	  "ActiveSpeakerObserver/level-changed",
+	  [&]()
+	  {
+		  const size_t speakerIdx = idx % NumSpeakers;
+
+		  if (speakerIdx == 0u)
+		  {
+			  now += 20u;
+		  }
+
+		  const auto level = static_cast<uint32_t>((idx * 37u) % 128u);
+
+		  speakers[speakerIdx].LevelChanged(speakerIdx % 4u == 0u ? level / 8u : level, now);
+
+		  ++idx;
+	  });
+
+	double total{ 0 };
+
+	// Each operation is a periodic evaluation of all the speakers against the
+	// dominant one, as done by the observer every 300 ms.
+	runner.Run(
+	  "ActiveSpeakerObserver/eval-32-speakers",
+	  [&]()
+	  {
+		  const auto* dominantSpeaker = std::addressof(speakers[0]);
+
+		  for (auto& speaker : speakers)
+		  {
+			  speaker.EvalActivityScores();
+
+			  for (uint8_t interval{ 0u }; interval < 3u; ++interval)
+			  {
+				  total += speaker.GetRelativeActivityScore(interval, dominantSpeaker);
+			  }
+		  }
+	  });
+
+	// Avoid [-Wunused-but-set-variable].
+	(void)total;
+}
@@ -0,0 +1,45 @@
+#include "RTC/BenchCpuTimeCounter.hpp"
+#include "RTC/CpuTimeCounter.hpp"
+#include <uv.h>
+
+void Bench::RTC::CpuTimeCounter::Run(Bench::Runner& runner)
+{
+	// Cost of measuring every Scope (two clock reads), for reference.
+	{
+		uint64_t timeNs{ 0u };
+
+		runner.Run(
+		  "CpuTimeCounter/unsampled-clock-reads",
+		  [&]()
+		  {
+			  const uint64_t startNs = uv_hrtime();
+
+			  timeNs += uv_hrtime() - startNs;
+		  });
+	}
+
+	{
+		::RTC::CpuTimeCounter counter;
+
+		runner.Run(
+		  "CpuTimeCounter/scope",
+		  [&]()
+		  {
+			  const ::RTC::CpuTimeCounter::Scope scope(counter);
+		  });
+	}
+
+	// As a Transport sending the packets received by another one.
+	{
+		::RTC::CpuTimeCounter outer;
+		::RTC::CpuTimeCounter inner;
+
+		runner.Run(
+		  "CpuTimeCounter/scope-nested",
+		  [&]()
+		  {
+			  const ::RTC::CpuTimeCounter::Scope outerScope(outer);
+			  const ::RTC::CpuTimeCounter::Scope innerScope(inner);
+		  });
+	}
+}
@@ -0,0 +1,539 @@
+#define MS_CLASS "Bench::RTC::Router"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/BenchRouter.hpp"
+#include "BenchLocalRouter.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include "RTC/RtpDictionaries.hpp"
+#include <cstring> // std::memset()
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+	namespace RTC
+	{
+		namespace Router
+		{
+			/* Static. */
+
+			enum class Scenario : uint8_t
+			{
+				SIMPLE_VP8,
+				SIMULCAST_VP8,
+				SVC_VP9
+			};
+
+			static const std::string RouterId{ "router" };
+			static const std::string ProducerTransportId{ "producer-transport" };
+			static const std::string ProducerId{ "producer" };
+			static constexpr uint8_t ProducerPayloadType{ 96u };
+			static constexpr uint8_t ConsumerPayloadType{ 101u };
+			static constexpr uint32_t ProducerSsrc{ 11110000u };
+			static constexpr uint32_t MappedSsrc{ 22220000u };
+			static constexpr uint32_t ConsumerSsrc{ 33330000u };
+			static constexpr uint8_t AbsSendTimeId{ 4u };
+			static constexpr uint8_t TransportWideCc01Id{ 5u };
+			static constexpr size_t PacketSize{ 1100u };
+			// RTP header plus abs-send-time and transport-wide-cc-01 extensions.
+			static constexpr size_t PacketHeaderSize{ 24u };
+			static constexpr size_t KeyFrameInterval{ 256u };
+			// Temporal layer of each frame (L1T3 and L3T3 patterns).
+			static constexpr uint8_t TemporalLayers[]{ 0u, 2u, 1u, 2u };
+			static constexpr size_t NumConsumers[]{ 1u, 10u, 100u };
+
+			// State of a synthetic video stream sent by the Producer.
+			struct Stream
+			{
+				uint32_t ssrc{ 0u };
+				uint16_t seq{ 0u };
+				uint32_t timestamp{ 0u };
+				uint16_t pictureId{ 0u };
+				uint8_t tl0PictureIndex{ 0u };
+				size_t frames{ 0u };
+			};
+
+			static const char* GetScenarioName(Scenario scenario)
+			{
+				switch (scenario)
+				{
+					case Scenario::SIMPLE_VP8:
+						return "simple-vp8";
+					case Scenario::SIMULCAST_VP8:
+						return "simulcast-vp8";
+					case Scenario::SVC_VP9:
+						return "svc-vp9";
+				}
+
+				return "";
+			}
+
+			static ::RTC::RtpCodecParameters CreateCodec(Scenario scenario, uint8_t payloadType)
+			{
+				::RTC::RtpCodecParameters codec;
+
+				codec.mimeType.SetMimeType(scenario == Scenario::SVC_VP9 ? "video/VP9" : "video/VP8");
+				codec.payloadType = payloadType;
+				codec.clockRate   = 90000u;
+
+				codec.rtcpFeedback.emplace_back();
+				codec.rtcpFeedback.back().type = "nack";
+				codec.rtcpFeedback.emplace_back();
+				codec.rtcpFeedback.back().type      = "nack";
+				codec.rtcpFeedback.back().parameter = "pli";
+
+				return codec;
+			}
+
+			static ::RTC::RtpParameters CreateRtpParameters(Scenario scenario, uint8_t payloadType)
+			{
+				::RTC::RtpParameters rtpParameters;
+
+				rtpParameters.codecs.push_back(CreateCodec(scenario, payloadType));
+
+				rtpParameters.headerExtensions.emplace_back();
+				rtpParameters.headerExtensions.back().type =
+				  ::RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME;
+				rtpParameters.headerExtensions.back().id = AbsSendTimeId;
+				rtpParameters.headerExtensions.emplace_back();
+				rtpParameters.headerExtensions.back().type =
+				  ::RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01;
+				rtpParameters.headerExtensions.back().id = TransportWideCc01Id;
+
+				rtpParameters.mid        = "0";
+				rtpParameters.rtcp.cname = "bench";
+
+				return rtpParameters;
+			}
+
+			// Encodings sent by the Producer.
+			static std::vector<::RTC::RtpEncodingParameters> CreateProducerEncodings(Scenario scenario)
+			{
+				std::vector<::RTC::RtpEncodingParameters> encodings;
+
+				const size_t numEncodings = scenario == Scenario::SIMULCAST_VP8 ? 3u : 1u;
+
+				for (size_t idx{ 0u }; idx < numEncodings; ++idx)
+				{
+					encodings.emplace_back();
+
+					auto& encoding = encodings.back();
+
+					encoding.ssrc = ProducerSsrc + idx;
+
+					if (scenario == Scenario::SIMULCAST_VP8)
+					{
+						encoding.scalabilityMode = "L1T3";
+					}
+					else if (scenario == Scenario::SVC_VP9)
+					{
+						encoding.scalabilityMode = "L3T3";
+					}
+				}
+
+				return encodings;
+			}
+
+			static void CreateDirectTransport(
+			  Bench::LocalRouter& localRouter, const std::string& transportId)
+			{
+				auto& builder = localRouter.GetBufferBuilder();
+				auto options  = FBS::Transport::CreateOptions(builder, /*direct*/ true, 262144u);
+				auto directTransportOptions =
+				  FBS::DirectTransport::CreateDirectTransportOptions(builder, options);
+				auto body = FBS::Router::CreateCreateDirectTransportRequestDirect(
+				  builder, transportId.c_str(), directTransportOptions);
+
+				localRouter.Request(
+				  FBS::Request::Method::ROUTER_CREATE_DIRECTTRANSPORT,
+				  RouterId,
+				  FBS::Request::Body::Router_CreateDirectTransportRequest,
+				  body.Union());
+			}
+
+			static void Produce(Bench::LocalRouter& localRouter, Scenario scenario)
+			{
+				auto& builder      = localRouter.GetBufferBuilder();
+				auto rtpParameters = CreateRtpParameters(scenario, ProducerPayloadType);
+
+				rtpParameters.encodings = CreateProducerEncodings(scenario);
+
+				std::vector<flatbuffers::Offset<FBS::RtpParameters::CodecMapping>> codecs;
+				std::vector<flatbuffers::Offset<FBS::RtpParameters::EncodingMapping>> encodings;
+
+				codecs.emplace_back(FBS::RtpParameters::CreateCodecMapping(
+				  builder, ProducerPayloadType, ConsumerPayloadType));
+
+				for (size_t idx{ 0u }; idx < rtpParameters.encodings.size(); ++idx)
+				{
+					const auto& encoding = rtpParameters.encodings[idx];
+
+					encodings.emplace_back(FBS::RtpParameters::CreateEncodingMappingDirect(
+					  builder,
+					  /*rid*/ nullptr,
+					  encoding.ssrc,
+					  encoding.scalabilityMode.c_str(),
+					  MappedSsrc + idx));
+				}
+
+				auto rtpMapping = FBS::RtpParameters::CreateRtpMappingDirect(builder, &codecs, &encodings);
+
+				auto body = FBS::Transport::CreateProduceRequestDirect(
+				  builder,
+				  ProducerId.c_str(),
+				  FBS::RtpParameters::MediaKind::VIDEO,
+				  rtpParameters.FillBuffer(builder),
+				  rtpMapping);
+
+				localRouter.Request(
+				  FBS::Request::Method::TRANSPORT_PRODUCE,
+				  ProducerTransportId,
+				  FBS::Request::Body::Transport_ProduceRequest,
+				  body.Union());
+			}
+
+			static void Consume(
+			  Bench::LocalRouter& localRouter,
+			  Scenario scenario,
+			  const std::string& transportId,
+			  const std::string& consumerId,
+			  uint32_t ssrc)
+			{
+				auto& builder      = localRouter.GetBufferBuilder();
+				auto rtpParameters = CreateRtpParameters(scenario, ConsumerPayloadType);
+
+				rtpParameters.encodings.emplace_back();
+				rtpParameters.encodings.back().ssrc = ssrc;
+
+				std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>>
+				  consumableEncodings;
+				FBS::RtpParameters::Type type;
+
+				// Consumable encodings are the Producer ones with mapped SSRCs.
+				auto producerEncodings = CreateProducerEncodings(scenario);
+
+				for (size_t idx{ 0u }; idx < producerEncodings.size(); ++idx)
+				{
+					auto& encoding = producerEncodings[idx];
+
+					encoding.ssrc = MappedSsrc + idx;
+
+					consumableEncodings.emplace_back(encoding.FillBuffer(builder));
+				}
+
+				switch (scenario)
+				{
+					case Scenario::SIMPLE_VP8:
+					{
+						type = FBS::RtpParameters::Type::SIMPLE;
+
+						break;
+					}
+
+					case Scenario::SIMULCAST_VP8:
+					{
+						type                                           = FBS::RtpParameters::Type::SIMULCAST;
+						rtpParameters.encodings.back().scalabilityMode = "L3T3";
+
+						break;
+					}
+
+					case Scenario::SVC_VP9:
+					{
+						type                                           = FBS::RtpParameters::Type::SVC;
+						rtpParameters.encodings.back().scalabilityMode = "L3T3";
+
+						break;
+					}
+				}
+
+				auto body = FBS::Transport::CreateConsumeRequestDirect(
+				  builder,
+				  consumerId.c_str(),
+				  ProducerId.c_str(),
+				  FBS::RtpParameters::MediaKind::VIDEO,
+				  rtpParameters.FillBuffer(builder),
+				  type,
+				  &consumableEncodings);
+
+				localRouter.Request(
+				  FBS::Request::Method::TRANSPORT_CONSUME,
+				  transportId,
+				  FBS::Request::Body::Transport_ConsumeRequest,
+				  body.Union());
+			}
+
+			static void WriteRtpHeader(uint8_t* data, Stream& stream, bool marker)
+			{
+				// Version 2 with header extension.
+				data[0] = 0b10010000;
+				data[1] = (marker ? 0x80 : 0x00) | ProducerPayloadType;
+				Utils::Byte::Set2Bytes(data, 2, stream.seq++);
+				Utils::Byte::Set4Bytes(data, 4, stream.timestamp);
+				Utils::Byte::Set4Bytes(data, 8, stream.ssrc);
+
+				// One-Byte extensions, 2 words.
+				data[12] = 0xBE;
+				data[13] = 0xDE;
+				data[14] = 0x00;
+				data[15] = 0x02;
+				// abs-send-time.
+				data[16] = (AbsSendTimeId << 4) | 2u;
+				Utils::Byte::Set3Bytes(data, 17, static_cast<uint32_t>(DepLibUV::GetTimeMs() & 0xFFFFFF));
+				// transport-wide-cc-01.
+				data[20] = (TransportWideCc01Id << 4) | 1u;
+				Utils::Byte::Set2Bytes(data, 21, stream.seq);
+				data[23] = 0x00;
+			}
+
+			// Writes the next VP8 frame (a single packet) of the stream.
+			static void WriteVp8Packet(uint8_t* data, Stream& stream)
+			{
+				const bool isKeyFrame = stream.frames % KeyFrameInterval == 0u;
+				const uint8_t tid     = isKeyFrame ? 0u : TemporalLayers[stream.frames % 4u];
+
+				if (tid == 0u)
+				{
+					++stream.tl0PictureIndex;
+				}
+
+				WriteRtpHeader(data, stream, /*marker*/ true);
+
+				uint8_t* descriptor = data + PacketHeaderSize;
+
+				// X and S bits, then I, L and T bits.
+				descriptor[0] = 0x90;
+				descriptor[1] = 0xE0;
+				descriptor[2] = 0x80 | ((stream.pictureId >> 8) & 0x7F);
+				descriptor[3] = stream.pictureId & 0xFF;
+				descriptor[4] = stream.tl0PictureIndex;
+				// TID and Y bit.
+				descriptor[5] = (tid << 6) | 0x20;
+				// VP8 payload header (P bit unset in key frames).
+				descriptor[6] = isKeyFrame ? 0x00 : 0x01;
+
+				stream.pictureId = (stream.pictureId + 1u) & 0x7FFF;
+				stream.timestamp += 3000u;
+				++stream.frames;
+			}
+
+			// Writes the given spatial layer packet of the current VP9 frame.
+			static void WriteVp9Packet(uint8_t* data, Stream& stream, uint8_t sid, uint8_t spatialLayers)
+			{
+				const bool isKeyFrame = stream.frames % KeyFrameInterval == 0u;
+				const uint8_t tid     = isKeyFrame ? 0u : TemporalLayers[stream.frames % 4u];
+				const bool lastLayer  = sid == spatialLayers - 1u;
+
+				if (tid == 0u && sid == 0u)
+				{
+					++stream.tl0PictureIndex;
+				}
+
+				WriteRtpHeader(data, stream, /*marker*/ lastLayer);
+
+				uint8_t* descriptor = data + PacketHeaderSize;
+
+				// I, P (not in key frames), L, B and E bits.
+				descriptor[0] = 0xA0 | (isKeyFrame ? 0x00 : 0x40) | 0x08 | 0x04;
+				descriptor[1] = 0x80 | ((stream.pictureId >> 8) & 0x7F);
+				descriptor[2] = stream.pictureId & 0xFF;
+				// TID, U, SID and D (upper layers depend on the lower ones).
+				descriptor[3] = (tid << 5) | (sid << 1) | (sid > 0u ? 0x01 : 0x00);
+				descriptor[4] = stream.tl0PictureIndex;
+
+				if (lastLayer)
+				{
+					stream.pictureId = (stream.pictureId + 1u) & 0x7FFF;
+					stream.timestamp += 3000u;
+					++stream.frames;
+				}
+			}
+
+			// Writes a RTCP Receiver Report with a single report block.
+			static void WriteReceiverReport(uint8_t* data, uint32_t ssrc, uint16_t highestSeq)
+			{
+				// V=2, RC=1, PT=201, length=7.
+				data[0] = 0x81;
+				data[1] = 201u;
+				Utils::Byte::Set2Bytes(data, 2, 7u);
+				Utils::Byte::Set4Bytes(data, 4, 1u);
+				// Report block.
+				Utils::Byte::Set4Bytes(data, 8, ssrc);
+				// Fraction lost and cumulative lost.
+				Utils::Byte::Set4Bytes(data, 12, 0u);
+				Utils::Byte::Set4Bytes(data, 16, highestSeq);
+				// Jitter, LSR and DLSR.
+				Utils::Byte::Set4Bytes(data, 20, 10u);
+				Utils::Byte::Set4Bytes(data, 24, 0u);
+				Utils::Byte::Set4Bytes(data, 28, 0u);
+			}
+
+			static std::unique_ptr<Bench::LocalRouter> CreateRouter(
+			  Scenario scenario, size_t numConsumers)
+			{
+				std::unique_ptr<Bench::LocalRouter> localRouter(new Bench::LocalRouter(RouterId));
+
+				CreateDirectTransport(*localRouter, ProducerTransportId);
+				Produce(*localRouter, scenario);
+
+				for (size_t idx{ 0u }; idx < numConsumers; ++idx)
+				{
+					const std::string transportId = "consumer-transport-" + std::to_string(idx);
+					const std::string consumerId  = "consumer-" + std::to_string(idx);
+
+					CreateDirectTransport(*localRouter, transportId);
+					Consume(*localRouter, scenario, transportId, consumerId, ConsumerSsrc + idx);
+				}
+
+				return localRouter;
+			}
+
+			static void RunForward(Bench::Runner& runner, Scenario scenario, size_t numConsumers)
+			{
+				const std::string name = std::string("Router/forward/") + GetScenarioName(scenario) +
+				                         "/consumers:" + std::to_string(numConsumers);
+
+				if (!runner.IsEnabled(name))
+				{
+					return;
+				}
+
+				auto localRouter = CreateRouter(scenario, numConsumers);
+
+				uint8_t packet[PacketSize];
+
+				std::memset(packet, 0, sizeof(packet));
+
+				auto notification =
+				  localRouter->CreateProducerSendNotification(ProducerId, packet, sizeof(packet));
+
+				std::vector<Stream> streams(scenario == Scenario::SIMULCAST_VP8 ? 3u : 1u);
+
+				for (size_t idx{ 0u }; idx < streams.size(); ++idx)
+				{
+					streams[idx].ssrc = ProducerSsrc + idx;
+				}
+
+				size_t packetIdx{ 0u };
+
+				// Each operation is a RTP packet received by the Producer, forwarded to
+				// all the Consumers that want it.
+				runner.Run(
+				  name,
+				  [&]()
+				  {
+					  switch (scenario)
+					  {
+						  case Scenario::SIMPLE_VP8:
+						  {
+							  WriteVp8Packet(notification.data, streams[0]);
+
+							  break;
+						  }
+
+						  case Scenario::SIMULCAST_VP8:
+						  {
+							  WriteVp8Packet(notification.data, streams[packetIdx % 3u]);
+
+							  break;
+						  }
+
+						  case Scenario::SVC_VP9:
+						  {
+							  WriteVp9Packet(notification.data, streams[0], packetIdx % 3u, 3u);
+
+							  break;
+						  }
+					  }
+
+					  ++packetIdx;
+
+					  localRouter->Notify(notification);
+				  });
+
+				if (localRouter->GetConsumerRtpCount() == 0u)
+				{
+					MS_THROW_ERROR("no RTP packet was forwarded in %s", name.c_str());
+				}
+			}
+
+			static void RunReceiverReports(Bench::Runner& runner, size_t numConsumers)
+			{
+				const std::string name = "Router/rtcp-rr/consumers:" + std::to_string(numConsumers);
+
+				if (!runner.IsEnabled(name))
+				{
+					return;
+				}
+
+				auto localRouter = CreateRouter(Scenario::SIMPLE_VP8, numConsumers);
+
+				uint8_t packet[PacketSize];
+
+				std::memset(packet, 0, sizeof(packet));
+
+				// Send some RTP so the Consumers have sent something to report about.
+				auto rtpNotification =
+				  localRouter->CreateProducerSendNotification(ProducerId, packet, sizeof(packet));
+				Stream stream;
+
+				stream.ssrc = ProducerSsrc;
+
+				for (size_t idx{ 0u }; idx < 100u; ++idx)
+				{
+					WriteVp8Packet(rtpNotification.data, stream);
+					localRouter->Notify(rtpNotification);
+				}
+
+				std::vector<Bench::LocalRouter::Notification> notifications;
+
+				for (size_t idx{ 0u }; idx < numConsumers; ++idx)
+				{
+					WriteReceiverReport(packet, ConsumerSsrc + idx, 0u);
+
+					notifications.push_back(localRouter->CreateTransportSendRtcpNotification(
+					  "consumer-transport-" + std::to_string(idx), packet, 32u));
+				}
+
+				size_t reportIdx{ 0u };
+
+				// Each operation is a RTCP Receiver Report received by a Consumer
+				// Transport, rotating across all of them.
+				runner.Run(
+				  name,
+				  [&]()
+				  {
+					  const size_t consumerIdx = reportIdx % numConsumers;
+					  auto& notification       = notifications[consumerIdx];
+
+					  WriteReceiverReport(notification.data, ConsumerSsrc + consumerIdx, stream.seq);
+
+					  ++reportIdx;
+
+					  localRouter->Notify(notification);
+				  });
+			}
+
+			void Run(Bench::Runner& runner)
+			{
+				for (const auto scenario :
+				     { Scenario::SIMPLE_VP8, Scenario::SIMULCAST_VP8, Scenario::SVC_VP9 })
+				{
+					for (const auto numConsumers : NumConsumers)
+					{
+						RunForward(runner, scenario, numConsumers);
+					}
+				}
+
+				for (const auto numConsumers : NumConsumers)
+				{
+					RunReceiverReports(runner, numConsumers);
+				}
+			}
+		} // namespace Router
+	} // namespace RTC
+} // namespace Bench
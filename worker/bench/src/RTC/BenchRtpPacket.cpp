@@ -0,0 +1,122 @@
+#include "RTC/BenchRtpPacket.hpp"
+#include "RTC/RtpDictionaries.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <cstring> // std::memcpy(), std::memset()
+#include <memory>
+#include <vector>
+
+void Bench::RTC::RtpPacket::Run(Bench::Runner& runner)
+{
+	using HeaderExtensionRewritePlan = ::RTC::RtpPacket::HeaderExtensionRewritePlan;
+	using Type                       = ::RTC::RtpHeaderExtensionUri::Type;
+
+	// Video packet as received from a browser, with MID, abs-send-time,
+	// transport-wide-cc-01, video-orientation and toffset extensions.
+	uint8_t packetBuffer[1500];
+	size_t packetLen;
+
+	{
+		std::memset(packetBuffer, 0, sizeof(packetBuffer));
+
+		// Version 2, payload type 96, sequence number, timestamp and SSRC.
+		packetBuffer[0]  = 0x80;
+		packetBuffer[1]  = 96;
+		packetBuffer[3]  = 1;
+		packetBuffer[7]  = 1;
+		packetBuffer[11] = 1;
+
+		std::unique_ptr<::RTC::RtpPacket> packet(::RTC::RtpPacket::Parse(packetBuffer, 12 + 1100));
+
+		uint8_t mid[]{ '0' };
+		uint8_t absSendTime[]{ 0x01, 0x02, 0x03 };
+		uint8_t transportWideCc01[]{ 0x00, 0x01 };
+		uint8_t videoOrientation[]{ 0x01 };
+		uint8_t toffset[]{ 0x00, 0x00, 0x10 };
+		std::vector<::RTC::RtpPacket::GenericExtension> extensions;
+
+		extensions.emplace_back(1, sizeof(mid), mid);
+		extensions.emplace_back(2, sizeof(absSendTime), absSendTime);
+		extensions.emplace_back(3, sizeof(transportWideCc01), transportWideCc01);
+		extensions.emplace_back(4, sizeof(videoOrientation), videoOrientation);
+		extensions.emplace_back(5, sizeof(toffset), toffset);
+
+		packet->SetExtensions(1, extensions);
+
+		packetLen = packet->GetSize();
+	}
+
+	// Same as the plan a Producer computes for these extensions.
+	HeaderExtensionRewritePlan plan;
+
+	plan.AddZeroed(static_cast<uint8_t>(Type::MID), ::RTC::MidMaxLength);
+	plan.AddZeroed(static_cast<uint8_t>(Type::ABS_SEND_TIME), 3);
+	plan.AddZeroed(static_cast<uint8_t>(Type::TRANSPORT_WIDE_CC_01), 2);
+	plan.AddProxied(static_cast<uint8_t>(Type::VIDEO_ORIENTATION), 4);
+	plan.AddProxied(static_cast<uint8_t>(Type::TOFFSET), 5);
+
+	uint8_t buffer[1500];
+
+	runner.Run(
+	  "RtpPacket/parse",
+	  [&]()
+	  {
+		  std::memcpy(buffer, packetBuffer, packetLen);
+
+		  delete ::RTC::RtpPacket::Parse(buffer, packetLen);
+	  });
+
+	runner.Run(
+	  "RtpPacket/rewrite-header-extensions/plan",
+	  [&]()
+	  {
+		  std::memcpy(buffer, packetBuffer, packetLen);
+
+		  auto* packet = ::RTC::RtpPacket::Parse(buffer, packetLen);
+
+		  packet->RewriteHeaderExtensions(plan);
+
+		  delete packet;
+	  });
+
+	// The generic path: build the list of extensions and call SetExtensions().
+	runner.Run(
+	  "RtpPacket/rewrite-header-extensions/set-extensions",
+	  [&]()
+	  {
+		  std::memcpy(buffer, packetBuffer, packetLen);
+
+		  auto* packet = ::RTC::RtpPacket::Parse(buffer, packetLen);
+
+		  uint8_t values[HeaderExtensionRewritePlan::MaxSteps * 16];
+		  uint8_t* valuesPtr{ values };
+		  std::vector<::RTC::RtpPacket::GenericExtension> extensions;
+
+		  for (size_t idx{ 0u }; idx < plan.GetNumSteps(); ++idx)
+		  {
+			  const auto& step = plan.GetStep(idx);
+
+			  if (step.sourceId == 0u)
+			  {
+				  std::memset(valuesPtr, 0, step.len);
+				  extensions.emplace_back(step.id, step.len, valuesPtr);
+				  valuesPtr += step.len;
+
+				  continue;
+			  }
+
+			  uint8_t extenLen;
+			  uint8_t* extenValue = packet->GetExtension(step.sourceId, extenLen);
+
+			  if (extenValue)
+			  {
+				  std::memcpy(valuesPtr, extenValue, extenLen);
+				  extensions.emplace_back(step.id, extenLen, valuesPtr);
+				  valuesPtr += extenLen;
+			  }
+		  }
+
+		  packet->SetExtensions(1, extensions);
+
+		  delete packet;
+	  });
+}
@@ -0,0 +1,76 @@
+#include "RTC/BenchSeqManager.hpp"
+#include "RTC/SeqManager.hpp"
+
+void Bench::RTC::SeqManager::Run(Bench::Runner& runner)
+{
+	{
+		::RTC::SeqManager<uint16_t> seqManager;
+		uint16_t seq{ 0u };
+		uint16_t output;
+
+		runner.Run(
+		  "SeqManager/input",
+		  [&]()
+		  {
+			  seqManager.Input(seq++, output);
+		  });
+	}
+
+	// Half of the packets dropped, as when forwarding the lowest temporal
+	// layers of a L1T3 stream.
+	{
+		::RTC::SeqManager<uint16_t> seqManager;
+		uint16_t seq{ 0u };
+		uint16_t output;
+
+		runner.Run(
+		  "SeqManager/input-drop-heavy",
+		  [&]()
+		  {
+			  if (seq % 2u == 1u)
+			  {
+				  seqManager.Drop(seq);
+			  }
+			  else
+			  {
+				  seqManager.Input(seq, output);
+			  }
+
+			  ++seq;
+		  });
+	}
+
+	// Same with every fourth pair of packets received out of order.
+	{
+		::RTC::SeqManager<uint16_t> seqManager;
+		uint32_t idx{ 0u };
+		uint16_t output;
+
+		runner.Run(
+		  "SeqManager/input-drop-heavy-reordered",
+		  [&]()
+		  {
+			  auto seq = static_cast<uint16_t>(idx);
+
+			  if (idx % 8u == 6u)
+			  {
+				  ++seq;
+			  }
+			  else if (idx % 8u == 7u)
+			  {
+				  --seq;
+			  }
+
+			  if (seq % 2u == 1u)
+			  {
+				  seqManager.Drop(seq);
+			  }
+			  else
+			  {
+				  seqManager.Input(seq, output);
+			  }
+
+			  ++idx;
+		  });
+	}
+}
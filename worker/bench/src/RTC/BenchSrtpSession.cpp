@@ -0,0 +1,87 @@
+#include "RTC/BenchSrtpSession.hpp"
+#include "Utils.hpp"
+#include "RTC/SrtpSession.hpp"
+#include <cstring> // std::memcpy(), std::memset()
+#include <string>
+
+void Bench::RTC::SrtpSession::Run(Bench::Runner& runner)
+{
+	using CryptoSuite = ::RTC::SrtpSession::CryptoSuite;
+	using Type        = ::RTC::SrtpSession::Type;
+
+	struct Suite
+	{
+		const char* name;
+		CryptoSuite cryptoSuite;
+		// Master key plus master salt.
+		size_t keyLen;
+	};
+
+	// clang-format off
+	const Suite suites[] =
+	{
+		{ "AEAD_AES_256_GCM",        CryptoSuite::AEAD_AES_256_GCM,        44u },
+		{ "AEAD_AES_128_GCM",        CryptoSuite::AEAD_AES_128_GCM,        28u },
+		{ "AES_CM_128_HMAC_SHA1_80", CryptoSuite::AES_CM_128_HMAC_SHA1_80, 30u },
+		{ "AES_CM_128_HMAC_SHA1_32", CryptoSuite::AES_CM_128_HMAC_SHA1_32, 30u }
+	};
+	// clang-format on
+
+	// Typical video packet.
+	constexpr size_t PacketLen{ 1200u };
+
+	uint8_t packet[PacketLen];
+	uint8_t buffer[PacketLen + 100];
+
+	std::memset(packet, 0xAB, sizeof(packet));
+
+	// Version 2, no extensions, payload type 96 and SSRC.
+	packet[0] = 0x80;
+	packet[1] = 96;
+	Utils::Byte::Set4Bytes(packet, 8, 12345678u);
+
+	for (const auto& suite : suites)
+	{
+		uint8_t key[64];
+
+		for (size_t idx{ 0u }; idx < suite.keyLen; ++idx)
+		{
+			key[idx] = static_cast<uint8_t>(idx);
+		}
+
+		::RTC::SrtpSession outbound(Type::OUTBOUND, suite.cryptoSuite, key, suite.keyLen);
+		::RTC::SrtpSession inbound(Type::INBOUND, suite.cryptoSuite, key, suite.keyLen);
+		uint16_t seq{ 0u };
+
+		runner.Run(
+		  std::string("SrtpSession/encrypt/") + suite.name,
+		  [&]()
+		  {
+			  Utils::Byte::Set2Bytes(packet, 2, seq++);
+
+			  const uint8_t* data = packet;
+			  int len             = static_cast<int>(PacketLen);
+
+			  outbound.EncryptRtp(&data, &len);
+		  });
+
+		// NOTE: Sequence numbers keep increasing since the inbound session
+		// discards replayed packets.
+		runner.Run(
+		  std::string("SrtpSession/encrypt-decrypt/") + suite.name,
+		  [&]()
+		  {
+			  Utils::Byte::Set2Bytes(packet, 2, seq++);
+
+			  const uint8_t* data = packet;
+			  int len             = static_cast<int>(PacketLen);
+
+			  if (outbound.EncryptRtp(&data, &len))
+			  {
+				  std::memcpy(buffer, data, len);
+
+				  inbound.DecryptSrtp(buffer, &len);
+			  }
+		  });
+	}
+}
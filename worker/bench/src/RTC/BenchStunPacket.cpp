@@ -0,0 +1,91 @@
+#include "RTC/BenchStunPacket.hpp"
+#include "Utils.hpp"
+#include "RTC/StunPacket.hpp"
+#include <cstring> // std::memset()
+#include <memory>
+#include <netinet/in.h>
+#include <string>
+
+void Bench::RTC::StunPacket::Run(Bench::Runner& runner)
+{
+	const std::string localUsername{ "localufrag" };
+	const std::string localPassword{ "localpassword0123456789" };
+	const uint8_t transactionId[12]{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+	// ICE Binding request as sent by a browser.
+	uint8_t request[1024];
+	size_t requestLen;
+
+	{
+		::RTC::StunPacket packet(
+		  ::RTC::StunPacket::Class::REQUEST,
+		  ::RTC::StunPacket::Method::BINDING,
+		  transactionId,
+		  nullptr,
+		  0);
+		const std::string username = localUsername + ":remoteufrag";
+
+		packet.SetUsername(username.c_str(), username.length());
+		packet.SetPriority(1853824767u);
+		packet.SetIceControlling(0x0102030405060708);
+		packet.Authenticate(localPassword);
+		packet.Serialize(request);
+
+		requestLen = packet.GetSize();
+	}
+
+	Utils::Crypto::HmacSha1 hmacSha1(localPassword);
+	std::unique_ptr<::RTC::StunPacket> packet(::RTC::StunPacket::Parse(request, requestLen));
+
+	struct sockaddr_in remoteAddr;
+
+	std::memset(std::addressof(remoteAddr), 0, sizeof(remoteAddr));
+	remoteAddr.sin_family      = AF_INET;
+	remoteAddr.sin_port        = htons(50000);
+	remoteAddr.sin_addr.s_addr = htonl(0x0A000001);
+
+	uint8_t response[1024];
+
+	runner.Run(
+	  "StunPacket/parse",
+	  [&]()
+	  {
+		  delete ::RTC::StunPacket::Parse(request, requestLen);
+	  });
+
+	runner.Run(
+	  "StunPacket/check-authentication/password",
+	  [&]()
+	  {
+		  packet->CheckAuthentication(localUsername, localPassword);
+	  });
+
+	runner.Run(
+	  "StunPacket/check-authentication/hmac",
+	  [&]()
+	  {
+		  packet->CheckAuthentication(localUsername, std::addressof(hmacSha1));
+	  });
+
+	// Same as the IceServer does for every received Binding request.
+	runner.Run(
+	  "StunPacket/success-response",
+	  [&]()
+	  {
+		  auto* successResponse = packet->CreateSuccessResponse();
+
+		  successResponse->SetXorMappedAddress(reinterpret_cast<struct sockaddr*>(&remoteAddr));
+		  successResponse->Authenticate(std::addressof(hmacSha1));
+		  successResponse->Serialize(response);
+
+		  delete successResponse;
+	  });
+
+	// FINGERPRINT attribute computation.
+	runner.Run(
+	  "StunPacket/crc32",
+	  [&]()
+	  {
+		  Utils::Crypto::GetCRC32(request, requestLen - 8);
+	  });
+}
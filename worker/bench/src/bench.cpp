@@ -0,0 +1,138 @@
+#define MS_CLASS "bench"
+
+#include "BenchRunner.hpp"
+#include "DepLibSRTP.hpp"
+#include "DepLibUV.hpp"
+#include "DepLibWebRTC.hpp"
+#include "DepOpenSSL.hpp"
+#include "DepUsrSCTP.hpp"
+#include "LogLevel.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Settings.hpp"
+#include "Utils.hpp"
+#include "RTC/BenchActiveSpeakerObserver.hpp"
+#include "RTC/BenchCpuTimeCounter.hpp"
+#include "RTC/BenchRouter.hpp"
+#include "RTC/BenchRtpPacket.hpp"
+#include "RTC/BenchSeqManager.hpp"
+#include "RTC/BenchSrtpSession.hpp"
+#include "RTC/BenchStunPacket.hpp"
+#include "RTC/SrtpSession.hpp"
+#include <cstdlib> // std::getenv(), std::strtoull()
+#include <fstream>
+#include <iostream>
+#include <string>
+
+static void printUsage()
+{
+	std::cerr << "usage: mediasoup-worker-bench [--filter=SUBSTRING] [--min-time-ms=MS] "
+	             "[--output=FILE]"
+	          << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	LogLevel logLevel{ LogLevel::LOG_NONE };
+
+	// Get logLevel from ENV variable.
+	if (std::getenv("MS_BENCH_LOG_LEVEL"))
+	{
+		if (std::string(std::getenv("MS_BENCH_LOG_LEVEL")) == "debug")
+		{
+			logLevel = LogLevel::LOG_DEBUG;
+		}
+		else if (std::string(std::getenv("MS_BENCH_LOG_LEVEL")) == "warn")
+		{
+			logLevel = LogLevel::LOG_WARN;
+		}
+		else if (std::string(std::getenv("MS_BENCH_LOG_LEVEL")) == "error")
+		{
+			logLevel = LogLevel::LOG_ERROR;
+		}
+	}
+
+	Settings::configuration.logLevel = logLevel;
+
+	std::string filter;
+	uint64_t minTimeMs{ 1000u };
+	std::string output;
+
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+
+		if (arg.rfind("--filter=", 0) == 0)
+		{
+			filter = arg.substr(9);
+		}
+		else if (arg.rfind("--min-time-ms=", 0) == 0)
+		{
+			minTimeMs = std::strtoull(arg.c_str() + 14, nullptr, 10);
+		}
+		else if (arg.rfind("--output=", 0) == 0)
+		{
+			output = arg.substr(9);
+		}
+		else
+		{
+			printUsage();
+
+			return 1;
+		}
+	}
+
+	// Initialize static stuff.
+	DepLibUV::ClassInit();
+	DepOpenSSL::ClassInit();
+	DepLibSRTP::ClassInit();
+	DepUsrSCTP::ClassInit();
+	DepLibWebRTC::ClassInit();
+	Utils::Crypto::ClassInit();
+	RTC::SrtpSession::ClassInit();
+
+	Bench::Runner runner(filter, minTimeMs);
+	int status{ 0 };
+
+	try
+	{
+		Bench::RTC::RtpPacket::Run(runner);
+		Bench::RTC::SeqManager::Run(runner);
+		Bench::RTC::ActiveSpeakerObserver::Run(runner);
+		Bench::RTC::StunPacket::Run(runner);
+		Bench::RTC::SrtpSession::Run(runner);
+		Bench::RTC::CpuTimeCounter::Run(runner);
+		Bench::RTC::Router::Run(runner);
+	}
+	catch (const MediaSoupError& error)
+	{
+		std::cerr << "[bench] failed: " << error.what() << std::endl;
+
+		status = 1;
+	}
+
+	for (const auto& result : runner.GetResults())
+	{
+		std::cerr << "[bench] " << result.name << ": " << result.nsPerOperation << " ns/op, "
+		          << result.allocationsPerOperation << " allocs/op" << std::endl;
+	}
+
+	if (output.empty())
+	{
+		runner.PrintJson(std::cout);
+	}
+	else
+	{
+		std::ofstream file(output);
+
+		runner.PrintJson(file);
+	}
+
+	// Free static stuff.
+	DepLibSRTP::ClassDestroy();
+	Utils::Crypto::ClassDestroy();
+	DepLibWebRTC::ClassDestroy();
+	DepUsrSCTP::ClassDestroy();
+	DepLibUV::ClassDestroy();
+
+	return status;
+}
@@ -221,8 +221,12 @@ void PacedSender::Process() {
     // TODO: REMOVE.
     // MS_DEBUG_DEV("sending padding packet [size:%zu]", padding_packet->GetSize());
 
+    // MS_NOTE: The packet may be RTX padding that is restored (RTX decoded)
+    // once sent, so read its size before sending it.
+    const size_t padding_packet_size = padding_packet->GetSize();
+
     packet_router_->SendPacket(padding_packet, pacing_info);
-    bytes_sent += padding_packet->GetSize();
+    bytes_sent += padding_packet_size;
 
     if (recommended_probe_size && bytes_sent > *recommended_probe_size)
       break;
@@ -25,7 +25,9 @@ namespace Channel
 		Event event;
 		// Others.
 		const char* eventCStr;
-		std::string handlerId;
+		// Not copied since it is only looked up when there is no valid handle.
+		const flatbuffers::String* handlerId{ nullptr };
+		uint32_t handlerHandle{ 0u };
 		const FBS::Notification::Notification* data{ nullptr };
 	};
 } // namespace Channel
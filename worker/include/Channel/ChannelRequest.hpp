@@ -8,6 +8,7 @@
 #include <flatbuffers/minireflect.h>
 #include <absl/container/flat_hash_map.h>
 #include <string>
+#include <vector>
 
 namespace Channel
 {
@@ -24,7 +25,10 @@ namespace Channel
 		static absl::flat_hash_map<FBS::Request::Method, const char*> method2String;
 
 	public:
-		ChannelRequest(Channel::ChannelSocket* channel, const FBS::Request::Request* request);
+		ChannelRequest(
+		  Channel::ChannelSocket* channel,
+		  const FBS::Request::Request* request,
+		  ChannelRequest* batchRequest = nullptr);
 		~ChannelRequest() = default;
 
 		flatbuffers::FlatBufferBuilder& GetBufferBuilder()
@@ -42,30 +46,35 @@ namespace Channel
 			auto& builder = this->bufferBuilder;
 			auto response = FBS::Response::CreateResponse(builder, this->id, true, type, body.Union());
 
-			auto message =
-			  FBS::Message::CreateMessage(builder, FBS::Message::Body::Response, response.Union());
-
-			builder.FinishSizePrefixed(message);
-			this->Send(builder.GetBufferPointer(), builder.GetSize());
-			builder.Reset();
+			this->SendResponse(response);
 		}
 		void Error(const char* reason = nullptr);
 		void TypeError(const char* reason = nullptr);
+		bool IsBatched() const
+		{
+			return this->batchRequest != nullptr;
+		}
+		void AcceptBatch();
 
 	private:
 		void Send(uint8_t* buffer, size_t size);
 		void SendResponse(const flatbuffers::Offset<FBS::Response::Response>& response);
+		void AddBatchResponse(const uint8_t* data, size_t len);
 
 	public:
 		// Passed by argument.
 		Channel::ChannelSocket* channel{ nullptr };
 		const FBS::Request::Request* data{ nullptr };
+		ChannelRequest* batchRequest{ nullptr };
 		// Others.
+		std::vector<flatbuffers::Offset<FBS::Response::BatchResponseItem>> batchResponses;
 		flatbuffers::FlatBufferBuilder bufferBuilder{};
 		uint32_t id{ 0u };
 		Method method;
 		const char* methodCStr;
-		std::string handlerId;
+		// Not copied since it is only looked up when there is no valid handle.
+		const flatbuffers::String* handlerId{ nullptr };
+		uint32_t handlerHandle{ 0u };
 		bool replied{ false };
 	};
 } // namespace Channel
@@ -5,9 +5,25 @@
 #include "Channel/ChannelSocket.hpp"
 #include <absl/container/flat_hash_map.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
 class ChannelMessageRegistrator
 {
+public:
+	// Handle value meaning "no handle".
+	static constexpr uint32_t NoHandle{ 0u };
+
+private:
+	struct HandlerSlot
+	{
+		std::string id;
+		Channel::ChannelSocket::RequestHandler* channelRequestHandler{ nullptr };
+		Channel::ChannelSocket::NotificationHandler* channelNotificationHandler{ nullptr };
+		uint16_t generation{ 1u };
+		bool used{ false };
+	};
+
 public:
 	explicit ChannelMessageRegistrator();
 	~ChannelMessageRegistrator();
@@ -15,17 +31,33 @@ public:
 public:
 	flatbuffers::Offset<FBS::Worker::ChannelMessageHandlers> FillBuffer(
 	  flatbuffers::FlatBufferBuilder& builder);
-	void RegisterHandler(
+	uint32_t RegisterHandler(
 	  const std::string& id,
 	  Channel::ChannelSocket::RequestHandler* channelRequestHandler,
 	  Channel::ChannelSocket::NotificationHandler* channelNotificationHandler);
 	void UnregisterHandler(const std::string& id);
+	uint32_t GetHandle(const std::string& id) const;
 	Channel::ChannelSocket::RequestHandler* GetChannelRequestHandler(const std::string& id);
+	Channel::ChannelSocket::RequestHandler* GetChannelRequestHandler(
+	  uint32_t handle, std::string_view id);
 	Channel::ChannelSocket::NotificationHandler* GetChannelNotificationHandler(const std::string& id);
+	Channel::ChannelSocket::NotificationHandler* GetChannelNotificationHandler(
+	  uint32_t handle, std::string_view id);
+
+private:
+	uint32_t AllocateHandle();
+	void ReleaseHandle(uint32_t handle);
+	HandlerSlot* GetSlot(uint32_t handle);
+	HandlerSlot* GetSlot(uint32_t handle, std::string_view id);
 
 private:
 	absl::flat_hash_map<std::string, Channel::ChannelSocket::RequestHandler*> mapChannelRequestHandlers;
 	absl::flat_hash_map<std::string, Channel::ChannelSocket::NotificationHandler*> mapChannelNotificationHandlers;
+	// Compact handles assigned to each registered id.
+	absl::flat_hash_map<std::string, uint32_t> mapHandles;
+	// Dense index of handlers addressed by handle.
+	std::vector<HandlerSlot> slots;
+	std::vector<uint32_t> freeSlots;
 };
 
 #endif
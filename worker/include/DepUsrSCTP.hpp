@@ -2,9 +2,11 @@
 #define MS_DEP_USRSCTP_HPP
 
 #include "common.hpp"
+#include "FBS/worker.h"
 #include "RTC/SctpAssociation.hpp"
 #include "handles/TimerHandle.hpp"
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 class DepUsrSCTP
 {
@@ -18,16 +20,40 @@ private:
 	public:
 		void Start();
 		void Stop();
+		void Kick();
+		void AddSctpAssociation(RTC::SctpAssociation* sctpAssociation);
+		void RemoveSctpAssociation(RTC::SctpAssociation* sctpAssociation);
+		flatbuffers::Offset<FBS::Worker::UsrSctpDump> FillBuffer(
+		  flatbuffers::FlatBufferBuilder& builder) const;
 
 		/* Pure virtual methods inherited from TimerHandle::Listener. */
 	public:
 		void OnTimer(TimerHandle* timer) override;
 
+	private:
+		bool HasActiveSctpAssociations() const;
+
 	private:
 		TimerHandle* timer{ nullptr };
+		// SctpAssociations owned by this thread.
+		absl::flat_hash_set<RTC::SctpAssociation*> sctpAssociations;
 		uint64_t lastCalledAtMs{ 0u };
+		uint64_t lastActivityAtMs{ 0u };
+		uint64_t interval{ 0u };
+		bool activity{ false };
+		uint64_t wakeupCount{ 0u };
+		uint64_t idleCount{ 0u };
 	};
 
+public:
+	// usrsctp does not expose the deadline of its next timer, so the Checker
+	// runs a one-shot timer that is rearmed with the shortest interval on SCTP
+	// activity and backs off while there is none.
+	static constexpr uint64_t CheckerMinInterval{ 10u };  // In ms.
+	static constexpr uint64_t CheckerMaxInterval{ 160u }; // In ms.
+	// Longer than the SCTP delayed SACK timeout (200 ms).
+	static constexpr uint64_t CheckerIdleTimeout{ 500u }; // In ms.
+
 public:
 	static void ClassInit();
 	static void ClassDestroy();
@@ -37,10 +63,14 @@ public:
 	static void RegisterSctpAssociation(RTC::SctpAssociation* sctpAssociation);
 	static void DeregisterSctpAssociation(RTC::SctpAssociation* sctpAssociation);
 	static RTC::SctpAssociation* RetrieveSctpAssociation(uintptr_t id);
+	static void OnSctpActivity();
+	static uint64_t GetCheckerInterval(
+	  uint64_t interval, bool activity, uint64_t idleMs, bool hasActiveSctpAssociations);
+	static flatbuffers::Offset<FBS::Worker::UsrSctpDump> FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder);
 
 private:
 	thread_local static Checker* checker;
-	static uint64_t numSctpAssociations;
 	static uintptr_t nextSctpAssociationId;
 	static absl::flat_hash_map<uintptr_t, RTC::SctpAssociation*> mapIdSctpAssociation;
 };
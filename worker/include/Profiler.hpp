@@ -0,0 +1,151 @@
+#ifndef MS_PROFILER_HPP
+#define MS_PROFILER_HPP
+
+#include "common.hpp"
+#include "FBS/worker.h"
+#include <uv.h>
+#include <array>
+
+// Measures the time spent in the given pipeline stage until the end of the
+// current scope. Compiled out unless the ms_profiling build option is set.
+#ifdef MS_PROFILING
+	#define MS_PROFILE_STAGE(stage) \
+		const Profiler::Scope msProfilerScope##stage(Profiler::Stage::stage)
+#else
+	#define MS_PROFILE_STAGE(stage) {}
+#endif
+
+class Profiler
+{
+public:
+	enum class Stage : uint8_t
+	{
+		UDP_RECV = 0,
+		SRTP_DECRYPT,
+		RTP_PARSE,
+		PRODUCER_RECEIVE,
+		ROUTER_FAN_OUT,
+		CONSUMER_SEND,
+		SRTP_ENCRYPT,
+		UDP_SEND,
+		MAX
+	};
+
+public:
+	/**
+	 * HDR style histogram of durations in nanoseconds. Every power of two range
+	 * is split into SubBucketCount / 2 linear buckets, so recorded values keep
+	 * a relative precision of ~3% with a fixed amount of memory.
+	 */
+	class Histogram
+	{
+	public:
+		static constexpr size_t SubBucketBits{ 5u };
+		static constexpr size_t SubBucketCount{ 1u << SubBucketBits };
+		static constexpr size_t SubBucketHalfCount{ SubBucketCount / 2u };
+		// Greater values (more than 18 minutes) are clamped.
+		static constexpr size_t MaxValueBits{ 40u };
+		static constexpr uint64_t MaxValue{ (uint64_t{ 1u } << MaxValueBits) - 1u };
+		static constexpr size_t NumBuckets{ (MaxValueBits - SubBucketBits + 2u) * SubBucketHalfCount };
+
+	public:
+		static size_t GetBucketIndex(uint64_t value);
+		static uint64_t GetBucketLowerBound(size_t idx);
+		static uint64_t GetBucketUpperBound(size_t idx);
+
+	public:
+		void Record(uint64_t value);
+		void Reset();
+		uint64_t GetCount() const
+		{
+			return this->count;
+		}
+		uint64_t GetMin() const
+		{
+			return this->count > 0u ? this->min : 0u;
+		}
+		uint64_t GetMax() const
+		{
+			return this->max;
+		}
+		uint64_t GetMean() const
+		{
+			return this->count > 0u ? this->sum / this->count : 0u;
+		}
+		uint64_t GetValueAtPercentile(double percentile) const;
+
+	private:
+		std::array<uint64_t, NumBuckets> buckets{};
+		uint64_t count{ 0u };
+		uint64_t sum{ 0u };
+		uint64_t min{ MaxValue };
+		uint64_t max{ 0u };
+	};
+
+public:
+	class Scope
+	{
+	public:
+		explicit Scope(Stage stage) : stage(stage)
+		{
+			if (Profiler::ShouldSample(stage))
+			{
+				this->startNs = uv_hrtime();
+			}
+		}
+		~Scope()
+		{
+			if (this->startNs != 0u)
+			{
+				Profiler::Record(this->stage, uv_hrtime() - this->startNs);
+			}
+		}
+		Scope(const Scope&)            = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		Stage stage;
+		uint64_t startNs{ 0u };
+	};
+
+public:
+	// Just one in every SampleInterval calls of each stage is measured, which
+	// keeps the cost of reading the clock out of most packets.
+	static constexpr uint32_t SampleInterval{ 16u };
+
+public:
+	static void ClassInit();
+	static void ClassDestroy();
+	static const char* GetStageName(Stage stage);
+	// Counts the call and tells whether it must be measured.
+	static bool ShouldSample(Stage stage)
+	{
+		// NOTE: Threads other than the Worker one (i.e. send offload threads) are
+		// not profiled.
+		if (!Profiler::data)
+		{
+			return false;
+		}
+
+		return (++Profiler::data->calls[static_cast<size_t>(stage)] & (SampleInterval - 1u)) == 0u;
+	}
+	static void Record(Stage stage, uint64_t durationNs)
+	{
+		Profiler::data->histograms[static_cast<size_t>(stage)].Record(durationNs);
+	}
+	static void Reset();
+	static flatbuffers::Offset<FBS::Worker::ProfileResponse> FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder);
+
+private:
+	struct Data
+	{
+		std::array<uint64_t, static_cast<size_t>(Stage::MAX)> calls{};
+		std::array<Histogram, static_cast<size_t>(Stage::MAX)> histograms;
+	};
+
+private:
+	thread_local static Data* data;
+};
+
+#endif
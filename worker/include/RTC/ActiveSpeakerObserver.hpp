@@ -5,8 +5,8 @@
 #include "RTC/Shared.hpp"
 #include "handles/TimerHandle.hpp"
 #include <absl/container/flat_hash_map.h>
+#include <array>
 #include <utility>
-#include <vector>
 
 // Implementation of Dominant Speaker Identification for Multipoint
 // Videoconferencing by Ilana Volfin and Israel Cohen. This implementation uses
@@ -18,12 +18,22 @@ namespace RTC
 	class ActiveSpeakerObserver : public RTC::RtpObserver, public TimerHandle::Listener
 	{
 	private:
+		static const size_t RelativeSpeachActivitiesLen{ 3u };
+
+	public:
+		static constexpr size_t LevelsBuffLen{ 50u };
+		static constexpr size_t ImmediatesBuffLen{ 50u };
+		static constexpr size_t MediumsBuffLen{ 10u };
+		static constexpr size_t LongsBuffLen{ 1u };
+
+	public:
 		class Speaker
 		{
 		public:
 			Speaker();
 			void EvalActivityScores();
-			double GetActivityScore(uint8_t interval);
+			double GetActivityScore(uint8_t interval) const;
+			double GetRelativeActivityScore(uint8_t interval, const Speaker* other) const;
 			void LevelChanged(uint32_t level, uint64_t now);
 			void LevelTimedOut(uint64_t now);
 
@@ -31,29 +41,28 @@ namespace RTC
 			bool ComputeImmediates();
 			bool ComputeLongs();
 			bool ComputeMediums();
-			void EvalImmediateActivityScore();
-			void EvalMediumActivityScore();
-			void EvalLongActivityScore();
 			void UpdateMinLevel(int8_t level);
 
 		public:
 			bool paused{ false };
-			double immediateActivityScore{ 0 };
-			double mediumActivityScore{ 0 };
-			double longActivityScore{ 0 };
 			uint64_t lastLevelChangeTime{ 0 };
 
 		private:
+			// Activity scores only depend on the number of active subunits in the
+			// most recent immediate, medium and long interval, so that number is
+			// stored instead of the score itself.
+			std::array<uint8_t, RelativeSpeachActivitiesLen> activities{};
 			uint8_t minLevel{ 0u };
 			uint8_t nextMinLevel{ 0u };
 			uint32_t nextMinLevelWindowLen{ 0u };
-			std::vector<uint8_t> immediates;
-			std::vector<uint8_t> mediums;
-			std::vector<uint8_t> longs;
-			std::vector<uint8_t> levels;
+			std::array<uint8_t, ImmediatesBuffLen> immediates{};
+			std::array<uint8_t, MediumsBuffLen> mediums{};
+			std::array<uint8_t, LongsBuffLen> longs{};
+			std::array<uint8_t, LevelsBuffLen> levels{};
 			size_t nextLevelIndex{ 0u };
 		};
 
+	private:
 		class ProducerSpeaker
 		{
 		public:
@@ -65,9 +74,6 @@ namespace RTC
 			Speaker* speaker;
 		};
 
-	private:
-		static const size_t RelativeSpeachActivitiesLen{ 3u };
-
 	public:
 		ActiveSpeakerObserver(
 		  RTC::Shared* shared,
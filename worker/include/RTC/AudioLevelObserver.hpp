@@ -5,6 +5,7 @@
 #include "RTC/Shared.hpp"
 #include "handles/TimerHandle.hpp"
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 namespace RTC
 {
@@ -17,6 +18,10 @@ namespace RTC
 			size_t count{ 0u };      // Number of dBvos entries in totalSum.
 		};
 
+	private:
+		// A Producer replaces a forwarded one if it's louder by this many dBov.
+		static constexpr int8_t LastNHysteresis{ 6 };
+
 	public:
 		AudioLevelObserver(
 		  RTC::Shared* shared,
@@ -31,12 +36,15 @@ namespace RTC
 		void ReceiveRtpPacket(RTC::Producer* producer, RTC::RtpPacket* packet) override;
 		void ProducerPaused(RTC::Producer* producer) override;
 		void ProducerResumed(RTC::Producer* producer) override;
+		bool IsForwarding(RTC::Producer* producer) const override;
 
 	private:
 		void Paused() override;
 		void Resumed() override;
 		void Update();
+		void UpdateForwardedProducers();
 		void ResetMapProducerDBovs();
+		void AddForwardedProducer(RTC::Producer* producer);
 
 		/* Pure virtual methods inherited from TimerHandle. */
 	protected:
@@ -47,10 +55,13 @@ namespace RTC
 		uint16_t maxEntries{ 1u };
 		int8_t threshold{ -80 };
 		uint16_t interval{ 1000u };
+		// Max number of Producers forwarded to Consumers (0 means all).
+		uint16_t lastN{ 0u };
 		// Allocated by this.
 		TimerHandle* periodicTimer{ nullptr };
 		// Others.
 		absl::flat_hash_map<RTC::Producer*, DBovs> mapProducerDBovs;
+		absl::flat_hash_set<RTC::Producer*> forwardedProducers;
 		bool silence{ true };
 	};
 } // namespace RTC
@@ -149,7 +149,20 @@ namespace RTC
 		virtual uint32_t IncreaseLayer(uint32_t bitrate, bool considerLoss) = 0;
 		virtual void ApplyLayers()                                          = 0;
 		virtual uint32_t GetDesiredBitrate() const                          = 0;
+		// Whether the Consumer has not sent any RTP packet yet and is waiting for
+		// a key frame, so it can be fed with the Producer cached key frame.
+		virtual bool IsWaitingForFirstKeyFrame() const
+		{
+			return false;
+		}
 		virtual void SendRtpPacket(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket) = 0;
+		// Called instead of SendRtpPacket() for packets that must not be
+		// forwarded. Returns false if the Consumer cannot skip packets, so they
+		// must be sent anyway.
+		virtual bool SkipRtpPacket(RTC::RtpPacket* /*packet*/)
+		{
+			return false;
+		}
 		virtual bool GetRtcp(RTC::RTCP::CompoundPacket* packet, uint64_t nowMs) = 0;
 		virtual const std::vector<RTC::RtpStreamSend*>& GetRtpStreams() const   = 0;
 		virtual void NeedWorstRemoteFractionLost(uint32_t mappedSsrc, uint8_t& worstRemoteFractionLost) = 0;
@@ -0,0 +1,108 @@
+#ifndef MS_RTC_CPU_TIME_COUNTER_HPP
+#define MS_RTC_CPU_TIME_COUNTER_HPP
+
+#include "common.hpp"
+#include <uv.h>
+
+namespace RTC
+{
+	/**
+	 * Loop time spent on behalf of an entity (Router, Transport). Time is
+	 * counted by Scope instances. Scopes nest: while an inner Scope is open the
+	 * outer one is paused, so the time of every call path is attributed just
+	 * once, to the innermost entity (i.e. a Transport sending the packets that
+	 * another Transport received).
+	 *
+	 * Scopes are opened for every packet, so just one in every SampleInterval
+	 * call paths of each entity is measured (and accounted SampleInterval
+	 * times). The phase is kept per entity so entities whose packets arrive
+	 * interleaved in a fixed order are all measured. Whether a call path is
+	 * measured is decided by its outermost Scope, so the inner ones are
+	 * measured along with it.
+	 */
+	class CpuTimeCounter
+	{
+	public:
+		static constexpr uint32_t SampleInterval{ 16u };
+
+	public:
+		class Scope
+		{
+		public:
+			explicit Scope(CpuTimeCounter& counter)
+			  : counter(counter), parent(Scope::current),
+			    sampled(this->parent ? this->parent->sampled : counter.ShouldSample())
+			{
+				Scope::current = this;
+
+				if (!this->sampled)
+				{
+					return;
+				}
+
+				const uint64_t nowNs = uv_hrtime();
+
+				if (this->parent)
+				{
+					this->parent->Pause(nowNs);
+				}
+
+				this->startNs = nowNs;
+			}
+			~Scope()
+			{
+				Scope::current = this->parent;
+
+				if (!this->sampled)
+				{
+					return;
+				}
+
+				const uint64_t nowNs = uv_hrtime();
+
+				Pause(nowNs);
+
+				if (this->parent)
+				{
+					this->parent->startNs = nowNs;
+				}
+			}
+			Scope(const Scope&)            = delete;
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			void Pause(uint64_t nowNs)
+			{
+				this->counter.timeNs += (nowNs - this->startNs) * SampleInterval;
+			}
+
+		private:
+			CpuTimeCounter& counter;
+			Scope* parent{ nullptr };
+			bool sampled{ false };
+			uint64_t startNs{ 0u };
+
+		private:
+			thread_local static Scope* current;
+		};
+
+	public:
+		uint64_t GetTimeNs() const
+		{
+			return this->timeNs;
+		}
+
+	private:
+		bool ShouldSample()
+		{
+			return (this->calls++ & (SampleInterval - 1u)) == 0u;
+		}
+
+	private:
+		uint64_t timeNs{ 0u };
+		// Number of outermost Scopes of this entity opened so far.
+		uint32_t calls{ 0u };
+	};
+} // namespace RTC
+
+#endif
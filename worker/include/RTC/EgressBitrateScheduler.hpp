@@ -0,0 +1,82 @@
+#ifndef MS_RTC_EGRESS_BITRATE_SCHEDULER_HPP
+#define MS_RTC_EGRESS_BITRATE_SCHEDULER_HPP
+
+#include "common.hpp"
+#include "handles/TimerHandle.hpp"
+#include <absl/container/flat_hash_map.h>
+#include <vector>
+
+namespace RTC
+{
+	// Keeps the egress bitrate of all the Transports of a worker within a
+	// given budget. It periodically collects the bitrate that each Transport
+	// sends and wants to send and, if the budget is exceeded, it caps the
+	// available outgoing bitrate of each Transport so the ones with higher
+	// priority keep their bitrate and the ones with lower priority step down
+	// first.
+	class EgressBitrateScheduler : public TimerHandle::Listener
+	{
+	public:
+		class Listener
+		{
+		public:
+			virtual ~Listener() = default;
+
+		public:
+			virtual uint32_t GetEgressSendBitrate(uint64_t nowMs)                                   = 0;
+			virtual uint32_t GetEgressDesiredBitrate() const                                        = 0;
+			virtual uint8_t GetEgressPriority() const                                               = 0;
+			virtual void OnEgressBitrateCapChanged(EgressBitrateScheduler* scheduler, uint32_t cap) = 0;
+		};
+
+	public:
+		struct Demand
+		{
+			uint8_t priority{ 0u };
+			uint32_t bitrate{ 0u };
+			// Computed cap (0 means no cap).
+			uint32_t cap{ 0u };
+		};
+
+	public:
+		static constexpr uint64_t IntervalMs{ 1000u };
+		// Never cap a Transport below this bitrate.
+		static constexpr uint32_t MinBitrateCap{ 30000u };
+
+	public:
+		static void AllocateCaps(uint32_t budget, std::vector<Demand>& demands);
+
+	public:
+		explicit EgressBitrateScheduler(uint32_t budget);
+		~EgressBitrateScheduler() override;
+
+	public:
+		uint32_t GetBudget() const
+		{
+			return this->budget;
+		}
+		uint32_t GetSendBitrate() const
+		{
+			return this->sendBitrate;
+		}
+		void AddListener(Listener* listener);
+		void RemoveListener(Listener* listener);
+
+		/* Pure virtual methods inherited from TimerHandle::Listener. */
+	public:
+		void OnTimer(TimerHandle* timer) override;
+
+	private:
+		// Passed by argument.
+		uint32_t budget{ 0u };
+		// Allocated by this.
+		TimerHandle* timer{ nullptr };
+		// Others.
+		// Current cap of each Listener (0 means no cap).
+		absl::flat_hash_map<Listener*, uint32_t> mapListenerCap;
+		std::vector<Demand> demands;
+		uint32_t sendBitrate{ 0u };
+	};
+} // namespace RTC
+
+#endif
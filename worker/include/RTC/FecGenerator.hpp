@@ -0,0 +1,69 @@
+#ifndef MS_RTC_FEC_GENERATOR_HPP
+#define MS_RTC_FEC_GENERATOR_HPP
+
+#include "common.hpp"
+#include "RTC/RtpPacket.hpp"
+
+namespace RTC
+{
+	// Generates FlexFEC (RFC 8627) repair packets for a RTP stream. Consecutive
+	// media packets are protected in groups (row FEC with flexible mask) and a
+	// repair packet, the XOR of all the packets in the group, is generated once
+	// each group is completed, so the remote endpoint can recover one lost
+	// packet per group without waiting for a retransmission.
+	class FecGenerator
+	{
+	public:
+		// Groups must fit into the 15 bits of the shortest flexible mask.
+		static constexpr size_t MaxGroupSize{ 15u };
+		static constexpr size_t MinGroupSize{ 2u };
+		// Size of the FEC header with R=0, F=0 and the shortest mask.
+		static constexpr size_t FecHeaderSize{ 12u };
+
+	public:
+		static void XorBytes(uint8_t* dst, const uint8_t* src, size_t len);
+		static size_t ComputeGroupSize(
+		  uint8_t fractionLost, uint32_t mediaBitrate, uint32_t maxFecBitrate);
+
+	public:
+		FecGenerator(uint8_t payloadType, uint32_t ssrc, uint32_t protectedSsrc);
+		virtual ~FecGenerator();
+
+	public:
+		size_t GetGroupSize() const
+		{
+			return this->groupSize;
+		}
+		// Takes effect with the next group. 0 disables the generation.
+		void SetGroupSize(size_t groupSize);
+		size_t GetPacketCount() const
+		{
+			return this->packetCount;
+		}
+		// Adds a sent media packet to the current group. It returns the repair
+		// packet once the group is completed (valid until the next call).
+		RTC::RtpPacket* AddPacket(const RTC::RtpPacket* packet);
+
+	private:
+		void ResetGroup();
+
+	private:
+		// Allocated by this.
+		uint8_t* fecPacketBuffer{ nullptr };
+		RTC::RtpPacket* fecPacket{ nullptr };
+		// Others.
+		uint8_t* fecPayload{ nullptr };
+		size_t groupSize{ 0u };
+		size_t nextGroupSize{ 0u };
+		size_t groupPacketCount{ 0u };
+		uint16_t snBase{ 0u };
+		// XOR of the first 8 bytes of the bit strings of the protected packets.
+		uint8_t recoveryHeader[8];
+		// XOR of the protected packets after their fixed RTP header.
+		uint8_t* recoveryPayload{ nullptr };
+		size_t recoveryPayloadLength{ 0u };
+		size_t packetCount{ 0u };
+	};
+} // namespace RTC
+
+#endif
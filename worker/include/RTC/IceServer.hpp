@@ -5,7 +5,9 @@
 #include "FBS/webRtcTransport.h"
 #include "RTC/StunPacket.hpp"
 #include "RTC/TransportTuple.hpp"
+#include "Utils.hpp"
 #include <list>
+#include <memory>
 #include <string>
 
 namespace RTC
@@ -87,6 +89,9 @@ namespace RTC
 			this->oldPassword = this->password;
 			this->password    = password;
 
+			this->oldHmacSha1 = std::move(this->hmacSha1);
+			this->hmacSha1    = std::make_unique<Utils::Crypto::HmacSha1>(password);
+
 			this->remoteNomination = 0u;
 
 			// Notify the listener.
@@ -129,6 +134,10 @@ namespace RTC
 		std::string password;
 		std::string oldUsernameFragment;
 		std::string oldPassword;
+		// HMAC-SHA1 keyed with password and oldPassword, so STUN messages are
+		// authenticated without processing the key every time.
+		std::unique_ptr<Utils::Crypto::HmacSha1> hmacSha1;
+		std::unique_ptr<Utils::Crypto::HmacSha1> oldHmacSha1;
 		IceState state{ IceState::NEW };
 		uint32_t remoteNomination{ 0u };
 		std::list<RTC::TransportTuple> tuples;
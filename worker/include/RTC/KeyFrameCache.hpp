@@ -0,0 +1,67 @@
+#ifndef MS_RTC_KEY_FRAME_CACHE_HPP
+#define MS_RTC_KEY_FRAME_CACHE_HPP
+
+#include "common.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <memory>
+#include <vector>
+
+namespace RTC
+{
+	// Holds the packets of the most recent key frame of a stream plus those of
+	// the following delta frames, so new Consumers can start without asking the
+	// endpoint for a new key frame. Packets received out of order are held in a
+	// small reorder window. The cache is invalidated when a packet is missing
+	// or when it becomes too big, until a new key frame is received.
+	class KeyFrameCache
+	{
+	public:
+		static constexpr size_t DefaultMaxPackets{ 500u };
+		// Max number of packets held while waiting for a missing one.
+		static constexpr size_t ReorderWindow{ 8u };
+
+	public:
+		explicit KeyFrameCache(size_t maxPackets = DefaultMaxPackets);
+
+	public:
+		void Insert(const RTC::RtpPacket* packet);
+		void Clear();
+		bool IsValid() const
+		{
+			return this->valid;
+		}
+		// Returns the cached packets or nullptr if the cache is not valid or a
+		// packet is still missing. It updates hit/miss counters.
+		const std::vector<std::shared_ptr<RTC::RtpPacket>>* Lookup();
+		size_t GetSize() const
+		{
+			return this->packets.size();
+		}
+		uint64_t GetHits() const
+		{
+			return this->hits;
+		}
+		uint64_t GetMisses() const
+		{
+			return this->misses;
+		}
+
+	private:
+		void Append(const std::shared_ptr<RTC::RtpPacket>& packet);
+
+	private:
+		// Passed by argument.
+		size_t maxPackets{ DefaultMaxPackets };
+		// Others.
+		std::vector<std::shared_ptr<RTC::RtpPacket>> packets;
+		// Packets received after a missing one, sorted by sequence number.
+		std::vector<std::shared_ptr<RTC::RtpPacket>> reorderPackets;
+		bool valid{ false };
+		uint32_t keyFrameTimestamp{ 0u };
+		uint16_t nextSeq{ 0u };
+		uint64_t hits{ 0u };
+		uint64_t misses{ 0u };
+	};
+} // namespace RTC
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef MS_RTC_PIPE_LOCAL_LINK_HPP
+#define MS_RTC_PIPE_LOCAL_LINK_HPP
+
+#include "common.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <absl/container/flat_hash_map.h>
+#include <uv.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace RTC
+{
+	// In-process link between PipeTransports whose workers run as threads of
+	// the same process. Each link owns an inbox, a multiple producer single
+	// consumer queue registered by name in a process wide registry, and it's
+	// woken up via an uv_async_t handle in its worker loop. The peer link
+	// pushes RTP packets into it (already parsed, so the receiving worker takes
+	// their ownership with no socket nor parsing) and RTCP data.
+	class PipeLocalLink
+	{
+	public:
+		class Listener
+		{
+		public:
+			virtual ~Listener() = default;
+
+		public:
+			// The listener takes ownership of the packet.
+			virtual void OnPipeLocalLinkRtpPacketReceived(PipeLocalLink* link, RTC::RtpPacket* packet) = 0;
+			virtual void OnPipeLocalLinkRtcpDataReceived(
+			  PipeLocalLink* link, const uint8_t* data, size_t len) = 0;
+		};
+
+	private:
+		struct Item
+		{
+			std::atomic<Item*> next{ nullptr };
+			// Owned by the item.
+			RTC::RtpPacket* rtpPacket{ nullptr };
+			uint8_t* rtcpData{ nullptr };
+			size_t rtcpLen{ 0u };
+		};
+
+		struct Inbox
+		{
+			~Inbox();
+
+			void Push(Item* item);
+			Item* Pop();
+
+			// Written by producers.
+			alignas(64) std::atomic<Item*> head{ std::addressof(stub) };
+			// Only accessed by the consumer.
+			alignas(64) Item* tail{ std::addressof(stub) };
+			Item stub;
+			std::atomic<bool> wakeUpPending{ false };
+			std::atomic<bool> closed{ false };
+			// Protects uvAsyncHandle from being used once closed.
+			std::mutex mutex;
+			uv_async_t* uvAsyncHandle{ nullptr };
+		};
+
+	private:
+		static std::mutex registryMutex;
+		static absl::flat_hash_map<std::string, std::shared_ptr<Inbox>> registry;
+
+	public:
+		explicit PipeLocalLink(Listener* listener);
+		~PipeLocalLink();
+
+	public:
+		const std::string& GetName() const
+		{
+			return this->name;
+		}
+		void Connect(const std::string& peerName);
+		bool IsConnected() const
+		{
+			return this->peerInbox && !this->peerInbox->closed.load(std::memory_order_relaxed);
+		}
+		bool SendRtpPacket(const RTC::RtpPacket* packet);
+		bool SendRtcp(const uint8_t* data, size_t len);
+
+	private:
+		void Push(Item* item);
+
+		/* Callbacks fired by UV events. */
+	public:
+		void OnUvAsync();
+
+	private:
+		// Passed by argument.
+		Listener* listener{ nullptr };
+		// Others.
+		std::string name;
+		std::shared_ptr<Inbox> inbox;
+		std::shared_ptr<Inbox> peerInbox;
+	};
+} // namespace RTC
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef MS_RTC_PIPE_SHM_RING_HPP
+#define MS_RTC_PIPE_SHM_RING_HPP
+
+#include "common.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace RTC
+{
+	// Single producer single consumer ring of RTP packets living in a POSIX
+	// shared memory object, used by PipeTransports whose peer runs in another
+	// worker of the same host. The sending PipeTransport creates the ring and
+	// writes packets into it, and the receiving one opens it by name and parses
+	// packets directly from the shared slots.
+	class PipeShmRing
+	{
+	public:
+		using onDataCallback = const std::function<void(uint8_t* data, size_t len)>;
+
+	public:
+		// Must be power of 2.
+		static constexpr size_t NumSlots{ 1024u };
+		// Leave room so received RTP packets can be expanded in place.
+		static constexpr size_t SlotDataSize{ RTC::MtuSize + 100u };
+
+	private:
+		static constexpr uint32_t Magic{ 0x4D535352 }; // "MSSR".
+
+	private:
+		struct Header
+		{
+			uint32_t magic;
+			uint32_t numSlots;
+			uint32_t slotDataSize;
+			std::atomic<uint32_t> consumerAttached;
+			// Written by the producer.
+			alignas(64) std::atomic<uint64_t> tail;
+			// Written by the consumer.
+			alignas(64) std::atomic<uint64_t> head;
+			std::atomic<uint32_t> consumerWaiting;
+		};
+
+		struct Slot
+		{
+			uint32_t len;
+			uint8_t data[SlotDataSize];
+		};
+
+	public:
+		// Creates a new ring (producer side).
+		PipeShmRing();
+		// Opens the ring created by the peer (consumer side).
+		explicit PipeShmRing(const std::string& name);
+		~PipeShmRing();
+
+	public:
+		const std::string& GetName() const
+		{
+			return this->name;
+		}
+		bool IsConsumerAttached() const
+		{
+			return this->header->consumerAttached.load(std::memory_order_acquire) != 0;
+		}
+		bool HasUnreadPackets() const
+		{
+			return this->header->tail.load(std::memory_order_relaxed) !=
+			       this->header->head.load(std::memory_order_acquire);
+		}
+		bool Write(const uint8_t* data, size_t len);
+		bool ShouldWakeUpConsumer();
+		bool IsConsumerStalled();
+		size_t Read(onDataCallback& onData);
+		bool Sleep();
+
+	private:
+		void Map(int fd, bool create);
+
+	private:
+		std::string name;
+		bool owner{ false };
+		Header* header{ nullptr };
+		Slot* slots{ nullptr };
+		size_t mappingSize{ 0u };
+		// Consumer head seen by the producer in the last IsConsumerStalled() call.
+		uint64_t lastHead{ 0u };
+	};
+} // namespace RTC
+
+#endif
@@ -2,21 +2,37 @@
 #define MS_RTC_PIPE_TRANSPORT_HPP
 
 #include "FBS/pipeTransport.h"
+#include "RTC/PipeLocalLink.hpp"
+#include "RTC/PipeShmRing.hpp"
 #include "RTC/Shared.hpp"
 #include "RTC/SrtpSession.hpp"
 #include "RTC/Transport.hpp"
 #include "RTC/TransportTuple.hpp"
 #include "RTC/UdpSocket.hpp"
+#include "handles/CheckHandle.hpp"
+#include <deque>
+#include <functional>
+#include <vector>
 
 namespace RTC
 {
-	class PipeTransport : public RTC::Transport, public RTC::UdpSocket::Listener
+	class PipeTransport : public RTC::Transport,
+	                      public RTC::UdpSocket::Listener,
+	                      public RTC::PipeLocalLink::Listener,
+	                      public CheckHandle::Listener
 	{
 	private:
 		static RTC::SrtpSession::CryptoSuite srtpCryptoSuite;
 		static std::string srtpCryptoSuiteString;
 		static size_t srtpMasterLength;
 
+	public:
+		using onAggregatedRtpPacket = const std::function<void(const uint8_t* data, size_t len)>;
+
+	public:
+		static bool ParseAggregatedRtpData(
+		  const uint8_t* data, size_t len, onAggregatedRtpPacket& onPacket);
+
 	public:
 		PipeTransport(
 		  RTC::Shared* shared,
@@ -46,6 +62,11 @@ namespace RTC
 		  RTC::Consumer* consumer,
 		  RTC::RtpPacket* packet,
 		  RTC::Transport::onSendCallback* cb = nullptr) override;
+		bool AggregateRtpPacket(RTC::RtpPacket* packet, RTC::Transport::onSendCallback* cb);
+		void FlushAggregatedRtpPackets();
+		bool CanSendShmData(size_t len) const;
+		bool SendShmData(const uint8_t* data, size_t len);
+		void WriteShmPendingPackets();
 		void SendRtcpPacket(RTC::RTCP::Packet* packet) override;
 		void SendRtcpCompoundPacket(RTC::RTCP::CompoundPacket* packet) override;
 		void SendMessage(
@@ -61,24 +82,63 @@ namespace RTC
 		void OnRtpDataReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
 		void OnRtcpDataReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
 		void OnSctpDataReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
+		void OnAggregatedRtpDataReceived(const uint8_t* data, size_t len);
+		void ReadShmRing();
+		void OnShmDataReceived(uint8_t* data, size_t len);
 
 		/* Pure virtual methods inherited from RTC::UdpSocket::Listener. */
 	public:
 		void OnUdpSocketPacketReceived(
 		  RTC::UdpSocket* socket, const uint8_t* data, size_t len, const struct sockaddr* remoteAddr) override;
 
+		/* Pure virtual methods inherited from RTC::PipeLocalLink::Listener. */
+	public:
+		void OnPipeLocalLinkRtpPacketReceived(RTC::PipeLocalLink* link, RTC::RtpPacket* packet) override;
+		void OnPipeLocalLinkRtcpDataReceived(
+		  RTC::PipeLocalLink* link, const uint8_t* data, size_t len) override;
+
+		/* Pure virtual methods inherited from CheckHandle::Listener. */
+	public:
+		void OnCheck(CheckHandle* check) override;
+
+		/* Methods inherited from TimerHandle::Listener. */
+	public:
+		void OnTimer(TimerHandle* timer) override;
+
 	private:
 		// Allocated by this.
 		RTC::UdpSocket* udpSocket{ nullptr };
 		RTC::TransportTuple* tuple{ nullptr };
 		RTC::SrtpSession* srtpRecvSession{ nullptr };
 		RTC::SrtpSession* srtpSendSession{ nullptr };
+		RTC::PipeShmRing* shmSendRing{ nullptr };
+		RTC::PipeShmRing* shmRecvRing{ nullptr };
+		TimerHandle* shmDoorbellTimer{ nullptr };
+		RTC::PipeLocalLink* localLink{ nullptr };
+		CheckHandle* aggregationCheckHandle{ nullptr };
+		uint8_t* aggregationBuffer{ nullptr };
 		// Others.
 		ListenInfo listenInfo;
 		struct sockaddr_storage remoteAddrStorage;
 		bool rtx{ false };
 		std::string srtpKey;
 		std::string srtpKeyBase64;
+		// Packets waiting for room in the shared memory ring.
+		std::deque<std::vector<uint8_t>> shmPendingPackets;
+		uint64_t shmPacketsSent{ 0u };
+		uint64_t shmPacketsReceived{ 0u };
+		uint64_t localPacketsSent{ 0u };
+		uint64_t localPacketsReceived{ 0u };
+		// Max size of aggregated RTP datagrams (0 means disabled).
+		size_t aggregationMaxSize{ 0u };
+		size_t aggregationLen{ 0u };
+		size_t aggregationNumPackets{ 0u };
+		std::vector<RTC::Transport::onSendCallback*> aggregationCallbacks;
+		uint16_t aggregationSeq{ 0u };
+		uint64_t aggregatedPacketsSent{ 0u };
+		uint64_t aggregatedDatagramsSent{ 0u };
+		uint64_t aggregatedPacketsReceived{ 0u };
+		uint64_t aggregatedDatagramsReceived{ 0u };
 	};
 } // namespace RTC
 
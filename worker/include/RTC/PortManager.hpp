@@ -2,7 +2,9 @@
 #define MS_RTC_PORT_MANAGER_HPP
 
 #include "common.hpp"
+#include "FBS/worker.h"
 #include "Settings.hpp"
+#include "handles/CheckHandle.hpp"
 #include <uv.h>
 #include <absl/container/flat_hash_map.h>
 #include <string>
@@ -20,10 +22,89 @@ namespace RTC
 		};
 
 	public:
-		static uv_udp_t* BindUdp(std::string& ip)
+		/**
+		 * Set of available ports of a given IP and transport. Taking and releasing
+		 * a port and iterating the available ones are O(1) operations, so binding
+		 * does not scan the ports in use when most of the range is taken.
+		 */
+		class FreePorts
 		{
-			return reinterpret_cast<uv_udp_t*>(Bind(Transport::UDP, ip));
-		}
+		public:
+			explicit FreePorts(size_t numPorts);
+
+		public:
+			// Number of available ports.
+			size_t GetSize() const
+			{
+				return this->freePortIdxs.size();
+			}
+			// Port index (port minus rtcMinPort) of the available port in the given
+			// position, which must be lower than GetSize().
+			size_t Get(size_t pos) const
+			{
+				return this->freePortIdxs[pos];
+			}
+			bool IsFree(size_t portIdx) const
+			{
+				return this->positions[portIdx] != Taken;
+			}
+			// Both methods invalidate the positions of other available ports.
+			void Take(size_t portIdx);
+			void Release(size_t portIdx);
+
+		private:
+			static constexpr uint32_t Taken{ UINT32_MAX };
+
+		private:
+			// Indexes of the available ports in no particular order.
+			std::vector<uint32_t> freePortIdxs;
+			// Position in freePortIdxs of every port index, or Taken.
+			std::vector<uint32_t> positions;
+		};
+
+	private:
+		/**
+		 * Keeps Settings::configuration.udpSocketPoolSize bound UDP sockets per
+		 * listen IP so creating a transport during a join storm does not pay the
+		 * port search and the bind() syscalls. Consumed sockets are replaced at
+		 * the end of later loop iterations, a few at a time. Datagrams received by
+		 * a pooled socket are discarded when it is taken.
+		 */
+		class UdpSocketPool : public CheckHandle::Listener
+		{
+		public:
+			explicit UdpSocketPool(size_t size);
+			~UdpSocketPool() override;
+
+		public:
+			uv_udp_t* Take(std::string& ip);
+			flatbuffers::Offset<FBS::Worker::UdpSocketPoolDump> FillBuffer(
+			  flatbuffers::FlatBufferBuilder& builder) const;
+
+			/* Pure virtual methods inherited from CheckHandle::Listener. */
+		public:
+			void OnCheck(CheckHandle* check) override;
+
+		private:
+			static void Close(std::string& ip, uv_udp_t* uvHandle);
+
+		private:
+			// Passed by argument.
+			size_t size{ 0u };
+			// Allocated by this.
+			CheckHandle* checkHandle{ nullptr };
+			// Others.
+			absl::flat_hash_map<std::string, std::vector<uv_udp_t*>> mapIpSockets;
+			uint64_t hits{ 0u };
+			uint64_t misses{ 0u };
+		};
+
+	public:
+		static void CreateUdpSocketPool();
+		static void CloseUdpSocketPool();
+		static flatbuffers::Offset<FBS::Worker::UdpSocketPoolDump> FillBuffer(
+		  flatbuffers::FlatBufferBuilder& builder);
+		static uv_udp_t* BindUdp(std::string& ip);
 		static uv_udp_t* BindUdp(std::string& ip, uint16_t port)
 		{
 			return reinterpret_cast<uv_udp_t*>(Bind(Transport::UDP, ip, port));
@@ -49,11 +130,12 @@ namespace RTC
 		static uv_handle_t* Bind(Transport transport, std::string& ip);
 		static uv_handle_t* Bind(Transport transport, std::string& ip, uint16_t port);
 		static void Unbind(Transport transport, std::string& ip, uint16_t port);
-		static std::vector<bool>& GetPorts(Transport transport, const std::string& ip);
+		static FreePorts& GetPorts(Transport transport, const std::string& ip);
 
 	private:
-		thread_local static absl::flat_hash_map<std::string, std::vector<bool>> mapUdpIpPorts;
-		thread_local static absl::flat_hash_map<std::string, std::vector<bool>> mapTcpIpPorts;
+		thread_local static absl::flat_hash_map<std::string, FreePorts> mapUdpIpPorts;
+		thread_local static absl::flat_hash_map<std::string, FreePorts> mapTcpIpPorts;
+		thread_local static UdpSocketPool* udpSocketPool;
 	};
 } // namespace RTC
 
@@ -4,11 +4,15 @@
 #include "common.hpp"
 #include "DepLibUV.hpp"
 #include "RTC/RtpPacket.hpp"
+#include <array>
+#include <vector>
 
 namespace RTC
 {
 	// It is considered that the time source increases monotonically.
 	// ie: the current timestamp can never be minor than a timestamp in the past.
+	// Old items are removed lazily, when the rate is requested or when there is
+	// no room for a new item.
 	class RateCalculator
 	{
 	public:
@@ -16,6 +20,11 @@ namespace RTC
 		static constexpr float DefaultBpsScale{ 8000.0f };
 		static constexpr uint16_t DefaultWindowItems{ 100u };
 
+	private:
+		// Max number of items stored within the instance itself. More items are
+		// allocated in the heap.
+		static constexpr size_t MaxInlineItems{ 128u };
+
 	public:
 		RateCalculator(
 		  size_t windowSizeMs  = DefaultWindowSize,
@@ -24,7 +33,21 @@ namespace RTC
 		  : windowSizeMs(windowSizeMs), scale(scale), windowItems(windowItems)
 		{
 			this->itemSizeMs = std::max(windowSizeMs / windowItems, static_cast<size_t>(1));
-			this->buffer.resize(windowItems);
+
+			// Power of 2 number of items so the index of an item is just masked.
+			size_t numItems{ 1u };
+
+			while (numItems < windowItems)
+			{
+				numItems <<= 1;
+			}
+
+			this->itemsMask = numItems - 1;
+
+			if (numItems > MaxInlineItems)
+			{
+				this->heapBuffer.resize(numItems);
+			}
 		}
 		void Update(size_t size, uint64_t nowMs);
 		uint32_t GetRate(uint64_t nowMs);
@@ -33,28 +56,39 @@ namespace RTC
 			return this->bytes;
 		}
 
+	private:
+		struct BufferItem
+		{
+			uint32_t count{ 0u };
+			// Lower 32 bits of the item start time.
+			uint32_t time{ 0u };
+		};
+
 	private:
 		void RemoveOldData(uint64_t nowMs);
 		void Reset()
 		{
-			std::memset(
-			  static_cast<void*>(&this->buffer.front()), 0, sizeof(BufferItem) * this->buffer.size());
-
 			this->newestItemStartTime = 0u;
-			this->newestItemIndex     = -1;
 			this->oldestItemStartTime = 0u;
-			this->oldestItemIndex     = -1;
+			this->oldestItemIndex     = 0u;
+			this->numItems            = 0u;
 			this->totalCount          = 0u;
 			this->lastRate            = 0u;
 			this->lastTime            = 0u;
 		}
+		BufferItem& GetItem(size_t index)
+		{
+			index &= this->itemsMask;
 
-	private:
-		struct BufferItem
+			return this->heapBuffer.empty() ? this->buffer[index] : this->heapBuffer[index];
+		}
+		uint64_t GetItemStartTime(const BufferItem& item) const
 		{
-			size_t count{ 0u };
-			uint64_t time{ 0u };
-		};
+			// Items are never older than 2^32 ms so the distance to the newest item
+			// fits in 32 bits.
+			return this->newestItemStartTime -
+			       static_cast<uint32_t>(static_cast<uint32_t>(this->newestItemStartTime) - item.time);
+		}
 
 	private:
 		// Window Size (in milliseconds).
@@ -65,16 +99,20 @@ namespace RTC
 		uint16_t windowItems{ DefaultWindowItems };
 		// Item Size (in milliseconds), calculated as: windowSizeMs / windowItems.
 		size_t itemSizeMs{ 0u };
+		// Number of items in the buffer minus 1.
+		size_t itemsMask{ 0u };
 		// Buffer to keep data.
-		std::vector<BufferItem> buffer;
+		std::array<BufferItem, MaxInlineItems> buffer;
+		// Buffer to keep data if it does not fit in the inline one.
+		std::vector<BufferItem> heapBuffer;
 		// Time (in milliseconds) for last item in the time window.
 		uint64_t newestItemStartTime{ 0u };
-		// Index for the last item in the time window.
-		int32_t newestItemIndex{ -1 };
 		// Time (in milliseconds) for oldest item in the time window.
 		uint64_t oldestItemStartTime{ 0u };
-		// Index for the oldest item in the time window.
-		int32_t oldestItemIndex{ -1 };
+		// Index for the oldest item in the time window (not masked).
+		size_t oldestItemIndex{ 0u };
+		// Number of items in the time window.
+		size_t numItems{ 0u };
 		// Total count in the time window.
 		size_t totalCount{ 0u };
 		// Total bytes transmitted.
@@ -0,0 +1,61 @@
+#ifndef MS_RTC_RECORDING_TRANSPORT_HPP
+#define MS_RTC_RECORDING_TRANSPORT_HPP
+
+#include "FBS/recordingTransport.h"
+#include "RTC/RtpDumpWriter.hpp"
+#include "RTC/Shared.hpp"
+#include "RTC/Transport.hpp"
+
+namespace RTC
+{
+	// Records the RTP packets of its Consumers and the RTCP packets generated
+	// for them (Sender Reports) into a file in rtpdump format.
+	class RecordingTransport : public RTC::Transport
+	{
+	public:
+		RecordingTransport(
+		  RTC::Shared* shared,
+		  const std::string& id,
+		  RTC::Transport::Listener* listener,
+		  const FBS::RecordingTransport::RecordingTransportOptions* options);
+		~RecordingTransport() override;
+
+	public:
+		flatbuffers::Offset<FBS::RecordingTransport::GetStatsResponse> FillBufferStats(
+		  flatbuffers::FlatBufferBuilder& builder);
+		flatbuffers::Offset<FBS::RecordingTransport::DumpResponse> FillBuffer(
+		  flatbuffers::FlatBufferBuilder& builder) const;
+
+	private:
+		bool IsConnected() const override;
+		void SendRtpPacket(
+		  RTC::Consumer* consumer,
+		  RTC::RtpPacket* packet,
+		  RTC::Transport::onSendCallback* cb = nullptr) override;
+		void SendRtcpPacket(RTC::RTCP::Packet* packet) override;
+		void SendRtcpCompoundPacket(RTC::RTCP::CompoundPacket* packet) override;
+		void SendMessage(
+		  RTC::DataConsumer* dataConsumer,
+		  const uint8_t* msg,
+		  size_t len,
+		  uint32_t ppid,
+		  onQueuedCallback* cb = nullptr) override;
+		void SendSctpData(const uint8_t* data, size_t len) override;
+		void RecvStreamClosed(uint32_t ssrc) override;
+		void SendStreamClosed(uint32_t ssrc) override;
+
+		/* Methods inherited from Channel::ChannelSocket::RequestHandler. */
+	public:
+		void HandleRequest(Channel::ChannelRequest* request) override;
+
+		/* Methods inherited from Channel::ChannelSocket::NotificationHandler. */
+	public:
+		void HandleNotification(Channel::ChannelNotification* notification) override;
+
+	private:
+		// Allocated by this (but deleted by itself once the file is closed).
+		RTC::RtpDumpWriter* writer{ nullptr };
+	};
+} // namespace RTC
+
+#endif
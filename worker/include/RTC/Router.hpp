@@ -5,6 +5,7 @@
 #include "Channel/ChannelNotification.hpp"
 #include "Channel/ChannelRequest.hpp"
 #include "RTC/Consumer.hpp"
+#include "RTC/CpuTimeCounter.hpp"
 #include "RTC/DataConsumer.hpp"
 #include "RTC/DataProducer.hpp"
 #include "RTC/Producer.hpp"
@@ -43,6 +44,8 @@ namespace RTC
 	public:
 		flatbuffers::Offset<FBS::Router::DumpResponse> FillBuffer(
 		  flatbuffers::FlatBufferBuilder& builder) const;
+		// Loop time spent by the Router and by its current and closed Transports.
+		uint64_t GetCpuTimeNs() const;
 
 		/* Methods inherited from Channel::ChannelSocket::RequestHandler. */
 	public:
@@ -53,6 +56,7 @@ namespace RTC
 		RTC::RtpObserver* GetRtpObserverById(const std::string& rtpObserverId) const;
 		void CheckNoTransport(const std::string& transportId) const;
 		void CheckNoRtpObserver(const std::string& rtpObserverId) const;
+		void DeleteTransport(RTC::Transport* transport);
 
 		/* Pure virtual methods inherited from RTC::Transport::Listener. */
 	public:
@@ -135,6 +139,10 @@ namespace RTC
 		  mapDataProducerDataConsumers;
 		absl::flat_hash_map<RTC::DataConsumer*, RTC::DataProducer*> mapDataConsumerDataProducer;
 		absl::flat_hash_map<std::string, RTC::DataProducer*> mapDataProducers;
+		// Loop time spent forwarding packets to Consumers.
+		RTC::CpuTimeCounter cpuTimeCounter;
+		// Loop time spent by already closed Transports.
+		uint64_t closedTransportsCpuTimeNs{ 0u };
 	};
 } // namespace RTC
 
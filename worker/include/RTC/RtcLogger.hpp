@@ -26,6 +26,7 @@ namespace RTC
 				PACKET_PREVIOUS_TO_SPATIAL_LAYER_SWITCH,
 				DROPPED_BY_CODEC,
 				SEND_RTP_STREAM_DISCARDED,
+				NOT_FORWARDED,
 			};
 
 			static absl::flat_hash_map<DropReason, std::string> dropReason2String;
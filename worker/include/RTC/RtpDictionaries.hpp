@@ -181,6 +181,18 @@ namespace RTC
 		uint32_t ssrc{ 0u };
 	};
 
+	class RtpFecParameters
+	{
+	public:
+		RtpFecParameters() = default;
+		explicit RtpFecParameters(const FBS::RtpParameters::Fec* data);
+
+		flatbuffers::Offset<FBS::RtpParameters::Fec> FillBuffer(flatbuffers::FlatBufferBuilder& builder) const;
+
+	public:
+		uint32_t ssrc{ 0u };
+	};
+
 	class RtpEncodingParameters
 	{
 	public:
@@ -197,6 +209,8 @@ namespace RTC
 		bool hasCodecPayloadType{ false };
 		RtpRtxParameters rtx;
 		bool hasRtx{ false };
+		RtpFecParameters fec;
+		bool hasFec{ false };
 		uint32_t maxBitrate{ 0u };
 		double maxFramerate{ 0 };
 		bool dtx{ false };
@@ -264,6 +278,7 @@ namespace RTC
 		  flatbuffers::FlatBufferBuilder& builder) const;
 		const RTC::RtpCodecParameters* GetCodecForEncoding(RtpEncodingParameters& encoding) const;
 		const RTC::RtpCodecParameters* GetRtxCodecForEncoding(RtpEncodingParameters& encoding) const;
+		const RTC::RtpCodecParameters* GetFecCodec() const;
 
 	private:
 		void ValidateCodecs();
@@ -0,0 +1,112 @@
+#ifndef MS_RTC_RTP_DUMP_WRITER_HPP
+#define MS_RTC_RTP_DUMP_WRITER_HPP
+
+#include "common.hpp"
+#include "FBS/recordingTransport.h"
+#include "handles/TimerHandle.hpp"
+#include <uv.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace RTC
+{
+	/**
+	 * Writes RTP and RTCP packets into a file in rtpdump format (as written by
+	 * rtptools' rtpdump and read by rtpplay, Wireshark or libwebrtc), which
+	 * keeps the arrival offset of every packet for offline muxing.
+	 *
+	 * Packets are appended to batches that are written asynchronously with
+	 * uv_fs_write(), so the loop never blocks on the disk (libuv runs file
+	 * requests in io_uring when the kernel supports it and in its threadpool
+	 * otherwise). Just a write is in flight at a time, so the file keeps the
+	 * packet order. If the disk cannot keep up, packets are dropped once
+	 * MaxPendingSize bytes are waiting.
+	 */
+	class RtpDumpWriter : public TimerHandle::Listener
+	{
+	public:
+		// Size of the batches given to uv_fs_write().
+		static constexpr size_t BatchSize{ 256u * 1024u };
+		static constexpr size_t MaxPendingSize{ 16u * 1024u * 1024u };
+		// Pending packets are written at least once per FlushInterval (ms).
+		static constexpr uint64_t FlushInterval{ 1000u };
+		// Size of the header preceding every packet.
+		static constexpr size_t PacketHeaderSize{ 8u };
+
+	private:
+		enum class State : uint8_t
+		{
+			OPENING = 1,
+			OPEN,
+			CLOSING,
+			FAILED
+		};
+
+	public:
+		explicit RtpDumpWriter(const std::string& filePath);
+
+	private:
+		// Deleted by itself once closed.
+		~RtpDumpWriter() override;
+
+	public:
+		// Writes the pending packets and closes the file. The instance must not be
+		// used anymore and it is deleted once done.
+		void Close();
+		void WriteRtp(const uint8_t* data, size_t len)
+		{
+			Write(data, len, /*isRtcp*/ false);
+		}
+		void WriteRtcp(const uint8_t* data, size_t len)
+		{
+			Write(data, len, /*isRtcp*/ true);
+		}
+		flatbuffers::Offset<FBS::RecordingTransport::Recording> FillBuffer(
+		  flatbuffers::FlatBufferBuilder& builder) const;
+
+	private:
+		void Write(const uint8_t* data, size_t len, bool isRtcp);
+		void WriteFileHeader();
+		void Flush();
+		void WriteNextBatch();
+		void CloseFile();
+		void Fail();
+
+		/* Callbacks fired by UV events. */
+	public:
+		void OnUvOpen(ssize_t result);
+		void OnUvWrite(ssize_t result);
+		void OnUvClose();
+
+		/* Pure virtual methods inherited from TimerHandle::Listener. */
+	public:
+		void OnTimer(TimerHandle* timer) override;
+
+	private:
+		// Passed by argument.
+		std::string filePath;
+		// Allocated by this.
+		TimerHandle* flushTimer{ nullptr };
+		// Others.
+		State state{ State::OPENING };
+		bool closeRequested{ false };
+		uv_fs_t fsReq{};
+		uv_file fd{ -1 };
+		uint64_t startMs{ 0u };
+		// Batch being filled.
+		std::vector<uint8_t> batch;
+		// Batches waiting to be written, the first one may be in flight.
+		std::deque<std::vector<uint8_t>> batches;
+		bool writing{ false };
+		size_t writtenInBatch{ 0u };
+		size_t pendingBytes{ 0u };
+		uint64_t recordedRtpPackets{ 0u };
+		uint64_t recordedRtcpPackets{ 0u };
+		uint64_t droppedPackets{ 0u };
+		uint64_t writtenBytes{ 0u };
+		uint64_t writeErrors{ 0u };
+	};
+} // namespace RTC
+
+#endif
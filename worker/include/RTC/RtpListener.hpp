@@ -4,13 +4,24 @@
 #include "common.hpp"
 #include "RTC/Producer.hpp"
 #include "RTC/RtpPacket.hpp"
+#include <absl/container/flat_hash_map.h>
+#include <array>
 #include <string>
-#include <unordered_map>
 
 namespace RTC
 {
 	class RtpListener
 	{
+	private:
+		static constexpr size_t UnknownSsrcsCacheBits{ 6u };
+
+	private:
+		struct UnknownSsrc
+		{
+			uint32_t ssrc{ 0u };
+			uint64_t expiresAtMs{ 0u };
+		};
+
 	public:
 		flatbuffers::Offset<FBS::Transport::RtpListener> FillBuffer(
 		  flatbuffers::FlatBufferBuilder& builder) const;
@@ -18,14 +29,27 @@ namespace RTC
 		void RemoveProducer(RTC::Producer* producer);
 		RTC::Producer* GetProducer(const RTC::RtpPacket* packet);
 		RTC::Producer* GetProducer(uint32_t ssrc) const;
+		// Remembers an SSRC that matched no Producer. Returns true if it was not
+		// already remembered (so the caller should report it).
+		bool AddUnknownSsrc(uint32_t ssrc, uint64_t nowMs);
+
+	private:
+		UnknownSsrc& GetUnknownSsrcEntry(uint32_t ssrc);
+		bool IsUnknownSsrc(uint32_t ssrc, uint64_t nowMs);
+		void ClearUnknownSsrcs();
 
 	public:
 		// Table of SSRC / Producer pairs.
-		std::unordered_map<uint32_t, RTC::Producer*> ssrcTable;
+		absl::flat_hash_map<uint32_t, RTC::Producer*> ssrcTable;
 		//  Table of MID / Producer pairs.
-		std::unordered_map<std::string, RTC::Producer*> midTable;
+		absl::flat_hash_map<std::string, RTC::Producer*> midTable;
 		//  Table of RID / Producer pairs.
-		std::unordered_map<std::string, RTC::Producer*> ridTable;
+		absl::flat_hash_map<std::string, RTC::Producer*> ridTable;
+
+	private:
+		// Direct mapped cache of SSRCs recently found to match no Producer.
+		std::array<UnknownSsrc, 1u << UnknownSsrcsCacheBits> unknownSsrcs{};
+		bool hasUnknownSsrcs{ false };
 	};
 } // namespace RTC
 
@@ -41,6 +41,12 @@ namespace RTC
 		virtual void ReceiveRtpPacket(RTC::Producer* producer, RTC::RtpPacket* packet) = 0;
 		virtual void ProducerPaused(RTC::Producer* producer)                           = 0;
 		virtual void ProducerResumed(RTC::Producer* producer)                          = 0;
+		// Whether RTP packets of the given Producer must be forwarded to its
+		// Consumers.
+		virtual bool IsForwarding(RTC::Producer* /*producer*/) const
+		{
+			return true;
+		}
 
 		/* Methods inherited from Channel::ChannelSocket::RequestHandler. */
 	public:
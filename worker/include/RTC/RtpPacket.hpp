@@ -8,6 +8,7 @@
 #include "RTC/RtcLogger.hpp"
 #include <flatbuffers/flatbuffers.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/strings/string_view.h>
 #include <array>
 #include <string>
 #include <vector>
@@ -89,6 +90,48 @@ namespace RTC
 			uint8_t* value;
 		};
 
+	public:
+		/* Precomputed replacement of all header extensions by One-Byte ones. */
+		class HeaderExtensionRewritePlan
+		{
+		public:
+			static constexpr size_t MaxSteps{ 14u };
+
+		public:
+			struct Step
+			{
+				// Id of the extension in the rewritten packet.
+				uint8_t id;
+				// Id of the extension to proxy from the original packet, or 0 to
+				// write len zeroed bytes.
+				uint8_t sourceId;
+				uint8_t len;
+			};
+
+		public:
+			void Clear()
+			{
+				this->numSteps = 0u;
+			}
+			// Adds an extension of the given length filled with zeros.
+			void AddZeroed(uint8_t id, uint8_t len);
+			// Proxies the extension with sourceId (if present in the packet) as id.
+			// Nothing is added if sourceId is 0.
+			void AddProxied(uint8_t id, uint8_t sourceId);
+			size_t GetNumSteps() const
+			{
+				return this->numSteps;
+			}
+			const Step& GetStep(size_t idx) const
+			{
+				return this->steps[idx];
+			}
+
+		private:
+			std::array<Step, MaxSteps> steps{};
+			size_t numSteps{ 0u };
+		};
+
 	public:
 		/* Struct with frame-marking information. */
 		struct FrameMarking
@@ -220,6 +263,7 @@ namespace RTC
 
 		// After calling this method, all the extension ids are reset to 0.
 		void SetExtensions(uint8_t type, const std::vector<GenericExtension>& extensions);
+		void RewriteHeaderExtensions(const HeaderExtensionRewritePlan& plan);
 
 		uint16_t GetHeaderExtensionId() const
 		{
@@ -322,6 +366,22 @@ namespace RTC
 			return true;
 		}
 
+		bool ReadMid(absl::string_view& mid) const
+		{
+			uint8_t extenLen;
+			uint8_t* extenValue = GetExtension(this->midExtensionId, extenLen);
+
+			if (!extenValue || extenLen == 0u)
+			{
+				return false;
+			}
+
+			mid = absl::string_view(
+			  reinterpret_cast<const char*>(extenValue), static_cast<size_t>(extenLen));
+
+			return true;
+		}
+
 		void UpdateMid(const std::string& mid);
 
 		bool ReadRid(std::string& rid) const
@@ -349,6 +409,33 @@ namespace RTC
 			return false;
 		}
 
+		bool ReadRid(absl::string_view& rid) const
+		{
+			// First try with the RID id then with the Repaired RID id.
+			uint8_t extenLen;
+			uint8_t* extenValue = GetExtension(this->ridExtensionId, extenLen);
+
+			if (extenValue && extenLen > 0u)
+			{
+				rid = absl::string_view(
+				  reinterpret_cast<const char*>(extenValue), static_cast<size_t>(extenLen));
+
+				return true;
+			}
+
+			extenValue = GetExtension(this->rridExtensionId, extenLen);
+
+			if (extenValue && extenLen > 0u)
+			{
+				rid = absl::string_view(
+				  reinterpret_cast<const char*>(extenValue), static_cast<size_t>(extenLen));
+
+				return true;
+			}
+
+			return false;
+		}
+
 		bool ReadAbsSendTime(uint32_t& absSendtime) const
 		{
 			uint8_t extenLen;
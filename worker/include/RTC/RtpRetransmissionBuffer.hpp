@@ -37,6 +37,7 @@ namespace RTC
 		~RtpRetransmissionBuffer();
 
 		Item* Get(uint16_t seq) const;
+		Item* GetNewestForPadding(size_t maxSize, uint64_t notResentSinceMs, size_t maxItems) const;
 		void Insert(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket);
 		void Clear();
 		void Dump() const;
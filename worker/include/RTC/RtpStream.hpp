@@ -141,6 +141,10 @@ namespace RTC
 		{
 			return this->maxPacketMs;
 		}
+		bool HasStarted() const
+		{
+			return this->started;
+		}
 		uint32_t GetMaxPacketTs() const
 		{
 			return this->maxPacketTs;
@@ -1,6 +1,7 @@
 #ifndef MS_RTC_RTP_STREAM_RECV_HPP
 #define MS_RTC_RTP_STREAM_RECV_HPP
 
+#include "RTC/KeyFrameCache.hpp"
 #include "RTC/NackGenerator.hpp"
 #include "RTC/RTCP/XrDelaySinceLastRr.hpp"
 #include "RTC/RateCalculator.hpp"
@@ -38,7 +39,26 @@ namespace RTC
 			size_t GetBytes() const;
 
 		private:
-			std::vector<std::vector<RTC::RtpDataCounter>> spatialLayerCounters;
+			size_t GetLayerIndex(uint8_t spatialLayer, uint8_t temporalLayer) const
+			{
+				return (spatialLayer * this->temporalLayers) + temporalLayer;
+			}
+			void UpdateRates(uint64_t nowMs);
+
+		private:
+			uint8_t spatialLayers{ 0u };
+			uint8_t temporalLayers{ 0u };
+			// Counters of all layers, indexed by GetLayerIndex().
+			std::vector<RTC::RtpDataCounter> layerCounters;
+			// Rate of each layer, indexed by GetLayerIndex().
+			std::vector<uint32_t> layerRates;
+			// Rate of all temporal layers of lower spatial layers plus the temporal
+			// layers up to each one in its spatial layer, indexed by GetLayerIndex().
+			std::vector<uint32_t> accumulatedRates;
+			// Rates are computed once per time and packet since consumers ask for
+			// them many times while distributing the available bitrate.
+			uint64_t ratesTimeMs{ 0u };
+			bool ratesValid{ false };
 		};
 
 	public:
@@ -81,6 +101,14 @@ namespace RTC
 		{
 			return this->useRtpInactivityCheck;
 		}
+		void EnableKeyFrameCache()
+		{
+			this->keyFrameCache.reset(new RTC::KeyFrameCache());
+		}
+		RTC::KeyFrameCache* GetKeyFrameCache() const
+		{
+			return this->keyFrameCache.get();
+		}
 
 	private:
 		void CalculateJitter(uint32_t rtpTimestamp);
@@ -125,6 +153,7 @@ namespace RTC
 		uint8_t firSeqNumber{ 0u };
 		uint32_t reportedPacketLost{ 0u };
 		std::unique_ptr<RTC::NackGenerator> nackGenerator;
+		std::unique_ptr<RTC::KeyFrameCache> keyFrameCache;
 		TimerHandle* inactivityCheckPeriodicTimer{ nullptr };
 		bool inactive{ false };
 		// Valid media + valid RTX.
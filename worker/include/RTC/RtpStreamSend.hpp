@@ -1,9 +1,11 @@
 #ifndef MS_RTC_RTP_STREAM_SEND_HPP
 #define MS_RTC_RTP_STREAM_SEND_HPP
 
+#include "RTC/FecGenerator.hpp"
 #include "RTC/RateCalculator.hpp"
 #include "RTC/RtpRetransmissionBuffer.hpp"
 #include "RTC/RtpStream.hpp"
+#include <limits>
 
 namespace RTC
 {
@@ -31,9 +33,18 @@ namespace RTC
 		flatbuffers::Offset<FBS::RtpStream::Stats> FillBufferStats(
 		  flatbuffers::FlatBufferBuilder& builder) override;
 		void SetRtx(uint8_t payloadType, uint32_t ssrc) override;
+		void SetFec(uint8_t payloadType, uint32_t ssrc);
+		bool HasFec() const
+		{
+			return this->fecGenerator != nullptr;
+		}
+		void SetFecMaxBitrate(uint32_t bitrate);
+		RTC::RtpPacket* GetFecPacket(const RTC::RtpPacket* packet);
 		bool ReceivePacket(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket);
 		void ReceiveNack(RTC::RTCP::FeedbackRtpNackPacket* nackPacket);
 		void ReceiveKeyFrameRequest(RTC::RTCP::FeedbackPs::MessageType messageType);
+		RTC::RtpPacket* GetRtxPaddingPacket(size_t size);
+		void RestoreRtxPaddingPacket(RTC::RtpPacket* packet);
 		void ReceiveRtcpReceiverReport(RTC::RTCP::ReceiverReport* report);
 		void ReceiveRtcpXrReceiverReferenceTime(RTC::RTCP::ReceiverReferenceTime* report);
 		RTC::RTCP::SenderReport* GetRtcpSenderReport(uint64_t nowMs);
@@ -53,6 +64,7 @@ namespace RTC
 		void StorePacket(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket);
 		void FillRetransmissionContainer(uint16_t seq, uint16_t bitmask);
 		void UpdateScore(RTC::RTCP::ReceiverReport* report);
+		void UpdateFecProtection();
 
 		/* Pure virtual methods inherited from RTC::RtpStream. */
 	public:
@@ -67,6 +79,9 @@ namespace RTC
 		uint16_t rtxSeq{ 0u };
 		RTC::RtpDataCounter transmissionCounter;
 		RTC::RtpRetransmissionBuffer* retransmissionBuffer{ nullptr };
+		RTC::FecGenerator* fecGenerator{ nullptr };
+		// Bitrate the FEC packets can use (as given by the BWE).
+		uint32_t fecMaxBitrate{ std::numeric_limits<uint32_t>::max() };
 		// The middle 32 bits out of 64 in the NTP timestamp received in the most
 		// recent receiver reference timestamp.
 		uint32_t lastRrTimestamp{ 0u };
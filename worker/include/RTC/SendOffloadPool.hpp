@@ -0,0 +1,143 @@
+#ifndef MS_RTC_SEND_OFFLOAD_POOL_HPP
+#define MS_RTC_SEND_OFFLOAD_POOL_HPP
+
+#include "common.hpp"
+#include "RTC/RtpPacket.hpp"
+#include "RTC/SrtpSession.hpp"
+#include "FBS/worker.h"
+#include <uv.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RTC
+{
+	// Pool of threads that SRTP protect and send UDP packets on behalf of the
+	// loop thread. Each user of the pool is pinned to a shard (a thread) so
+	// its packets are protected and sent in order and its SRTP session is
+	// never used by two threads at the same time. The loop thread and each
+	// shard thread share a single producer single consumer ring of slots and
+	// results are delivered back to the loop thread via an uv_async_t handle.
+	class SendOffloadPool
+	{
+	public:
+		using onSendCallback = const std::function<void(bool sent)>;
+
+	public:
+		class Listener
+		{
+		public:
+			virtual ~Listener() = default;
+
+		public:
+			// Called in the loop thread. userData is the one given to Send(). len is
+			// the protected length of the packet or 0 if it could not be protected.
+			virtual void OnSendOffloadPoolPacketSent(
+			  SendOffloadPool* pool, void* userData, size_t len, bool sent) = 0;
+			// Called in the loop thread when the packet was protected but the socket
+			// buffer was full. The listener must send it from the loop thread and
+			// takes ownership of cb.
+			virtual void OnSendOffloadPoolPacketWouldBlock(
+			  SendOffloadPool* pool,
+			  void* userData,
+			  const uint8_t* data,
+			  size_t len,
+			  const struct sockaddr* addr,
+			  onSendCallback* cb) = 0;
+		};
+
+	private:
+		// Must be power of 2.
+		static constexpr size_t SlotsPerShard{ 1024u };
+		static constexpr size_t SlotDataSize{ RTC::MtuSize + SRTP_MAX_TRAILER_LEN };
+		// Max number of slots processed by a shard before notifying the loop.
+		static constexpr size_t MaxSlotsPerRound{ 32u };
+
+	private:
+		struct Slot
+		{
+			Listener* listener{ nullptr };
+			void* userData{ nullptr };
+			RTC::SrtpSession* srtpSession{ nullptr };
+			uv_os_fd_t fd{};
+			struct sockaddr_storage addr{};
+			onSendCallback* cb{ nullptr };
+			size_t len{ 0u };
+			// libsrtp events raised while protecting (see SrtpSession::DeferEvents()).
+			uint32_t srtpEvents{ 0u };
+			bool isRtcp{ false };
+			bool sent{ false };
+			bool wouldBlock{ false };
+			uint8_t data[SlotDataSize];
+		};
+
+		struct Shard
+		{
+			std::unique_ptr<Slot[]> slots{ new Slot[SlotsPerShard] };
+			// Written by the loop thread.
+			alignas(64) std::atomic<size_t> produced{ 0u };
+			// Written by the shard thread.
+			alignas(64) std::atomic<size_t> processed{ 0u };
+			// Only accessed by the loop thread.
+			alignas(64) size_t completed{ 0u };
+			std::atomic<bool> sleeping{ false };
+			std::atomic<bool> stopping{ false };
+			// Set by the loop thread while waiting in Flush().
+			std::atomic<bool> flushing{ false };
+			std::mutex mutex;
+			std::condition_variable cv;
+			std::condition_variable flushedCv;
+			std::thread thread;
+		};
+
+	public:
+		explicit SendOffloadPool(size_t numThreads);
+		~SendOffloadPool();
+
+	public:
+		flatbuffers::Offset<FBS::Worker::SendOffloadPoolDump> FillBuffer(
+		  flatbuffers::FlatBufferBuilder& builder) const;
+		size_t GetNumShards() const
+		{
+			return this->shards.size();
+		}
+		size_t AssignShard();
+		bool Send(
+		  size_t shardIdx,
+		  Listener* listener,
+		  void* userData,
+		  RTC::SrtpSession* srtpSession,
+		  uv_os_fd_t fd,
+		  const struct sockaddr* addr,
+		  const uint8_t* data,
+		  size_t len,
+		  bool isRtcp,
+		  onSendCallback* cb);
+		void Flush(size_t shardIdx);
+		void ProcessCompletions(size_t shardIdx);
+
+	private:
+		void ProcessCompletions(Shard* shard);
+		void RunShard(Shard* shard);
+		static void ProcessSlot(Slot& slot);
+
+		/* Callbacks fired by UV events. */
+	public:
+		void OnUvAsync();
+
+	private:
+		// Allocated by this.
+		std::vector<std::unique_ptr<Shard>> shards;
+		uv_async_t* uvAsyncHandle{ nullptr };
+		// Others.
+		size_t nextShardIdx{ 0u };
+		// Packets sent from the loop thread because the socket buffer was full.
+		uint64_t sendFallbacks{ 0u };
+	};
+} // namespace RTC
+
+#endif
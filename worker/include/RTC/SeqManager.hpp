@@ -2,8 +2,9 @@
 #define RTC_SEQ_MANAGER_HPP
 
 #include "common.hpp"
+#include <algorithm> // std::min()
+#include <array>
 #include <limits> // std::numeric_limits
-#include <set>
 
 namespace RTC
 {
@@ -15,6 +16,18 @@ namespace RTC
 	public:
 		static constexpr T MaxValue = (N == 0) ? std::numeric_limits<T>::max() : ((1 << N) - 1);
 
+	private:
+		// A dropped input is removed once it is more than half the range behind
+		// maxInput, so this is the max number of positions to track (capped for
+		// 32 bits types, in which older dropped inputs are removed earlier).
+		static constexpr uint64_t DroppedWindowSize =
+		  std::min<uint64_t>((uint64_t{ MaxValue } / 2) + 2, uint64_t{ 1 } << 16);
+		static constexpr size_t DroppedWords = (DroppedWindowSize + 63) / 64;
+		static constexpr uint64_t DroppedSlots = DroppedWords * 64;
+		static constexpr bool FullDroppedWindow = DroppedWindowSize == (uint64_t{ MaxValue } / 2) + 2;
+		// Initial extended value of maxInput, so it never underflows.
+		static constexpr uint64_t ExtendedBase = uint64_t{ 1 } << 40;
+
 	public:
 		struct SeqLowerThan
 		{
@@ -45,7 +58,21 @@ namespace RTC
 		T GetMaxOutput() const;
 
 	private:
+		using DroppedBitmap = std::array<uint64_t, DroppedWords>;
+
+	private:
+		static uint64_t GetNextDropped(const DroppedBitmap& bitmap, uint64_t ext);
+
+	private:
+		void SetMaxInput(T input);
+		uint64_t GetExtendedInput(T input) const;
+		void InsertDropped(uint64_t ext);
+		bool IsDropped(uint64_t ext) const;
+		size_t CountDroppedLowerThan(uint64_t ext) const;
+		size_t CountDroppedInRange(uint64_t from, uint64_t to) const;
+		void MoveDroppedToNextCycle();
 		void ClearDropped();
+		void ResetDropped();
 
 	private:
 		// Whether at least a sequence number has been inserted.
@@ -53,7 +80,15 @@ namespace RTC
 		T base{ 0 };
 		T maxOutput{ 0 };
 		T maxInput{ 0 };
-		std::set<T, SeqLowerThan> dropped;
+		// Dropped inputs are stored in a circular bitmap indexed by their
+		// extended value (not wrapped, so (ext & MaxValue) is the input). They
+		// all live in [oldestDroppedExt, newestDroppedExt], which is never wider
+		// than the bitmap.
+		DroppedBitmap droppedBitmap{};
+		size_t droppedCount{ 0u };
+		uint64_t maxInputExt{ ExtendedBase };
+		uint64_t oldestDroppedExt{ 0u };
+		uint64_t newestDroppedExt{ 0u };
 	};
 } // namespace RTC
 
@@ -6,17 +6,26 @@
 
 namespace RTC
 {
+	class EgressBitrateScheduler;
+	class SendOffloadPool;
+
 	class Shared
 	{
 	public:
 		explicit Shared(
 		  ChannelMessageRegistrator* channelMessageRegistrator,
-		  Channel::ChannelNotifier* channelNotifier);
+		  Channel::ChannelNotifier* channelNotifier,
+		  RTC::SendOffloadPool* sendOffloadPool               = nullptr,
+		  RTC::EgressBitrateScheduler* egressBitrateScheduler = nullptr);
 		~Shared();
 
 	public:
 		ChannelMessageRegistrator* channelMessageRegistrator{ nullptr };
 		Channel::ChannelNotifier* channelNotifier{ nullptr };
+		// May be nullptr.
+		RTC::SendOffloadPool* sendOffloadPool{ nullptr };
+		// May be nullptr.
+		RTC::EgressBitrateScheduler* egressBitrateScheduler{ nullptr };
 	};
 } // namespace RTC
 
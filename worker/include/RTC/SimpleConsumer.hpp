@@ -47,7 +47,13 @@ namespace RTC
 		uint32_t IncreaseLayer(uint32_t bitrate, bool considerLoss) override;
 		void ApplyLayers() override;
 		uint32_t GetDesiredBitrate() const override;
+		bool IsWaitingForFirstKeyFrame() const override
+		{
+			return IsActive() && this->syncRequired && this->keyFrameSupported &&
+			       !this->rtpStream->HasStarted();
+		}
 		void SendRtpPacket(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket) override;
+		bool SkipRtpPacket(RTC::RtpPacket* packet) override;
 		const std::vector<RTC::RtpStreamSend*>& GetRtpStreams() const override
 		{
 			return this->rtpStreams;
@@ -29,9 +29,21 @@ namespace RTC
 		static void ClassInit();
 		static FBS::SrtpParameters::SrtpCryptoSuite CryptoSuiteToFbs(CryptoSuite cryptoSuite);
 		static CryptoSuite CryptoSuiteFromFbs(FBS::SrtpParameters::SrtpCryptoSuite cryptoSuite);
+		// Make libsrtp events raised in the calling thread be accumulated into the
+		// given bitmask (1 << srtp_event_t) instead of being logged, since logging
+		// is only possible in the loop thread. Pass nullptr to stop deferring.
+		static void DeferEvents(uint32_t* events)
+		{
+			SrtpSession::deferredEvents = events;
+		}
+		static void LogEvents(uint32_t events);
 
 	private:
 		static void OnSrtpEvent(srtp_event_data_t* data);
+		static void LogEvent(srtp_event_t event);
+
+	private:
+		thread_local static uint32_t* deferredEvents;
 
 	public:
 		SrtpSession(Type type, CryptoSuite cryptoSuite, uint8_t* key, size_t keyLen);
@@ -42,6 +54,17 @@ namespace RTC
 		bool DecryptSrtp(uint8_t* data, int* len);
 		bool EncryptRtcp(const uint8_t** data, int* len);
 		bool DecryptSrtcp(uint8_t* data, int* len);
+		// Protect the given packet in place. The buffer must have room for
+		// SRTP_MAX_TRAILER_LEN extra bytes. These methods do not log so they can
+		// be called from a thread other than the loop thread.
+		bool ProtectRtp(uint8_t* data, int* len)
+		{
+			return srtp_protect(this->session, static_cast<void*>(data), len) == srtp_err_status_ok;
+		}
+		bool ProtectRtcp(uint8_t* data, int* len)
+		{
+			return srtp_protect_rtcp(this->session, static_cast<void*>(data), len) == srtp_err_status_ok;
+		}
 		void RemoveStream(uint32_t ssrc)
 		{
 			srtp_remove_stream(this->session, uint32_t{ htonl(ssrc) });
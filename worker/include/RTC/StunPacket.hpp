@@ -2,6 +2,7 @@
 #define MS_RTC_STUN_PACKET_HPP
 
 #include "common.hpp"
+#include "Utils.hpp"
 #include <string>
 
 namespace RTC
@@ -181,11 +182,21 @@ namespace RTC
 		}
 		Authentication CheckAuthentication(
 		  const std::string& localUsername, const std::string& localPassword);
+		Authentication CheckAuthentication(
+		  const std::string& localUsername, Utils::Crypto::HmacSha1* localHmacSha1);
 		StunPacket* CreateSuccessResponse();
 		StunPacket* CreateErrorResponse(uint16_t errorCode);
 		void Authenticate(const std::string& password);
+		// NOTE: The given HMAC-SHA1 must be alive until Serialize() is called.
+		void Authenticate(Utils::Crypto::HmacSha1* hmacSha1);
 		void Serialize(uint8_t* buffer);
 
+	private:
+		Authentication CheckAuthentication(
+		  const std::string& localUsername,
+		  const std::string* localPassword,
+		  Utils::Crypto::HmacSha1* localHmacSha1);
+
 	private:
 		// Passed by argument.
 		Class klass;                             // 2 bytes.
@@ -206,6 +217,7 @@ namespace RTC
 		const struct sockaddr* xorMappedAddress{ nullptr }; // 8 or 20 bytes.
 		uint16_t errorCode{ 0u };                           // 4 bytes (no reason phrase).
 		std::string password;
+		Utils::Crypto::HmacSha1* hmacSha1{ nullptr };
 	};
 } // namespace RTC
 
@@ -9,8 +9,10 @@
 #include "Channel/ChannelSocket.hpp"
 #include "FBS/transport.h"
 #include "RTC/Consumer.hpp"
+#include "RTC/CpuTimeCounter.hpp"
 #include "RTC/DataConsumer.hpp"
 #include "RTC/DataProducer.hpp"
+#include "RTC/EgressBitrateScheduler.hpp"
 #include "RTC/Producer.hpp"
 #include "RTC/RTCP/CompoundPacket.hpp"
 #include "RTC/RTCP/Packet.hpp"
@@ -39,6 +41,7 @@ namespace RTC
 	                  public RTC::DataProducer::Listener,
 	                  public RTC::DataConsumer::Listener,
 	                  public RTC::SctpAssociation::Listener,
+	                  public RTC::EgressBitrateScheduler::Listener,
 	                  public RTC::TransportCongestionControlClient::Listener,
 	                  public RTC::TransportCongestionControlServer::Listener,
 	                  public Channel::ChannelSocket::RequestHandler,
@@ -149,6 +152,10 @@ namespace RTC
 		// Subclasses must also invoke the parent Close().
 		flatbuffers::Offset<FBS::Transport::Stats> FillBufferStats(flatbuffers::FlatBufferBuilder& builder);
 		flatbuffers::Offset<FBS::Transport::Dump> FillBuffer(flatbuffers::FlatBufferBuilder& builder) const;
+		uint64_t GetCpuTimeNs() const
+		{
+			return this->cpuTimeCounter.GetTimeNs();
+		}
 
 		/* Methods inherited from Channel::ChannelSocket::RequestHandler. */
 	public:
@@ -284,6 +291,14 @@ namespace RTC
 		void OnSctpAssociationBufferedAmount(
 		  RTC::SctpAssociation* sctpAssociation, uint32_t bufferedAmount) override;
 
+		/* Pure virtual methods inherited from RTC::EgressBitrateScheduler::Listener. */
+	public:
+		uint32_t GetEgressSendBitrate(uint64_t nowMs) override;
+		uint32_t GetEgressDesiredBitrate() const override;
+		uint8_t GetEgressPriority() const override;
+		void OnEgressBitrateCapChanged(
+		  RTC::EgressBitrateScheduler* egressBitrateScheduler, uint32_t cap) override;
+
 		/* Pure virtual methods inherited from RTC::TransportCongestionControlClient::Listener. */
 	public:
 		void OnTransportCongestionControlClientBitrates(
@@ -293,6 +308,8 @@ namespace RTC
 		  RTC::TransportCongestionControlClient* tccClient,
 		  RTC::RtpPacket* packet,
 		  const webrtc::PacedPacketInfo& pacingInfo) override;
+		RTC::RtpPacket* OnTransportCongestionControlClientGeneratePadding(
+		  RTC::TransportCongestionControlClient* tccClient, size_t size) override;
 
 		/* Pure virtual methods inherited from RTC::TransportCongestionControlServer::Listener. */
 	public:
@@ -321,6 +338,9 @@ namespace RTC
 		size_t maxMessageSize{ 262144u };
 		// Allocated by this.
 		RTC::SctpAssociation* sctpAssociation{ nullptr };
+		// Others.
+		// Loop time spent receiving and sending packets of this Transport.
+		RTC::CpuTimeCounter cpuTimeCounter;
 
 	private:
 		// Passed by argument.
@@ -340,6 +360,11 @@ namespace RTC
 #endif
 		// Others.
 		bool direct{ false }; // Whether this Transport allows direct communication.
+		// Whether to probe with RTX of recently sent packets.
+		bool probeWithRtx{ false };
+		// Consumer and stream of the RTX padding packet being sent.
+		RTC::Consumer* rtxPaddingConsumer{ nullptr };
+		RTC::RtpStreamSend* rtxPaddingStream{ nullptr };
 		bool destroying{ false };
 		struct RTC::RtpHeaderExtensionIds recvRtpHeaderExtensionIds;
 		RTC::RtpListener rtpListener;
@@ -351,11 +376,14 @@ namespace RTC
 		RTC::RtpDataCounter recvRtxTransmission;
 		RTC::RtpDataCounter sendRtxTransmission;
 		RTC::RtpDataCounter sendProbationTransmission;
+		RTC::RtpDataCounter sendRtxProbationTransmission;
 		uint16_t transportWideCcSeq{ 0u };
 		uint32_t initialAvailableOutgoingBitrate{ 600000u };
 		uint32_t maxIncomingBitrate{ 0u };
 		uint32_t maxOutgoingBitrate{ 0u };
 		uint32_t minOutgoingBitrate{ 0u };
+		// Set by the EgressBitrateScheduler (0 means no cap).
+		uint32_t egressBitrateCap{ 0u };
 		struct TraceEventTypes traceEventTypes;
 	};
 } // namespace RTC
@@ -49,6 +49,10 @@ namespace RTC
 			  RTC::TransportCongestionControlClient* tccClient,
 			  RTC::RtpPacket* packet,
 			  const webrtc::PacedPacketInfo& pacingInfo) = 0;
+			// Returns a media packet to be sent as padding, or nullptr to send a
+			// probation packet instead.
+			virtual RTC::RtpPacket* OnTransportCongestionControlClientGeneratePadding(
+			  RTC::TransportCongestionControlClient* tccClient, size_t size) = 0;
 		};
 
 	public:
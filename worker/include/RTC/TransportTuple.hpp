@@ -114,6 +114,18 @@ namespace RTC
 			return this->protocol;
 		}
 
+		// Only valid for UDP tuples.
+		RTC::UdpSocket* GetUdpSocket() const
+		{
+			return this->udpSocket;
+		}
+
+		// Only valid for UDP tuples.
+		uv_os_fd_t GetUdpSocketFd() const
+		{
+			return this->udpSocket->GetFd();
+		}
+
 		const struct sockaddr* GetLocalAddress() const
 		{
 			if (this->protocol == Protocol::UDP)
@@ -4,6 +4,7 @@
 #include "RTC/DtlsTransport.hpp"
 #include "RTC/IceCandidate.hpp"
 #include "RTC/IceServer.hpp"
+#include "RTC/SendOffloadPool.hpp"
 #include "RTC/Shared.hpp"
 #include "RTC/SrtpSession.hpp"
 #include "RTC/StunPacket.hpp"
@@ -21,7 +22,8 @@ namespace RTC
 	                        public RTC::TcpServer::Listener,
 	                        public RTC::TcpConnection::Listener,
 	                        public RTC::IceServer::Listener,
-	                        public RTC::DtlsTransport::Listener
+	                        public RTC::DtlsTransport::Listener,
+	                        public RTC::SendOffloadPool::Listener
 	{
 	public:
 		class WebRtcTransportListener
@@ -66,6 +68,7 @@ namespace RTC
 		void ProcessNonStunPacketFromWebRtcServer(
 		  RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
 		void RemoveTuple(RTC::TransportTuple* tuple);
+		void FlushSendOffload();
 
 		/* Methods inherited from Channel::ChannelSocket::RequestHandler. */
 	public:
@@ -98,6 +101,8 @@ namespace RTC
 		void OnDtlsDataReceived(const RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
 		void OnRtpDataReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
 		void OnRtcpDataReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len);
+		bool MaySendOffloaded(
+		  const uint8_t* data, size_t len, bool isRtcp, RTC::Transport::onSendCallback* cb = nullptr);
 
 		/* Pure virtual methods inherited from RTC::UdpSocket::Listener. */
 	public:
@@ -148,6 +153,18 @@ namespace RTC
 		void OnDtlsTransportApplicationDataReceived(
 		  const RTC::DtlsTransport* dtlsTransport, const uint8_t* data, size_t len) override;
 
+		/* Pure virtual methods inherited from RTC::SendOffloadPool::Listener. */
+	public:
+		void OnSendOffloadPoolPacketSent(
+		  RTC::SendOffloadPool* pool, void* userData, size_t len, bool sent) override;
+		void OnSendOffloadPoolPacketWouldBlock(
+		  RTC::SendOffloadPool* pool,
+		  void* userData,
+		  const uint8_t* data,
+		  size_t len,
+		  const struct sockaddr* addr,
+		  RTC::SendOffloadPool::onSendCallback* cb) override;
+
 	private:
 		// Passed by argument.
 		WebRtcTransportListener* webRtcTransportListener{ nullptr };
@@ -164,6 +181,9 @@ namespace RTC
 		bool connectCalled{ false };
 		std::vector<RTC::IceCandidate> iceCandidates;
 		RTC::DtlsTransport::Role dtlsRole{ RTC::DtlsTransport::Role::AUTO };
+		// Shard of the SendOffloadPool (if any) and number of packets in it.
+		size_t sendOffloadShard{ 0u };
+		size_t sendOffloadPending{ 0u };
 	};
 } // namespace RTC
 
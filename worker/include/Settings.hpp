@@ -39,6 +39,15 @@ public:
 		std::string dtlsCertificateFile;
 		std::string dtlsPrivateKeyFile;
 		std::string libwebrtcFieldTrials{ "WebRTC-Bwe-AlrLimitedBackoff/Enabled/" };
+		// Number of threads SRTP protecting and sending packets of WebRtcTransports
+		// (0 means that everything runs in the loop thread).
+		uint8_t sendThreads{ 0u };
+		// Maximum egress bitrate (bps) of all the Transports of the worker (0
+		// means no limit).
+		uint32_t egressBitrateBudget{ 0u };
+		// Number of pre-bound UDP sockets kept ready for every listen IP (0 means
+		// that sockets are bound on demand).
+		uint16_t udpSocketPoolSize{ 0u };
 	};
 
 public:
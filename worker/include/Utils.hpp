@@ -12,6 +12,7 @@
 // https://stackoverflow.com/a/24550632/2085408
 #include <intrin.h>
 #define __builtin_popcount __popcnt
+#define __builtin_popcountll __popcnt64
 #endif
 
 namespace Utils
@@ -219,10 +220,61 @@ namespace Utils
 		{
 			return static_cast<size_t>(__builtin_popcount(mask));
 		}
+
+		static size_t CountSetBits(const uint64_t mask)
+		{
+			return static_cast<size_t>(__builtin_popcountll(mask));
+		}
+
+		// NOTE: mask must not be 0.
+		static size_t CountTrailingZeros(const uint64_t mask)
+		{
+#ifdef _WIN32
+			unsigned long idx;
+
+			_BitScanForward64(&idx, mask);
+
+			return static_cast<size_t>(idx);
+#else
+			return static_cast<size_t>(__builtin_ctzll(mask));
+#endif
+		}
+
+		// NOTE: mask must not be 0.
+		static size_t CountLeadingZeros(const uint64_t mask)
+		{
+#ifdef _WIN32
+			unsigned long idx;
+
+			_BitScanReverse64(&idx, mask);
+
+			return static_cast<size_t>(63u - idx);
+#else
+			return static_cast<size_t>(__builtin_clzll(mask));
+#endif
+		}
 	};
 
 	class Crypto
 	{
+	public:
+		// HMAC-SHA1 with a fixed key. The key (and so the inner and outer pads) is
+		// processed just once instead of in every computation.
+		class HmacSha1
+		{
+		public:
+			explicit HmacSha1(const std::string& key);
+			~HmacSha1();
+			HmacSha1(const HmacSha1&)            = delete;
+			HmacSha1& operator=(const HmacSha1&) = delete;
+
+		public:
+			const uint8_t* Compute(const uint8_t* data, size_t len);
+
+		private:
+			EVP_MAC_CTX* ctx{ nullptr };
+		};
+
 	public:
 		static void ClassInit();
 		static void ClassDestroy();
@@ -270,18 +322,7 @@ namespace Utils
 			return std::string(buffer, len);
 		}
 
-		static uint32_t GetCRC32(const uint8_t* data, size_t size)
-		{
-			uint32_t crc{ 0xFFFFFFFF };
-			const uint8_t* p = data;
-
-			while (size--)
-			{
-				crc = Crypto::crc32Table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
-			}
-
-			return crc ^ ~0U;
-		}
+		static uint32_t GetCRC32(const uint8_t* data, size_t size);
 
 		static const uint8_t* GetHmacSha1(const std::string& key, const uint8_t* data, size_t len);
 
@@ -290,7 +331,6 @@ namespace Utils
 		thread_local static EVP_MAC* mac;
 		thread_local static EVP_MAC_CTX* hmacSha1Ctx;
 		thread_local static uint8_t hmacSha1Buffer[];
-		static const uint32_t crc32Table[256];
 	};
 
 	class String
@@ -0,0 +1,51 @@
+#ifndef MS_CHECK_HANDLE_HPP
+#define MS_CHECK_HANDLE_HPP
+
+#include "common.hpp"
+#include <uv.h>
+
+// Calls the listener once at the end of the current loop iteration (after
+// I/O callbacks), similar to Node's setImmediate(). While started, the loop
+// does not block waiting for I/O so the listener is not delayed.
+class CheckHandle
+{
+public:
+	class Listener
+	{
+	public:
+		virtual ~Listener() = default;
+
+	public:
+		virtual void OnCheck(CheckHandle* check) = 0;
+	};
+
+public:
+	explicit CheckHandle(Listener* listener);
+	CheckHandle& operator=(const CheckHandle&) = delete;
+	CheckHandle(const CheckHandle&)            = delete;
+	~CheckHandle();
+
+public:
+	void Close();
+	void Start();
+	void Stop();
+	bool IsActive() const
+	{
+		return uv_is_active(reinterpret_cast<uv_handle_t*>(this->uvCheckHandle)) != 0;
+	}
+
+	/* Callbacks fired by UV events. */
+public:
+	void OnUvCheck();
+
+private:
+	// Passed by argument.
+	Listener* listener{ nullptr };
+	// Allocated by this.
+	uv_check_t* uvCheckHandle{ nullptr };
+	uv_idle_t* uvIdleHandle{ nullptr };
+	// Others.
+	bool closed{ false };
+};
+
+#endif
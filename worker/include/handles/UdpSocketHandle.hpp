@@ -75,6 +75,12 @@ public:
 	{
 		return this->sentBytes;
 	}
+	// For datagrams sent with the fd out of the loop thread.
+	void AddSentBytes(size_t len)
+	{
+		this->sentBytes += len;
+	}
+	uv_os_fd_t GetFd() const;
 	uint32_t GetSendBufferSize() const;
 	void SetSendBufferSize(uint32_t size);
 	uint32_t GetRecvBufferSize() const;
@@ -0,0 +1,67 @@
+#ifndef MS_LOADGEN_GENERATOR_HPP
+#define MS_LOADGEN_GENERATOR_HPP
+
+#include "common.hpp"
+#include "LoadgenSession.hpp"
+#include "LoadgenStats.hpp"
+#include "LoadgenWorkerProcess.hpp"
+#include "handles/TimerHandle.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Loadgen
+{
+	/**
+	 * Creates a Router in a mediasoup-worker child process and connects the
+	 * given number of sessions to it, each one with its own WebRtcTransport.
+	 * Sessions are arranged in a ring: every session consumes the audio and
+	 * video of the next consumersPerSession sessions.
+	 */
+	class Generator : public TimerHandle::Listener
+	{
+	public:
+		struct Options
+		{
+			std::string workerBin;
+			std::string ip{ "127.0.0.1" };
+			size_t sessions{ 10u };
+			size_t consumersPerSession{ 1u };
+			uint64_t warmUpMs{ 5000u };
+			uint64_t durationMs{ 30000u };
+		};
+
+	public:
+		Generator(const Options& options, Loadgen::Stats* stats);
+		~Generator() override;
+
+	public:
+		// Sets up all the sessions, waits for the warm up period and measures
+		// during the configured duration. Results are written into the stats.
+		void Run();
+
+	private:
+		void CreateRouter();
+		void CreateSession(size_t index);
+		void Produce(const Loadgen::Session& session, bool isVideo);
+		void Consume(
+		  Loadgen::Session& session, const Loadgen::Session& producerSession, size_t idx, bool isVideo);
+		void WaitForConnectedSessions();
+		void RunFor(uint64_t ms);
+
+		/* Pure virtual methods inherited from TimerHandle::Listener. */
+	public:
+		void OnTimer(TimerHandle* timer) override;
+
+	private:
+		// Passed by argument.
+		Options options;
+		Loadgen::Stats* stats{ nullptr };
+		// Allocated by this.
+		std::unique_ptr<Loadgen::WorkerProcess> worker;
+		TimerHandle* tickTimer{ nullptr };
+		std::vector<std::unique_ptr<Loadgen::Session>> sessions;
+	};
+} // namespace Loadgen
+
+#endif
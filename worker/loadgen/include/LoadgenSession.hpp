@@ -0,0 +1,230 @@
+#ifndef MS_LOADGEN_SESSION_HPP
+#define MS_LOADGEN_SESSION_HPP
+
+#include "common.hpp"
+#include "LoadgenStats.hpp"
+#include "RTC/DtlsTransport.hpp"
+#include "RTC/NackGenerator.hpp"
+#include "RTC/RTCP/Packet.hpp"
+#include "RTC/RtpDictionaries.hpp"
+#include "RTC/SrtpSession.hpp"
+#include "RTC/TransportCongestionControlServer.hpp"
+#include "RTC/UdpSocket.hpp"
+#include <absl/container/flat_hash_map.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Loadgen
+{
+	/**
+	 * A WebRTC-like peer connected to a WebRtcTransport of the worker: ICE
+	 * (controlling, aggressive nomination), DTLS client and SRTP over a single
+	 * UDP socket. It publishes a VP8 simulcast stream plus an Opus stream with
+	 * synthetic payloads and receives the streams of its Consumers, sending
+	 * NACK, PLI and transport-cc feedback for them.
+	 *
+	 * Every RTP payload carries the uv_hrtime() at which it was sent so the
+	 * receiving session (in the same process) can compute the latency.
+	 */
+	class Session : public ::RTC::UdpSocket::Listener,
+	                public ::RTC::DtlsTransport::Listener,
+	                public ::RTC::TransportCongestionControlServer::Listener
+	{
+	public:
+		static constexpr uint8_t VideoPayloadType{ 96u };
+		static constexpr uint8_t AudioPayloadType{ 100u };
+		static constexpr uint8_t AbsSendTimeId{ 4u };
+		static constexpr uint8_t TransportWideCc01Id{ 5u };
+		static constexpr size_t NumVideoStreams{ 3u };
+
+	private:
+		// RTP header plus VP8 payload descriptor and VP8 payload header.
+		static constexpr size_t MaxStoredHeaderLen{ 32u };
+		static constexpr size_t HistorySize{ 512u };
+
+	private:
+		// Headers of a sent packet. Payloads are synthetic so they are not kept.
+		struct SentPacket
+		{
+			bool valid{ false };
+			uint16_t seq{ 0u };
+			uint16_t len{ 0u };
+			uint8_t headerLen{ 0u };
+			uint64_t sentAtNs{ 0u };
+			uint8_t header[MaxStoredHeaderLen];
+		};
+
+		// Synthetic stream published by the session.
+		struct SendStream
+		{
+			uint32_t ssrc{ 0u };
+			bool isVideo{ false };
+			uint32_t bitrate{ 0u };
+			uint16_t seq{ 0u };
+			uint32_t timestamp{ 0u };
+			uint16_t pictureId{ 0u };
+			uint8_t tl0PictureIndex{ 0u };
+			uint64_t frames{ 0u };
+			bool keyFrameRequested{ false };
+			std::vector<SentPacket> history;
+		};
+
+		// Stream received from a Consumer of the session.
+		class RecvStream : public ::RTC::NackGenerator::Listener
+		{
+		public:
+			RecvStream(Session* session, uint32_t ssrc, bool isVideo);
+
+		public:
+			void ReceivePacket(::RTC::RtpPacket* packet);
+			uint64_t GetExpectedPackets() const;
+			uint64_t GetReceivedPackets() const
+			{
+				return this->received;
+			}
+			void ResetStats();
+
+			/* Pure virtual methods inherited from RTC::NackGenerator::Listener. */
+		public:
+			void OnNackGeneratorNackRequired(const std::vector<uint16_t>& seqNumbers) override;
+			void OnNackGeneratorKeyFrameRequired() override;
+
+		private:
+			// Passed by argument.
+			Session* session{ nullptr };
+			uint32_t ssrc{ 0u };
+			bool isVideo{ false };
+			// Allocated by this.
+			std::unique_ptr<::RTC::NackGenerator> nackGenerator;
+			// Others.
+			::RTC::RtpCodecMimeType mimeType;
+			bool started{ false };
+			uint32_t cycles{ 0u };
+			uint16_t maxSeq{ 0u };
+			uint32_t baseExtendedSeq{ 0u };
+			uint64_t received{ 0u };
+		};
+
+	public:
+		Session(Loadgen::Stats* stats, size_t index, std::string& ip);
+		~Session() override;
+
+	public:
+		size_t GetIndex() const
+		{
+			return this->index;
+		}
+		uint32_t GetVideoSsrc(size_t idx) const
+		{
+			return this->videoStreams[idx].ssrc;
+		}
+		uint32_t GetAudioSsrc() const
+		{
+			return this->audioStream.ssrc;
+		}
+		const std::string& GetIceUsernameFragment() const
+		{
+			return this->iceUsernameFragment;
+		}
+		const ::RTC::DtlsTransport::Fingerprint& GetLocalFingerprint() const;
+		// Starts ICE (and then DTLS) against the given WebRtcTransport candidate.
+		void Connect(
+		  const std::string& remoteIceUsernameFragment,
+		  const std::string& remoteIcePassword,
+		  const std::string& remoteIp,
+		  uint16_t remotePort,
+		  const ::RTC::DtlsTransport::Fingerprint& remoteFingerprint);
+		bool IsConnected() const
+		{
+			return this->srtpSendSession != nullptr;
+		}
+		bool HasFailed() const
+		{
+			return this->failed;
+		}
+		void AddRecvStream(uint32_t ssrc, bool isVideo);
+		size_t GetNumRecvStreams() const
+		{
+			return this->recvStreams.size();
+		}
+		// Sends due media frames and ICE keepalives.
+		void Tick(uint64_t nowMs);
+		void ResetStats();
+		// Adds expected and received packet counts of the received streams.
+		void CollectStats();
+
+	private:
+		void SendBindingRequest();
+		void SendVideoFrame(SendStream& stream);
+		void SendAudioFrame(SendStream& stream);
+		size_t WriteRtpHeader(uint8_t* data, SendStream& stream, uint8_t payloadType, bool marker);
+		void SendRtpPacket(uint8_t* data, size_t len);
+		void SendRtcpPacket(::RTC::RTCP::Packet* packet);
+		void Retransmit(SendStream& stream, uint16_t seq);
+		SendStream* GetSendStream(uint32_t ssrc);
+		void ProcessStunPacket(const uint8_t* data, size_t len);
+		void ProcessRtcpPacket(const uint8_t* data, size_t len);
+		void ProcessRtpPacket(const uint8_t* data, size_t len);
+
+		/* Pure virtual methods inherited from RTC::UdpSocket::Listener. */
+	public:
+		void OnUdpSocketPacketReceived(
+		  ::RTC::UdpSocket* socket,
+		  const uint8_t* data,
+		  size_t len,
+		  const struct sockaddr* remoteAddr) override;
+
+		/* Pure virtual methods inherited from RTC::DtlsTransport::Listener. */
+	public:
+		void OnDtlsTransportConnecting(const ::RTC::DtlsTransport* dtlsTransport) override;
+		void OnDtlsTransportConnected(
+		  const ::RTC::DtlsTransport* dtlsTransport,
+		  ::RTC::SrtpSession::CryptoSuite srtpCryptoSuite,
+		  uint8_t* srtpLocalKey,
+		  size_t srtpLocalKeyLen,
+		  uint8_t* srtpRemoteKey,
+		  size_t srtpRemoteKeyLen,
+		  std::string& remoteCert) override;
+		void OnDtlsTransportFailed(const ::RTC::DtlsTransport* dtlsTransport) override;
+		void OnDtlsTransportClosed(const ::RTC::DtlsTransport* dtlsTransport) override;
+		void OnDtlsTransportSendData(
+		  const ::RTC::DtlsTransport* dtlsTransport, const uint8_t* data, size_t len) override;
+		void OnDtlsTransportApplicationDataReceived(
+		  const ::RTC::DtlsTransport* dtlsTransport, const uint8_t* data, size_t len) override;
+
+		/* Pure virtual methods inherited from RTC::TransportCongestionControlServer::Listener. */
+	public:
+		void OnTransportCongestionControlServerSendRtcpPacket(
+		  ::RTC::TransportCongestionControlServer* tccServer, ::RTC::RTCP::Packet* packet) override;
+
+	private:
+		// Passed by argument.
+		Loadgen::Stats* stats{ nullptr };
+		size_t index{ 0u };
+		// Allocated by this.
+		::RTC::UdpSocket* udpSocket{ nullptr };
+		::RTC::DtlsTransport* dtlsTransport{ nullptr };
+		::RTC::SrtpSession* srtpSendSession{ nullptr };
+		::RTC::SrtpSession* srtpRecvSession{ nullptr };
+		::RTC::TransportCongestionControlServer* tccServer{ nullptr };
+		absl::flat_hash_map<uint32_t, std::unique_ptr<RecvStream>> recvStreams;
+		// Others.
+		std::string iceUsernameFragment;
+		std::string icePassword;
+		std::string remoteIceUsernameFragment;
+		std::string remoteIcePassword;
+		struct sockaddr_storage remoteAddr;
+		bool hasRemoteAddr{ false };
+		bool failed{ false };
+		uint64_t iceTieBreaker{ 0u };
+		uint64_t nextBindingRequestAtMs{ 0u };
+		uint64_t nextVideoFrameAtUs{ 0u };
+		uint64_t nextAudioFrameAtUs{ 0u };
+		uint16_t transportWideSeq{ 0u };
+		SendStream videoStreams[NumVideoStreams];
+		SendStream audioStream;
+	};
+} // namespace Loadgen
+
+#endif
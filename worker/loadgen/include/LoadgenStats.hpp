@@ -0,0 +1,61 @@
+#ifndef MS_LOADGEN_STATS_HPP
+#define MS_LOADGEN_STATS_HPP
+
+#include "common.hpp"
+#include <ostream>
+#include <vector>
+
+namespace Loadgen
+{
+	/**
+	 * Counters shared by all the sessions of a load generator run. Latencies
+	 * are kept in a fixed histogram so recording them never allocates.
+	 */
+	class Stats
+	{
+	private:
+		static constexpr uint64_t LatencyBucketUs{ 10u };
+		static constexpr size_t NumLatencyBuckets{ 100000u };
+
+	public:
+		Stats();
+
+	public:
+		void AddLatency(uint64_t latencyNs);
+		uint64_t GetLatencyPercentileUs(double percentile) const;
+		uint64_t GetMaxLatencyUs() const
+		{
+			return this->maxLatencyUs;
+		}
+		void Reset();
+		void PrintJson(std::ostream& os) const;
+
+	public:
+		// Set by the caller before printing.
+		size_t sessions{ 0u };
+		size_t producerStreams{ 0u };
+		size_t consumerStreams{ 0u };
+		uint64_t durationMs{ 0u };
+		double workerCpuPercent{ 0 };
+		double loadgenCpuPercent{ 0 };
+		// Updated by the sessions.
+		uint64_t packetsSent{ 0u };
+		uint64_t bytesSent{ 0u };
+		uint64_t bytesReceived{ 0u };
+		// Packets of the Consumer streams (probation packets are not included).
+		uint64_t packetsReceived{ 0u };
+		uint64_t packetsExpected{ 0u };
+		uint64_t retransmissionsSent{ 0u };
+		uint64_t keyFramesSent{ 0u };
+		uint64_t nacksSent{ 0u };
+		uint64_t plisSent{ 0u };
+		uint64_t transportCcFeedbacksSent{ 0u };
+
+	private:
+		std::vector<uint64_t> latencyBuckets;
+		uint64_t latencyCount{ 0u };
+		uint64_t maxLatencyUs{ 0u };
+	};
+} // namespace Loadgen
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef MS_LOADGEN_WORKER_PROCESS_HPP
+#define MS_LOADGEN_WORKER_PROCESS_HPP
+
+#include "common.hpp"
+#include "Channel/ChannelSocket.hpp"
+#include <uv.h>
+#include <string>
+#include <vector>
+
+namespace Loadgen
+{
+	/**
+	 * A mediasoup-worker child process driven through its Channel pipes, the
+	 * same way the Node library does. Requests are synchronous: the libuv loop
+	 * is run until the response arrives, so they must not be sent from within
+	 * a libuv callback.
+	 */
+	class WorkerProcess : public Channel::ConsumerSocket::Listener
+	{
+	public:
+		explicit WorkerProcess(const std::string& workerBin);
+		~WorkerProcess() override;
+
+	public:
+		flatbuffers::FlatBufferBuilder& GetBufferBuilder()
+		{
+			return this->bufferBuilder;
+		}
+		// Sends the request whose body has been built into the buffer builder and
+		// returns the serialized response. Throws if the worker rejects it.
+		std::vector<uint8_t> Request(
+		  FBS::Request::Method method,
+		  const std::string& handlerId,
+		  FBS::Request::Body bodyType = FBS::Request::Body::NONE,
+		  flatbuffers::Offset<void> body = 0);
+		// Total user plus system CPU time of the worker (in ms).
+		uint64_t GetCpuTimeMs();
+		void Close();
+
+	public:
+		static const FBS::Response::Response* GetResponse(const std::vector<uint8_t>& buffer)
+		{
+			return FBS::Message::GetMessage(buffer.data())->data_as<FBS::Response::Response>();
+		}
+
+		/* Callbacks fired by UV events. */
+	public:
+		void OnUvExit(int64_t exitStatus, int termSignal);
+
+		/* Pure virtual methods inherited from Channel::ConsumerSocket::Listener. */
+	public:
+		void OnConsumerSocketMessage(
+		  Channel::ConsumerSocket* consumerSocket, char* msg, size_t msgLen) override;
+		void OnConsumerSocketClosed(Channel::ConsumerSocket* consumerSocket) override;
+
+	private:
+		// Allocated by this.
+		uv_process_t* uvProcess{ nullptr };
+		Channel::ProducerSocket* producerSocket{ nullptr };
+		Channel::ConsumerSocket* consumerSocket{ nullptr };
+		// Others.
+		flatbuffers::FlatBufferBuilder bufferBuilder{};
+		bool running{ false };
+		bool exited{ false };
+		bool closed{ false };
+		uint32_t nextRequestId{ 0u };
+		uint32_t pendingRequestId{ 0u };
+		bool responseReceived{ false };
+		std::vector<uint8_t> response;
+	};
+} // namespace Loadgen
+
+#endif
@@ -0,0 +1,512 @@
+#define MS_CLASS "Loadgen::Generator"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "LoadgenGenerator.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "RTC/RtpDictionaries.hpp"
+#include <algorithm> // std::max()
+
+namespace Loadgen
+{
+	/* Static. */
+
+	static const std::string RouterId{ "router" };
+	static constexpr uint8_t ConsumerVideoPayloadType{ 101u };
+	static constexpr uint64_t TickIntervalMs{ 10u };
+	static constexpr uint64_t ConnectTimeoutMs{ 10000u };
+
+	static std::string getTransportId(size_t index)
+	{
+		return "transport-" + std::to_string(index);
+	}
+
+	static std::string getProducerId(size_t index, bool isVideo)
+	{
+		return "producer-" + std::to_string(index) + (isVideo ? "-video" : "-audio");
+	}
+
+	// SSRC the Router uses for a Producer encoding.
+	static uint32_t getMappedSsrc(size_t index, size_t idx)
+	{
+		return static_cast<uint32_t>(20000000u + (index * 10u) + idx);
+	}
+
+	static uint32_t getConsumerSsrc(size_t index, size_t idx, bool isVideo)
+	{
+		return static_cast<uint32_t>(30000000u + (index * 1000u) + (idx * 2u) + (isVideo ? 0u : 1u));
+	}
+
+	static RTC::RtpParameters createRtpParameters(bool isVideo, uint8_t payloadType)
+	{
+		RTC::RtpParameters rtpParameters;
+		RTC::RtpCodecParameters codec;
+
+		if (isVideo)
+		{
+			codec.mimeType.SetMimeType("video/VP8");
+			codec.clockRate = 90000u;
+
+			codec.rtcpFeedback.emplace_back();
+			codec.rtcpFeedback.back().type = "nack";
+			codec.rtcpFeedback.emplace_back();
+			codec.rtcpFeedback.back().type      = "nack";
+			codec.rtcpFeedback.back().parameter = "pli";
+			codec.rtcpFeedback.emplace_back();
+			codec.rtcpFeedback.back().type      = "ccm";
+			codec.rtcpFeedback.back().parameter = "fir";
+		}
+		else
+		{
+			codec.mimeType.SetMimeType("audio/opus");
+			codec.clockRate = 48000u;
+			codec.channels  = 2u;
+		}
+
+		codec.payloadType = payloadType;
+
+		codec.rtcpFeedback.emplace_back();
+		codec.rtcpFeedback.back().type = "transport-cc";
+
+		rtpParameters.codecs.push_back(codec);
+
+		rtpParameters.headerExtensions.emplace_back();
+		rtpParameters.headerExtensions.back().type = RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME;
+		rtpParameters.headerExtensions.back().id   = Loadgen::Session::AbsSendTimeId;
+		rtpParameters.headerExtensions.emplace_back();
+		rtpParameters.headerExtensions.back().type =
+		  RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01;
+		rtpParameters.headerExtensions.back().id = Loadgen::Session::TransportWideCc01Id;
+
+		rtpParameters.rtcp.cname = "loadgen";
+
+		return rtpParameters;
+	}
+
+	/* Instance methods. */
+
+	Generator::Generator(const Options& options, Loadgen::Stats* stats)
+	  : options(options), stats(stats)
+	{
+		MS_TRACE();
+
+		// This may throw.
+		this->worker = std::make_unique<Loadgen::WorkerProcess>(this->options.workerBin);
+
+		this->tickTimer = new TimerHandle(this);
+	}
+
+	Generator::~Generator()
+	{
+		MS_TRACE();
+
+		delete this->tickTimer;
+
+		this->sessions.clear();
+
+		this->worker->Close();
+	}
+
+	void Generator::Run()
+	{
+		MS_TRACE();
+
+		CreateRouter();
+
+		// Needed for ICE checks while the sessions are being created.
+		this->tickTimer->Start(TickIntervalMs, TickIntervalMs);
+
+		for (size_t index{ 0u }; index < this->options.sessions; ++index)
+		{
+			CreateSession(index);
+		}
+
+		WaitForConnectedSessions();
+
+		MS_DEBUG_TAG(info, "%zu sessions connected", this->sessions.size());
+
+		size_t consumerStreams{ 0u };
+
+		for (auto& session : this->sessions)
+		{
+			for (size_t idx{ 0u }; idx < this->options.consumersPerSession; ++idx)
+			{
+				const auto& producerSession =
+				  this->sessions[(session->GetIndex() + idx + 1u) % this->sessions.size()];
+
+				Consume(*session, *producerSession, idx, /*isVideo*/ true);
+				Consume(*session, *producerSession, idx, /*isVideo*/ false);
+
+				consumerStreams += 2u;
+			}
+		}
+
+		RunFor(this->options.warmUpMs);
+
+		// Measure.
+		this->stats->Reset();
+
+		for (auto& session : this->sessions)
+		{
+			session->ResetStats();
+		}
+
+		uv_rusage_t startUsage;
+
+		uv_getrusage(std::addressof(startUsage));
+
+		const uint64_t startWorkerCpuMs = this->worker->GetCpuTimeMs();
+		const uint64_t startMs          = DepLibUV::GetTimeMs();
+
+		RunFor(this->options.durationMs);
+
+		const uint64_t endWorkerCpuMs = this->worker->GetCpuTimeMs();
+		const uint64_t endMs          = DepLibUV::GetTimeMs();
+
+		uv_rusage_t endUsage;
+
+		uv_getrusage(std::addressof(endUsage));
+
+		this->tickTimer->Stop();
+
+		for (auto& session : this->sessions)
+		{
+			session->CollectStats();
+		}
+
+		auto getCpuMs = [](const uv_rusage_t& usage)
+		{
+			return (usage.ru_utime.tv_sec * static_cast<uint64_t>(1000)) +
+			       (usage.ru_utime.tv_usec / 1000) +
+			       (usage.ru_stime.tv_sec * static_cast<uint64_t>(1000)) +
+			       (usage.ru_stime.tv_usec / 1000);
+		};
+
+		const uint64_t durationMs = std::max<uint64_t>(endMs - startMs, 1u);
+
+		this->stats->sessions        = this->sessions.size();
+		this->stats->producerStreams = this->sessions.size() * (Loadgen::Session::NumVideoStreams + 1u);
+		this->stats->consumerStreams = consumerStreams;
+		this->stats->durationMs      = durationMs;
+		this->stats->workerCpuPercent =
+		  100.0 * static_cast<double>(endWorkerCpuMs - startWorkerCpuMs) / durationMs;
+		this->stats->loadgenCpuPercent =
+		  100.0 * static_cast<double>(getCpuMs(endUsage) - getCpuMs(startUsage)) / durationMs;
+	}
+
+	void Generator::CreateRouter()
+	{
+		MS_TRACE();
+
+		auto& builder = this->worker->GetBufferBuilder();
+		auto body     = FBS::Worker::CreateCreateRouterRequestDirect(builder, RouterId.c_str());
+
+		this->worker->Request(
+		  FBS::Request::Method::WORKER_CREATE_ROUTER,
+		  "",
+		  FBS::Request::Body::Worker_CreateRouterRequest,
+		  body.Union());
+	}
+
+	void Generator::CreateSession(size_t index)
+	{
+		MS_TRACE();
+
+		// This may throw.
+		auto session = std::make_unique<Loadgen::Session>(this->stats, index, this->options.ip);
+
+		const auto transportId = getTransportId(index);
+
+		// Create the WebRtcTransport.
+		std::string iceUsernameFragment;
+		std::string icePassword;
+		std::string ip;
+		uint16_t port;
+		RTC::DtlsTransport::Fingerprint fingerprint;
+
+		{
+			auto& builder = this->worker->GetBufferBuilder();
+
+			std::vector<flatbuffers::Offset<FBS::Transport::ListenInfo>> listenInfos;
+
+			listenInfos.emplace_back(FBS::Transport::CreateListenInfoDirect(
+			  builder, FBS::Transport::Protocol::UDP, this->options.ip.c_str()));
+
+			auto listenIndividual =
+			  FBS::WebRtcTransport::CreateListenIndividualDirect(builder, &listenInfos);
+			auto webRtcTransportOptions = FBS::WebRtcTransport::CreateWebRtcTransportOptions(
+			  builder,
+			  FBS::Transport::CreateOptions(builder),
+			  FBS::WebRtcTransport::Listen::ListenIndividual,
+			  listenIndividual.Union());
+			auto body = FBS::Router::CreateCreateWebRtcTransportRequestDirect(
+			  builder, transportId.c_str(), webRtcTransportOptions);
+
+			auto response = this->worker->Request(
+			  FBS::Request::Method::ROUTER_CREATE_WEBRTCTRANSPORT,
+			  RouterId,
+			  FBS::Request::Body::Router_CreateWebRtcTransportRequest,
+			  body.Union());
+
+			const auto* dump = Loadgen::WorkerProcess::GetResponse(response)
+			                     ->body_as<FBS::WebRtcTransport::DumpResponse>();
+
+			iceUsernameFragment = dump->iceParameters()->usernameFragment()->str();
+			icePassword         = dump->iceParameters()->password()->str();
+
+			if (dump->iceCandidates()->size() == 0u)
+			{
+				MS_THROW_ERROR("no ICE candidates in WebRtcTransport %s", transportId.c_str());
+			}
+
+			ip   = dump->iceCandidates()->Get(0)->ip()->str();
+			port = dump->iceCandidates()->Get(0)->port();
+
+			for (const auto* remoteFingerprint : *dump->dtlsParameters()->fingerprints())
+			{
+				fingerprint.algorithm =
+				  RTC::DtlsTransport::AlgorithmFromFbs(remoteFingerprint->algorithm());
+				fingerprint.value = remoteFingerprint->value()->str();
+
+				if (fingerprint.algorithm == RTC::DtlsTransport::FingerprintAlgorithm::SHA256)
+				{
+					break;
+				}
+			}
+		}
+
+		// Connect the WebRtcTransport (the session is the DTLS client).
+		{
+			auto& builder                = this->worker->GetBufferBuilder();
+			const auto& localFingerprint = session->GetLocalFingerprint();
+
+			std::vector<flatbuffers::Offset<FBS::WebRtcTransport::Fingerprint>> fingerprints;
+
+			fingerprints.emplace_back(FBS::WebRtcTransport::CreateFingerprintDirect(
+			  builder,
+			  RTC::DtlsTransport::AlgorithmToFbs(localFingerprint.algorithm),
+			  localFingerprint.value.c_str()));
+
+			auto dtlsParameters = FBS::WebRtcTransport::CreateDtlsParametersDirect(
+			  builder, &fingerprints, FBS::WebRtcTransport::DtlsRole::CLIENT);
+			auto body = FBS::WebRtcTransport::CreateConnectRequest(builder, dtlsParameters);
+
+			this->worker->Request(
+			  FBS::Request::Method::WEBRTCTRANSPORT_CONNECT,
+			  transportId,
+			  FBS::Request::Body::WebRtcTransport_ConnectRequest,
+			  body.Union());
+		}
+
+		session->Connect(iceUsernameFragment, icePassword, ip, port, fingerprint);
+
+		Produce(*session, /*isVideo*/ true);
+		Produce(*session, /*isVideo*/ false);
+
+		this->sessions.push_back(std::move(session));
+	}
+
+	void Generator::Produce(const Loadgen::Session& session, bool isVideo)
+	{
+		MS_TRACE();
+
+		const uint8_t payloadType =
+		  isVideo ? Loadgen::Session::VideoPayloadType : Loadgen::Session::AudioPayloadType;
+
+		auto& builder      = this->worker->GetBufferBuilder();
+		auto rtpParameters = createRtpParameters(isVideo, payloadType);
+
+		std::vector<flatbuffers::Offset<FBS::RtpParameters::CodecMapping>> codecs;
+		std::vector<flatbuffers::Offset<FBS::RtpParameters::EncodingMapping>> encodings;
+
+		if (isVideo)
+		{
+			rtpParameters.mid = "0";
+
+			codecs.emplace_back(FBS::RtpParameters::CreateCodecMapping(
+			  builder, Loadgen::Session::VideoPayloadType, ConsumerVideoPayloadType));
+
+			for (size_t idx{ 0u }; idx < Loadgen::Session::NumVideoStreams; ++idx)
+			{
+				rtpParameters.encodings.emplace_back();
+				rtpParameters.encodings.back().ssrc            = session.GetVideoSsrc(idx);
+				rtpParameters.encodings.back().scalabilityMode = "L1T3";
+
+				encodings.emplace_back(FBS::RtpParameters::CreateEncodingMappingDirect(
+				  builder,
+				  /*rid*/ nullptr,
+				  session.GetVideoSsrc(idx),
+				  "L1T3",
+				  getMappedSsrc(session.GetIndex(), idx)));
+			}
+		}
+		else
+		{
+			rtpParameters.mid = "1";
+
+			codecs.emplace_back(FBS::RtpParameters::CreateCodecMapping(
+			  builder, Loadgen::Session::AudioPayloadType, Loadgen::Session::AudioPayloadType));
+
+			rtpParameters.encodings.emplace_back();
+			rtpParameters.encodings.back().ssrc = session.GetAudioSsrc();
+
+			encodings.emplace_back(FBS::RtpParameters::CreateEncodingMappingDirect(
+			  builder,
+			  /*rid*/ nullptr,
+			  session.GetAudioSsrc(),
+			  /*scalabilityMode*/ nullptr,
+			  getMappedSsrc(session.GetIndex(), Loadgen::Session::NumVideoStreams)));
+		}
+
+		auto rtpMapping = FBS::RtpParameters::CreateRtpMappingDirect(builder, &codecs, &encodings);
+
+		auto body = FBS::Transport::CreateProduceRequestDirect(
+		  builder,
+		  getProducerId(session.GetIndex(), isVideo).c_str(),
+		  isVideo ? FBS::RtpParameters::MediaKind::VIDEO : FBS::RtpParameters::MediaKind::AUDIO,
+		  rtpParameters.FillBuffer(builder),
+		  rtpMapping);
+
+		this->worker->Request(
+		  FBS::Request::Method::TRANSPORT_PRODUCE,
+		  getTransportId(session.GetIndex()),
+		  FBS::Request::Body::Transport_ProduceRequest,
+		  body.Union());
+	}
+
+	void Generator::Consume(
+	  Loadgen::Session& session, const Loadgen::Session& producerSession, size_t idx, bool isVideo)
+	{
+		MS_TRACE();
+
+		const uint8_t payloadType =
+		  isVideo ? ConsumerVideoPayloadType : Loadgen::Session::AudioPayloadType;
+		const uint32_t ssrc = getConsumerSsrc(session.GetIndex(), idx, isVideo);
+
+		auto& builder      = this->worker->GetBufferBuilder();
+		auto rtpParameters = createRtpParameters(isVideo, payloadType);
+
+		// Producers use mids "0" and "1".
+		rtpParameters.mid = std::to_string(2u + (idx * 2u) + (isVideo ? 0u : 1u));
+
+		rtpParameters.encodings.emplace_back();
+		rtpParameters.encodings.back().ssrc = ssrc;
+
+		// Consumable encodings are the Producer ones with mapped SSRCs.
+		std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>> consumableEncodings;
+		FBS::RtpParameters::Type type;
+
+		if (isVideo)
+		{
+			type = FBS::RtpParameters::Type::SIMULCAST;
+
+			rtpParameters.encodings.back().scalabilityMode = "L3T3";
+
+			for (size_t streamIdx{ 0u }; streamIdx < Loadgen::Session::NumVideoStreams; ++streamIdx)
+			{
+				RTC::RtpEncodingParameters encoding;
+
+				encoding.ssrc            = getMappedSsrc(producerSession.GetIndex(), streamIdx);
+				encoding.scalabilityMode = "L1T3";
+
+				consumableEncodings.emplace_back(encoding.FillBuffer(builder));
+			}
+		}
+		else
+		{
+			type = FBS::RtpParameters::Type::SIMPLE;
+
+			RTC::RtpEncodingParameters encoding;
+
+			encoding.ssrc = getMappedSsrc(producerSession.GetIndex(), Loadgen::Session::NumVideoStreams);
+
+			consumableEncodings.emplace_back(encoding.FillBuffer(builder));
+		}
+
+		const std::string consumerId = "consumer-" + std::to_string(session.GetIndex()) + "-" +
+		                               std::to_string(idx) + (isVideo ? "-video" : "-audio");
+
+		auto body = FBS::Transport::CreateConsumeRequestDirect(
+		  builder,
+		  consumerId.c_str(),
+		  getProducerId(producerSession.GetIndex(), isVideo).c_str(),
+		  isVideo ? FBS::RtpParameters::MediaKind::VIDEO : FBS::RtpParameters::MediaKind::AUDIO,
+		  rtpParameters.FillBuffer(builder),
+		  type,
+		  &consumableEncodings);
+
+		this->worker->Request(
+		  FBS::Request::Method::TRANSPORT_CONSUME,
+		  getTransportId(session.GetIndex()),
+		  FBS::Request::Body::Transport_ConsumeRequest,
+		  body.Union());
+
+		session.AddRecvStream(ssrc, isVideo);
+	}
+
+	void Generator::WaitForConnectedSessions()
+	{
+		MS_TRACE();
+
+		const uint64_t timeoutAtMs = DepLibUV::GetTimeMs() + ConnectTimeoutMs;
+
+		while (true)
+		{
+			size_t connected{ 0u };
+
+			for (const auto& session : this->sessions)
+			{
+				if (session->HasFailed())
+				{
+					MS_THROW_ERROR("session %zu failed to connect", session->GetIndex());
+				}
+
+				if (session->IsConnected())
+				{
+					++connected;
+				}
+			}
+
+			if (connected == this->sessions.size())
+			{
+				break;
+			}
+			else if (DepLibUV::GetTimeMs() >= timeoutAtMs)
+			{
+				MS_THROW_ERROR(
+				  "only %zu of %zu sessions connected after %" PRIu64 " ms",
+				  connected,
+				  this->sessions.size(),
+				  ConnectTimeoutMs);
+			}
+
+			uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+		}
+	}
+
+	void Generator::RunFor(uint64_t ms)
+	{
+		MS_TRACE();
+
+		const uint64_t endAtMs = DepLibUV::GetTimeMs() + ms;
+
+		// The tick timer ensures that the loop wakes up periodically.
+		while (DepLibUV::GetTimeMs() < endAtMs)
+		{
+			uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+		}
+	}
+
+	inline void Generator::OnTimer(TimerHandle* /*timer*/)
+	{
+		MS_TRACE();
+
+		const uint64_t nowMs = DepLibUV::GetTimeMs();
+
+		for (auto& session : this->sessions)
+		{
+			session->Tick(nowMs);
+		}
+	}
+} // namespace Loadgen
@@ -0,0 +1,905 @@
+#define MS_CLASS "Loadgen::Session"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "LoadgenSession.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include "RTC/BweType.hpp"
+#include "RTC/Codecs/Tools.hpp"
+#include "RTC/RTCP/FeedbackPsFir.hpp"
+#include "RTC/RTCP/FeedbackPsPli.hpp"
+#include "RTC/RTCP/FeedbackRtpNack.hpp"
+#include "RTC/SeqManager.hpp"
+#include "RTC/StunPacket.hpp"
+#include <algorithm> // std::min(), std::max()
+#include <cstring>   // std::memcpy(), std::memset()
+
+namespace Loadgen
+{
+	/* Static. */
+
+	// Marks the trailer written at the end of every RTP payload.
+	static constexpr uint32_t TrailerMagic{ 0x4C47454E };
+	// Magic plus uv_hrtime() at which the packet was first sent.
+	static constexpr size_t TrailerLen{ 12u };
+	// RTP header plus abs-send-time and transport-wide-cc-01 extensions.
+	static constexpr size_t RtpHeaderLen{ 24u };
+	static constexpr size_t Vp8DescriptorLen{ 6u };
+	static constexpr size_t MaxPayloadLen{ 1100u };
+	static constexpr uint32_t VideoBitrates[Session::NumVideoStreams]{ 150000u, 500000u, 1200000u };
+	static constexpr uint32_t AudioBitrate{ 32000u };
+	static constexpr uint64_t VideoFrameIntervalUs{ 33333u };
+	static constexpr uint64_t AudioFrameIntervalUs{ 20000u };
+	static constexpr uint64_t KeyFrameInterval{ 300u };
+	static constexpr size_t KeyFrameSizeFactor{ 3u };
+	// Temporal layer of each frame (L1T3 pattern).
+	static constexpr uint8_t TemporalLayers[]{ 0u, 2u, 1u, 2u };
+	static constexpr uint64_t IceCheckIntervalMs{ 500u };
+	static constexpr uint64_t IceKeepAliveIntervalMs{ 5000u };
+	static constexpr unsigned int SendNackDelayMs{ 10u };
+	static constexpr size_t BufferSize{ RTC::MtuSize + 100u };
+
+	thread_local static uint8_t Buffer[BufferSize];
+
+	/* Instance methods. */
+
+	Session::Session(Loadgen::Stats* stats, size_t index, std::string& ip)
+	  : stats(stats), index(index)
+	{
+		MS_TRACE();
+
+		// This may throw.
+		this->udpSocket = new RTC::UdpSocket(this, ip);
+
+		this->dtlsTransport = new RTC::DtlsTransport(this);
+		this->tccServer =
+		  new RTC::TransportCongestionControlServer(this, RTC::BweType::TRANSPORT_CC, RTC::MtuSize);
+
+		this->iceUsernameFragment = Utils::Crypto::GetRandomString(16);
+		this->icePassword         = Utils::Crypto::GetRandomString(32);
+		this->iceTieBreaker =
+		  (static_cast<uint64_t>(Utils::Crypto::GetRandomUInt(0u, 0x7FFFFFFF)) << 32) |
+		  Utils::Crypto::GetRandomUInt(0u, 0x7FFFFFFF);
+
+		// SSRCs are derived from the session index so they are unique within the
+		// Router.
+		const auto ssrcBase = static_cast<uint32_t>(10000000u + (index * 10u));
+
+		for (size_t idx{ 0u }; idx < NumVideoStreams; ++idx)
+		{
+			auto& stream = this->videoStreams[idx];
+
+			stream.ssrc    = ssrcBase + idx;
+			stream.isVideo = true;
+			stream.bitrate = VideoBitrates[idx];
+			stream.seq     = static_cast<uint16_t>(Utils::Crypto::GetRandomUInt(0u, 0xFFFF));
+			stream.history.resize(HistorySize);
+		}
+
+		this->audioStream.ssrc    = ssrcBase + NumVideoStreams;
+		this->audioStream.bitrate = AudioBitrate;
+		this->audioStream.seq     = static_cast<uint16_t>(Utils::Crypto::GetRandomUInt(0u, 0xFFFF));
+	}
+
+	Session::~Session()
+	{
+		MS_TRACE();
+
+		this->recvStreams.clear();
+
+		delete this->tccServer;
+		delete this->srtpSendSession;
+		delete this->srtpRecvSession;
+		delete this->dtlsTransport;
+		delete this->udpSocket;
+	}
+
+	const RTC::DtlsTransport::Fingerprint& Session::GetLocalFingerprint() const
+	{
+		MS_TRACE();
+
+		for (const auto& fingerprint : this->dtlsTransport->GetLocalFingerprints())
+		{
+			if (fingerprint.algorithm == RTC::DtlsTransport::FingerprintAlgorithm::SHA256)
+			{
+				return fingerprint;
+			}
+		}
+
+		return this->dtlsTransport->GetLocalFingerprints().front();
+	}
+
+	void Session::Connect(
+	  const std::string& remoteIceUsernameFragment,
+	  const std::string& remoteIcePassword,
+	  const std::string& remoteIp,
+	  uint16_t remotePort,
+	  const RTC::DtlsTransport::Fingerprint& remoteFingerprint)
+	{
+		MS_TRACE();
+
+		this->remoteIceUsernameFragment = remoteIceUsernameFragment;
+		this->remoteIcePassword         = remoteIcePassword;
+
+		std::memset(std::addressof(this->remoteAddr), 0, sizeof(this->remoteAddr));
+
+		const int err = uv_ip4_addr(
+		  remoteIp.c_str(),
+		  static_cast<int>(remotePort),
+		  reinterpret_cast<struct sockaddr_in*>(std::addressof(this->remoteAddr)));
+
+		if (err != 0)
+		{
+			MS_THROW_ERROR("uv_ip4_addr() failed: %s", uv_strerror(err));
+		}
+
+		this->hasRemoteAddr = true;
+
+		this->dtlsTransport->SetRemoteFingerprint(remoteFingerprint);
+
+		// DTLS is run once the first ICE check succeeds.
+		SendBindingRequest();
+
+		this->nextBindingRequestAtMs = DepLibUV::GetTimeMs() + IceCheckIntervalMs;
+	}
+
+	void Session::AddRecvStream(uint32_t ssrc, bool isVideo)
+	{
+		MS_TRACE();
+
+		this->recvStreams[ssrc] = std::make_unique<RecvStream>(this, ssrc, isVideo);
+	}
+
+	void Session::Tick(uint64_t nowMs)
+	{
+		MS_TRACE();
+
+		if (!this->hasRemoteAddr || this->failed)
+		{
+			return;
+		}
+
+		if (nowMs >= this->nextBindingRequestAtMs)
+		{
+			SendBindingRequest();
+
+			this->nextBindingRequestAtMs =
+			  nowMs + (IsConnected() ? IceKeepAliveIntervalMs : IceCheckIntervalMs);
+		}
+
+		if (!IsConnected())
+		{
+			return;
+		}
+
+		const uint64_t nowUs = nowMs * 1000u;
+
+		// Spread the first frame of every session over a frame interval.
+		if (this->nextVideoFrameAtUs == 0u)
+		{
+			this->nextVideoFrameAtUs = nowUs + Utils::Crypto::GetRandomUInt(0u, VideoFrameIntervalUs);
+			this->nextAudioFrameAtUs = nowUs + Utils::Crypto::GetRandomUInt(0u, AudioFrameIntervalUs);
+		}
+
+		if (nowUs >= this->nextVideoFrameAtUs)
+		{
+			for (auto& stream : this->videoStreams)
+			{
+				SendVideoFrame(stream);
+			}
+
+			// Do not try to catch up if the generator is overloaded.
+			this->nextVideoFrameAtUs =
+			  std::max(this->nextVideoFrameAtUs + VideoFrameIntervalUs, nowUs);
+		}
+
+		if (nowUs >= this->nextAudioFrameAtUs)
+		{
+			SendAudioFrame(this->audioStream);
+
+			this->nextAudioFrameAtUs =
+			  std::max(this->nextAudioFrameAtUs + AudioFrameIntervalUs, nowUs);
+		}
+	}
+
+	void Session::ResetStats()
+	{
+		MS_TRACE();
+
+		for (auto& kv : this->recvStreams)
+		{
+			kv.second->ResetStats();
+		}
+	}
+
+	void Session::CollectStats()
+	{
+		MS_TRACE();
+
+		for (auto& kv : this->recvStreams)
+		{
+			this->stats->packetsExpected += kv.second->GetExpectedPackets();
+			this->stats->packetsReceived += kv.second->GetReceivedPackets();
+		}
+	}
+
+	void Session::SendBindingRequest()
+	{
+		MS_TRACE();
+
+		uint8_t transactionId[12];
+
+		for (auto& byte : transactionId)
+		{
+			byte = static_cast<uint8_t>(Utils::Crypto::GetRandomUInt(0u, 255u));
+		}
+
+		RTC::StunPacket packet(
+		  RTC::StunPacket::Class::REQUEST, RTC::StunPacket::Method::BINDING, transactionId, nullptr, 0);
+		const std::string username = this->remoteIceUsernameFragment + ":" + this->iceUsernameFragment;
+
+		packet.SetUsername(username.c_str(), username.length());
+		// Priority of a host candidate.
+		packet.SetPriority(2113937151u);
+		packet.SetIceControlling(this->iceTieBreaker);
+		packet.SetUseCandidate();
+		packet.Authenticate(this->remoteIcePassword);
+		packet.Serialize(Buffer);
+
+		this->udpSocket->Send(
+		  Buffer,
+		  packet.GetSize(),
+		  reinterpret_cast<const struct sockaddr*>(std::addressof(this->remoteAddr)),
+		  nullptr);
+	}
+
+	void Session::SendVideoFrame(SendStream& stream)
+	{
+		MS_TRACE();
+
+		const bool isKeyFrame = stream.keyFrameRequested || stream.frames % KeyFrameInterval == 0u;
+		const uint8_t tid     = isKeyFrame ? 0u : TemporalLayers[stream.frames % 4u];
+
+		if (tid == 0u)
+		{
+			++stream.tl0PictureIndex;
+		}
+
+		size_t frameLen = stream.bitrate / 8u * VideoFrameIntervalUs / 1000000u;
+
+		if (isKeyFrame)
+		{
+			frameLen *= KeyFrameSizeFactor;
+
+			++this->stats->keyFramesSent;
+		}
+
+		const size_t numPackets = std::max<size_t>((frameLen + MaxPayloadLen - 1u) / MaxPayloadLen, 1u);
+		const uint64_t sentAtNs = DepLibUV::GetTimeNs();
+
+		for (size_t packetIdx{ 0u }; packetIdx < numPackets; ++packetIdx)
+		{
+			const bool first = packetIdx == 0u;
+			const bool last  = packetIdx == numPackets - 1u;
+			uint8_t* data    = Buffer;
+			size_t headerLen = WriteRtpHeader(data, stream, VideoPayloadType, /*marker*/ last);
+
+			uint8_t* descriptor = data + headerLen;
+
+			// X and S bits, then I, L and T bits.
+			descriptor[0] = 0x80 | (first ? 0x10 : 0x00);
+			descriptor[1] = 0xE0;
+			descriptor[2] = 0x80 | ((stream.pictureId >> 8) & 0x7F);
+			descriptor[3] = stream.pictureId & 0xFF;
+			descriptor[4] = stream.tl0PictureIndex;
+			// TID and Y bit.
+			descriptor[5] = (tid << 6) | 0x20;
+
+			headerLen += Vp8DescriptorLen;
+
+			// VP8 payload header (P bit unset in key frames).
+			if (first)
+			{
+				data[headerLen++] = isKeyFrame ? 0x00 : 0x01;
+			}
+
+			const size_t payloadLen = std::min(frameLen / numPackets, MaxPayloadLen);
+			const size_t len        = std::max(headerLen + payloadLen, headerLen + TrailerLen);
+
+			// Payload bytes are not initialized: their content is irrelevant.
+			Utils::Byte::Set4Bytes(data, len - TrailerLen, TrailerMagic);
+			Utils::Byte::Set8Bytes(data, len - 8u, sentAtNs);
+
+			auto& sentPacket = stream.history[stream.seq % HistorySize];
+
+			sentPacket.valid     = true;
+			sentPacket.seq       = stream.seq;
+			sentPacket.len       = static_cast<uint16_t>(len);
+			sentPacket.headerLen = static_cast<uint8_t>(headerLen);
+			sentPacket.sentAtNs  = sentAtNs;
+
+			std::memcpy(sentPacket.header, data, headerLen);
+
+			++stream.seq;
+
+			SendRtpPacket(data, len);
+		}
+
+		stream.keyFrameRequested = false;
+		stream.pictureId         = (stream.pictureId + 1u) & 0x7FFF;
+		stream.timestamp += 90000u * VideoFrameIntervalUs / 1000000u;
+		++stream.frames;
+	}
+
+	void Session::SendAudioFrame(SendStream& stream)
+	{
+		MS_TRACE();
+
+		uint8_t* data           = Buffer;
+		const size_t headerLen  = WriteRtpHeader(data, stream, AudioPayloadType, /*marker*/ false);
+		const size_t payloadLen = stream.bitrate / 8u * AudioFrameIntervalUs / 1000000u;
+		const size_t len        = headerLen + std::max(payloadLen, TrailerLen);
+
+		Utils::Byte::Set4Bytes(data, len - TrailerLen, TrailerMagic);
+		Utils::Byte::Set8Bytes(data, len - 8u, DepLibUV::GetTimeNs());
+
+		++stream.seq;
+		stream.timestamp += 48000u * AudioFrameIntervalUs / 1000000u;
+		++stream.frames;
+
+		SendRtpPacket(data, len);
+	}
+
+	size_t Session::WriteRtpHeader(
+	  uint8_t* data, SendStream& stream, uint8_t payloadType, bool marker)
+	{
+		MS_TRACE();
+
+		// Version 2 with header extension.
+		data[0] = 0b10010000;
+		data[1] = (marker ? 0x80 : 0x00) | payloadType;
+		Utils::Byte::Set2Bytes(data, 2, stream.seq);
+		Utils::Byte::Set4Bytes(data, 4, stream.timestamp);
+		Utils::Byte::Set4Bytes(data, 8, stream.ssrc);
+
+		// One-Byte extensions, 2 words.
+		data[12] = 0xBE;
+		data[13] = 0xDE;
+		data[14] = 0x00;
+		data[15] = 0x02;
+		// abs-send-time (value written when sending).
+		data[16] = (AbsSendTimeId << 4) | 2u;
+		// transport-wide-cc-01 (value written when sending).
+		data[20] = (TransportWideCc01Id << 4) | 1u;
+		data[23] = 0x00;
+
+		return RtpHeaderLen;
+	}
+
+	void Session::SendRtpPacket(uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		Utils::Byte::Set3Bytes(data, 17, Utils::Time::TimeMsToAbsSendTime(DepLibUV::GetTimeMs()));
+		Utils::Byte::Set2Bytes(data, 21, this->transportWideSeq++);
+
+		const uint8_t* encryptedData = data;
+		auto intLen                  = static_cast<int>(len);
+
+		if (!this->srtpSendSession->EncryptRtp(&encryptedData, &intLen))
+		{
+			return;
+		}
+
+		this->udpSocket->Send(
+		  encryptedData,
+		  static_cast<size_t>(intLen),
+		  reinterpret_cast<const struct sockaddr*>(std::addressof(this->remoteAddr)),
+		  nullptr);
+
+		++this->stats->packetsSent;
+		this->stats->bytesSent += intLen;
+	}
+
+	void Session::SendRtcpPacket(RTC::RTCP::Packet* packet)
+	{
+		MS_TRACE();
+
+		if (!IsConnected())
+		{
+			return;
+		}
+
+		packet->Serialize(RTC::RTCP::Buffer);
+
+		const uint8_t* data = RTC::RTCP::Buffer;
+		auto intLen         = static_cast<int>(packet->GetSize());
+
+		if (!this->srtpSendSession->EncryptRtcp(&data, &intLen))
+		{
+			return;
+		}
+
+		this->udpSocket->Send(
+		  data,
+		  static_cast<size_t>(intLen),
+		  reinterpret_cast<const struct sockaddr*>(std::addressof(this->remoteAddr)),
+		  nullptr);
+	}
+
+	void Session::Retransmit(SendStream& stream, uint16_t seq)
+	{
+		MS_TRACE();
+
+		const auto& sentPacket = stream.history[seq % HistorySize];
+
+		if (!sentPacket.valid || sentPacket.seq != seq)
+		{
+			return;
+		}
+
+		// Rebuild the packet with the original headers and send time.
+		uint8_t* data = Buffer;
+
+		std::memcpy(data, sentPacket.header, sentPacket.headerLen);
+		Utils::Byte::Set4Bytes(data, sentPacket.len - TrailerLen, TrailerMagic);
+		Utils::Byte::Set8Bytes(data, sentPacket.len - 8u, sentPacket.sentAtNs);
+
+		++this->stats->retransmissionsSent;
+
+		SendRtpPacket(data, sentPacket.len);
+	}
+
+	Session::SendStream* Session::GetSendStream(uint32_t ssrc)
+	{
+		MS_TRACE();
+
+		for (auto& stream : this->videoStreams)
+		{
+			if (stream.ssrc == ssrc)
+			{
+				return std::addressof(stream);
+			}
+		}
+
+		if (this->audioStream.ssrc == ssrc)
+		{
+			return std::addressof(this->audioStream);
+		}
+
+		return nullptr;
+	}
+
+	void Session::ProcessStunPacket(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		std::unique_ptr<RTC::StunPacket> packet(RTC::StunPacket::Parse(data, len));
+
+		if (!packet || packet->GetClass() != RTC::StunPacket::Class::SUCCESS_RESPONSE)
+		{
+			return;
+		}
+
+		// The worker (ICE Lite) has accepted the nominated candidate pair.
+		if (this->dtlsTransport->GetState() == RTC::DtlsTransport::DtlsState::NEW)
+		{
+			this->dtlsTransport->Run(RTC::DtlsTransport::Role::CLIENT);
+		}
+	}
+
+	void Session::ProcessRtcpPacket(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		if (!this->srtpRecvSession)
+		{
+			return;
+		}
+
+		auto intLen = static_cast<int>(len);
+
+		if (!this->srtpRecvSession->DecryptSrtcp(const_cast<uint8_t*>(data), &intLen))
+		{
+			return;
+		}
+
+		RTC::RTCP::Packet* packet = RTC::RTCP::Packet::Parse(data, static_cast<size_t>(intLen));
+
+		while (packet)
+		{
+			switch (packet->GetType())
+			{
+				case RTC::RTCP::Type::RTPFB:
+				{
+					auto* feedback = static_cast<RTC::RTCP::FeedbackRtpPacket*>(packet);
+
+					if (feedback->GetMessageType() != RTC::RTCP::FeedbackRtp::MessageType::NACK)
+					{
+						break;
+					}
+
+					auto* stream = GetSendStream(feedback->GetMediaSsrc());
+
+					if (!stream || !stream->isVideo)
+					{
+						break;
+					}
+
+					auto* nackPacket = static_cast<RTC::RTCP::FeedbackRtpNackPacket*>(packet);
+
+					for (auto it = nackPacket->Begin(); it != nackPacket->End(); ++it)
+					{
+						auto* item       = *it;
+						const auto seq   = item->GetPacketId();
+						uint16_t bitmask = item->GetLostPacketBitmask();
+
+						Retransmit(*stream, seq);
+
+						for (uint16_t shift{ 1u }; bitmask != 0u; ++shift, bitmask >>= 1)
+						{
+							if (bitmask & 0x01)
+							{
+								Retransmit(*stream, static_cast<uint16_t>(seq + shift));
+							}
+						}
+					}
+
+					break;
+				}
+
+				case RTC::RTCP::Type::PSFB:
+				{
+					auto* feedback = static_cast<RTC::RTCP::FeedbackPsPacket*>(packet);
+
+					switch (feedback->GetMessageType())
+					{
+						case RTC::RTCP::FeedbackPs::MessageType::PLI:
+						{
+							auto* stream = GetSendStream(feedback->GetMediaSsrc());
+
+							if (stream && stream->isVideo)
+							{
+								stream->keyFrameRequested = true;
+							}
+
+							break;
+						}
+
+						case RTC::RTCP::FeedbackPs::MessageType::FIR:
+						{
+							auto* firPacket = static_cast<RTC::RTCP::FeedbackPsFirPacket*>(packet);
+
+							for (auto it = firPacket->Begin(); it != firPacket->End(); ++it)
+							{
+								auto* stream = GetSendStream((*it)->GetSsrc());
+
+								if (stream && stream->isVideo)
+								{
+									stream->keyFrameRequested = true;
+								}
+							}
+
+							break;
+						}
+
+						default:;
+					}
+
+					break;
+				}
+
+				// Sender and Receiver Reports, SDES, etc. are not needed.
+				default:;
+			}
+
+			auto* previousPacket = packet;
+
+			packet = packet->GetNext();
+
+			delete previousPacket;
+		}
+	}
+
+	void Session::ProcessRtpPacket(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		if (!this->srtpRecvSession)
+		{
+			return;
+		}
+
+		auto intLen = static_cast<int>(len);
+
+		if (!this->srtpRecvSession->DecryptSrtp(const_cast<uint8_t*>(data), &intLen))
+		{
+			return;
+		}
+
+		std::unique_ptr<RTC::RtpPacket> packet(
+		  RTC::RtpPacket::Parse(data, static_cast<size_t>(intLen)));
+
+		if (!packet)
+		{
+			return;
+		}
+
+		this->stats->bytesReceived += intLen;
+
+		packet->SetTransportWideCc01ExtensionId(TransportWideCc01Id);
+
+		// Probation packets count for the bandwidth estimation too.
+		this->tccServer->IncomingPacket(DepLibUV::GetTimeMs(), packet.get());
+
+		auto it = this->recvStreams.find(packet->GetSsrc());
+
+		if (it == this->recvStreams.end())
+		{
+			return;
+		}
+
+		it->second->ReceivePacket(packet.get());
+
+		const uint8_t* payload  = packet->GetPayload();
+		const size_t payloadLen = packet->GetPayloadLength();
+
+		if (
+		  payloadLen >= TrailerLen &&
+		  Utils::Byte::Get4Bytes(payload, payloadLen - TrailerLen) == TrailerMagic)
+		{
+			const uint64_t sentAtNs = Utils::Byte::Get8Bytes(payload, payloadLen - 8u);
+
+			this->stats->AddLatency(DepLibUV::GetTimeNs() - sentAtNs);
+		}
+	}
+
+	inline void Session::OnUdpSocketPacketReceived(
+	  RTC::UdpSocket* /*socket*/,
+	  const uint8_t* data,
+	  size_t len,
+	  const struct sockaddr* /*remoteAddr*/)
+	{
+		MS_TRACE();
+
+		// Same demultiplexing as WebRtcTransport.
+		if (RTC::StunPacket::IsStun(data, len))
+		{
+			ProcessStunPacket(data, len);
+		}
+		else if (RTC::RTCP::Packet::IsRtcp(data, len))
+		{
+			ProcessRtcpPacket(data, len);
+		}
+		else if (RTC::RtpPacket::IsRtp(data, len))
+		{
+			ProcessRtpPacket(data, len);
+		}
+		else if (RTC::DtlsTransport::IsDtls(data, len))
+		{
+			this->dtlsTransport->ProcessDtlsData(data, len);
+		}
+	}
+
+	inline void Session::OnDtlsTransportConnecting(const RTC::DtlsTransport* /*dtlsTransport*/)
+	{
+		MS_TRACE();
+	}
+
+	inline void Session::OnDtlsTransportConnected(
+	  const RTC::DtlsTransport* /*dtlsTransport*/,
+	  RTC::SrtpSession::CryptoSuite srtpCryptoSuite,
+	  uint8_t* srtpLocalKey,
+	  size_t srtpLocalKeyLen,
+	  uint8_t* srtpRemoteKey,
+	  size_t srtpRemoteKeyLen,
+	  std::string& /*remoteCert*/)
+	{
+		MS_TRACE();
+
+		try
+		{
+			this->srtpSendSession = new RTC::SrtpSession(
+			  RTC::SrtpSession::Type::OUTBOUND, srtpCryptoSuite, srtpLocalKey, srtpLocalKeyLen);
+			this->srtpRecvSession = new RTC::SrtpSession(
+			  RTC::SrtpSession::Type::INBOUND, srtpCryptoSuite, srtpRemoteKey, srtpRemoteKeyLen);
+		}
+		catch (const MediaSoupError& error)
+		{
+			MS_ERROR("error creating SRTP sessions: %s", error.what());
+
+			delete this->srtpSendSession;
+			this->srtpSendSession = nullptr;
+			delete this->srtpRecvSession;
+			this->srtpRecvSession = nullptr;
+
+			this->failed = true;
+
+			return;
+		}
+
+		this->tccServer->TransportConnected();
+	}
+
+	inline void Session::OnDtlsTransportFailed(const RTC::DtlsTransport* /*dtlsTransport*/)
+	{
+		MS_TRACE();
+
+		MS_WARN_TAG(dtls, "DTLS failed [session:%zu]", this->index);
+
+		this->failed = true;
+	}
+
+	inline void Session::OnDtlsTransportClosed(const RTC::DtlsTransport* /*dtlsTransport*/)
+	{
+		MS_TRACE();
+
+		MS_WARN_TAG(dtls, "DTLS remotely closed [session:%zu]", this->index);
+
+		this->failed = true;
+	}
+
+	inline void Session::OnDtlsTransportSendData(
+	  const RTC::DtlsTransport* /*dtlsTransport*/, const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		this->udpSocket->Send(
+		  data,
+		  len,
+		  reinterpret_cast<const struct sockaddr*>(std::addressof(this->remoteAddr)),
+		  nullptr);
+	}
+
+	inline void Session::OnDtlsTransportApplicationDataReceived(
+	  const RTC::DtlsTransport* /*dtlsTransport*/, const uint8_t* /*data*/, size_t /*len*/)
+	{
+		MS_TRACE();
+	}
+
+	inline void Session::OnTransportCongestionControlServerSendRtcpPacket(
+	  RTC::TransportCongestionControlServer* /*tccServer*/, RTC::RTCP::Packet* packet)
+	{
+		MS_TRACE();
+
+		++this->stats->transportCcFeedbacksSent;
+
+		SendRtcpPacket(packet);
+	}
+
+	/* RecvStream instance methods. */
+
+	Session::RecvStream::RecvStream(Session* session, uint32_t ssrc, bool isVideo)
+	  : session(session), ssrc(ssrc), isVideo(isVideo)
+	{
+		MS_TRACE();
+
+		if (this->isVideo)
+		{
+			this->nackGenerator = std::make_unique<RTC::NackGenerator>(this, SendNackDelayMs);
+
+			this->mimeType.SetMimeType("video/VP8");
+		}
+		else
+		{
+			this->mimeType.SetMimeType("audio/opus");
+		}
+	}
+
+	void Session::RecvStream::ReceivePacket(RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		const uint16_t seq = packet->GetSequenceNumber();
+
+		if (!this->started)
+		{
+			this->started         = true;
+			this->maxSeq          = seq;
+			this->baseExtendedSeq = seq;
+		}
+		else if (RTC::SeqManager<uint16_t>::IsSeqHigherThan(seq, this->maxSeq))
+		{
+			if (seq < this->maxSeq)
+			{
+				this->cycles += 1u << 16;
+			}
+
+			this->maxSeq = seq;
+		}
+
+		++this->received;
+
+		if (this->nackGenerator)
+		{
+			// Needed to detect key frames.
+			RTC::Codecs::Tools::ProcessRtpPacket(packet, this->mimeType);
+
+			this->nackGenerator->ReceivePacket(packet, /*isRecovered*/ false);
+		}
+	}
+
+	uint64_t Session::RecvStream::GetExpectedPackets() const
+	{
+		MS_TRACE();
+
+		if (!this->started)
+		{
+			return 0u;
+		}
+
+		const uint64_t extendedMaxSeq = static_cast<uint64_t>(this->cycles) + this->maxSeq;
+
+		if (extendedMaxSeq < this->baseExtendedSeq)
+		{
+			return 0u;
+		}
+
+		return extendedMaxSeq - this->baseExtendedSeq + 1u;
+	}
+
+	void Session::RecvStream::ResetStats()
+	{
+		MS_TRACE();
+
+		if (this->started)
+		{
+			this->baseExtendedSeq = this->cycles + this->maxSeq + 1u;
+		}
+
+		this->received = 0u;
+	}
+
+	inline void Session::RecvStream::OnNackGeneratorNackRequired(
+	  const std::vector<uint16_t>& seqNumbers)
+	{
+		MS_TRACE();
+
+		// Same as RtpStreamRecv.
+		RTC::RTCP::FeedbackRtpNackPacket packet(0u, this->ssrc);
+
+		auto it        = seqNumbers.begin();
+		const auto end = seqNumbers.end();
+
+		while (it != end)
+		{
+			uint16_t seq;
+			uint16_t bitmask{ 0 };
+
+			seq = *it;
+			++it;
+
+			while (it != end)
+			{
+				uint16_t shift = *it - seq - 1;
+
+				if (shift > 15)
+				{
+					break;
+				}
+
+				bitmask |= (1 << shift);
+				++it;
+			}
+
+			packet.AddItem(new RTC::RTCP::FeedbackRtpNackItem(seq, bitmask));
+		}
+
+		++this->session->stats->nacksSent;
+
+		this->session->SendRtcpPacket(std::addressof(packet));
+	}
+
+	inline void Session::RecvStream::OnNackGeneratorKeyFrameRequired()
+	{
+		MS_TRACE();
+
+		RTC::RTCP::FeedbackPsPliPacket packet(0u, this->ssrc);
+
+		++this->session->stats->plisSent;
+
+		this->session->SendRtcpPacket(std::addressof(packet));
+	}
+} // namespace Loadgen
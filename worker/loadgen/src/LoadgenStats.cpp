@@ -0,0 +1,97 @@
+#include "LoadgenStats.hpp"
+#include <algorithm> // std::max(), std::min()
+
+namespace Loadgen
+{
+	Stats::Stats() : latencyBuckets(NumLatencyBuckets, 0u)
+	{
+	}
+
+	void Stats::AddLatency(uint64_t latencyNs)
+	{
+		const uint64_t latencyUs = latencyNs / 1000u;
+		const size_t bucket =
+		  std::min<uint64_t>(latencyUs / LatencyBucketUs, NumLatencyBuckets - 1u);
+
+		++this->latencyBuckets[bucket];
+		++this->latencyCount;
+
+		this->maxLatencyUs = std::max(this->maxLatencyUs, latencyUs);
+	}
+
+	uint64_t Stats::GetLatencyPercentileUs(double percentile) const
+	{
+		if (this->latencyCount == 0u)
+		{
+			return 0u;
+		}
+
+		const auto target = static_cast<uint64_t>(percentile * (this->latencyCount - 1u)) + 1u;
+		uint64_t count{ 0u };
+
+		for (size_t bucket{ 0u }; bucket < NumLatencyBuckets; ++bucket)
+		{
+			count += this->latencyBuckets[bucket];
+
+			if (count >= target)
+			{
+				// Upper bound of the bucket.
+				return (bucket + 1u) * LatencyBucketUs;
+			}
+		}
+
+		return this->maxLatencyUs;
+	}
+
+	void Stats::Reset()
+	{
+		std::fill(this->latencyBuckets.begin(), this->latencyBuckets.end(), 0u);
+
+		this->latencyCount             = 0u;
+		this->maxLatencyUs             = 0u;
+		this->packetsSent              = 0u;
+		this->bytesSent                = 0u;
+		this->packetsReceived          = 0u;
+		this->bytesReceived            = 0u;
+		this->packetsExpected          = 0u;
+		this->retransmissionsSent      = 0u;
+		this->keyFramesSent            = 0u;
+		this->nacksSent                = 0u;
+		this->plisSent                 = 0u;
+		this->transportCcFeedbacksSent = 0u;
+	}
+
+	void Stats::PrintJson(std::ostream& os) const
+	{
+		const size_t streams = this->producerStreams + this->consumerStreams;
+		const uint64_t lost =
+		  this->packetsExpected > this->packetsReceived ? this->packetsExpected - this->packetsReceived
+		                                                : 0u;
+
+		os << "{\n";
+		os << "  \"sessions\": " << this->sessions << ",\n";
+		os << "  \"producerStreams\": " << this->producerStreams << ",\n";
+		os << "  \"consumerStreams\": " << this->consumerStreams << ",\n";
+		os << "  \"durationMs\": " << this->durationMs << ",\n";
+		os << "  \"workerCpuPercent\": " << this->workerCpuPercent << ",\n";
+		os << "  \"workerCpuPercentPerStream\": "
+		   << (streams > 0u ? this->workerCpuPercent / streams : 0) << ",\n";
+		os << "  \"loadgenCpuPercent\": " << this->loadgenCpuPercent << ",\n";
+		os << "  \"packetsSent\": " << this->packetsSent << ",\n";
+		os << "  \"bytesSent\": " << this->bytesSent << ",\n";
+		os << "  \"packetsReceived\": " << this->packetsReceived << ",\n";
+		os << "  \"bytesReceived\": " << this->bytesReceived << ",\n";
+		os << "  \"packetsLost\": " << lost << ",\n";
+		os << "  \"lossPercent\": "
+		   << (this->packetsExpected > 0u ? 100.0 * lost / this->packetsExpected : 0) << ",\n";
+		os << "  \"retransmissionsSent\": " << this->retransmissionsSent << ",\n";
+		os << "  \"keyFramesSent\": " << this->keyFramesSent << ",\n";
+		os << "  \"nacksSent\": " << this->nacksSent << ",\n";
+		os << "  \"plisSent\": " << this->plisSent << ",\n";
+		os << "  \"transportCcFeedbacksSent\": " << this->transportCcFeedbacksSent << ",\n";
+		os << "  \"latencyP50Us\": " << GetLatencyPercentileUs(0.50) << ",\n";
+		os << "  \"latencyP99Us\": " << GetLatencyPercentileUs(0.99) << ",\n";
+		os << "  \"latencyMaxUs\": " << this->maxLatencyUs << "\n";
+		os << "}\n";
+	}
+} // namespace Loadgen
@@ -0,0 +1,313 @@
+#define MS_CLASS "Loadgen::WorkerProcess"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "LoadgenWorkerProcess.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Channel/ChannelRequest.hpp"
+#include <csignal>  // SIGTERM
+#include <unistd.h> // close()
+
+namespace Loadgen
+{
+	/* Static. */
+
+	// Channel fds of the worker, as in main.cpp.
+	static constexpr int ConsumerChannelFd{ 3 };
+	static constexpr int ProducerChannelFd{ 4 };
+	// Same as Channel::MessageMaxLen.
+	static constexpr size_t MessageMaxLen{ 4194308 };
+
+	/* Static methods for UV callbacks. */
+
+	inline static void onExit(uv_process_t* handle, int64_t exitStatus, int termSignal)
+	{
+		static_cast<WorkerProcess*>(handle->data)->OnUvExit(exitStatus, termSignal);
+	}
+
+	inline static void onCloseProcess(uv_handle_t* handle)
+	{
+		delete reinterpret_cast<uv_process_t*>(handle);
+	}
+
+	/* Instance methods. */
+
+	WorkerProcess::WorkerProcess(const std::string& workerBin)
+	{
+		MS_TRACE();
+
+		// Pipe read by the worker and pipe written by the worker. uv_pipe() sets
+		// close-on-exec portably (pipe2() is not available on macOS).
+		uv_file toWorkerFds[2];
+		uv_file fromWorkerFds[2];
+		int err;
+
+		err = uv_pipe(toWorkerFds, 0, 0);
+
+		if (err != 0)
+		{
+			MS_THROW_ERROR("uv_pipe() failed: %s", uv_strerror(err));
+		}
+
+		err = uv_pipe(fromWorkerFds, 0, 0);
+
+		if (err != 0)
+		{
+			close(toWorkerFds[0]);
+			close(toWorkerFds[1]);
+
+			MS_THROW_ERROR("uv_pipe() failed: %s", uv_strerror(err));
+		}
+
+		uv_stdio_container_t stdio[5];
+
+		stdio[0].flags                   = UV_IGNORE;
+		stdio[1].flags                   = UV_INHERIT_FD;
+		stdio[1].data.fd                 = 1;
+		stdio[2].flags                   = UV_INHERIT_FD;
+		stdio[2].data.fd                 = 2;
+		stdio[ConsumerChannelFd].flags   = UV_INHERIT_FD;
+		stdio[ConsumerChannelFd].data.fd = toWorkerFds[0];
+		stdio[ProducerChannelFd].flags   = UV_INHERIT_FD;
+		stdio[ProducerChannelFd].data.fd = fromWorkerFds[1];
+
+		// The worker refuses to run without it.
+		std::string versionEnv{ "MEDIASOUP_VERSION=loadgen" };
+		char* env[]{ versionEnv.data(), nullptr };
+		char* args[]{ const_cast<char*>(workerBin.c_str()), nullptr };
+
+		uv_process_options_t options{};
+
+		options.file        = workerBin.c_str();
+		options.args        = args;
+		options.env         = env;
+		options.exit_cb     = static_cast<uv_exit_cb>(onExit);
+		options.stdio       = stdio;
+		options.stdio_count = 5;
+
+		this->uvProcess       = new uv_process_t;
+		this->uvProcess->data = static_cast<void*>(this);
+
+		err = uv_spawn(DepLibUV::GetLoop(), this->uvProcess, std::addressof(options));
+
+		// The child ends are not needed anymore.
+		close(toWorkerFds[0]);
+		close(fromWorkerFds[1]);
+
+		if (err != 0)
+		{
+			close(toWorkerFds[1]);
+			close(fromWorkerFds[0]);
+
+			// A failed uv_spawn() still initializes the handle so it must be closed.
+			uv_close(
+			  reinterpret_cast<uv_handle_t*>(this->uvProcess), static_cast<uv_close_cb>(onCloseProcess));
+			this->uvProcess = nullptr;
+
+			MS_THROW_ERROR("uv_spawn() failed: %s", uv_strerror(err));
+		}
+
+		this->producerSocket = new Channel::ProducerSocket(toWorkerFds[1], MessageMaxLen);
+		this->consumerSocket = new Channel::ConsumerSocket(fromWorkerFds[0], MessageMaxLen, this);
+
+		// Wait for the WORKER_RUNNING notification.
+		while (!this->running && !this->exited)
+		{
+			uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+		}
+
+		if (!this->running)
+		{
+			Close();
+
+			delete this->producerSocket;
+			delete this->consumerSocket;
+
+			MS_THROW_ERROR("mediasoup-worker exited before running");
+		}
+	}
+
+	WorkerProcess::~WorkerProcess()
+	{
+		MS_TRACE();
+
+		Close();
+
+		delete this->producerSocket;
+		delete this->consumerSocket;
+	}
+
+	std::vector<uint8_t> WorkerProcess::Request(
+	  FBS::Request::Method method,
+	  const std::string& handlerId,
+	  FBS::Request::Body bodyType,
+	  flatbuffers::Offset<void> body)
+	{
+		MS_TRACE();
+
+		if (this->exited)
+		{
+			MS_THROW_ERROR("mediasoup-worker exited");
+		}
+
+		auto& builder = this->bufferBuilder;
+
+		this->pendingRequestId = ++this->nextRequestId;
+		this->responseReceived = false;
+
+		auto request = FBS::Request::CreateRequestDirect(
+		  builder, this->pendingRequestId, method, handlerId.c_str(), bodyType, body);
+		auto message =
+		  FBS::Message::CreateMessage(builder, FBS::Message::Body::Request, request.Union());
+
+		builder.FinishSizePrefixed(message);
+
+		this->producerSocket->Write(builder.GetBufferPointer(), builder.GetSize());
+
+		builder.Reset();
+
+		while (!this->responseReceived && !this->exited)
+		{
+			uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+		}
+
+		if (!this->responseReceived)
+		{
+			MS_THROW_ERROR(
+			  "mediasoup-worker exited while waiting for %s response",
+			  Channel::ChannelRequest::method2String[method]);
+		}
+
+		const auto* response = GetResponse(this->response);
+
+		if (!response->accepted())
+		{
+			MS_THROW_ERROR(
+			  "request %s rejected: %s",
+			  Channel::ChannelRequest::method2String[method],
+			  response->reason() ? response->reason()->c_str() : "");
+		}
+
+		return std::move(this->response);
+	}
+
+	uint64_t WorkerProcess::GetCpuTimeMs()
+	{
+		MS_TRACE();
+
+		auto buffer = Request(FBS::Request::Method::WORKER_GET_RESOURCE_USAGE, "");
+		const auto* resourceUsage =
+		  GetResponse(buffer)->body_as<FBS::Worker::ResourceUsageResponse>();
+
+		return resourceUsage->ruUtime() + resourceUsage->ruStime();
+	}
+
+	void WorkerProcess::Close()
+	{
+		MS_TRACE();
+
+		if (this->closed)
+		{
+			return;
+		}
+
+		this->closed = true;
+
+		if (!this->exited)
+		{
+			uv_process_kill(this->uvProcess, SIGTERM);
+
+			while (!this->exited)
+			{
+				uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+			}
+		}
+
+		this->producerSocket->Close();
+		this->consumerSocket->Close();
+	}
+
+	inline void WorkerProcess::OnUvExit(int64_t exitStatus, int termSignal)
+	{
+		MS_TRACE();
+
+		if (!this->closed)
+		{
+			MS_ERROR(
+			  "mediasoup-worker exited unexpectedly [exitStatus:%" PRIi64 ", termSignal:%d]",
+			  exitStatus,
+			  termSignal);
+		}
+
+		this->exited = true;
+
+		uv_close(
+		  reinterpret_cast<uv_handle_t*>(this->uvProcess), static_cast<uv_close_cb>(onCloseProcess));
+		this->uvProcess = nullptr;
+	}
+
+	void WorkerProcess::OnConsumerSocketMessage(
+	  Channel::ConsumerSocket* /*consumerSocket*/, char* msg, size_t msgLen)
+	{
+		MS_TRACE();
+
+		const auto* message = FBS::Message::GetMessage(msg);
+
+		switch (message->data_type())
+		{
+			case FBS::Message::Body::Response:
+			{
+				const auto* response = message->data_as<FBS::Response::Response>();
+
+				if (response->id() != this->pendingRequestId)
+				{
+					MS_WARN_DEV("ignoring response with unexpected id %" PRIu32, response->id());
+
+					break;
+				}
+
+				this->response.assign(msg, msg + msgLen);
+				this->responseReceived = true;
+
+				break;
+			}
+
+			case FBS::Message::Body::Notification:
+			{
+				const auto* notification = message->data_as<FBS::Notification::Notification>();
+
+				if (notification->event() == FBS::Notification::Event::WORKER_RUNNING)
+				{
+					this->running = true;
+				}
+
+				break;
+			}
+
+			case FBS::Message::Body::Log:
+			{
+				const auto* log = message->data_as<FBS::Log::Log>();
+
+				MS_DEBUG_DEV("mediasoup-worker log: %s", log->data()->c_str());
+
+				break;
+			}
+
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	void WorkerProcess::OnConsumerSocketClosed(Channel::ConsumerSocket* /*consumerSocket*/)
+	{
+		MS_TRACE();
+
+		if (!this->closed)
+		{
+			MS_ERROR("mediasoup-worker Channel closed");
+		}
+	}
+} // namespace Loadgen
@@ -0,0 +1,157 @@
+#define MS_CLASS "loadgen"
+
+#include "DepLibSRTP.hpp"
+#include "DepLibUV.hpp"
+#include "DepLibWebRTC.hpp"
+#include "DepOpenSSL.hpp"
+#include "DepUsrSCTP.hpp"
+#include "LoadgenGenerator.hpp"
+#include "LoadgenStats.hpp"
+#include "LogLevel.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Settings.hpp"
+#include "Utils.hpp"
+#include "RTC/DtlsTransport.hpp"
+#include "RTC/SrtpSession.hpp"
+#include <cstdlib> // std::getenv(), std::strtoull()
+#include <fstream>
+#include <iostream>
+#include <string>
+
+static constexpr size_t MaxConsumersPerSession{ 500u };
+
+static void printUsage()
+{
+	std::cerr << "usage: mediasoup-worker-loadgen --worker=PATH [--sessions=N] [--consumers=K] "
+	             "[--warm-up-ms=MS] [--duration-ms=MS] [--ip=IP] [--output=FILE]"
+	          << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	LogLevel logLevel{ LogLevel::LOG_NONE };
+
+	// Get logLevel from ENV variable.
+	if (std::getenv("MS_LOADGEN_LOG_LEVEL"))
+	{
+		if (std::string(std::getenv("MS_LOADGEN_LOG_LEVEL")) == "debug")
+		{
+			logLevel = LogLevel::LOG_DEBUG;
+		}
+		else if (std::string(std::getenv("MS_LOADGEN_LOG_LEVEL")) == "warn")
+		{
+			logLevel = LogLevel::LOG_WARN;
+		}
+		else if (std::string(std::getenv("MS_LOADGEN_LOG_LEVEL")) == "error")
+		{
+			logLevel = LogLevel::LOG_ERROR;
+		}
+	}
+
+	Settings::configuration.logLevel = logLevel;
+
+	Loadgen::Generator::Options options;
+	std::string output;
+
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+
+		if (arg.rfind("--worker=", 0) == 0)
+		{
+			options.workerBin = arg.substr(9);
+		}
+		else if (arg.rfind("--sessions=", 0) == 0)
+		{
+			options.sessions = std::strtoull(arg.c_str() + 11, nullptr, 10);
+		}
+		else if (arg.rfind("--consumers=", 0) == 0)
+		{
+			options.consumersPerSession = std::strtoull(arg.c_str() + 12, nullptr, 10);
+		}
+		else if (arg.rfind("--warm-up-ms=", 0) == 0)
+		{
+			options.warmUpMs = std::strtoull(arg.c_str() + 13, nullptr, 10);
+		}
+		else if (arg.rfind("--duration-ms=", 0) == 0)
+		{
+			options.durationMs = std::strtoull(arg.c_str() + 14, nullptr, 10);
+		}
+		else if (arg.rfind("--ip=", 0) == 0)
+		{
+			options.ip = arg.substr(5);
+		}
+		else if (arg.rfind("--output=", 0) == 0)
+		{
+			output = arg.substr(9);
+		}
+		else
+		{
+			printUsage();
+
+			return 1;
+		}
+	}
+
+	// Every session consumes the next K sessions of the ring, so K must be
+	// lower than the number of sessions.
+	if (
+	  options.workerBin.empty() || options.sessions == 0u ||
+	  options.consumersPerSession >= options.sessions ||
+	  options.consumersPerSession > MaxConsumersPerSession || options.durationMs == 0u)
+	{
+		printUsage();
+
+		return 1;
+	}
+
+	// Initialize static stuff.
+	DepLibUV::ClassInit();
+	DepOpenSSL::ClassInit();
+	DepLibSRTP::ClassInit();
+	DepUsrSCTP::ClassInit();
+	DepLibWebRTC::ClassInit();
+	Utils::Crypto::ClassInit();
+	RTC::DtlsTransport::ClassInit();
+	RTC::SrtpSession::ClassInit();
+
+	Loadgen::Stats stats;
+	int status{ 0 };
+
+	try
+	{
+		Loadgen::Generator generator(options, std::addressof(stats));
+
+		generator.Run();
+	}
+	catch (const MediaSoupError& error)
+	{
+		std::cerr << "[loadgen] failed: " << error.what() << std::endl;
+
+		status = 1;
+	}
+
+	if (status == 0)
+	{
+		if (output.empty())
+		{
+			stats.PrintJson(std::cout);
+		}
+		else
+		{
+			std::ofstream file(output);
+
+			stats.PrintJson(file);
+		}
+	}
+
+	// Free static stuff.
+	DepLibSRTP::ClassDestroy();
+	Utils::Crypto::ClassDestroy();
+	DepLibWebRTC::ClassDestroy();
+	RTC::DtlsTransport::ClassDestroy();
+	DepUsrSCTP::ClassDestroy();
+	DepLibUV::ClassDestroy();
+
+	return status;
+}
@@ -16,7 +16,11 @@ async function run()
 			'../test/src/**/*.cpp',
 			'../test/include/helpers.hpp',
 			'../fuzzer/src/**/*.cpp',
-			'../fuzzer/include/**/*.hpp'
+			'../fuzzer/include/**/*.hpp',
+			'../bench/src/**/*.cpp',
+			'../bench/include/**/*.hpp',
+			'../loadgen/src/**/*.cpp',
+			'../loadgen/include/**/*.hpp'
 		]
 	);
 
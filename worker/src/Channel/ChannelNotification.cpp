@@ -34,7 +34,8 @@ namespace Channel
 			MS_THROW_ERROR("unknown event '%" PRIu8 "'", static_cast<uint8_t>(this->event));
 		}
 
-		this->eventCStr = eventCStrIt->second;
-		this->handlerId = this->data->handlerId()->str();
+		this->eventCStr     = eventCStrIt->second;
+		this->handlerId     = this->data->handlerId();
+		this->handlerHandle = this->data->handlerHandle();
 	}
 } // namespace Channel
@@ -20,6 +20,8 @@ namespace Channel
 		{ FBS::Request::Method::WORKER_CREATE_ROUTER,                           "worker.createRouter"                        },
 		{ FBS::Request::Method::WORKER_WEBRTCSERVER_CLOSE,                      "worker.closeWebRtcServer"                   },
 		{ FBS::Request::Method::WORKER_CLOSE_ROUTER,                            "worker.closeRouter"                         },
+		{ FBS::Request::Method::WORKER_BATCH,                                   "worker.batch"                               },
+		{ FBS::Request::Method::WORKER_GET_PROFILE,                             "worker.getProfile"                          },
 		{ FBS::Request::Method::WEBRTCSERVER_DUMP,                              "webRtcServer.dump"                          },
 		{ FBS::Request::Method::ROUTER_DUMP,                                    "router.dump"                                },
 		{ FBS::Request::Method::ROUTER_CREATE_WEBRTCTRANSPORT,                  "router.createWebRtcTransport"               },
@@ -27,6 +29,7 @@ namespace Channel
 		{ FBS::Request::Method::ROUTER_CREATE_PLAINTRANSPORT,                   "router.createPlainTransport"                },
 		{ FBS::Request::Method::ROUTER_CREATE_PIPETRANSPORT,                    "router.createPipeTransport"                 },
 		{ FBS::Request::Method::ROUTER_CREATE_DIRECTTRANSPORT,                  "router.createDirectTransport"               },
+		{ FBS::Request::Method::ROUTER_CREATE_RECORDINGTRANSPORT,               "router.createRecordingTransport"            },
 		{ FBS::Request::Method::ROUTER_CLOSE_TRANSPORT,                         "router.closeTransport"                      },
 		{ FBS::Request::Method::ROUTER_CREATE_ACTIVESPEAKEROBSERVER,            "router.createActiveSpeakerObserver"         },
 		{ FBS::Request::Method::ROUTER_CREATE_AUDIOLEVELOBSERVER,               "router.createAudioLevelObserver"            },
@@ -88,9 +91,12 @@ namespace Channel
 
 	/**
 	 * msg contains the request flatbuffer.
+	 * batchRequest is the enclosing WORKER_BATCH request (if any), which collects
+	 * the response of this request instead of sending it over the channel.
 	 */
-	ChannelRequest::ChannelRequest(Channel::ChannelSocket* channel, const FBS::Request::Request* request)
-	  : channel(channel)
+	ChannelRequest::ChannelRequest(
+	  Channel::ChannelSocket* channel, const FBS::Request::Request* request, ChannelRequest* batchRequest)
+	  : channel(channel), batchRequest(batchRequest)
 	{
 		MS_TRACE();
 
@@ -107,8 +113,9 @@ namespace Channel
 			MS_THROW_ERROR("unknown method '%" PRIu8 "'", static_cast<uint8_t>(this->method));
 		}
 
-		this->methodCStr = methodCStrIt->second;
-		this->handlerId  = this->data->handlerId()->str();
+		this->methodCStr    = methodCStrIt->second;
+		this->handlerId     = this->data->handlerId();
+		this->handlerHandle = this->data->handlerHandle();
 	}
 
 	void ChannelRequest::Accept()
@@ -156,6 +163,19 @@ namespace Channel
 		this->SendResponse(response);
 	}
 
+	void ChannelRequest::AcceptBatch()
+	{
+		MS_TRACE();
+
+		auto& builder  = this->bufferBuilder;
+		auto responses = builder.CreateVector(this->batchResponses);
+		auto body      = FBS::Response::CreateBatchResponse(builder, responses);
+
+		this->batchResponses.clear();
+
+		Accept(FBS::Response::Body::Worker_BatchResponse, body);
+	}
+
 	void ChannelRequest::Send(uint8_t* buffer, size_t size)
 	{
 		this->channel->Send(buffer, size);
@@ -164,6 +184,18 @@ namespace Channel
 	void ChannelRequest::SendResponse(const flatbuffers::Offset<FBS::Response::Response>& response)
 	{
 		auto& builder = this->bufferBuilder;
+
+		// If this is a batched request, hand the finished Response to the batch
+		// request instead of sending it.
+		if (this->batchRequest)
+		{
+			builder.Finish(response);
+			this->batchRequest->AddBatchResponse(builder.GetBufferPointer(), builder.GetSize());
+			builder.Reset();
+
+			return;
+		}
+
 		auto message =
 		  FBS::Message::CreateMessage(builder, FBS::Message::Body::Response, response.Union());
 
@@ -171,4 +203,16 @@ namespace Channel
 		this->Send(builder.GetBufferPointer(), builder.GetSize());
 		builder.Reset();
 	}
+
+	void ChannelRequest::AddBatchResponse(const uint8_t* data, size_t len)
+	{
+		auto& builder = this->bufferBuilder;
+
+		// Nested flatbuffers must be aligned to their largest scalar.
+		builder.ForceVectorAlignment(len, sizeof(uint8_t), sizeof(uint64_t));
+
+		auto item = FBS::Response::CreateBatchResponseItem(builder, builder.CreateVector(data, len));
+
+		this->batchResponses.push_back(item);
+	}
 } // namespace Channel
@@ -5,6 +5,15 @@
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
 
+/* Static. */
+
+// A handle is made of a slot index (lower bits) and the slot generation
+// (upper bits) so stale handles of closed entities are never resolved to a
+// newer entity reusing the same slot.
+static constexpr uint32_t HandleIndexBits{ 20u };
+static constexpr uint32_t HandleIndexMask{ (1u << HandleIndexBits) - 1 };
+static constexpr uint32_t HandleGenerationMask{ (1u << (32u - HandleIndexBits)) - 1 };
+
 ChannelMessageRegistrator::ChannelMessageRegistrator()
 {
 	MS_TRACE();
@@ -16,6 +25,9 @@ ChannelMessageRegistrator::~ChannelMessageRegistrator()
 
 	this->mapChannelRequestHandlers.clear();
 	this->mapChannelNotificationHandlers.clear();
+	this->mapHandles.clear();
+	this->slots.clear();
+	this->freeSlots.clear();
 }
 
 flatbuffers::Offset<FBS::Worker::ChannelMessageHandlers> ChannelMessageRegistrator::FillBuffer(
@@ -43,37 +55,53 @@ flatbuffers::Offset<FBS::Worker::ChannelMessageHandlers> ChannelMessageRegistrat
 	  builder, &channelRequestHandlerIds, &channelNotificationHandlerIds);
 }
 
-void ChannelMessageRegistrator::RegisterHandler(
+uint32_t ChannelMessageRegistrator::RegisterHandler(
   const std::string& id,
   Channel::ChannelSocket::RequestHandler* channelRequestHandler,
   Channel::ChannelSocket::NotificationHandler* channelNotificationHandler)
 {
 	MS_TRACE();
 
-	if (channelRequestHandler != nullptr)
+	if (
+	  channelRequestHandler != nullptr &&
+	  this->mapChannelRequestHandlers.find(id) != this->mapChannelRequestHandlers.end())
 	{
-		if (this->mapChannelRequestHandlers.find(id) != this->mapChannelRequestHandlers.end())
-		{
-			MS_THROW_ERROR("Channel request handler with ID %s already exists", id.c_str());
-		}
+		MS_THROW_ERROR("Channel request handler with ID %s already exists", id.c_str());
+	}
 
-		this->mapChannelRequestHandlers[id] = channelRequestHandler;
+	if (
+	  channelNotificationHandler != nullptr &&
+	  this->mapChannelNotificationHandlers.find(id) != this->mapChannelNotificationHandlers.end())
+	{
+		MS_THROW_ERROR("Channel notification handler with ID %s already exists", id.c_str());
 	}
 
-	if (channelNotificationHandler != nullptr)
+	if (this->mapHandles.find(id) != this->mapHandles.end())
 	{
-		if (this->mapChannelNotificationHandlers.find(id) != this->mapChannelNotificationHandlers.end())
-		{
-			if (channelRequestHandler != nullptr)
-			{
-				this->mapChannelRequestHandlers.erase(id);
-			}
+		MS_THROW_ERROR("Channel handler with ID %s already exists", id.c_str());
+	}
 
-			MS_THROW_ERROR("Channel notification handler with ID %s already exists", id.c_str());
-		}
+	// Allocate the handle first since it may throw, so nothing must be undone.
+	const uint32_t handle = AllocateHandle();
+	auto* slot            = GetSlot(handle);
 
+	slot->id                         = id;
+	slot->channelRequestHandler      = channelRequestHandler;
+	slot->channelNotificationHandler = channelNotificationHandler;
+
+	if (channelRequestHandler != nullptr)
+	{
+		this->mapChannelRequestHandlers[id] = channelRequestHandler;
+	}
+
+	if (channelNotificationHandler != nullptr)
+	{
 		this->mapChannelNotificationHandlers[id] = channelNotificationHandler;
 	}
+
+	this->mapHandles[id] = handle;
+
+	return handle;
 }
 
 void ChannelMessageRegistrator::UnregisterHandler(const std::string& id)
@@ -82,6 +110,31 @@ void ChannelMessageRegistrator::UnregisterHandler(const std::string& id)
 
 	this->mapChannelRequestHandlers.erase(id);
 	this->mapChannelNotificationHandlers.erase(id);
+
+	auto it = this->mapHandles.find(id);
+
+	if (it != this->mapHandles.end())
+	{
+		ReleaseHandle(it->second);
+
+		this->mapHandles.erase(it);
+	}
+}
+
+uint32_t ChannelMessageRegistrator::GetHandle(const std::string& id) const
+{
+	MS_TRACE();
+
+	auto it = this->mapHandles.find(id);
+
+	if (it != this->mapHandles.end())
+	{
+		return it->second;
+	}
+	else
+	{
+		return NoHandle;
+	}
 }
 
 Channel::ChannelSocket::RequestHandler* ChannelMessageRegistrator::GetChannelRequestHandler(
@@ -101,6 +154,23 @@ Channel::ChannelSocket::RequestHandler* ChannelMessageRegistrator::GetChannelReq
 	}
 }
 
+Channel::ChannelSocket::RequestHandler* ChannelMessageRegistrator::GetChannelRequestHandler(
+  uint32_t handle, std::string_view id)
+{
+	MS_TRACE();
+
+	auto* slot = GetSlot(handle, id);
+
+	if (slot)
+	{
+		return slot->channelRequestHandler;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
 Channel::ChannelSocket::NotificationHandler* ChannelMessageRegistrator::GetChannelNotificationHandler(
   const std::string& id)
 {
@@ -117,3 +187,107 @@ Channel::ChannelSocket::NotificationHandler* ChannelMessageRegistrator::GetChann
 		return nullptr;
 	}
 }
+
+Channel::ChannelSocket::NotificationHandler* ChannelMessageRegistrator::GetChannelNotificationHandler(
+  uint32_t handle, std::string_view id)
+{
+	MS_TRACE();
+
+	auto* slot = GetSlot(handle, id);
+
+	if (slot)
+	{
+		return slot->channelNotificationHandler;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+uint32_t ChannelMessageRegistrator::AllocateHandle()
+{
+	MS_TRACE();
+
+	uint32_t index;
+
+	if (!this->freeSlots.empty())
+	{
+		index = this->freeSlots.back();
+
+		this->freeSlots.pop_back();
+	}
+	else
+	{
+		if (this->slots.size() > HandleIndexMask)
+		{
+			MS_THROW_ERROR("no more channel handles available");
+		}
+
+		index = static_cast<uint32_t>(this->slots.size());
+
+		this->slots.emplace_back();
+	}
+
+	auto& slot = this->slots[index];
+
+	slot.used = true;
+
+	return (static_cast<uint32_t>(slot.generation) << HandleIndexBits) | index;
+}
+
+void ChannelMessageRegistrator::ReleaseHandle(uint32_t handle)
+{
+	MS_TRACE();
+
+	auto* slot = GetSlot(handle);
+
+	if (!slot)
+	{
+		return;
+	}
+
+	slot->id.clear();
+	slot->channelRequestHandler      = nullptr;
+	slot->channelNotificationHandler = nullptr;
+	slot->used                       = false;
+	// Generation 0 is never used so a handle is never NoHandle.
+	slot->generation = static_cast<uint16_t>((slot->generation % HandleGenerationMask) + 1);
+
+	this->freeSlots.push_back(handle & HandleIndexMask);
+}
+
+ChannelMessageRegistrator::HandlerSlot* ChannelMessageRegistrator::GetSlot(uint32_t handle)
+{
+	const uint32_t index      = handle & HandleIndexMask;
+	const uint32_t generation = handle >> HandleIndexBits;
+
+	if (index >= this->slots.size())
+	{
+		return nullptr;
+	}
+
+	auto& slot = this->slots[index];
+
+	if (!slot.used || slot.generation != generation)
+	{
+		return nullptr;
+	}
+
+	return std::addressof(slot);
+}
+
+ChannelMessageRegistrator::HandlerSlot* ChannelMessageRegistrator::GetSlot(
+  uint32_t handle, std::string_view id)
+{
+	auto* slot = GetSlot(handle);
+
+	// The handle must belong to the addressed entity. A mismatch means a buggy
+	// or stale handle, so let the caller fall back to the id lookup.
+	if (!slot || slot->id != id)
+	{
+		return nullptr;
+	}
+
+	return slot;
+}
@@ -350,6 +350,14 @@ bool DepLibUring::LibUring::PrepareSend(
 {
 	MS_TRACE();
 
+	// The datagram does not fit into our send buffers.
+	if (len > DepLibUring::SendBufferSize)
+	{
+		MS_DEBUG_DEV("data too big for send buffers");
+
+		return false;
+	}
+
 	auto* userData = this->GetUserData();
 
 	if (!userData)
@@ -409,6 +417,14 @@ bool DepLibUring::LibUring::PrepareWrite(
 {
 	MS_TRACE();
 
+	// The payload does not fit into our send buffers.
+	if (len2 > DepLibUring::SendBufferSize)
+	{
+		MS_DEBUG_DEV("data too big for send buffers");
+
+		return false;
+	}
+
 	auto* userData = this->GetUserData();
 
 	if (!userData)
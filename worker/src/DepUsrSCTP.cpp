@@ -8,12 +8,12 @@
 #include "DepLibUV.hpp"
 #include "Logger.hpp"
 #include <usrsctp.h>
-#include <cstdio> // std::vsnprintf()
+#include <algorithm> // std::min(), std::max()
+#include <cstdio>    // std::vsnprintf()
 #include <mutex>
 
 /* Static. */
 
-static constexpr size_t CheckerInterval{ 10u }; // In ms.
 static std::mutex GlobalSyncMutex;
 static size_t GlobalInstances{ 0u };
 
@@ -32,6 +32,9 @@ inline static int onSendSctpData(void* addr, void* data, size_t len, uint8_t /*t
 
 	sctpAssociation->OnUsrSctpSendSctpData(data, len);
 
+	// Sent data may need to be retransmitted.
+	DepUsrSCTP::OnSctpActivity();
+
 	// NOTE: Must not free data, usrsctp lib does it.
 
 	return 0;
@@ -57,7 +60,6 @@ inline static void sctpDebug(const char* format, ...)
 /* Static variables. */
 
 thread_local DepUsrSCTP::Checker* DepUsrSCTP::checker{ nullptr };
-uint64_t DepUsrSCTP::numSctpAssociations{ 0u };
 uintptr_t DepUsrSCTP::nextSctpAssociationId{ 0u };
 absl::flat_hash_map<uintptr_t, RTC::SctpAssociation*> DepUsrSCTP::mapIdSctpAssociation;
 
@@ -97,7 +99,6 @@ void DepUsrSCTP::ClassDestroy()
 	{
 		usrsctp_finish();
 
-		numSctpAssociations   = 0u;
 		nextSctpAssociationId = 0u;
 
 		DepUsrSCTP::mapIdSctpAssociation.clear();
@@ -120,6 +121,7 @@ void DepUsrSCTP::CloseChecker()
 	MS_ASSERT(DepUsrSCTP::checker != nullptr, "Checker not created");
 
 	delete DepUsrSCTP::checker;
+	DepUsrSCTP::checker = nullptr;
 }
 
 uintptr_t DepUsrSCTP::GetNextSctpAssociationId()
@@ -166,10 +168,7 @@ void DepUsrSCTP::RegisterSctpAssociation(RTC::SctpAssociation* sctpAssociation)
 
 	DepUsrSCTP::mapIdSctpAssociation[sctpAssociation->id] = sctpAssociation;
 
-	if (++DepUsrSCTP::numSctpAssociations == 1u)
-	{
-		DepUsrSCTP::checker->Start();
-	}
+	DepUsrSCTP::checker->AddSctpAssociation(sctpAssociation);
 }
 
 void DepUsrSCTP::DeregisterSctpAssociation(RTC::SctpAssociation* sctpAssociation)
@@ -183,12 +182,8 @@ void DepUsrSCTP::DeregisterSctpAssociation(RTC::SctpAssociation* sctpAssociation
 	auto found = DepUsrSCTP::mapIdSctpAssociation.erase(sctpAssociation->id);
 
 	MS_ASSERT(found > 0, "SctpAssociation not found");
-	MS_ASSERT(DepUsrSCTP::numSctpAssociations > 0u, "numSctpAssociations was not higher than 0");
 
-	if (--DepUsrSCTP::numSctpAssociations == 0u)
-	{
-		DepUsrSCTP::checker->Stop();
-	}
+	DepUsrSCTP::checker->RemoveSctpAssociation(sctpAssociation);
 }
 
 RTC::SctpAssociation* DepUsrSCTP::RetrieveSctpAssociation(uintptr_t id)
@@ -207,6 +202,53 @@ RTC::SctpAssociation* DepUsrSCTP::RetrieveSctpAssociation(uintptr_t id)
 	return it->second;
 }
 
+void DepUsrSCTP::OnSctpActivity()
+{
+	MS_TRACE();
+
+	if (DepUsrSCTP::checker)
+	{
+		DepUsrSCTP::checker->Kick();
+	}
+}
+
+/**
+ * Returns the interval of the next Checker timer (or 0 to stop it) given the
+ * current one, whether there was SCTP activity since the last check and for
+ * how long there has been none.
+ *
+ * The Checker is just stopped once idle if no SctpAssociation is connecting
+ * or connected. Otherwise it keeps ticking with the max interval so usrsctp
+ * timers without activity (HEARTBEAT, T3-rtx) fire at most CheckerMaxInterval
+ * late, which is way below the min RTO (1 second).
+ */
+uint64_t DepUsrSCTP::GetCheckerInterval(
+  uint64_t interval, bool activity, uint64_t idleMs, bool hasActiveSctpAssociations)
+{
+	MS_TRACE();
+
+	if (activity)
+	{
+		return CheckerMinInterval;
+	}
+	else if (idleMs >= CheckerIdleTimeout && !hasActiveSctpAssociations)
+	{
+		return 0u;
+	}
+
+	return std::min(std::max(interval * 2, CheckerMinInterval), CheckerMaxInterval);
+}
+
+flatbuffers::Offset<FBS::Worker::UsrSctpDump> DepUsrSCTP::FillBuffer(
+  flatbuffers::FlatBufferBuilder& builder)
+{
+	MS_TRACE();
+
+	MS_ASSERT(DepUsrSCTP::checker != nullptr, "Checker not created");
+
+	return DepUsrSCTP::checker->FillBuffer(builder);
+}
+
 /* DepUsrSCTP::Checker instance methods. */
 
 DepUsrSCTP::Checker::Checker()
@@ -227,24 +269,79 @@ void DepUsrSCTP::Checker::Start()
 {
 	MS_TRACE();
 
-	MS_DEBUG_TAG(sctp, "usrsctp periodic check started");
+	MS_DEBUG_TAG(sctp, "usrsctp check started");
 
-	this->lastCalledAtMs = 0u;
+	this->lastCalledAtMs   = 0u;
+	this->lastActivityAtMs = DepLibUV::GetTimeMs();
+	this->interval         = CheckerMinInterval;
+	this->activity         = false;
 
-	this->timer->Start(CheckerInterval, CheckerInterval);
+	this->timer->Start(this->interval);
 }
 
 void DepUsrSCTP::Checker::Stop()
 {
 	MS_TRACE();
 
-	MS_DEBUG_TAG(sctp, "usrsctp periodic check stopped");
+	MS_DEBUG_TAG(sctp, "usrsctp check stopped");
 
 	this->lastCalledAtMs = 0u;
 
 	this->timer->Stop();
 }
 
+void DepUsrSCTP::Checker::Kick()
+{
+	MS_TRACE();
+
+	this->activity = true;
+
+	// Already checking with the shortest interval. Do not restart the timer
+	// here, otherwise continuous activity would postpone it forever.
+	if (this->timer->IsActive() && this->interval == CheckerMinInterval)
+	{
+		return;
+	}
+
+	this->interval = CheckerMinInterval;
+
+	this->timer->Start(this->interval);
+}
+
+void DepUsrSCTP::Checker::AddSctpAssociation(RTC::SctpAssociation* sctpAssociation)
+{
+	MS_TRACE();
+
+	this->sctpAssociations.insert(sctpAssociation);
+
+	if (this->sctpAssociations.size() == 1u)
+	{
+		Start();
+	}
+}
+
+void DepUsrSCTP::Checker::RemoveSctpAssociation(RTC::SctpAssociation* sctpAssociation)
+{
+	MS_TRACE();
+
+	auto found = this->sctpAssociations.erase(sctpAssociation);
+
+	MS_ASSERT(found > 0, "SctpAssociation not owned by this thread");
+
+	if (this->sctpAssociations.empty())
+	{
+		Stop();
+	}
+}
+
+flatbuffers::Offset<FBS::Worker::UsrSctpDump> DepUsrSCTP::Checker::FillBuffer(
+  flatbuffers::FlatBufferBuilder& builder) const
+{
+	MS_TRACE();
+
+	return FBS::Worker::CreateUsrSctpDump(builder, this->wakeupCount, this->idleCount);
+}
+
 void DepUsrSCTP::Checker::OnTimer(TimerHandle* /*timer*/)
 {
 	MS_TRACE();
@@ -252,6 +349,14 @@ void DepUsrSCTP::Checker::OnTimer(TimerHandle* /*timer*/)
 	auto nowMs          = DepLibUV::GetTimeMs();
 	const int elapsedMs = this->lastCalledAtMs ? static_cast<int>(nowMs - this->lastCalledAtMs) : 0;
 
+	++this->wakeupCount;
+
+	if (this->activity)
+	{
+		this->lastActivityAtMs = nowMs;
+		this->activity         = false;
+	}
+
 #ifdef MS_LIBURING_SUPPORTED
 	// Activate liburing usage.
 	// 'usrsctp_handle_timers()' will synchronously call the send/recv
@@ -269,4 +374,54 @@ void DepUsrSCTP::Checker::OnTimer(TimerHandle* /*timer*/)
 #endif
 
 	this->lastCalledAtMs = nowMs;
+
+	// Expired timers sent something (retransmissions, SACKs...).
+	const bool activity = this->activity;
+
+	if (activity)
+	{
+		this->lastActivityAtMs = nowMs;
+		this->activity         = false;
+	}
+
+	this->interval = DepUsrSCTP::GetCheckerInterval(
+	  this->interval, activity, nowMs - this->lastActivityAtMs, HasActiveSctpAssociations());
+
+	if (this->interval == 0u)
+	{
+		MS_DEBUG_DEV("no active SctpAssociation, usrsctp check idle");
+
+		++this->idleCount;
+
+		this->timer->Stop();
+
+		return;
+	}
+
+	this->timer->Start(this->interval);
+}
+
+/**
+ * Whether usrsctp has timers running (handshake, HEARTBEAT, T3-rtx...) for
+ * some SctpAssociation. Only checks the SctpAssociations of this thread, so
+ * other workers in the same process are not touched without their own
+ * synchronization.
+ */
+bool DepUsrSCTP::Checker::HasActiveSctpAssociations() const
+{
+	MS_TRACE();
+
+	for (const auto* sctpAssociation : this->sctpAssociations)
+	{
+		const auto state = sctpAssociation->GetState();
+
+		if (
+		  state == RTC::SctpAssociation::SctpState::CONNECTING ||
+		  state == RTC::SctpAssociation::SctpState::CONNECTED)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
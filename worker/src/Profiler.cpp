@@ -0,0 +1,205 @@
+#define MS_CLASS "Profiler"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "Profiler.hpp"
+#include "Logger.hpp"
+#include "Utils.hpp"
+#include <algorithm> // std::min(), std::max()
+#include <cmath>     // std::ceil()
+#include <vector>
+
+/* Class variables. */
+
+thread_local Profiler::Data* Profiler::data{ nullptr };
+
+/* Class methods. */
+
+void Profiler::ClassInit()
+{
+	MS_TRACE();
+
+#ifdef MS_PROFILING
+	Profiler::data = new Data();
+
+	MS_DEBUG_TAG(info, "stage profiling enabled [sampleInterval:%" PRIu32 "]", SampleInterval);
+#endif
+}
+
+void Profiler::ClassDestroy()
+{
+	MS_TRACE();
+
+	delete Profiler::data;
+	Profiler::data = nullptr;
+}
+
+const char* Profiler::GetStageName(Stage stage)
+{
+	MS_TRACE();
+
+	switch (stage)
+	{
+		case Stage::UDP_RECV:
+			return "udpRecv";
+		case Stage::SRTP_DECRYPT:
+			return "srtpDecrypt";
+		case Stage::RTP_PARSE:
+			return "rtpParse";
+		case Stage::PRODUCER_RECEIVE:
+			return "producerReceive";
+		case Stage::ROUTER_FAN_OUT:
+			return "routerFanOut";
+		case Stage::CONSUMER_SEND:
+			return "consumerSend";
+		case Stage::SRTP_ENCRYPT:
+			return "srtpEncrypt";
+		case Stage::UDP_SEND:
+			return "udpSend";
+		default:
+			return "unknown";
+	}
+}
+
+void Profiler::Reset()
+{
+	MS_TRACE();
+
+	if (!Profiler::data)
+	{
+		return;
+	}
+
+	Profiler::data->calls.fill(0u);
+
+	for (auto& histogram : Profiler::data->histograms)
+	{
+		histogram.Reset();
+	}
+}
+
+flatbuffers::Offset<FBS::Worker::ProfileResponse> Profiler::FillBuffer(
+  flatbuffers::FlatBufferBuilder& builder)
+{
+	MS_TRACE();
+
+	std::vector<flatbuffers::Offset<FBS::Worker::ProfileStage>> stages;
+
+	if (Profiler::data)
+	{
+		stages.reserve(static_cast<size_t>(Stage::MAX));
+
+		for (size_t idx{ 0u }; idx < static_cast<size_t>(Stage::MAX); ++idx)
+		{
+			const auto& histogram = Profiler::data->histograms[idx];
+
+			stages.emplace_back(FBS::Worker::CreateProfileStageDirect(
+			  builder,
+			  GetStageName(static_cast<Stage>(idx)),
+			  Profiler::data->calls[idx],
+			  histogram.GetCount(),
+			  histogram.GetMin(),
+			  histogram.GetMax(),
+			  histogram.GetMean(),
+			  histogram.GetValueAtPercentile(0.50),
+			  histogram.GetValueAtPercentile(0.90),
+			  histogram.GetValueAtPercentile(0.99),
+			  histogram.GetValueAtPercentile(0.999)));
+		}
+	}
+
+	return FBS::Worker::CreateProfileResponseDirect(
+	  builder, Profiler::data != nullptr, SampleInterval, std::addressof(stages));
+}
+
+/* Class methods of Histogram. */
+
+size_t Profiler::Histogram::GetBucketIndex(uint64_t value)
+{
+	value = std::min(value, MaxValue);
+
+	// Values in the first range map to themselves.
+	if (value < SubBucketCount)
+	{
+		return static_cast<size_t>(value);
+	}
+
+	const size_t msb   = 63u - Utils::Bits::CountLeadingZeros(value);
+	const size_t shift = msb - (SubBucketBits - 1u);
+
+	// value >> shift is in [SubBucketHalfCount, SubBucketCount).
+	return (shift * SubBucketHalfCount) + static_cast<size_t>(value >> shift);
+}
+
+uint64_t Profiler::Histogram::GetBucketLowerBound(size_t idx)
+{
+	if (idx < SubBucketCount)
+	{
+		return idx;
+	}
+
+	const size_t shift    = (idx / SubBucketHalfCount) - 1u;
+	const size_t mantissa = idx - (shift * SubBucketHalfCount);
+
+	return uint64_t{ mantissa } << shift;
+}
+
+uint64_t Profiler::Histogram::GetBucketUpperBound(size_t idx)
+{
+	if (idx < SubBucketCount)
+	{
+		return idx;
+	}
+
+	const size_t shift    = (idx / SubBucketHalfCount) - 1u;
+	const size_t mantissa = idx - (shift * SubBucketHalfCount);
+
+	return (uint64_t{ mantissa + 1u } << shift) - 1u;
+}
+
+/* Instance methods of Histogram. */
+
+void Profiler::Histogram::Record(uint64_t value)
+{
+	++this->buckets[GetBucketIndex(value)];
+	++this->count;
+
+	this->sum += value;
+	this->min = std::min(this->min, value);
+	this->max = std::max(this->max, value);
+}
+
+void Profiler::Histogram::Reset()
+{
+	this->buckets.fill(0u);
+
+	this->count = 0u;
+	this->sum   = 0u;
+	this->min   = MaxValue;
+	this->max   = 0u;
+}
+
+uint64_t Profiler::Histogram::GetValueAtPercentile(double percentile) const
+{
+	if (this->count == 0u)
+	{
+		return 0u;
+	}
+
+	const auto rank   = std::ceil(percentile * static_cast<double>(this->count));
+	const auto target = std::max(uint64_t{ 1u }, static_cast<uint64_t>(rank));
+	uint64_t accumulated{ 0u };
+
+	for (size_t idx{ 0u }; idx < NumBuckets; ++idx)
+	{
+		accumulated += this->buckets[idx];
+
+		if (accumulated >= target)
+		{
+			// Report the highest value equivalent to the bucket, but never above
+			// the maximum recorded value.
+			return std::min(GetBucketUpperBound(idx), this->max);
+		}
+	}
+
+	return this->max;
+}
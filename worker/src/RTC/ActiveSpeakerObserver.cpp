@@ -25,11 +25,22 @@ namespace RTC
 	static constexpr uint32_t MinLevelWindowLen{ 15 * 1000 / 20 };
 	static constexpr uint32_t MediumThreshold{ 7u };
 	static constexpr uint32_t SubunitLengthN1{ (MaxLevel - MinLevel + N1 - 1) / N1 };
-	static constexpr uint32_t ImmediateBuffLen{ LongCount * N3 * N2 };
-	static constexpr uint32_t MediumsBuffLen{ LongCount * N3 };
-	static constexpr uint32_t LongsBuffLen{ LongCount };
-	static constexpr uint32_t LevelsBuffLen{ LongCount * N3 * N2 };
 	static constexpr double MinActivityScore{ 0.0000000001 };
+	// Max number of active subunits in an immediate, medium and long interval.
+	static constexpr uint32_t MaxImmediateActivity{ MaxLevel / SubunitLengthN1 };
+	static constexpr uint32_t MaxMediumActivity{ N2 };
+	static constexpr uint32_t MaxLongActivity{ N3 };
+	static constexpr size_t ActivityTableLen{
+		std::max({ MaxImmediateActivity, MaxMediumActivity, MaxLongActivity }) + 1
+	};
+
+	static_assert(ActiveSpeakerObserver::ImmediatesBuffLen == LongCount * N3 * N2, "wrong length");
+	static_assert(ActiveSpeakerObserver::MediumsBuffLen == LongCount * N3, "wrong length");
+	static_assert(ActiveSpeakerObserver::LongsBuffLen == LongCount, "wrong length");
+	static_assert(ActiveSpeakerObserver::LevelsBuffLen == LongCount * N3 * N2, "wrong length");
+	static_assert(
+	  ActiveSpeakerObserver::ImmediatesBuffLen == ActiveSpeakerObserver::LevelsBuffLen,
+	  "immediates must cover all levels");
 
 	inline int64_t BinomialCoefficient(int32_t n, int32_t r)
 	{
@@ -64,15 +75,54 @@ namespace RTC
 		return activityScore;
 	}
 
+	// Activity scores (and the log ratio between any two of them) for every
+	// possible number of active subunits of each interval, computed once so
+	// evaluating speakers does not involve any log() call.
+	struct ActivityScoreTables
+	{
+		ActivityScoreTables()
+		{
+			const std::array<uint32_t, 3> maxActivities{
+				MaxImmediateActivity, MaxMediumActivity, MaxLongActivity
+			};
+			const std::array<uint32_t, 3> nRs{ N1, N2, N3 };
+			const std::array<double, 3> lambdas{ 0.78, 24, 47 };
+
+			for (size_t interval{ 0u }; interval < 3; ++interval)
+			{
+				for (uint32_t vL{ 0u }; vL <= maxActivities[interval]; ++vL)
+				{
+					this->scores[interval][vL] =
+					  ComputeActivityScore(vL, nRs[interval], 0.5, lambdas[interval]);
+				}
+
+				for (uint32_t vL{ 0u }; vL <= maxActivities[interval]; ++vL)
+				{
+					for (uint32_t otherVL{ 0u }; otherVL <= maxActivities[interval]; ++otherVL)
+					{
+						this->relativeScores[interval][vL][otherVL] =
+						  std::log(this->scores[interval][vL] / this->scores[interval][otherVL]);
+					}
+				}
+			}
+		}
+
+		double scores[3][ActivityTableLen]{};
+		double relativeScores[3][ActivityTableLen][ActivityTableLen]{};
+	};
+
+	static const ActivityScoreTables ActivityScores;
+
+	template<size_t LittleLen, size_t BigLen>
 	inline bool ComputeBigs(
-	  const std::vector<uint8_t>& littles, std::vector<uint8_t>& bigs, uint8_t threashold)
+	  const std::array<uint8_t, LittleLen>& littles,
+	  std::array<uint8_t, BigLen>& bigs,
+	  uint8_t threashold)
 	{
-		uint32_t littleLen             = littles.size();
-		uint32_t bigLen                = bigs.size();
-		const uint32_t littleLenPerBig = littleLen / bigLen;
+		constexpr uint32_t littleLenPerBig = LittleLen / BigLen;
 		bool changed{ false };
 
-		for (uint32_t b = 0u, l = 0u; b < bigLen; ++b)
+		for (uint32_t b = 0u, l = 0u; b < BigLen; ++b)
 		{
 			uint8_t sum{ 0u };
 
@@ -348,8 +398,8 @@ namespace RTC
 				for (uint8_t interval = 0u; interval < ActiveSpeakerObserver::RelativeSpeachActivitiesLen;
 				     ++interval)
 				{
-					this->relativeSpeachActivities[interval] = std::log(
-					  speaker->GetActivityScore(interval) / dominantSpeaker->GetActivityScore(interval));
+					this->relativeSpeachActivities[interval] =
+					  speaker->GetRelativeActivityScore(interval, dominantSpeaker);
 				}
 
 				double c1 = this->relativeSpeachActivities[0];
@@ -413,10 +463,7 @@ namespace RTC
 	}
 
 	ActiveSpeakerObserver::Speaker::Speaker()
-	  : immediateActivityScore(MinActivityScore), mediumActivityScore(MinActivityScore),
-	    longActivityScore(MinActivityScore), lastLevelChangeTime(DepLibUV::GetTimeMs()),
-	    minLevel(MinLevel), nextMinLevel(MinLevel), immediates(ImmediateBuffLen, 0),
-	    mediums(MediumsBuffLen, 0), longs(LongsBuffLen, 0), levels(LevelsBuffLen, 0), nextLevelIndex(0)
+	  : lastLevelChangeTime(DepLibUV::GetTimeMs()), minLevel(MinLevel), nextMinLevel(MinLevel)
 	{
 		MS_TRACE();
 	}
@@ -427,37 +474,38 @@ namespace RTC
 
 		if (ComputeImmediates())
 		{
-			EvalImmediateActivityScore();
+			this->activities[0] = this->immediates[0];
 
 			if (ComputeMediums())
 			{
-				EvalMediumActivityScore();
+				this->activities[1] = this->mediums[0];
 
 				if (ComputeLongs())
 				{
-					EvalLongActivityScore();
+					this->activities[2] = this->longs[0];
 				}
 			}
 		}
 	}
 
-	double ActiveSpeakerObserver::Speaker::GetActivityScore(uint8_t interval)
+	double ActiveSpeakerObserver::Speaker::GetActivityScore(uint8_t interval) const
 	{
 		MS_TRACE();
 
-		switch (interval)
-		{
-			case 0u:
-				return this->immediateActivityScore;
-			case 1u:
-				return this->mediumActivityScore;
-			case 2u:
-				return this->longActivityScore;
-			default:
-				MS_ABORT("interval is invalid");
-		}
+		MS_ASSERT(interval < RelativeSpeachActivitiesLen, "interval is invalid");
+
+		return ActivityScores.scores[interval][this->activities[interval]];
+	}
+
+	double ActiveSpeakerObserver::Speaker::GetRelativeActivityScore(
+	  uint8_t interval, const Speaker* other) const
+	{
+		MS_TRACE();
+
+		MS_ASSERT(interval < RelativeSpeachActivitiesLen, "interval is invalid");
 
-		return 0;
+		return ActivityScores
+		  .relativeScores[interval][this->activities[interval]][other->activities[interval]];
 	}
 
 	void ActiveSpeakerObserver::Speaker::LevelChanged(uint32_t level, uint64_t now)
@@ -486,8 +534,8 @@ namespace RTC
 			// The algorithm expect to have an update every 20 milliseconds. If the
 			// Producer is paused, using a different packetization time or using DTX
 			// we need to update more than one sample when receiving an audio packet.
-			uint32_t intervalsUpdated =
-			  std::min(std::max(static_cast<uint32_t>(elapsed / 20), 1U), LevelsBuffLen);
+			uint32_t intervalsUpdated = std::min(
+			  std::max(static_cast<uint32_t>(elapsed / 20), 1U), static_cast<uint32_t>(LevelsBuffLen));
 
 			for (uint32_t i{ 0u }; i < intervalsUpdated; ++i)
 			{
@@ -511,33 +559,33 @@ namespace RTC
 		MS_TRACE();
 
 		const int8_t minLevel = this->minLevel + SubunitLengthN1;
-		bool changed          = false;
+		std::array<uint8_t, LevelsBuffLen> subunits;
+		std::array<uint8_t, ImmediatesBuffLen> immediates;
 
-		for (uint32_t i = 0; i < ImmediateBuffLen; ++i)
+		// Branchless loop over contiguous memory, which the compiler vectorizes.
+		for (size_t i = 0; i < LevelsBuffLen; ++i)
 		{
-			// this->levels is a circular buffer where new samples are written in the
-			// next vector index. this->immediates is a buffer where the most recent
-			// value is always in index 0.
-			const size_t levelIndex = this->nextLevelIndex >= (i + 1)
-			                            ? this->nextLevelIndex - i - 1
-			                            : this->nextLevelIndex + LevelsBuffLen - i - 1;
-			uint8_t level           = this->levels[levelIndex];
-
-			if (level < minLevel)
-			{
-				level = MinLevel;
-			}
+			const uint8_t level = this->levels[i] < minLevel ? MinLevel : this->levels[i];
 
-			const uint8_t immediate = (level / SubunitLengthN1);
+			subunits[i] = level / SubunitLengthN1;
+		}
 
-			if (this->immediates[i] != immediate)
-			{
-				this->immediates[i] = immediate;
-				changed             = true;
-			}
+		// this->levels is a circular buffer where new samples are written in the
+		// next vector index. this->immediates is a buffer where the most recent
+		// value is always in index 0.
+		auto it = std::reverse_copy(
+		  subunits.begin(), subunits.begin() + this->nextLevelIndex, immediates.begin());
+
+		std::reverse_copy(subunits.begin() + this->nextLevelIndex, subunits.end(), it);
+
+		if (immediates == this->immediates)
+		{
+			return false;
 		}
 
-		return changed;
+		this->immediates = immediates;
+
+		return true;
 	}
 
 	bool ActiveSpeakerObserver::Speaker::ComputeMediums()
@@ -554,27 +602,6 @@ namespace RTC
 		return ComputeBigs(this->mediums, this->longs, LongThreashold);
 	}
 
-	void ActiveSpeakerObserver::Speaker::EvalImmediateActivityScore()
-	{
-		MS_TRACE();
-
-		this->immediateActivityScore = ComputeActivityScore(this->immediates[0], N1, 0.5, 0.78);
-	}
-
-	void ActiveSpeakerObserver::Speaker::EvalMediumActivityScore()
-	{
-		MS_TRACE();
-
-		this->mediumActivityScore = ComputeActivityScore(this->mediums[0], N2, 0.5, 24);
-	}
-
-	void ActiveSpeakerObserver::Speaker::EvalLongActivityScore()
-	{
-		MS_TRACE();
-
-		this->longActivityScore = ComputeActivityScore(this->longs[0], N3, 0.5, 47);
-	}
-
 	void ActiveSpeakerObserver::Speaker::UpdateMinLevel(int8_t level)
 	{
 		MS_TRACE();
@@ -6,8 +6,11 @@
 #include "MediaSoupErrors.hpp"
 #include "Utils.hpp"
 #include "RTC/RtpDictionaries.hpp"
-#include <cmath> // std::lround()
+#include <algorithm> // std::sort()
+#include <cmath>     // std::lround()
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace RTC
 {
@@ -25,6 +28,7 @@ namespace RTC
 		this->maxEntries = options->maxEntries();
 		this->threshold  = options->threshold();
 		this->interval   = options->interval();
+		this->lastN      = options->lastN();
 
 		if (this->threshold > 0)
 		{
@@ -71,6 +75,8 @@ namespace RTC
 
 		// Insert into the map.
 		this->mapProducerDBovs[producer];
+
+		AddForwardedProducer(producer);
 	}
 
 	void AudioLevelObserver::RemoveProducer(RTC::Producer* producer)
@@ -79,6 +85,8 @@ namespace RTC
 
 		// Remove from the map.
 		this->mapProducerDBovs.erase(producer);
+
+		this->forwardedProducers.erase(producer);
 	}
 
 	void AudioLevelObserver::ReceiveRtpPacket(RTC::Producer* producer, RTC::RtpPacket* packet)
@@ -108,12 +116,28 @@ namespace RTC
 	{
 		// Remove from the map.
 		this->mapProducerDBovs.erase(producer);
+
+		this->forwardedProducers.erase(producer);
 	}
 
 	void AudioLevelObserver::ProducerResumed(RTC::Producer* producer)
 	{
 		// Insert into the map.
 		this->mapProducerDBovs[producer];
+
+		AddForwardedProducer(producer);
+	}
+
+	bool AudioLevelObserver::IsForwarding(RTC::Producer* producer) const
+	{
+		MS_TRACE();
+
+		if (this->lastN == 0u || IsPaused())
+		{
+			return true;
+		}
+
+		return this->forwardedProducers.find(producer) != this->forwardedProducers.end();
 	}
 
 	void AudioLevelObserver::Paused()
@@ -164,6 +188,11 @@ namespace RTC
 			}
 		}
 
+		if (this->lastN > 0u)
+		{
+			UpdateForwardedProducers();
+		}
+
 		// Clear the map.
 		ResetMapProducerDBovs();
 
@@ -200,6 +229,86 @@ namespace RTC
 		}
 	}
 
+	/**
+	 * Replaces the quietest forwarded Producers with louder ones. A Producer
+	 * must be louder than the one it replaces by LastNHysteresis so forwarded
+	 * Producers don't flap between similar levels.
+	 */
+	void AudioLevelObserver::UpdateForwardedProducers()
+	{
+		MS_TRACE();
+
+		// Average dBov of forwarded and not forwarded Producers.
+		std::vector<std::pair<int8_t, RTC::Producer*>> forwarded;
+		std::vector<std::pair<int8_t, RTC::Producer*>> candidates;
+
+		for (auto& kv : this->mapProducerDBovs)
+		{
+			auto* producer = kv.first;
+			auto& dBovs    = kv.second;
+			int8_t avgDBov{ -127 };
+
+			// Few packets mean DTX, so silence.
+			if (dBovs.count >= 10)
+			{
+				avgDBov = -1 * static_cast<int8_t>(std::lround(dBovs.totalSum / dBovs.count));
+			}
+
+			if (this->forwardedProducers.find(producer) != this->forwardedProducers.end())
+			{
+				forwarded.emplace_back(avgDBov, producer);
+			}
+			else if (dBovs.count >= 10 && avgDBov >= this->threshold)
+			{
+				candidates.emplace_back(avgDBov, producer);
+			}
+		}
+
+		if (candidates.empty())
+		{
+			return;
+		}
+
+		// Quietest forwarded first and loudest candidate first.
+		std::sort(
+		  forwarded.begin(),
+		  forwarded.end(),
+		  [](const auto& a, const auto& b) { return a.first < b.first; });
+		std::sort(
+		  candidates.begin(),
+		  candidates.end(),
+		  [](const auto& a, const auto& b) { return a.first > b.first; });
+
+		size_t forwardedIdx{ 0u };
+
+		for (auto& candidate : candidates)
+		{
+			if (this->forwardedProducers.size() < this->lastN)
+			{
+				this->forwardedProducers.insert(candidate.second);
+
+				continue;
+			}
+
+			if (
+			  forwardedIdx == forwarded.size() ||
+			  candidate.first <= forwarded[forwardedIdx].first + LastNHysteresis)
+			{
+				break;
+			}
+
+			MS_DEBUG_DEV(
+			  "forwarded Producer replaced [in:%s, out:%s]",
+			  candidate.second->id.c_str(),
+			  forwarded[forwardedIdx].second->id.c_str());
+
+			this->forwardedProducers.erase(forwarded[forwardedIdx].second);
+			this->forwardedProducers.insert(candidate.second);
+
+			++forwardedIdx;
+		}
+	}
+
 	void AudioLevelObserver::ResetMapProducerDBovs()
 	{
 		MS_TRACE();
@@ -213,6 +322,20 @@ namespace RTC
 		}
 	}
 
+	/**
+	 * Forwards the Producer if there is room, otherwise it must be louder than
+	 * a forwarded one first.
+	 */
+	void AudioLevelObserver::AddForwardedProducer(RTC::Producer* producer)
+	{
+		MS_TRACE();
+
+		if (this->lastN > 0u && this->forwardedProducers.size() < this->lastN)
+		{
+			this->forwardedProducers.insert(producer);
+		}
+	}
+
 	inline void AudioLevelObserver::OnTimer(TimerHandle* /*timer*/)
 	{
 		MS_TRACE();
@@ -0,0 +1,11 @@
+#define MS_CLASS "RTC::CpuTimeCounter"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/CpuTimeCounter.hpp"
+
+namespace RTC
+{
+	/* Class variables. */
+
+	thread_local CpuTimeCounter::Scope* CpuTimeCounter::Scope::current{ nullptr };
+} // namespace RTC
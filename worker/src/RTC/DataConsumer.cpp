@@ -123,7 +123,8 @@ namespace RTC
 		  this->bufferedAmountLowThreshold,
 		  this->paused,
 		  this->dataProducerPaused,
-		  std::addressof(subchannels));
+		  std::addressof(subchannels),
+		  this->shared->channelMessageRegistrator->GetHandle(this->id));
 	}
 
 	flatbuffers::Offset<FBS::DataConsumer::GetStatsResponse> DataConsumer::FillBufferStats(
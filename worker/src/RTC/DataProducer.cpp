@@ -99,7 +99,8 @@ namespace RTC
 		  sctpStreamParametersOffset,
 		  this->label.c_str(),
 		  this->protocol.c_str(),
-		  this->paused);
+		  this->paused,
+		  this->shared->channelMessageRegistrator->GetHandle(this->id));
 	}
 
 	flatbuffers::Offset<FBS::DataProducer::GetStatsResponse> DataProducer::FillBufferStats(
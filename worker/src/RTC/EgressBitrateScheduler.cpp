@@ -0,0 +1,162 @@
+#define MS_CLASS "RTC::EgressBitrateScheduler"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/EgressBitrateScheduler.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include <algorithm> // std::sort(), std::max()
+#include <numeric>   // std::iota()
+
+namespace RTC
+{
+	/* Static methods. */
+
+	/**
+	 * Computes the cap of each demand. If all of them fit in the budget nobody
+	 * is capped. Otherwise the budget is given to demands in priority order,
+	 * and the first priority that does not fit splits the remaining budget
+	 * proportionally to its demands. Lower priorities get the minimum.
+	 */
+	void EgressBitrateScheduler::AllocateCaps(uint32_t budget, std::vector<Demand>& demands)
+	{
+		MS_TRACE();
+
+		uint64_t totalBitrate{ 0u };
+
+		for (auto& demand : demands)
+		{
+			demand.cap = 0u;
+			totalBitrate += demand.bitrate;
+		}
+
+		if (totalBitrate <= budget)
+		{
+			return;
+		}
+
+		std::vector<size_t> idxs(demands.size());
+
+		std::iota(idxs.begin(), idxs.end(), 0u);
+		std::sort(
+		  idxs.begin(),
+		  idxs.end(),
+		  [&demands](size_t a, size_t b) { return demands[a].priority > demands[b].priority; });
+
+		uint64_t remainingBitrate{ budget };
+
+		for (size_t groupStart{ 0u }; groupStart < idxs.size();)
+		{
+			const uint8_t priority = demands[idxs[groupStart]].priority;
+			size_t groupEnd        = groupStart;
+			uint64_t groupBitrate{ 0u };
+
+			for (; groupEnd < idxs.size() && demands[idxs[groupEnd]].priority == priority; ++groupEnd)
+			{
+				groupBitrate += demands[idxs[groupEnd]].bitrate;
+			}
+
+			for (size_t i{ groupStart }; i < groupEnd; ++i)
+			{
+				auto& demand = demands[idxs[i]];
+				uint64_t cap;
+
+				if (groupBitrate <= remainingBitrate)
+				{
+					cap = demand.bitrate;
+				}
+				else
+				{
+					cap = remainingBitrate * demand.bitrate / groupBitrate;
+				}
+
+				demand.cap = static_cast<uint32_t>(std::max<uint64_t>(cap, MinBitrateCap));
+			}
+
+			remainingBitrate -= std::min(groupBitrate, remainingBitrate);
+
+			groupStart = groupEnd;
+		}
+	}
+
+	/* Instance methods. */
+
+	EgressBitrateScheduler::EgressBitrateScheduler(uint32_t budget) : budget(budget)
+	{
+		MS_TRACE();
+
+		this->timer = new TimerHandle(this);
+
+		this->timer->Start(EgressBitrateScheduler::IntervalMs, EgressBitrateScheduler::IntervalMs);
+	}
+
+	EgressBitrateScheduler::~EgressBitrateScheduler()
+	{
+		MS_TRACE();
+
+		delete this->timer;
+		this->timer = nullptr;
+	}
+
+	void EgressBitrateScheduler::AddListener(Listener* listener)
+	{
+		MS_TRACE();
+
+		this->mapListenerCap[listener] = 0u;
+	}
+
+	void EgressBitrateScheduler::RemoveListener(Listener* listener)
+	{
+		MS_TRACE();
+
+		this->mapListenerCap.erase(listener);
+	}
+
+	inline void EgressBitrateScheduler::OnTimer(TimerHandle* /*timer*/)
+	{
+		MS_TRACE();
+
+		const uint64_t nowMs = DepLibUV::GetTimeMs();
+
+		this->demands.clear();
+		this->sendBitrate = 0u;
+
+		for (auto& kv : this->mapListenerCap)
+		{
+			auto* listener             = kv.first;
+			const uint32_t sendBitrate = listener->GetEgressSendBitrate(nowMs);
+			Demand demand;
+
+			// NOTE: Use the sent bitrate too since it includes RTX, probation,
+			// RTCP and media of Transports without bandwidth estimation.
+			demand.priority = listener->GetEgressPriority();
+			demand.bitrate  = std::max(sendBitrate, listener->GetEgressDesiredBitrate());
+
+			this->sendBitrate += sendBitrate;
+			this->demands.push_back(demand);
+		}
+
+		AllocateCaps(this->budget, this->demands);
+
+		MS_DEBUG_DEV(
+		  "[budget:%" PRIu32 ", sendBitrate:%" PRIu32 ", transports:%zu]",
+		  this->budget,
+		  this->sendBitrate,
+		  this->demands.size());
+
+		// NOTE: Listeners must not be added or removed while notified.
+		size_t idx{ 0u };
+
+		for (auto& kv : this->mapListenerCap)
+		{
+			auto* listener     = kv.first;
+			const uint32_t cap = this->demands[idx++].cap;
+
+			if (cap != kv.second)
+			{
+				kv.second = cap;
+
+				listener->OnEgressBitrateCapChanged(this, cap);
+			}
+		}
+	}
+} // namespace RTC
@@ -0,0 +1,345 @@
+#define MS_CLASS "RTC::FecGenerator"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/FecGenerator.hpp"
+#include "Logger.hpp"
+#include "Utils.hpp"
+#include "RTC/RtpDictionaries.hpp"
+#include <algorithm> // std::min(), std::max()
+#include <cstring>   // std::memcpy(), std::memset()
+#include <vector>
+#if defined(__SSE2__) && !defined(_MSC_VER)
+#include <emmintrin.h>
+#define MS_FEC_XOR_SSE2
+#elif defined(__ARM_NEON) && !defined(_MSC_VER)
+#include <arm_neon.h>
+#define MS_FEC_XOR_NEON
+#endif
+
+namespace RTC
+{
+	/* Static. */
+
+	// clang-format off
+	// FlexFEC RTP header.
+	// Caution: This must have an exact size for the RTP extensions to be added
+	// and must align extensions to 4 bytes.
+	static const uint8_t FecPacketHeader[] =
+	{
+		0b10010001, 0, 0, 0, // One CSRC (the protected SSRC), Sequence Number: 0
+		0, 0, 0, 0,          // Timestamp: 0
+		0, 0, 0, 0,          // SSRC: 0
+		0, 0, 0, 0,          // CSRC: 0
+		0xBE, 0xDE, 0, 2,    // Header Extension (One-Byte Extensions)
+		0, 0, 0, 0,          // Space for abs-send-time extension
+		0, 0, 0, 0           // Space for transport-wide-cc-01 extension
+	};
+	// clang-format on
+
+	static constexpr size_t FecPacketHeaderSize{ 28u };
+	static constexpr size_t MaxRecoveryPayloadLength{
+		RTC::MtuSize - FecPacketHeaderSize - FecGenerator::FecHeaderSize
+	};
+
+	/* Class methods. */
+
+	/**
+	 * XORs src into dst. This is where the CPU cost of the FEC generation goes
+	 * so it uses 16 bytes vectors when available and 64 bits words otherwise.
+	 */
+	void FecGenerator::XorBytes(uint8_t* dst, const uint8_t* src, size_t len)
+	{
+		size_t idx{ 0u };
+
+#if defined(MS_FEC_XOR_SSE2)
+		for (; idx + 32 <= len; idx += 32)
+		{
+			const __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + idx));
+			const __m128i d1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + idx + 16));
+			const __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+			const __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx + 16));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + idx), _mm_xor_si128(d0, s0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + idx + 16), _mm_xor_si128(d1, s1));
+		}
+#elif defined(MS_FEC_XOR_NEON)
+		for (; idx + 32 <= len; idx += 32)
+		{
+			vst1q_u8(dst + idx, veorq_u8(vld1q_u8(dst + idx), vld1q_u8(src + idx)));
+			vst1q_u8(dst + idx + 16, veorq_u8(vld1q_u8(dst + idx + 16), vld1q_u8(src + idx + 16)));
+		}
+#endif
+
+		for (; idx + 8 <= len; idx += 8)
+		{
+			uint64_t d;
+			uint64_t s;
+
+			std::memcpy(std::addressof(d), dst + idx, 8);
+			std::memcpy(std::addressof(s), src + idx, 8);
+
+			d ^= s;
+
+			std::memcpy(dst + idx, std::addressof(d), 8);
+		}
+
+		for (; idx < len; ++idx)
+		{
+			dst[idx] ^= src[idx];
+		}
+	}
+
+	/**
+	 * A group recovers at most one lost packet so its size is chosen to keep
+	 * the expected losses per group around one half. Then it's enlarged, which
+	 * reduces the FEC overhead (about the media bitrate divided by the group
+	 * size), until the FEC bitrate fits into the given one. Returns 0 if FEC is
+	 * not needed or does not fit.
+	 */
+	size_t FecGenerator::ComputeGroupSize(
+	  uint8_t fractionLost, uint32_t mediaBitrate, uint32_t maxFecBitrate)
+	{
+		MS_TRACE();
+
+		if (fractionLost == 0u)
+		{
+			return 0u;
+		}
+
+		// fractionLost is the loss fraction multiplied by 256.
+		size_t groupSize = std::max<size_t>(128u / fractionLost, MinGroupSize);
+
+		groupSize = std::min(groupSize, MaxGroupSize);
+
+		if (static_cast<uint64_t>(maxFecBitrate) * groupSize < mediaBitrate)
+		{
+			if (maxFecBitrate == 0u)
+			{
+				return 0u;
+			}
+
+			groupSize = (mediaBitrate + maxFecBitrate - 1u) / maxFecBitrate;
+
+			if (groupSize > MaxGroupSize)
+			{
+				return 0u;
+			}
+		}
+
+		return groupSize;
+	}
+
+	/* Instance methods. */
+
+	FecGenerator::FecGenerator(uint8_t payloadType, uint32_t ssrc, uint32_t protectedSsrc)
+	{
+		MS_TRACE();
+
+		// Allocate the FEC RTP packet buffer.
+		this->fecPacketBuffer = new uint8_t[RTC::MtuSize + 100];
+
+		// Copy the generic FEC RTP packet header into the buffer.
+		std::memcpy(this->fecPacketBuffer, FecPacketHeader, FecPacketHeaderSize);
+
+		// Create the FEC RTP packet.
+		this->fecPacket = RTC::RtpPacket::Parse(this->fecPacketBuffer, RTC::MtuSize);
+
+		this->fecPacket->SetPayloadType(payloadType);
+		this->fecPacket->SetSsrc(ssrc);
+		this->fecPacket->SetSequenceNumber(
+		  static_cast<uint16_t>(Utils::Crypto::GetRandomUInt(0u, 0xFFFF)));
+
+		// Protected SSRC in the CSRC list.
+		Utils::Byte::Set4Bytes(this->fecPacketBuffer, RTC::RtpPacket::HeaderSize, protectedSsrc);
+
+		// Add BWE related RTP header extensions.
+		thread_local static uint8_t buffer[4096];
+
+		std::vector<RTC::RtpPacket::GenericExtension> extensions;
+		uint8_t extenLen;
+		uint8_t* bufferPtr{ buffer };
+
+		// Add http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time.
+		// NOTE: Just the corresponding id and space for its value.
+		{
+			extenLen = 3u;
+
+			extensions.emplace_back(
+			  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME), extenLen, bufferPtr);
+
+			bufferPtr += extenLen;
+		}
+
+		// Add http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01.
+		// NOTE: Just the corresponding id and space for its value.
+		{
+			extenLen = 2u;
+
+			extensions.emplace_back(
+			  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01),
+			  extenLen,
+			  bufferPtr);
+
+			// Not needed since this is the latest added extension.
+			// bufferPtr += extenLen;
+		}
+
+		// Set the extensions into the packet using One-Byte format.
+		this->fecPacket->SetExtensions(1, extensions);
+
+		// Set our abs-send-time extension id.
+		this->fecPacket->SetAbsSendTimeExtensionId(
+		  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME));
+
+		// Set our transport-wide-cc-01 extension id.
+		this->fecPacket->SetTransportWideCc01ExtensionId(
+		  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01));
+
+		this->fecPayload = this->fecPacket->GetPayload();
+
+		// Allocate the recovery payload with room for the XOR kernel.
+		this->recoveryPayload = new uint8_t[RTC::MtuSize];
+	}
+
+	FecGenerator::~FecGenerator()
+	{
+		MS_TRACE();
+
+		// Delete the FEC RTP packet.
+		delete this->fecPacket;
+
+		// Delete the FEC packet buffer.
+		delete[] this->fecPacketBuffer;
+
+		delete[] this->recoveryPayload;
+	}
+
+	void FecGenerator::SetGroupSize(size_t groupSize)
+	{
+		MS_TRACE();
+
+		MS_ASSERT(groupSize <= MaxGroupSize, "group size too big");
+
+		this->nextGroupSize = groupSize;
+
+		// Apply it now if no group is in progress.
+		if (this->groupPacketCount == 0u)
+		{
+			this->groupSize = groupSize;
+		}
+	}
+
+	RTC::RtpPacket* FecGenerator::AddPacket(const RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		const uint16_t seq     = packet->GetSequenceNumber();
+		const uint16_t nextSeq = this->snBase + static_cast<uint16_t>(this->groupPacketCount);
+
+		// Groups are made of consecutive packets, so start a new one if this
+		// packet does not follow the last one (the current group is lost).
+		if (this->groupPacketCount != 0u && seq != nextSeq)
+		{
+			ResetGroup();
+		}
+
+		if (this->groupSize == 0u)
+		{
+			return nullptr;
+		}
+
+		const uint8_t* data = packet->GetData();
+		const size_t length = packet->GetSize() - RTC::RtpPacket::HeaderSize;
+
+		if (length > MaxRecoveryPayloadLength)
+		{
+			MS_WARN_DEV("packet too big to be protected, discarding current group");
+
+			ResetGroup();
+
+			return nullptr;
+		}
+
+		if (this->groupPacketCount == 0u)
+		{
+			this->snBase = seq;
+
+			std::memset(this->recoveryHeader, 0, sizeof(this->recoveryHeader));
+			this->recoveryPayloadLength = 0u;
+		}
+
+		// The bit string of the packet begins with its first 8 bytes with the
+		// sequence number replaced by the length after the fixed RTP header.
+		uint8_t bitString[8];
+
+		std::memcpy(bitString, data, 8);
+		Utils::Byte::Set2Bytes(bitString, 2, static_cast<uint16_t>(length));
+
+		FecGenerator::XorBytes(this->recoveryHeader, bitString, sizeof(bitString));
+
+		// Packets shorter than the longest one are padded with zeroes.
+		if (length > this->recoveryPayloadLength)
+		{
+			std::memset(
+			  this->recoveryPayload + this->recoveryPayloadLength,
+			  0,
+			  length - this->recoveryPayloadLength);
+
+			this->recoveryPayloadLength = length;
+		}
+
+		FecGenerator::XorBytes(this->recoveryPayload, data + RTC::RtpPacket::HeaderSize, length);
+
+		++this->groupPacketCount;
+
+		if (this->groupPacketCount < this->groupSize)
+		{
+			return nullptr;
+		}
+
+		// Group completed, write the FEC header and payload.
+		uint8_t* ptr = this->fecPayload;
+
+		std::memcpy(ptr, this->recoveryHeader, sizeof(this->recoveryHeader));
+
+		// R=0 and F=0 (flexible mask) in place of the RTP version.
+		ptr[0] &= 0b00111111;
+
+		Utils::Byte::Set2Bytes(ptr, 8, this->snBase);
+
+		// k=1 (no more mask) followed by the mask of the protected packets.
+		uint16_t mask{ 0x8000 };
+
+		for (size_t idx{ 0u }; idx < this->groupPacketCount; ++idx)
+		{
+			mask |= static_cast<uint16_t>(1u << (14u - idx));
+		}
+
+		Utils::Byte::Set2Bytes(ptr, 10, mask);
+
+		std::memcpy(ptr + FecHeaderSize, this->recoveryPayload, this->recoveryPayloadLength);
+
+		const size_t payloadLength = FecHeaderSize + this->recoveryPayloadLength;
+
+		// The payload length is padded to 4 bytes, so zero the extra bytes.
+		std::memset(ptr + payloadLength, 0, 3);
+
+		this->fecPacket->SetPayloadLength(payloadLength);
+		this->fecPacket->SetSequenceNumber(this->fecPacket->GetSequenceNumber() + 1);
+		this->fecPacket->SetTimestamp(packet->GetTimestamp());
+
+		++this->packetCount;
+
+		ResetGroup();
+
+		return this->fecPacket;
+	}
+
+	void FecGenerator::ResetGroup()
+	{
+		MS_TRACE();
+
+		this->groupPacketCount = 0u;
+		this->groupSize        = this->nextGroupSize;
+	}
+} // namespace RTC
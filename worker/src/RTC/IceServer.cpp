@@ -62,7 +62,8 @@ namespace RTC
 	/* Instance methods. */
 
 	IceServer::IceServer(Listener* listener, const std::string& usernameFragment, const std::string& password)
-	  : listener(listener), usernameFragment(usernameFragment), password(password)
+	  : listener(listener), usernameFragment(usernameFragment), password(password),
+	    hmacSha1(std::make_unique<Utils::Crypto::HmacSha1>(password))
 	{
 		MS_TRACE();
 
@@ -172,7 +173,7 @@ namespace RTC
 				}
 
 				// Check authentication.
-				switch (packet->CheckAuthentication(this->usernameFragment, this->password))
+				switch (packet->CheckAuthentication(this->usernameFragment, this->hmacSha1.get()))
 				{
 					case RTC::StunPacket::Authentication::OK:
 					{
@@ -185,6 +186,7 @@ namespace RTC
 
 							this->oldUsernameFragment.clear();
 							this->oldPassword.clear();
+							this->oldHmacSha1.reset();
 						}
 
 						break;
@@ -198,7 +200,7 @@ namespace RTC
 						if (
 							!this->oldUsernameFragment.empty() &&
 							!this->oldPassword.empty() &&
-							packet->CheckAuthentication(this->oldUsernameFragment, this->oldPassword) == RTC::StunPacket::Authentication::OK
+							packet->CheckAuthentication(this->oldUsernameFragment, this->oldHmacSha1.get()) == RTC::StunPacket::Authentication::OK
 						)
 						// clang-format on
 						{
@@ -266,11 +268,11 @@ namespace RTC
 				// Authenticate the response.
 				if (this->oldPassword.empty())
 				{
-					response->Authenticate(this->password);
+					response->Authenticate(this->hmacSha1.get());
 				}
 				else
 				{
-					response->Authenticate(this->oldPassword);
+					response->Authenticate(this->oldHmacSha1.get());
 				}
 
 				// Send back.
@@ -0,0 +1,162 @@
+#define MS_CLASS "RTC::KeyFrameCache"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/KeyFrameCache.hpp"
+#include "Logger.hpp"
+#include "RTC/SeqManager.hpp"
+
+namespace RTC
+{
+	/* Instance methods. */
+
+	KeyFrameCache::KeyFrameCache(size_t maxPackets) : maxPackets(maxPackets)
+	{
+		MS_TRACE();
+
+		this->packets.reserve(maxPackets);
+	}
+
+	void KeyFrameCache::Insert(const RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		const auto seq = packet->GetSequenceNumber();
+
+		// First packet of a new key frame, start over.
+		// NOTE: Depending on the codec just the first packet of the key frame may
+		// be flagged as key frame.
+		if (packet->IsKeyFrame() && (!this->valid || packet->GetTimestamp() != this->keyFrameTimestamp))
+		{
+			MS_DEBUG_DEV(
+			  "new key frame [ssrc:%" PRIu32 ", seq:%" PRIu16 ", ts:%" PRIu32 "]",
+			  packet->GetSsrc(),
+			  seq,
+			  packet->GetTimestamp());
+
+			Clear();
+
+			this->packets.emplace_back(packet->Clone());
+
+			this->valid             = true;
+			this->keyFrameTimestamp = packet->GetTimestamp();
+			this->nextSeq           = seq + 1;
+
+			return;
+		}
+
+		if (!this->valid)
+		{
+			return;
+		}
+
+		// Duplicated or retransmitted packet we already have. Ignore it.
+		if (RTC::SeqManager<uint16_t>::IsSeqLowerThan(seq, this->nextSeq))
+		{
+			return;
+		}
+
+		// The cache is full. Wait for next key frame.
+		if (this->packets.size() + this->reorderPackets.size() >= this->maxPackets)
+		{
+			MS_DEBUG_DEV(
+			  "cache full, invalidating it [ssrc:%" PRIu32 ", size:%zu]",
+			  packet->GetSsrc(),
+			  this->packets.size());
+
+			Clear();
+
+			return;
+		}
+
+		if (seq == this->nextSeq)
+		{
+			Append(std::shared_ptr<RTC::RtpPacket>(packet->Clone()));
+
+			// Append those packets that were waiting for this one.
+			while (!this->reorderPackets.empty() &&
+			       this->reorderPackets.front()->GetSequenceNumber() == this->nextSeq)
+			{
+				Append(this->reorderPackets.front());
+
+				this->reorderPackets.erase(this->reorderPackets.begin());
+			}
+
+			return;
+		}
+
+		// A packet is missing. Hold this one unless the missing one is too old or
+		// too many packets are waiting already, in which case it's considered
+		// lost. Wait for next key frame then.
+		if (
+		  static_cast<uint16_t>(seq - this->nextSeq) >= ReorderWindow ||
+		  this->reorderPackets.size() >= ReorderWindow)
+		{
+			MS_DEBUG_DEV(
+			  "missing packet, invalidating cache [ssrc:%" PRIu32 ", seq:%" PRIu16
+			  ", expected seq:%" PRIu16 ", size:%zu]",
+			  packet->GetSsrc(),
+			  seq,
+			  this->nextSeq,
+			  this->packets.size());
+
+			Clear();
+
+			return;
+		}
+
+		auto it = this->reorderPackets.begin();
+
+		for (; it != this->reorderPackets.end(); ++it)
+		{
+			const auto waitingSeq = (*it)->GetSequenceNumber();
+
+			// Duplicated packet.
+			if (waitingSeq == seq)
+			{
+				return;
+			}
+			else if (RTC::SeqManager<uint16_t>::IsSeqHigherThan(waitingSeq, seq))
+			{
+				break;
+			}
+		}
+
+		this->reorderPackets.emplace(it, packet->Clone());
+	}
+
+	void KeyFrameCache::Clear()
+	{
+		MS_TRACE();
+
+		this->packets.clear();
+		this->reorderPackets.clear();
+		this->valid = false;
+	}
+
+	const std::vector<std::shared_ptr<RTC::RtpPacket>>* KeyFrameCache::Lookup()
+	{
+		MS_TRACE();
+
+		// NOTE: Don't give away the packets while one is missing, since the
+		// Consumer would never get it.
+		if (!this->valid || !this->reorderPackets.empty())
+		{
+			++this->misses;
+
+			return nullptr;
+		}
+
+		++this->hits;
+
+		return std::addressof(this->packets);
+	}
+
+	void KeyFrameCache::Append(const std::shared_ptr<RTC::RtpPacket>& packet)
+	{
+		MS_TRACE();
+
+		this->packets.push_back(packet);
+
+		++this->nextSeq;
+	}
+} // namespace RTC
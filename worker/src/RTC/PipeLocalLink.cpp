@@ -0,0 +1,278 @@
+#define MS_CLASS "RTC::PipeLocalLink"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/PipeLocalLink.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include <cstring> // std::memcpy()
+
+namespace RTC
+{
+	/* Class variables. */
+
+	// NOTE: Not thread_local since links of different workers (threads) must
+	// find each other.
+	std::mutex PipeLocalLink::registryMutex;
+	absl::flat_hash_map<std::string, std::shared_ptr<PipeLocalLink::Inbox>> PipeLocalLink::registry;
+
+	/* Static methods for UV callbacks. */
+
+	inline static void onAsync(uv_async_t* handle)
+	{
+		static_cast<PipeLocalLink*>(handle->data)->OnUvAsync();
+	}
+
+	inline static void onCloseAsync(uv_handle_t* handle)
+	{
+		delete reinterpret_cast<uv_async_t*>(handle);
+	}
+
+	/* Inbox methods. */
+
+	// NOTE: It may be destroyed in any thread.
+	PipeLocalLink::Inbox::~Inbox()
+	{
+		while (auto* item = Pop())
+		{
+			delete item->rtpPacket;
+			delete[] item->rtcpData;
+			delete item;
+		}
+	}
+
+	/**
+	 * Lock free push (Dmitry Vyukov's intrusive MPSC queue). Can be called by
+	 * any thread.
+	 */
+	void PipeLocalLink::Inbox::Push(Item* item)
+	{
+		item->next.store(nullptr, std::memory_order_relaxed);
+
+		auto* prev = this->head.exchange(item);
+
+		prev->next.store(item);
+	}
+
+	/**
+	 * Returns nullptr if the queue is empty or if a producer is in the middle
+	 * of a push (it will wake us up once done).
+	 */
+	PipeLocalLink::Item* PipeLocalLink::Inbox::Pop()
+	{
+		auto* tail = this->tail;
+		auto* next = tail->next.load();
+
+		if (tail == std::addressof(this->stub))
+		{
+			if (!next)
+			{
+				return nullptr;
+			}
+
+			this->tail = next;
+			tail       = next;
+			next       = next->next.load();
+		}
+
+		if (next)
+		{
+			this->tail = next;
+
+			return tail;
+		}
+
+		if (tail != this->head.load())
+		{
+			return nullptr;
+		}
+
+		Push(std::addressof(this->stub));
+
+		next = tail->next.load();
+
+		if (next)
+		{
+			this->tail = next;
+
+			return tail;
+		}
+
+		return nullptr;
+	}
+
+	/* Instance methods. */
+
+	PipeLocalLink::PipeLocalLink(Listener* listener) : listener(listener), inbox(new Inbox())
+	{
+		MS_TRACE();
+
+		auto* uvAsyncHandle = new uv_async_t;
+
+		uvAsyncHandle->data = static_cast<void*>(this);
+
+		const int err =
+		  uv_async_init(DepLibUV::GetLoop(), uvAsyncHandle, static_cast<uv_async_cb>(onAsync));
+
+		if (err != 0)
+		{
+			delete uvAsyncHandle;
+
+			MS_THROW_ERROR("uv_async_init() failed: %s", uv_strerror(err));
+		}
+
+		// The link must not keep the loop alive.
+		uv_unref(reinterpret_cast<uv_handle_t*>(uvAsyncHandle));
+
+		this->inbox->uvAsyncHandle = uvAsyncHandle;
+
+		const std::lock_guard<std::mutex> lock(PipeLocalLink::registryMutex);
+
+		do
+		{
+			this->name = Utils::Crypto::GetRandomString(16);
+		} while (PipeLocalLink::registry.find(this->name) != PipeLocalLink::registry.end());
+
+		PipeLocalLink::registry[this->name] = this->inbox;
+
+		MS_DEBUG_DEV("local link created [name:%s]", this->name.c_str());
+	}
+
+	PipeLocalLink::~PipeLocalLink()
+	{
+		MS_TRACE();
+
+		{
+			const std::lock_guard<std::mutex> lock(PipeLocalLink::registryMutex);
+
+			PipeLocalLink::registry.erase(this->name);
+		}
+
+		// Once closed producers stop pushing and waking us up. Items pushed
+		// meanwhile are freed with the inbox.
+		{
+			const std::lock_guard<std::mutex> lock(this->inbox->mutex);
+
+			this->inbox->closed.store(true);
+		}
+
+		uv_close(
+		  reinterpret_cast<uv_handle_t*>(this->inbox->uvAsyncHandle),
+		  static_cast<uv_close_cb>(onCloseAsync));
+
+		this->inbox->uvAsyncHandle = nullptr;
+	}
+
+	void PipeLocalLink::Connect(const std::string& peerName)
+	{
+		MS_TRACE();
+
+		const std::lock_guard<std::mutex> lock(PipeLocalLink::registryMutex);
+
+		auto it = PipeLocalLink::registry.find(peerName);
+
+		if (it == PipeLocalLink::registry.end())
+		{
+			MS_THROW_TYPE_ERROR("local link not found (is the peer in the same process?)");
+		}
+		else if (peerName == this->name)
+		{
+			MS_THROW_TYPE_ERROR("cannot connect a local link to itself");
+		}
+
+		this->peerInbox = it->second;
+	}
+
+	/**
+	 * Hands a copy of the packet to the peer. Returns false if not connected.
+	 */
+	bool PipeLocalLink::SendRtpPacket(const RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		if (!IsConnected())
+		{
+			return false;
+		}
+
+		auto* item = new Item();
+
+		item->rtpPacket = packet->Clone();
+
+		Push(item);
+
+		return true;
+	}
+
+	/**
+	 * Hands a copy of the RTCP data to the peer. Returns false if not
+	 * connected.
+	 */
+	bool PipeLocalLink::SendRtcp(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		if (!IsConnected())
+		{
+			return false;
+		}
+
+		auto* item = new Item();
+
+		item->rtcpData = new uint8_t[len];
+		item->rtcpLen  = len;
+
+		std::memcpy(item->rtcpData, data, len);
+
+		Push(item);
+
+		return true;
+	}
+
+	void PipeLocalLink::Push(Item* item)
+	{
+		MS_TRACE();
+
+		auto& peerInbox = *this->peerInbox;
+
+		peerInbox.Push(item);
+
+		// Wake up the peer unless it was already done and the peer didn't start
+		// popping yet.
+		if (!peerInbox.wakeUpPending.exchange(true))
+		{
+			const std::lock_guard<std::mutex> lock(peerInbox.mutex);
+
+			if (!peerInbox.closed.load())
+			{
+				uv_async_send(peerInbox.uvAsyncHandle);
+			}
+		}
+	}
+
+	inline void PipeLocalLink::OnUvAsync()
+	{
+		MS_TRACE();
+
+		// NOTE: Clear it before popping so a producer pushing meanwhile wakes us
+		// up again.
+		this->inbox->wakeUpPending.store(false);
+
+		while (auto* item = this->inbox->Pop())
+		{
+			if (item->rtpPacket)
+			{
+				this->listener->OnPipeLocalLinkRtpPacketReceived(this, item->rtpPacket);
+			}
+			else
+			{
+				this->listener->OnPipeLocalLinkRtcpDataReceived(this, item->rtcpData, item->rtcpLen);
+
+				delete[] item->rtcpData;
+			}
+
+			delete item;
+		}
+	}
+} // namespace RTC
@@ -0,0 +1,283 @@
+#define MS_CLASS "RTC::PipeShmRing"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/PipeShmRing.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include <cerrno>
+#include <cstring> // std::memcpy(), std::strerror()
+#include <new>     // placement new
+#ifndef _WIN32
+#include <fcntl.h>    // O_CREAT, O_EXCL, O_RDWR
+#include <sys/mman.h> // shm_open(), shm_unlink(), mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // ftruncate(), close()
+#endif
+
+namespace RTC
+{
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory atomics must be lock free");
+	static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared memory atomics must be lock free");
+
+	/* Instance methods. */
+
+	PipeShmRing::PipeShmRing() : owner(true)
+	{
+		MS_TRACE();
+
+#ifdef _WIN32
+		MS_THROW_ERROR("shared memory pipe not supported on Windows");
+#else
+		// NOTE: Keep it short since some systems limit the name to 31 chars.
+		this->name = "/mediasoup-" + Utils::Crypto::GetRandomString(16);
+
+		const int fd = shm_open(this->name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+
+		if (fd == -1)
+		{
+			MS_THROW_ERROR("shm_open() failed: %s", std::strerror(errno));
+		}
+
+		try
+		{
+			Map(fd, /*create*/ true);
+		}
+		catch (const MediaSoupError& error)
+		{
+			close(fd);
+			shm_unlink(this->name.c_str());
+
+			throw;
+		}
+
+		// The mapping keeps the shared memory alive.
+		close(fd);
+
+		// NOTE: Placement new so atomics are properly constructed.
+		this->header = new (this->header) Header();
+
+		this->header->magic        = PipeShmRing::Magic;
+		this->header->numSlots     = PipeShmRing::NumSlots;
+		this->header->slotDataSize = PipeShmRing::SlotDataSize;
+		this->header->consumerAttached.store(0);
+		this->header->tail.store(0);
+		this->header->head.store(0);
+		// The consumer starts waiting for data.
+		this->header->consumerWaiting.store(1);
+
+		MS_DEBUG_TAG(info, "shared memory ring created [name:%s]", this->name.c_str());
+#endif
+	}
+
+	PipeShmRing::PipeShmRing(const std::string& name) : name(name), owner(false)
+	{
+		MS_TRACE();
+
+#ifdef _WIN32
+		MS_THROW_ERROR("shared memory pipe not supported on Windows");
+#else
+		const int fd = shm_open(this->name.c_str(), O_RDWR, 0);
+
+		if (fd == -1)
+		{
+			MS_THROW_ERROR("shm_open() failed: %s", std::strerror(errno));
+		}
+
+		try
+		{
+			Map(fd, /*create*/ false);
+		}
+		catch (const MediaSoupError& error)
+		{
+			close(fd);
+
+			throw;
+		}
+
+		close(fd);
+
+		if (
+		  this->header->magic != PipeShmRing::Magic ||
+		  this->header->numSlots != PipeShmRing::NumSlots ||
+		  this->header->slotDataSize != PipeShmRing::SlotDataSize)
+		{
+			munmap(static_cast<void*>(this->header), this->mappingSize);
+
+			MS_THROW_ERROR("invalid shared memory ring [name:%s]", this->name.c_str());
+		}
+
+		this->header->consumerAttached.store(1, std::memory_order_release);
+
+		MS_DEBUG_TAG(info, "shared memory ring opened [name:%s]", this->name.c_str());
+#endif
+	}
+
+	PipeShmRing::~PipeShmRing()
+	{
+		MS_TRACE();
+
+#ifndef _WIN32
+		// Let the producer know that nobody reads the ring anymore.
+		if (!this->owner)
+		{
+			this->header->consumerAttached.store(0, std::memory_order_release);
+		}
+
+		munmap(static_cast<void*>(this->header), this->mappingSize);
+
+		// The peer keeps its mapping (if any) after the name is removed.
+		if (this->owner)
+		{
+			shm_unlink(this->name.c_str());
+		}
+#endif
+	}
+
+	/**
+	 * Returns false if the packet is too big or the ring is full.
+	 */
+	bool PipeShmRing::Write(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		if (len > RTC::MtuSize)
+		{
+			return false;
+		}
+
+		const uint64_t tail = this->header->tail.load(std::memory_order_relaxed);
+		const uint64_t head = this->header->head.load(std::memory_order_acquire);
+
+		if (tail - head >= PipeShmRing::NumSlots)
+		{
+			return false;
+		}
+
+		auto& slot = this->slots[tail & (PipeShmRing::NumSlots - 1)];
+
+		slot.len = static_cast<uint32_t>(len);
+		std::memcpy(slot.data, data, len);
+
+		// NOTE: Sequentially consistent store so either the consumer sees the new
+		// slot before going to sleep or we see it sleeping.
+		this->header->tail.store(tail + 1);
+
+		return true;
+	}
+
+	/**
+	 * Must be called after writing packets. If it returns true the consumer is
+	 * sleeping and must be woken up.
+	 */
+	bool PipeShmRing::ShouldWakeUpConsumer()
+	{
+		MS_TRACE();
+
+		return this->header->consumerWaiting.load() != 0 &&
+		       this->header->consumerWaiting.exchange(0) != 0;
+	}
+
+	/**
+	 * Must be called periodically by the producer while there are unread
+	 * packets. Returns true if the consumer did not read any packet since the
+	 * previous call, meaning that the doorbell may have been lost and must be
+	 * sent again.
+	 */
+	bool PipeShmRing::IsConsumerStalled()
+	{
+		MS_TRACE();
+
+		const uint64_t head = this->header->head.load(std::memory_order_acquire);
+		const uint64_t tail = this->header->tail.load(std::memory_order_relaxed);
+		const bool stalled  = head != tail && head == this->lastHead;
+
+		this->lastHead = head;
+
+		return stalled;
+	}
+
+	/**
+	 * Calls onData() for every pending packet. The slot is released once
+	 * onData() returns so the packet must not be retained.
+	 */
+	size_t PipeShmRing::Read(onDataCallback& onData)
+	{
+		MS_TRACE();
+
+		uint64_t head       = this->header->head.load(std::memory_order_relaxed);
+		const uint64_t tail = this->header->tail.load(std::memory_order_acquire);
+		size_t count{ 0u };
+
+		for (; head != tail; ++head)
+		{
+			auto& slot     = this->slots[head & (PipeShmRing::NumSlots - 1)];
+			const auto len = static_cast<size_t>(slot.len);
+
+			// Never trust the peer.
+			if (len <= RTC::MtuSize)
+			{
+				onData(slot.data, len);
+
+				++count;
+			}
+
+			this->header->head.store(head + 1, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/**
+	 * Tells the producer that we are waiting for new data. Returns false if new
+	 * data was written meanwhile, so Read() must be called again.
+	 */
+	bool PipeShmRing::Sleep()
+	{
+		MS_TRACE();
+
+		this->header->consumerWaiting.store(1);
+
+		return this->header->tail.load() == this->header->head.load(std::memory_order_relaxed);
+	}
+
+	void PipeShmRing::Map(int fd, bool create)
+	{
+		MS_TRACE();
+
+#ifndef _WIN32
+		this->mappingSize = sizeof(Header) + (PipeShmRing::NumSlots * sizeof(Slot));
+
+		if (create)
+		{
+			if (ftruncate(fd, static_cast<off_t>(this->mappingSize)) == -1)
+			{
+				MS_THROW_ERROR("ftruncate() failed: %s", std::strerror(errno));
+			}
+		}
+		else
+		{
+			struct stat st{};
+
+			if (fstat(fd, &st) == -1)
+			{
+				MS_THROW_ERROR("fstat() failed: %s", std::strerror(errno));
+			}
+			else if (static_cast<size_t>(st.st_size) != this->mappingSize)
+			{
+				MS_THROW_ERROR("invalid shared memory size [size:%lld]", static_cast<long long>(st.st_size));
+			}
+		}
+
+		void* addr = mmap(nullptr, this->mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+		if (addr == MAP_FAILED)
+		{
+			MS_THROW_ERROR("mmap() failed: %s", std::strerror(errno));
+		}
+
+		this->header = static_cast<Header*>(addr);
+		this->slots  = reinterpret_cast<Slot*>(static_cast<uint8_t*>(addr) + sizeof(Header));
+#endif
+	}
+} // namespace RTC
@@ -17,6 +17,69 @@ namespace RTC
 	};
 	// MAster length of AEAD_AES_256_GCM.
 	size_t PipeTransport::srtpMasterLength{ 44 };
+	// Datagram sent to the peer when it must read the shared memory ring. It
+	// cannot be confused with RTP, RTCP or SCTP.
+	static constexpr uint8_t ShmDoorbell[]{ 'M', 'S', 'S', 'H' };
+	// The doorbell is sent again with this interval while the peer does not
+	// read the shared memory ring, since the datagram may be lost.
+	static constexpr uint64_t ShmDoorbellRetryIntervalMs{ 20u };
+	// Max number of packets waiting for room in the shared memory ring. Further
+	// packets are dropped.
+	static constexpr size_t ShmMaxPendingPackets{ 1024u };
+	// Aggregated RTP packets travel as the payload of an RTP packet with this
+	// SSRC and payload type, each of them prefixed by its 2 bytes length. This
+	// way SRTP applies once per datagram.
+	static constexpr uint32_t AggregationSsrc{ 0x4D534147 }; // "MSAG".
+	static constexpr uint8_t AggregationPayloadType{ 127u };
+	static constexpr size_t AggregationHeaderLen{ 12u };
+	static constexpr size_t AggregationMinMaxSize{ RTC::MtuSize };
+	static constexpr size_t AggregationMaxMaxSize{ 65000u };
+	// Aggregated packets are copied here so they can be expanded in place.
+	thread_local static uint8_t AggregatedPacketBuffer[RTC::MtuSize + 100];
+
+	/* Class methods. */
+
+	/**
+	 * Calls onPacket() for every entry in the payload of an aggregated RTP
+	 * datagram. Returns false if the datagram is malformed (entries before the
+	 * malformed one are still passed).
+	 */
+	bool PipeTransport::ParseAggregatedRtpData(
+	  const uint8_t* data, size_t len, onAggregatedRtpPacket& onPacket)
+	{
+		MS_TRACE();
+
+		if (len < AggregationHeaderLen)
+		{
+			return false;
+		}
+
+		size_t offset{ AggregationHeaderLen };
+
+		while (offset < len)
+		{
+			// Truncated length prefix.
+			if (offset + 2 > len)
+			{
+				return false;
+			}
+
+			const size_t packetLen = Utils::Byte::Get2Bytes(data, offset);
+
+			offset += 2;
+
+			if (packetLen == 0u || packetLen > RTC::MtuSize || offset + packetLen > len)
+			{
+				return false;
+			}
+
+			onPacket(data + offset, packetLen);
+
+			offset += packetLen;
+		}
+
+		return true;
+	}
 
 	/* Instance methods. */
 
@@ -66,6 +129,21 @@ namespace RTC
 
 		this->rtx = options->enableRtx();
 
+		if (options->aggregationMaxSize() != 0u)
+		{
+			if (
+			  options->aggregationMaxSize() < AggregationMinMaxSize ||
+			  options->aggregationMaxSize() > AggregationMaxMaxSize)
+			{
+				MS_THROW_TYPE_ERROR(
+				  "invalid aggregationMaxSize (must be between %zu and %zu)",
+				  AggregationMinMaxSize,
+				  AggregationMaxMaxSize);
+			}
+
+			this->aggregationMaxSize = options->aggregationMaxSize();
+		}
+
 		if (options->enableSrtp())
 		{
 			this->srtpKey       = Utils::Crypto::GetRandomString(PipeTransport::srtpMasterLength);
@@ -96,6 +174,32 @@ namespace RTC
 				this->udpSocket->SetRecvBufferSize(this->listenInfo.recvBufferSize);
 			}
 
+			if (options->enableShm())
+			{
+				// Packets in the shared memory ring are not encrypted.
+				if (options->enableSrtp())
+				{
+					MS_THROW_TYPE_ERROR("enableShm and enableSrtp cannot be used together");
+				}
+
+				// NOTE: This may throw.
+				this->shmSendRing      = new RTC::PipeShmRing();
+				this->shmDoorbellTimer = new TimerHandle(this);
+			}
+
+			if (options->enableLocal())
+			{
+				// NOTE: This may throw.
+				this->localLink = new RTC::PipeLocalLink(this);
+			}
+
+			if (this->aggregationMaxSize != 0u)
+			{
+				// NOTE: This may throw.
+				this->aggregationCheckHandle = new CheckHandle(this);
+				this->aggregationBuffer      = new uint8_t[this->aggregationMaxSize];
+			}
+
 			MS_DEBUG_TAG(
 			  info,
 			  "UDP socket buffer sizes [send:%" PRIu32 ", recv:%" PRIu32 "]",
@@ -115,6 +219,18 @@ namespace RTC
 			delete this->udpSocket;
 			this->udpSocket = nullptr;
 
+			delete this->shmSendRing;
+			this->shmSendRing = nullptr;
+
+			delete this->shmDoorbellTimer;
+			this->shmDoorbellTimer = nullptr;
+
+			delete this->localLink;
+			this->localLink = nullptr;
+
+			delete this->aggregationCheckHandle;
+			this->aggregationCheckHandle = nullptr;
+
 			throw;
 		}
 	}
@@ -129,6 +245,13 @@ namespace RTC
 
 		this->shared->channelMessageRegistrator->UnregisterHandler(this->id);
 
+		// Send pending aggregated RTP packets while the tuple and the SRTP session
+		// still exist.
+		if (this->aggregationCheckHandle)
+		{
+			FlushAggregatedRtpPackets();
+		}
+
 		delete this->udpSocket;
 		this->udpSocket = nullptr;
 
@@ -140,6 +263,31 @@ namespace RTC
 
 		delete this->srtpRecvSession;
 		this->srtpRecvSession = nullptr;
+
+		delete this->shmDoorbellTimer;
+		this->shmDoorbellTimer = nullptr;
+
+		delete this->shmSendRing;
+		this->shmSendRing = nullptr;
+
+		delete this->shmRecvRing;
+		this->shmRecvRing = nullptr;
+
+		delete this->localLink;
+		this->localLink = nullptr;
+
+		delete this->aggregationCheckHandle;
+		this->aggregationCheckHandle = nullptr;
+
+		delete[] this->aggregationBuffer;
+		this->aggregationBuffer = nullptr;
+
+		for (auto* cb : this->aggregationCallbacks)
+		{
+			(*cb)(false);
+			delete cb;
+		}
+		this->aggregationCallbacks.clear();
 	}
 
 	flatbuffers::Offset<FBS::PipeTransport::DumpResponse> PipeTransport::FillBuffer(
@@ -190,7 +338,17 @@ namespace RTC
 		// Add base transport dump.
 		auto base = Transport::FillBuffer(builder);
 
-		return FBS::PipeTransport::CreateDumpResponse(builder, base, tuple, this->rtx, srtpParameters);
+		return FBS::PipeTransport::CreateDumpResponseDirect(
+		  builder,
+		  base,
+		  tuple,
+		  this->rtx,
+		  srtpParameters,
+		  this->shmSendRing ? this->shmSendRing->GetName().c_str() : nullptr,
+		  this->localLink ? this->localLink->GetName().c_str() : nullptr,
+		  static_cast<uint32_t>(this->aggregationMaxSize),
+		  this->aggregatedPacketsSent,
+		  this->aggregatedDatagramsSent);
 	}
 
 	flatbuffers::Offset<FBS::PipeTransport::GetStatsResponse> PipeTransport::FillBufferStats(
@@ -235,7 +393,18 @@ namespace RTC
 		// Base Transport stats.
 		auto base = Transport::FillBufferStats(builder);
 
-		return FBS::PipeTransport::CreateGetStatsResponse(builder, base, tuple);
+		return FBS::PipeTransport::CreateGetStatsResponse(
+		  builder,
+		  base,
+		  tuple,
+		  this->shmPacketsSent,
+		  this->shmPacketsReceived,
+		  this->aggregatedPacketsSent,
+		  this->aggregatedDatagramsSent,
+		  this->aggregatedPacketsReceived,
+		  this->aggregatedDatagramsReceived,
+		  this->localPacketsSent,
+		  this->localPacketsReceived);
 	}
 
 	void PipeTransport::HandleRequest(Channel::ChannelRequest* request)
@@ -371,6 +540,28 @@ namespace RTC
 
 					port = body->port().value();
 
+					if (flatbuffers::IsFieldPresent(body, FBS::PipeTransport::ConnectRequest::VT_SHMNAME))
+					{
+						if (!this->shmSendRing)
+						{
+							MS_THROW_TYPE_ERROR("invalid shmName (shared memory not enabled)");
+						}
+
+						// NOTE: This may throw.
+						this->shmRecvRing = new RTC::PipeShmRing(body->shmName()->str());
+					}
+
+					if (flatbuffers::IsFieldPresent(body, FBS::PipeTransport::ConnectRequest::VT_LOCALNAME))
+					{
+						if (!this->localLink)
+						{
+							MS_THROW_TYPE_ERROR("invalid localName (local link not enabled)");
+						}
+
+						// NOTE: This may throw.
+						this->localLink->Connect(body->localName()->str());
+					}
+
 					int err;
 
 					switch (Utils::IP::GetFamily(ip))
@@ -431,6 +622,9 @@ namespace RTC
 					delete this->srtpRecvSession;
 					this->srtpRecvSession = nullptr;
 
+					delete this->shmRecvRing;
+					this->shmRecvRing = nullptr;
+
 					throw;
 				}
 
@@ -490,6 +684,50 @@ namespace RTC
 			return;
 		}
 
+		// If the peer lives in this process hand it a copy of the packet. No need
+		// for SRTP nor parsing.
+		if (this->localLink && this->localLink->SendRtpPacket(packet))
+		{
+			++this->localPacketsSent;
+
+			if (cb)
+			{
+				(*cb)(true);
+				delete cb;
+			}
+
+			// Increase send transmission.
+			RTC::Transport::DataSent(packet->GetSize());
+
+			return;
+		}
+
+		// If the peer reads our shared memory ring write the packet there. No
+		// need for SRTP since it never leaves the host.
+		if (CanSendShmData(packet->GetSize()))
+		{
+			const bool sent = SendShmData(packet->GetData(), packet->GetSize());
+
+			if (cb)
+			{
+				(*cb)(sent);
+				delete cb;
+			}
+
+			if (sent)
+			{
+				// Increase send transmission.
+				RTC::Transport::DataSent(packet->GetSize());
+			}
+
+			return;
+		}
+
+		if (this->aggregationMaxSize != 0u && AggregateRtpPacket(packet, cb))
+		{
+			return;
+		}
+
 		const uint8_t* data = packet->GetData();
 		auto intLen         = static_cast<int>(packet->GetSize());
 
@@ -512,6 +750,195 @@ namespace RTC
 		RTC::Transport::DataSent(len);
 	}
 
+	/**
+	 * Appends the packet to the pending aggregated datagram, which is sent at
+	 * the end of the current loop iteration or once it gets full. Returns false
+	 * if the packet must be sent alone.
+	 */
+	bool PipeTransport::AggregateRtpPacket(RTC::RtpPacket* packet, RTC::Transport::onSendCallback* cb)
+	{
+		MS_TRACE();
+
+		const size_t maxLen =
+		  HasSrtp() ? this->aggregationMaxSize - SRTP_MAX_TRAILER_LEN : this->aggregationMaxSize;
+		const size_t len = packet->GetSize();
+
+		if (AggregationHeaderLen + 2 + len > maxLen)
+		{
+			// Keep packets in order.
+			FlushAggregatedRtpPackets();
+
+			return false;
+		}
+
+		if (this->aggregationLen + 2 + len > maxLen)
+		{
+			FlushAggregatedRtpPackets();
+		}
+
+		if (this->aggregationLen == 0u)
+		{
+			// RTP header (version 2, no padding, extension nor CSRCs).
+			this->aggregationBuffer[0] = 0x80;
+			this->aggregationBuffer[1] = AggregationPayloadType;
+			Utils::Byte::Set4Bytes(this->aggregationBuffer, 4, 0u);
+			Utils::Byte::Set4Bytes(this->aggregationBuffer, 8, AggregationSsrc);
+
+			this->aggregationLen = AggregationHeaderLen;
+
+			this->aggregationCheckHandle->Start();
+		}
+
+		Utils::Byte::Set2Bytes(this->aggregationBuffer, this->aggregationLen, static_cast<uint16_t>(len));
+		std::memcpy(this->aggregationBuffer + this->aggregationLen + 2, packet->GetData(), len);
+
+		this->aggregationLen += 2 + len;
+		++this->aggregationNumPackets;
+
+		if (cb)
+		{
+			this->aggregationCallbacks.push_back(cb);
+		}
+
+		return true;
+	}
+
+	void PipeTransport::FlushAggregatedRtpPackets()
+	{
+		MS_TRACE();
+
+		if (this->aggregationNumPackets == 0u)
+		{
+			return;
+		}
+
+		const uint8_t* data;
+		size_t len;
+
+		// Not worth aggregating a single packet.
+		if (this->aggregationNumPackets == 1u)
+		{
+			data = this->aggregationBuffer + AggregationHeaderLen + 2;
+			len  = this->aggregationLen - AggregationHeaderLen - 2;
+		}
+		else
+		{
+			Utils::Byte::Set2Bytes(this->aggregationBuffer, 2, this->aggregationSeq++);
+
+			data = this->aggregationBuffer;
+			len  = this->aggregationLen;
+
+			this->aggregatedPacketsSent += this->aggregationNumPackets;
+			++this->aggregatedDatagramsSent;
+		}
+
+		RTC::Transport::onSendCallback* onSend{ nullptr };
+
+		if (!this->aggregationCallbacks.empty())
+		{
+			onSend = new RTC::Transport::onSendCallback(
+			  [callbacks = std::move(this->aggregationCallbacks)](bool sent)
+			  {
+				  for (auto* cb : callbacks)
+				  {
+					  (*cb)(sent);
+					  delete cb;
+				  }
+			  });
+
+			this->aggregationCallbacks.clear();
+		}
+
+		this->aggregationLen        = 0u;
+		this->aggregationNumPackets = 0u;
+
+		this->aggregationCheckHandle->Stop();
+
+		auto intLen = static_cast<int>(len);
+
+		if (HasSrtp() && !this->srtpSendSession->EncryptRtp(&data, &intLen))
+		{
+			if (onSend)
+			{
+				(*onSend)(false);
+				delete onSend;
+			}
+
+			return;
+		}
+
+		len = static_cast<size_t>(intLen);
+
+		this->tuple->Send(data, len, onSend);
+
+		// Increase send transmission.
+		RTC::Transport::DataSent(len);
+	}
+
+	inline bool PipeTransport::CanSendShmData(size_t len) const
+	{
+		return this->shmSendRing && this->shmSendRing->IsConsumerAttached() && len <= RTC::MtuSize;
+	}
+
+	/**
+	 * Writes the data into the shared memory ring or, if it is full, queues it
+	 * until the peer makes room. Returns false if the data was dropped.
+	 */
+	bool PipeTransport::SendShmData(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		// Queued packets go first.
+		WriteShmPendingPackets();
+
+		if (this->shmPendingPackets.empty() && this->shmSendRing->Write(data, len))
+		{
+			++this->shmPacketsSent;
+		}
+		else if (this->shmPendingPackets.size() < ShmMaxPendingPackets)
+		{
+			this->shmPendingPackets.emplace_back(data, data + len);
+		}
+		else
+		{
+			MS_WARN_DEV("shared memory ring full and too many pending packets, dropping packet");
+
+			return false;
+		}
+
+		if (this->shmSendRing->ShouldWakeUpConsumer())
+		{
+			this->tuple->Send(ShmDoorbell, sizeof(ShmDoorbell));
+		}
+
+		// Watch the ring until the peer reads it.
+		if (!this->shmDoorbellTimer->IsActive())
+		{
+			this->shmDoorbellTimer->Start(ShmDoorbellRetryIntervalMs, ShmDoorbellRetryIntervalMs);
+		}
+
+		return true;
+	}
+
+	void PipeTransport::WriteShmPendingPackets()
+	{
+		MS_TRACE();
+
+		while (!this->shmPendingPackets.empty())
+		{
+			const auto& data = this->shmPendingPackets.front();
+
+			if (!this->shmSendRing->Write(data.data(), data.size()))
+			{
+				break;
+			}
+
+			++this->shmPacketsSent;
+
+			this->shmPendingPackets.pop_front();
+		}
+	}
+
 	void PipeTransport::SendRtcpPacket(RTC::RTCP::Packet* packet)
 	{
 		MS_TRACE();
@@ -521,9 +948,33 @@ namespace RTC
 			return;
 		}
 
+		// RTCP (such as a SR) must not overtake the RTP packets sent before it.
+		FlushAggregatedRtpPackets();
+
 		const uint8_t* data = packet->GetData();
 		auto intLen         = static_cast<int>(packet->GetSize());
 
+		if (this->localLink && this->localLink->SendRtcp(data, packet->GetSize()))
+		{
+			// Increase send transmission.
+			RTC::Transport::DataSent(packet->GetSize());
+
+			return;
+		}
+
+		// RTCP must not overtake the RTP packets written into the shared memory
+		// ring.
+		if (CanSendShmData(packet->GetSize()))
+		{
+			if (SendShmData(data, packet->GetSize()))
+			{
+				// Increase send transmission.
+				RTC::Transport::DataSent(packet->GetSize());
+			}
+
+			return;
+		}
+
 		if (HasSrtp() && !this->srtpSendSession->EncryptRtcp(&data, &intLen))
 		{
 			return;
@@ -546,11 +997,35 @@ namespace RTC
 			return;
 		}
 
+		// RTCP (such as a SR) must not overtake the RTP packets sent before it.
+		FlushAggregatedRtpPackets();
+
 		packet->Serialize(RTC::RTCP::Buffer);
 
 		const uint8_t* data = packet->GetData();
 		auto intLen         = static_cast<int>(packet->GetSize());
 
+		if (this->localLink && this->localLink->SendRtcp(data, packet->GetSize()))
+		{
+			// Increase send transmission.
+			RTC::Transport::DataSent(packet->GetSize());
+
+			return;
+		}
+
+		// RTCP must not overtake the RTP packets written into the shared memory
+		// ring.
+		if (CanSendShmData(packet->GetSize()))
+		{
+			if (SendShmData(data, packet->GetSize()))
+			{
+				// Increase send transmission.
+				RTC::Transport::DataSent(packet->GetSize());
+			}
+
+			return;
+		}
+
 		if (HasSrtp() && !this->srtpSendSession->EncryptRtcp(&data, &intLen))
 		{
 			return;
@@ -610,6 +1085,19 @@ namespace RTC
 	inline void PipeTransport::OnPacketReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
+
+		// Check if the peer wrote into its shared memory ring. The doorbell is
+		// never passed up, even if we don't read the ring (yet).
+		if (len == sizeof(ShmDoorbell) && std::memcmp(data, ShmDoorbell, sizeof(ShmDoorbell)) == 0)
+		{
+			if (this->shmRecvRing)
+			{
+				ReadShmRing();
+			}
+
+			return;
+		}
 
 		// Increase receive transmission.
 		RTC::Transport::DataReceived(len);
@@ -670,6 +1158,26 @@ namespace RTC
 			return;
 		}
 
+		// Check if it contains aggregated RTP packets (just if aggregation is
+		// enabled, otherwise it's a regular RTP packet).
+		if (
+		  this->aggregationMaxSize != 0u && intLen >= static_cast<int>(AggregationHeaderLen) &&
+		  Utils::Byte::Get4Bytes(data, 8) == AggregationSsrc &&
+		  (data[1] & 0x7F) == AggregationPayloadType)
+		{
+			// Verify that the packet's tuple matches our tuple.
+			if (!this->tuple->Compare(tuple))
+			{
+				MS_DEBUG_TAG(rtp, "ignoring aggregated RTP packets from unknown IP:port");
+
+				return;
+			}
+
+			OnAggregatedRtpDataReceived(data, static_cast<size_t>(intLen));
+
+			return;
+		}
+
 		RTC::RtpPacket* packet = RTC::RtpPacket::Parse(data, static_cast<size_t>(intLen));
 
 		if (!packet)
@@ -757,6 +1265,100 @@ namespace RTC
 		RTC::Transport::ReceiveSctpData(data, len);
 	}
 
+	inline void PipeTransport::OnAggregatedRtpDataReceived(const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		++this->aggregatedDatagramsReceived;
+
+		const onAggregatedRtpPacket onPacket = [this](const uint8_t* data, size_t len)
+		{
+			std::memcpy(AggregatedPacketBuffer, data, len);
+
+			RTC::RtpPacket* packet = RTC::RtpPacket::Parse(AggregatedPacketBuffer, len);
+
+			if (!packet)
+			{
+				MS_WARN_TAG(rtp, "aggregated data is not a valid RTP packet");
+
+				return;
+			}
+
+			++this->aggregatedPacketsReceived;
+
+			// Pass the packet to the parent transport.
+			RTC::Transport::ReceiveRtpPacket(packet);
+		};
+
+		if (!PipeTransport::ParseAggregatedRtpData(data, len, onPacket))
+		{
+			MS_WARN_TAG(rtp, "invalid aggregated RTP datagram [len:%zu]", len);
+		}
+	}
+
+	inline void PipeTransport::ReadShmRing()
+	{
+		MS_TRACE();
+
+		const RTC::PipeShmRing::onDataCallback onData = [this](uint8_t* data, size_t len)
+		{ OnShmDataReceived(data, len); };
+
+		// Read until the ring is empty and the peer knows we are waiting for the
+		// next doorbell.
+		do
+		{
+			this->shmRecvRing->Read(onData);
+		} while (!this->shmRecvRing->Sleep());
+	}
+
+	inline void PipeTransport::OnShmDataReceived(uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		// Increase receive transmission.
+		RTC::Transport::DataReceived(len);
+
+		if (!IsConnected())
+		{
+			return;
+		}
+
+		// Check if it's RTCP.
+		if (RTC::RTCP::Packet::IsRtcp(data, len))
+		{
+			RTC::RTCP::Packet* packet = RTC::RTCP::Packet::Parse(data, len);
+
+			if (!packet)
+			{
+				MS_WARN_TAG(
+				  rtcp, "received shared memory data is not a valid RTCP compound or single packet");
+
+				return;
+			}
+
+			// Pass the packet to the parent transport.
+			RTC::Transport::ReceiveRtcpPacket(packet);
+
+			return;
+		}
+
+		// NOTE: The packet is parsed in place. It's deleted by the parent
+		// transport before the slot is released.
+		RTC::RtpPacket* packet = RTC::RtpPacket::Parse(data, len);
+
+		if (!packet)
+		{
+			MS_WARN_TAG(rtp, "received shared memory data is not a valid RTP packet");
+
+			return;
+		}
+
+		++this->shmPacketsReceived;
+
+		// Pass the packet to the parent transport.
+		RTC::Transport::ReceiveRtpPacket(packet);
+	}
+
 	inline void PipeTransport::OnUdpSocketPacketReceived(
 	  RTC::UdpSocket* socket, const uint8_t* data, size_t len, const struct sockaddr* remoteAddr)
 	{
@@ -766,4 +1368,103 @@ namespace RTC
 
 		OnPacketReceived(&tuple, data, len);
 	}
+
+	inline void PipeTransport::OnPipeLocalLinkRtpPacketReceived(
+	  RTC::PipeLocalLink* /*link*/, RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		// Increase receive transmission.
+		RTC::Transport::DataReceived(packet->GetSize());
+
+		if (!IsConnected())
+		{
+			delete packet;
+
+			return;
+		}
+
+		++this->localPacketsReceived;
+
+		// Pass the packet to the parent transport.
+		RTC::Transport::ReceiveRtpPacket(packet);
+	}
+
+	inline void PipeTransport::OnPipeLocalLinkRtcpDataReceived(
+	  RTC::PipeLocalLink* /*link*/, const uint8_t* data, size_t len)
+	{
+		MS_TRACE();
+
+		// Increase receive transmission.
+		RTC::Transport::DataReceived(len);
+
+		if (!IsConnected())
+		{
+			return;
+		}
+
+		RTC::RTCP::Packet* packet = RTC::RTCP::Packet::Parse(data, len);
+
+		if (!packet)
+		{
+			MS_WARN_TAG(rtcp, "received local data is not a valid RTCP compound or single packet");
+
+			return;
+		}
+
+		// Pass the packet to the parent transport.
+		RTC::Transport::ReceiveRtcpPacket(packet);
+	}
+
+	inline void PipeTransport::OnCheck(CheckHandle* /*check*/)
+	{
+		MS_TRACE();
+
+		FlushAggregatedRtpPackets();
+	}
+
+	void PipeTransport::OnTimer(TimerHandle* timer)
+	{
+		MS_TRACE();
+
+		if (timer != this->shmDoorbellTimer)
+		{
+			RTC::Transport::OnTimer(timer);
+
+			return;
+		}
+
+		// The peer closed the ring, nobody will read pending packets.
+		if (!this->shmSendRing->IsConsumerAttached())
+		{
+			this->shmPendingPackets.clear();
+			this->shmDoorbellTimer->Stop();
+
+			return;
+		}
+
+		WriteShmPendingPackets();
+
+		if (!this->shmSendRing->HasUnreadPackets() && this->shmPendingPackets.empty())
+		{
+			this->shmDoorbellTimer->Stop();
+
+			return;
+		}
+
+		if (this->shmSendRing->ShouldWakeUpConsumer())
+		{
+			this->tuple->Send(ShmDoorbell, sizeof(ShmDoorbell));
+
+			return;
+		}
+
+		// The peer is sleeping on a lost doorbell (or busy), ring it again.
+		if (this->shmSendRing->IsConsumerStalled())
+		{
+			MS_DEBUG_DEV("shared memory ring not being read, sending doorbell again");
+
+			this->tuple->Send(ShmDoorbell, sizeof(ShmDoorbell));
+		}
+	}
 } // namespace RTC
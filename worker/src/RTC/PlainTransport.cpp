@@ -911,6 +911,7 @@ namespace RTC
 	inline void PlainTransport::OnPacketReceived(RTC::TransportTuple* tuple, const uint8_t* data, size_t len)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		// Increase receive transmission.
 		RTC::Transport::DataReceived(len);
@@ -9,6 +9,17 @@
 #include "Utils.hpp"
 #include <tuple>   // std:make_tuple()
 #include <utility> // std::piecewise_construct
+#ifndef _WIN32
+#include <sys/socket.h> // recv()
+#endif
+
+/* Static. */
+
+// Maximum number of sockets bound by the UdpSocketPool in a loop iteration.
+static constexpr size_t UdpSocketPoolMaxRefillsPerIteration{ 4u };
+// Max number of datagrams discarded from a taken UDP socket. If there are more
+// the socket is being flooded and it's replaced.
+static constexpr size_t UdpSocketPoolMaxDrainedDatagrams{ 256u };
 
 /* Static methods for UV callbacks. */
 
@@ -29,15 +40,96 @@ inline static void onFakeConnection(uv_stream_t* /*handle*/, int /*status*/)
 	// Do nothing.
 }
 
+/**
+ * Discards the datagrams queued in a UDP socket that was not being read.
+ * Returns false if it could not be fully drained.
+ */
+static bool drainUdpSocket(uv_udp_t* uvHandle)
+{
+#ifdef _WIN32
+	// NOTE: Not implemented on Windows, the transport gets those datagrams.
+	return true;
+#else
+	uv_os_fd_t fd;
+
+	if (uv_fileno(reinterpret_cast<uv_handle_t*>(uvHandle), &fd) != 0)
+	{
+		return true;
+	}
+
+	// NOTE: The rest of a datagram longer than this buffer is discarded.
+	uint8_t buffer[4];
+
+	for (size_t i{ 0u }; i < UdpSocketPoolMaxDrainedDatagrams; ++i)
+	{
+		// No more datagrams (EAGAIN) or error.
+		if (recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT) < 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+#endif
+}
+
 namespace RTC
 {
 	/* Class variables. */
 
-	thread_local absl::flat_hash_map<std::string, std::vector<bool>> PortManager::mapUdpIpPorts;
-	thread_local absl::flat_hash_map<std::string, std::vector<bool>> PortManager::mapTcpIpPorts;
+	thread_local absl::flat_hash_map<std::string, PortManager::FreePorts> PortManager::mapUdpIpPorts;
+	thread_local absl::flat_hash_map<std::string, PortManager::FreePorts> PortManager::mapTcpIpPorts;
+	thread_local PortManager::UdpSocketPool* PortManager::udpSocketPool{ nullptr };
 
 	/* Class methods. */
 
+	void PortManager::CreateUdpSocketPool()
+	{
+		MS_TRACE();
+
+		if (Settings::configuration.udpSocketPoolSize == 0u)
+		{
+			return;
+		}
+
+		MS_ASSERT(PortManager::udpSocketPool == nullptr, "UdpSocketPool already created");
+
+		PortManager::udpSocketPool = new UdpSocketPool(Settings::configuration.udpSocketPoolSize);
+	}
+
+	void PortManager::CloseUdpSocketPool()
+	{
+		MS_TRACE();
+
+		delete PortManager::udpSocketPool;
+		PortManager::udpSocketPool = nullptr;
+	}
+
+	flatbuffers::Offset<FBS::Worker::UdpSocketPoolDump> PortManager::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder)
+	{
+		MS_TRACE();
+
+		if (!PortManager::udpSocketPool)
+		{
+			return 0;
+		}
+
+		return PortManager::udpSocketPool->FillBuffer(builder);
+	}
+
+	uv_udp_t* PortManager::BindUdp(std::string& ip)
+	{
+		MS_TRACE();
+
+		if (PortManager::udpSocketPool)
+		{
+			return PortManager::udpSocketPool->Take(ip);
+		}
+
+		return reinterpret_cast<uv_udp_t*>(Bind(Transport::UDP, ip));
+	}
+
 	uv_handle_t* PortManager::Bind(Transport transport, std::string& ip)
 	{
 		MS_TRACE();
@@ -48,11 +140,12 @@ namespace RTC
 		int err;
 		const int family = Utils::IP::GetFamily(ip);
 		struct sockaddr_storage bindAddr; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		size_t pos;
 		size_t portIdx;
 		int flags{ 0 };
-		std::vector<bool>& ports = PortManager::GetPorts(transport, ip);
+		FreePorts& ports = PortManager::GetPorts(transport, ip);
 		size_t attempt{ 0u };
-		const size_t numAttempts = ports.size();
+		const size_t numAttempts = ports.GetSize();
 		uv_handle_t* uvHandle{ nullptr };
 		uint16_t port;
 		std::string transportStr;
@@ -104,12 +197,18 @@ namespace RTC
 			}
 		}
 
-		// Choose a random port index to start from.
-		portIdx = static_cast<size_t>(Utils::Crypto::GetRandomUInt(
-		  static_cast<uint32_t>(0), static_cast<uint32_t>(ports.size() - 1)));
+		if (numAttempts == 0u)
+		{
+			MS_THROW_ERROR(
+			  "no more available ports [transport:%s, ip:'%s']", transportStr.c_str(), ip.c_str());
+		}
+
+		// Choose a random position in the available ports to start from.
+		pos = static_cast<size_t>(Utils::Crypto::GetRandomUInt(
+		  static_cast<uint32_t>(0), static_cast<uint32_t>(numAttempts - 1)));
 
-		// Iterate all ports until getting one available. Fail if none found and also
-		// if bind() fails N times in theoretically available ports.
+		// Iterate the available ports until bind() succeeds in one of them. Fail if
+		// it fails in all of them (other processes may be using them).
 		while (true)
 		{
 			// Increase attempt number.
@@ -125,10 +224,12 @@ namespace RTC
 				  numAttempts);
 			}
 
-			// Increase current port index.
-			portIdx = (portIdx + 1) % ports.size();
+			// Increase current position. Available ports do not change until the
+			// loop exits.
+			pos     = (pos + 1) % numAttempts;
+			portIdx = ports.Get(pos);
 
-			// So the corresponding port is the vector position plus the RTC minimum port.
+			// So the corresponding port is the port index plus the RTC minimum port.
 			port = static_cast<uint16_t>(portIdx + Settings::configuration.rtcMinPort);
 
 			MS_DEBUG_DEV(
@@ -139,20 +240,6 @@ namespace RTC
 			  attempt,
 			  numAttempts);
 
-			// Check whether this port is not available.
-			if (ports[portIdx])
-			{
-				MS_DEBUG_DEV(
-				  "port in use, trying again [transport:%s, ip:'%s', port:%" PRIu16 ", attempt:%zu/%zu]",
-				  transportStr.c_str(),
-				  ip.c_str(),
-				  port,
-				  attempt,
-				  numAttempts);
-
-				continue;
-			}
-
 			// Here we already have a theoretically available port. Now let's check
 			// whether no other process is binding into it.
 
@@ -343,7 +430,7 @@ namespace RTC
 		}
 
 		// If here, we got an available port. Mark it as unavailable.
-		ports[portIdx] = true;
+		ports.Take(portIdx);
 
 		MS_DEBUG_DEV(
 		  "bind succeeded [transport:%s, ip:'%s', port:%" PRIu16 ", attempt:%zu/%zu]",
@@ -575,7 +662,7 @@ namespace RTC
 				auto& ports = it->second;
 
 				// Mark the port as available.
-				ports[portIdx] = false;
+				ports.Release(portIdx);
 
 				break;
 			}
@@ -592,20 +679,20 @@ namespace RTC
 				auto& ports = it->second;
 
 				// Mark the port as available.
-				ports[portIdx] = false;
+				ports.Release(portIdx);
 
 				break;
 			}
 		}
 	}
 
-	std::vector<bool>& PortManager::GetPorts(Transport transport, const std::string& ip)
+	PortManager::FreePorts& PortManager::GetPorts(Transport transport, const std::string& ip)
 	{
 		MS_TRACE();
 
 		// Make GCC happy so it does not print:
 		// "control reaches end of non-void function [-Wreturn-type]"
-		static std::vector<bool> emptyPorts;
+		static FreePorts emptyPorts(0u);
 
 		switch (transport)
 		{
@@ -622,13 +709,12 @@ namespace RTC
 				}
 
 				// Otherwise add an entry in the map and return it.
-				const uint16_t numPorts =
+				const size_t numPorts =
 				  Settings::configuration.rtcMaxPort - Settings::configuration.rtcMinPort + 1;
 
-				// Emplace a new vector filled with numPorts false values, meaning that
-				// all ports are available.
+				// Emplace a new set with all ports available.
 				auto pair = PortManager::mapUdpIpPorts.emplace(
-				  std::piecewise_construct, std::make_tuple(ip), std::make_tuple(numPorts, false));
+				  std::piecewise_construct, std::make_tuple(ip), std::make_tuple(numPorts));
 
 				// pair.first is an iterator to the inserted value.
 				auto& ports = pair.first->second;
@@ -649,13 +735,12 @@ namespace RTC
 				}
 
 				// Otherwise add an entry in the map and return it.
-				const uint16_t numPorts =
+				const size_t numPorts =
 				  Settings::configuration.rtcMaxPort - Settings::configuration.rtcMinPort + 1;
 
-				// Emplace a new vector filled with numPorts false values, meaning that
-				// all ports are available.
+				// Emplace a new set with all ports available.
 				auto pair = PortManager::mapTcpIpPorts.emplace(
-				  std::piecewise_construct, std::make_tuple(ip), std::make_tuple(numPorts, false));
+				  std::piecewise_construct, std::make_tuple(ip), std::make_tuple(numPorts));
 
 				// pair.first is an iterator to the inserted value.
 				auto& ports = pair.first->second;
@@ -666,4 +751,216 @@ namespace RTC
 
 		return emptyPorts;
 	}
+
+	/* Instance methods of FreePorts. */
+
+	PortManager::FreePorts::FreePorts(size_t numPorts) : freePortIdxs(numPorts), positions(numPorts)
+	{
+		MS_TRACE();
+
+		for (size_t portIdx{ 0u }; portIdx < numPorts; ++portIdx)
+		{
+			this->freePortIdxs[portIdx] = static_cast<uint32_t>(portIdx);
+			this->positions[portIdx]    = static_cast<uint32_t>(portIdx);
+		}
+	}
+
+	void PortManager::FreePorts::Take(size_t portIdx)
+	{
+		MS_TRACE();
+
+		const auto pos = this->positions[portIdx];
+
+		if (pos == Taken)
+		{
+			return;
+		}
+
+		// Move the last available port to the position of the taken one.
+		const auto lastPortIdx = this->freePortIdxs.back();
+
+		this->freePortIdxs[pos]      = lastPortIdx;
+		this->positions[lastPortIdx] = pos;
+		this->positions[portIdx]     = Taken;
+
+		this->freePortIdxs.pop_back();
+	}
+
+	void PortManager::FreePorts::Release(size_t portIdx)
+	{
+		MS_TRACE();
+
+		if (this->positions[portIdx] != Taken)
+		{
+			return;
+		}
+
+		this->positions[portIdx] = static_cast<uint32_t>(this->freePortIdxs.size());
+
+		this->freePortIdxs.push_back(static_cast<uint32_t>(portIdx));
+	}
+
+	/* Instance methods of UdpSocketPool. */
+
+	PortManager::UdpSocketPool::UdpSocketPool(size_t size) : size(size)
+	{
+		MS_TRACE();
+
+		this->checkHandle = new CheckHandle(this);
+	}
+
+	PortManager::UdpSocketPool::~UdpSocketPool()
+	{
+		MS_TRACE();
+
+		delete this->checkHandle;
+
+		for (auto& kv : this->mapIpSockets)
+		{
+			auto ip       = kv.first;
+			auto& sockets = kv.second;
+
+			for (auto* uvHandle : sockets)
+			{
+				UdpSocketPool::Close(ip, uvHandle);
+			}
+		}
+		this->mapIpSockets.clear();
+	}
+
+	uv_udp_t* PortManager::UdpSocketPool::Take(std::string& ip)
+	{
+		MS_TRACE();
+
+		// First normalize the IP. This may throw if invalid IP.
+		Utils::IP::NormalizeIp(ip);
+
+		auto& sockets = this->mapIpSockets[ip];
+		uv_udp_t* uvHandle{ nullptr };
+
+		if (!sockets.empty())
+		{
+			uvHandle = sockets.back();
+
+			sockets.pop_back();
+
+			// Don't pass stale datagrams to the transport.
+			if (drainUdpSocket(uvHandle))
+			{
+				++this->hits;
+			}
+			else
+			{
+				MS_WARN_TAG(ice, "pooled UDP socket flooded, replacing it [ip:'%s']", ip.c_str());
+
+				UdpSocketPool::Close(ip, uvHandle);
+
+				// May throw.
+				uvHandle = reinterpret_cast<uv_udp_t*>(PortManager::Bind(Transport::UDP, ip));
+
+				++this->misses;
+			}
+		}
+		else
+		{
+			// May throw.
+			uvHandle = reinterpret_cast<uv_udp_t*>(PortManager::Bind(Transport::UDP, ip));
+
+			++this->misses;
+		}
+
+		// Replace the socket at the end of this loop iteration.
+		if (!this->checkHandle->IsActive())
+		{
+			this->checkHandle->Start();
+		}
+
+		return uvHandle;
+	}
+
+	flatbuffers::Offset<FBS::Worker::UdpSocketPoolDump> PortManager::UdpSocketPool::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder) const
+	{
+		MS_TRACE();
+
+		size_t available{ 0u };
+
+		for (const auto& kv : this->mapIpSockets)
+		{
+			available += kv.second.size();
+		}
+
+		return FBS::Worker::CreateUdpSocketPoolDump(
+		  builder,
+		  static_cast<uint32_t>(this->size),
+		  static_cast<uint32_t>(available),
+		  this->hits,
+		  this->misses);
+	}
+
+	void PortManager::UdpSocketPool::OnCheck(CheckHandle* /*check*/)
+	{
+		MS_TRACE();
+
+		size_t numRefills{ 0u };
+
+		for (auto& kv : this->mapIpSockets)
+		{
+			auto ip       = kv.first;
+			auto& sockets = kv.second;
+
+			while (sockets.size() < this->size)
+			{
+				if (numRefills == UdpSocketPoolMaxRefillsPerIteration)
+				{
+					// Go on in the next iteration.
+					return;
+				}
+
+				try
+				{
+					sockets.push_back(reinterpret_cast<uv_udp_t*>(PortManager::Bind(Transport::UDP, ip)));
+				}
+				catch (const MediaSoupError& error)
+				{
+					// No ports available, let transports bind on demand. Refilling is
+					// retried once a socket is taken again.
+					MS_WARN_TAG(
+					  ice, "failed to refill UDP socket pool [ip:'%s']: %s", ip.c_str(), error.what());
+
+					break;
+				}
+
+				++numRefills;
+			}
+		}
+
+		// Every pool is full (or cannot be refilled).
+		this->checkHandle->Stop();
+	}
+
+	void PortManager::UdpSocketPool::Close(std::string& ip, uv_udp_t* uvHandle)
+	{
+		MS_TRACE();
+
+		int err;
+		struct sockaddr_storage localAddr; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		int len = sizeof(localAddr);
+
+		err = uv_udp_getsockname(uvHandle, reinterpret_cast<struct sockaddr*>(&localAddr), &len);
+
+		if (err == 0)
+		{
+			int family;
+			uint16_t port;
+			std::string localIp;
+
+			Utils::IP::GetAddressInfo(
+			  reinterpret_cast<const struct sockaddr*>(&localAddr), family, localIp, port);
+
+			PortManager::Unbind(Transport::UDP, ip, port);
+		}
+
+		uv_close(reinterpret_cast<uv_handle_t*>(uvHandle), static_cast<uv_close_cb>(onCloseUdp));
+	}
 } // namespace RTC
@@ -5,6 +5,7 @@
 #include "DepLibUV.hpp"
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include "Utils.hpp"
 #include "RTC/Codecs/Tools.hpp"
 #include "RTC/RTCP/FeedbackPs.hpp"
@@ -200,6 +201,60 @@ namespace RTC
 			}
 		}
 
+		// Compile the header extensions rewrite plan used when mangling packets.
+		{
+			auto& plan = this->headerExtensionRewritePlan;
+
+			// Add urn:ietf:params:rtp-hdrext:sdes:mid.
+			plan.AddZeroed(static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::MID), RTC::MidMaxLength);
+
+			// Proxy http://www.webrtc.org/experiments/rtp-hdrext/abs-capture-time.
+			plan.AddProxied(
+			  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_CAPTURE_TIME),
+			  this->rtpHeaderExtensionIds.absCaptureTime);
+
+			if (this->kind == RTC::Media::Kind::AUDIO)
+			{
+				// Proxy urn:ietf:params:rtp-hdrext:ssrc-audio-level.
+				plan.AddProxied(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::SSRC_AUDIO_LEVEL),
+				  this->rtpHeaderExtensionIds.ssrcAudioLevel);
+			}
+			else if (this->kind == RTC::Media::Kind::VIDEO)
+			{
+				// Add http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time.
+				// NOTE: This is for REMB. The sending Transport will update it.
+				plan.AddZeroed(static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME), 3u);
+
+				// Add http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01.
+				// NOTE: We don't include it in outbound audio packets for now. The
+				// sending Transport will update it.
+				plan.AddZeroed(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01), 2u);
+
+				// NOTE: Remove this once framemarking draft becomes RFC.
+				// Proxy http://tools.ietf.org/html/draft-ietf-avtext-framemarking-07.
+				plan.AddProxied(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::FRAME_MARKING_07),
+				  this->rtpHeaderExtensionIds.frameMarking07);
+
+				// Proxy urn:ietf:params:rtp-hdrext:framemarking.
+				plan.AddProxied(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::FRAME_MARKING),
+				  this->rtpHeaderExtensionIds.frameMarking);
+
+				// Proxy urn:3gpp:video-orientation.
+				plan.AddProxied(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::VIDEO_ORIENTATION),
+				  this->rtpHeaderExtensionIds.videoOrientation);
+
+				// Proxy urn:ietf:params:rtp-hdrext:toffset.
+				plan.AddProxied(
+				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TOFFSET),
+				  this->rtpHeaderExtensionIds.toffset);
+			}
+		}
+
 		// Set the RTCP report generation interval.
 		if (this->kind == RTC::Media::Kind::AUDIO)
 		{
@@ -216,6 +271,8 @@ namespace RTC
 			auto keyFrameRequestDelay = data->keyFrameRequestDelay();
 
 			this->keyFrameRequestManager = new RTC::KeyFrameRequestManager(this, keyFrameRequestDelay);
+
+			this->keyFrameCacheEnabled = data->keyFrameCache();
 		}
 
 		// NOTE: This may throw.
@@ -561,6 +618,7 @@ namespace RTC
 	Producer::ReceiveRtpPacketResult Producer::ReceiveRtpPacket(RTC::RtpPacket* packet)
 	{
 		MS_TRACE();
+		MS_PROFILE_STAGE(PRODUCER_RECEIVE);
 
 		packet->logger.producerId = this->id;
 
@@ -678,6 +736,14 @@ namespace RTC
 		// Post-process the packet.
 		PostProcessRtpPacket(packet);
 
+		// Keep the most recent key frame (and following frames) for new Consumers.
+		auto* keyFrameCache = rtpStream->GetKeyFrameCache();
+
+		if (keyFrameCache)
+		{
+			keyFrameCache->Insert(packet);
+		}
+
 		this->listener->OnProducerRtpPacketReceived(this, packet);
 
 		return result;
@@ -1049,6 +1115,34 @@ namespace RTC
 		return nullptr;
 	}
 
+	RTC::KeyFrameCache* Producer::GetKeyFrameCache(uint32_t mappedSsrc) const
+	{
+		MS_TRACE();
+
+		if (this->paused)
+		{
+			return nullptr;
+		}
+
+		auto it = this->mapMappedSsrcSsrc.find(mappedSsrc);
+
+		if (it == this->mapMappedSsrcSsrc.end())
+		{
+			return nullptr;
+		}
+
+		auto it2 = this->mapSsrcRtpStream.find(it->second);
+
+		if (it2 == this->mapSsrcRtpStream.end())
+		{
+			return nullptr;
+		}
+
+		auto* rtpStream = it2->second;
+
+		return rtpStream->GetKeyFrameCache();
+	}
+
 	RTC::RtpStreamRecv* Producer::CreateRtpStream(
 	  RTC::RtpPacket* packet, const RTC::RtpCodecParameters& mediaCodec, size_t encodingIdx)
 	{
@@ -1141,6 +1235,11 @@ namespace RTC
 		// Create a RtpStreamRecv for receiving a media stream.
 		auto* rtpStream = new RTC::RtpStreamRecv(this, params, SendNackDelay, useRtpInactivityCheck);
 
+		if (this->keyFrameCacheEnabled)
+		{
+			rtpStream->EnableKeyFrameCache();
+		}
+
 		// Insert into the maps.
 		this->mapSsrcRtpStream[ssrc]              = rtpStream;
 		this->rtpStreamByEncodingIdx[encodingIdx] = rtpStream;
@@ -1214,161 +1313,8 @@ namespace RTC
 
 		// Mangle RTP header extensions.
 		{
-			thread_local static uint8_t buffer[4096];
-			thread_local static std::vector<RTC::RtpPacket::GenericExtension> extensions;
-
-			// This happens just once.
-			if (extensions.capacity() != 24)
-			{
-				extensions.reserve(24);
-			}
-
-			extensions.clear();
-
-			uint8_t* extenValue;
-			uint8_t extenLen;
-			uint8_t* bufferPtr{ buffer };
-
-			// Add urn:ietf:params:rtp-hdrext:sdes:mid.
-			{
-				extenLen = RTC::MidMaxLength;
-
-				extensions.emplace_back(
-				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::MID), extenLen, bufferPtr);
-
-				bufferPtr += extenLen;
-			}
-
-			// Proxy http://www.webrtc.org/experiments/rtp-hdrext/abs-capture-time.
-			extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.absCaptureTime, extenLen);
-
-			if (extenValue)
-			{
-				std::memcpy(bufferPtr, extenValue, extenLen);
-
-				extensions.emplace_back(
-				  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_CAPTURE_TIME),
-				  extenLen,
-				  bufferPtr);
-
-				bufferPtr += extenLen;
-			}
-
-			if (this->kind == RTC::Media::Kind::AUDIO)
-			{
-				// Proxy urn:ietf:params:rtp-hdrext:ssrc-audio-level.
-				extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.ssrcAudioLevel, extenLen);
-
-				if (extenValue)
-				{
-					std::memcpy(bufferPtr, extenValue, extenLen);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::SSRC_AUDIO_LEVEL),
-					  extenLen,
-					  bufferPtr);
-
-					// Not needed since this is the latest added extension.
-					// bufferPtr += extenLen;
-				}
-			}
-			else if (this->kind == RTC::Media::Kind::VIDEO)
-			{
-				// Add http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time.
-				// NOTE: This is for REMB.
-				{
-					extenLen = 3u;
-
-					// NOTE: Add value 0. The sending Transport will update it.
-					const uint32_t absSendTime{ 0u };
-
-					Utils::Byte::Set3Bytes(bufferPtr, 0, absSendTime);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::ABS_SEND_TIME), extenLen, bufferPtr);
-
-					bufferPtr += extenLen;
-				}
-
-				// Add http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01.
-				// NOTE: We don't include it in outbound audio packets for now.
-				{
-					extenLen = 2u;
-
-					// NOTE: Add value 0. The sending Transport will update it.
-					const uint16_t wideSeqNumber{ 0u };
-
-					Utils::Byte::Set2Bytes(bufferPtr, 0, wideSeqNumber);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TRANSPORT_WIDE_CC_01),
-					  extenLen,
-					  bufferPtr);
-
-					bufferPtr += extenLen;
-				}
-
-				// NOTE: Remove this once framemarking draft becomes RFC.
-				// Proxy http://tools.ietf.org/html/draft-ietf-avtext-framemarking-07.
-				extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.frameMarking07, extenLen);
-
-				if (extenValue)
-				{
-					std::memcpy(bufferPtr, extenValue, extenLen);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::FRAME_MARKING_07),
-					  extenLen,
-					  bufferPtr);
-
-					bufferPtr += extenLen;
-				}
-
-				// Proxy urn:ietf:params:rtp-hdrext:framemarking.
-				extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.frameMarking, extenLen);
-
-				if (extenValue)
-				{
-					std::memcpy(bufferPtr, extenValue, extenLen);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::FRAME_MARKING), extenLen, bufferPtr);
-
-					bufferPtr += extenLen;
-				}
-
-				// Proxy urn:3gpp:video-orientation.
-				extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.videoOrientation, extenLen);
-
-				if (extenValue)
-				{
-					std::memcpy(bufferPtr, extenValue, extenLen);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::VIDEO_ORIENTATION),
-					  extenLen,
-					  bufferPtr);
-
-					bufferPtr += extenLen;
-				}
-
-				// Proxy urn:ietf:params:rtp-hdrext:toffset.
-				extenValue = packet->GetExtension(this->rtpHeaderExtensionIds.toffset, extenLen);
-
-				if (extenValue)
-				{
-					std::memcpy(bufferPtr, extenValue, extenLen);
-
-					extensions.emplace_back(
-					  static_cast<uint8_t>(RTC::RtpHeaderExtensionUri::Type::TOFFSET), extenLen, bufferPtr);
-
-					// Not needed since this is the latest added extension.
-					// bufferPtr += extenLen;
-				}
-			}
-
 			// Set the new extensions into the packet using One-Byte format.
-			packet->SetExtensions(1, extensions);
+			packet->RewriteHeaderExtensions(this->headerExtensionRewritePlan);
 
 			// Assign mediasoup RTP header extension ids (just those that mediasoup may
 			// be interested in after passing it to the Router).
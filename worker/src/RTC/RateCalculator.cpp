@@ -20,41 +20,38 @@ namespace RTC
 		// Increase bytes.
 		this->bytes += size;
 
-		RemoveOldData(nowMs);
-
 		// If the elapsed time from the newest item start time is greater than the
-		// item size (in milliseconds), increase the item index.
-		if (this->newestItemIndex < 0 || nowMs - this->newestItemStartTime >= this->itemSizeMs)
+		// item size (in milliseconds), use a new item.
+		if (this->numItems == 0 || nowMs - this->newestItemStartTime >= this->itemSizeMs)
 		{
-			this->newestItemIndex++;
-			this->newestItemStartTime = nowMs;
+			// No room for a new item, so remove old ones now.
+			if (this->numItems > this->itemsMask)
+			{
+				RemoveOldData(nowMs);
+
+				MS_ASSERT(this->numItems <= this->itemsMask, "newest item overlaps with the oldest one");
+			}
 
-			if (this->newestItemIndex >= this->windowItems)
+			// Set the oldest item time, if not set.
+			if (this->numItems == 0)
 			{
-				this->newestItemIndex = 0;
+				this->oldestItemIndex     = 0u;
+				this->oldestItemStartTime = nowMs;
 			}
 
-			MS_ASSERT(
-			  this->newestItemIndex != this->oldestItemIndex || this->oldestItemIndex == -1,
-			  "newest index overlaps with the oldest one");
+			++this->numItems;
+			this->newestItemStartTime = nowMs;
 
 			// Set the newest item.
-			BufferItem& item = this->buffer[this->newestItemIndex];
-			item.count       = size;
-			item.time        = nowMs;
+			BufferItem& item = GetItem(this->oldestItemIndex + this->numItems - 1);
+			item.count       = static_cast<uint32_t>(size);
+			item.time        = static_cast<uint32_t>(nowMs);
 		}
 		else
 		{
 			// Update the newest item.
-			BufferItem& item = this->buffer[this->newestItemIndex];
-			item.count += size;
-		}
-
-		// Set the oldest item index and time, if not set.
-		if (this->oldestItemIndex < 0)
-		{
-			this->oldestItemIndex     = this->newestItemIndex;
-			this->oldestItemStartTime = nowMs;
+			BufferItem& item = GetItem(this->oldestItemIndex + this->numItems - 1);
+			item.count += static_cast<uint32_t>(size);
 		}
 
 		this->totalCount += size;
@@ -89,7 +86,7 @@ namespace RTC
 		MS_TRACE();
 
 		// No item set.
-		if (this->newestItemIndex < 0 || this->oldestItemIndex < 0)
+		if (this->numItems == 0)
 		{
 			return;
 		}
@@ -110,20 +107,15 @@ namespace RTC
 			return;
 		}
 
+		// NOTE: The newest item is never removed here.
 		while (newOldestTime >= this->oldestItemStartTime)
 		{
-			BufferItem& oldestItem = this->buffer[this->oldestItemIndex];
-			this->totalCount -= oldestItem.count;
-			oldestItem.count = 0u;
-			oldestItem.time  = 0u;
+			this->totalCount -= GetItem(this->oldestItemIndex).count;
 
-			if (++this->oldestItemIndex >= this->windowItems)
-			{
-				this->oldestItemIndex = 0;
-			}
+			++this->oldestItemIndex;
+			--this->numItems;
 
-			const BufferItem& newOldestItem = this->buffer[this->oldestItemIndex];
-			this->oldestItemStartTime       = newOldestItem.time;
+			this->oldestItemStartTime = GetItemStartTime(GetItem(this->oldestItemIndex));
 		}
 	}
 
@@ -0,0 +1,213 @@
+#define MS_CLASS "RTC::RecordingTransport"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/RecordingTransport.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+
+namespace RTC
+{
+	/* Instance methods. */
+
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+	RecordingTransport::RecordingTransport(
+	  RTC::Shared* shared,
+	  const std::string& id,
+	  RTC::Transport::Listener* listener,
+	  const FBS::RecordingTransport::RecordingTransportOptions* options)
+	  : RTC::Transport::Transport(shared, id, listener, options->base())
+	{
+		MS_TRACE();
+
+		if (options->filePath()->size() == 0)
+		{
+			MS_THROW_TYPE_ERROR("empty filePath");
+		}
+
+		// NOTE: This may throw.
+		this->writer = new RTC::RtpDumpWriter(options->filePath()->str());
+
+		try
+		{
+			// NOTE: This may throw.
+			this->shared->channelMessageRegistrator->RegisterHandler(
+			  this->id,
+			  /*channelRequestHandler*/ this,
+			  /*channelNotificationHandler*/ this);
+		}
+		catch (const MediaSoupError& error)
+		{
+			// Must close the writer since the destructor won't be called.
+			this->writer->Close();
+			this->writer = nullptr;
+
+			throw;
+		}
+
+		// There is no remote endpoint to connect to, so start sending RTCP (Sender
+		// Reports are needed to synchronize the recorded streams).
+		RTC::Transport::Connected();
+	}
+
+	RecordingTransport::~RecordingTransport()
+	{
+		MS_TRACE();
+
+		// Tell the Transport parent class that we are about to destroy
+		// the class instance.
+		Destroying();
+
+		this->shared->channelMessageRegistrator->UnregisterHandler(this->id);
+
+		// Pending packets are written in background.
+		this->writer->Close();
+		this->writer = nullptr;
+	}
+
+	flatbuffers::Offset<FBS::RecordingTransport::DumpResponse> RecordingTransport::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder) const
+	{
+		// Add base transport dump.
+		auto base = Transport::FillBuffer(builder);
+		// Add recording.
+		auto recording = this->writer->FillBuffer(builder);
+
+		return FBS::RecordingTransport::CreateDumpResponse(builder, base, recording);
+	}
+
+	flatbuffers::Offset<FBS::RecordingTransport::GetStatsResponse>
+	RecordingTransport::FillBufferStats(flatbuffers::FlatBufferBuilder& builder)
+	{
+		MS_TRACE();
+
+		// Base Transport stats.
+		auto base = Transport::FillBufferStats(builder);
+		// Add recording.
+		auto recording = this->writer->FillBuffer(builder);
+
+		return FBS::RecordingTransport::CreateGetStatsResponse(builder, base, recording);
+	}
+
+	void RecordingTransport::HandleRequest(Channel::ChannelRequest* request)
+	{
+		MS_TRACE();
+
+		switch (request->method)
+		{
+			case Channel::ChannelRequest::Method::TRANSPORT_GET_STATS:
+			{
+				auto responseOffset = FillBufferStats(request->GetBufferBuilder());
+
+				request->Accept(FBS::Response::Body::RecordingTransport_GetStatsResponse, responseOffset);
+
+				break;
+			}
+
+			case Channel::ChannelRequest::Method::TRANSPORT_DUMP:
+			{
+				auto dumpOffset = FillBuffer(request->GetBufferBuilder());
+
+				request->Accept(FBS::Response::Body::RecordingTransport_DumpResponse, dumpOffset);
+
+				break;
+			}
+
+			default:
+			{
+				// Pass it to the parent class.
+				RTC::Transport::HandleRequest(request);
+			}
+		}
+	}
+
+	void RecordingTransport::HandleNotification(Channel::ChannelNotification* notification)
+	{
+		MS_TRACE();
+
+		// Pass it to the parent class.
+		RTC::Transport::HandleNotification(notification);
+	}
+
+	inline bool RecordingTransport::IsConnected() const
+	{
+		return true;
+	}
+
+	void RecordingTransport::SendRtpPacket(
+	  RTC::Consumer* /*consumer*/, RTC::RtpPacket* packet, RTC::Transport::onSendCallback* cb)
+	{
+		MS_TRACE();
+
+		this->writer->WriteRtp(packet->GetData(), packet->GetSize());
+
+		if (cb)
+		{
+			(*cb)(true);
+			delete cb;
+		}
+
+		// Increase send transmission.
+		RTC::Transport::DataSent(packet->GetSize());
+	}
+
+	void RecordingTransport::SendRtcpPacket(RTC::RTCP::Packet* packet)
+	{
+		MS_TRACE();
+
+		this->writer->WriteRtcp(packet->GetData(), packet->GetSize());
+
+		// Increase send transmission.
+		RTC::Transport::DataSent(packet->GetSize());
+	}
+
+	void RecordingTransport::SendRtcpCompoundPacket(RTC::RTCP::CompoundPacket* packet)
+	{
+		MS_TRACE();
+
+		packet->Serialize(RTC::RTCP::Buffer);
+
+		this->writer->WriteRtcp(packet->GetData(), packet->GetSize());
+
+		// Increase send transmission.
+		RTC::Transport::DataSent(packet->GetSize());
+	}
+
+	void RecordingTransport::SendMessage(
+	  RTC::DataConsumer* /*dataConsumer*/,
+	  const uint8_t* /*msg*/,
+	  size_t /*len*/,
+	  uint32_t /*ppid*/,
+	  onQueuedCallback* cb)
+	{
+		MS_TRACE();
+
+		// Messages are not recorded (and DataConsumers cannot be created since
+		// there is no SCTP association).
+		if (cb)
+		{
+			(*cb)(false, false);
+			delete cb;
+		}
+	}
+
+	void RecordingTransport::SendSctpData(const uint8_t* /*data*/, size_t /*len*/)
+	{
+		MS_TRACE();
+
+		// Do nothing.
+	}
+
+	void RecordingTransport::RecvStreamClosed(uint32_t /*ssrc*/)
+	{
+		MS_TRACE();
+
+		// Do nothing.
+	}
+
+	void RecordingTransport::SendStreamClosed(uint32_t /*ssrc*/)
+	{
+		MS_TRACE();
+
+		// Do nothing.
+	}
+} // namespace RTC
@@ -7,12 +7,14 @@
 #endif
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include "Utils.hpp"
 #include "RTC/ActiveSpeakerObserver.hpp"
 #include "RTC/AudioLevelObserver.hpp"
 #include "RTC/DirectTransport.hpp"
 #include "RTC/PipeTransport.hpp"
 #include "RTC/PlainTransport.hpp"
+#include "RTC/RecordingTransport.hpp"
 #include "RTC/WebRtcTransport.hpp"
 
 namespace RTC
@@ -190,7 +192,24 @@ namespace RTC
 		  &mapConsumerIdProducerId,
 		  &mapProducerIdObserverIds,
 		  &mapDataProducerIdDataConsumerIds,
-		  &mapDataConsumerIdDataProducerId);
+		  &mapDataConsumerIdDataProducerId,
+		  GetCpuTimeNs() / 1000u);
+	}
+
+	uint64_t Router::GetCpuTimeNs() const
+	{
+		MS_TRACE();
+
+		uint64_t cpuTimeNs = this->cpuTimeCounter.GetTimeNs() + this->closedTransportsCpuTimeNs;
+
+		for (const auto& kv : this->mapTransports)
+		{
+			const auto* transport = kv.second;
+
+			cpuTimeNs += transport->GetCpuTimeNs();
+		}
+
+		return cpuTimeNs;
 	}
 
 	void Router::HandleRequest(Channel::ChannelRequest* request)
@@ -342,6 +361,30 @@ namespace RTC
 				break;
 			}
 
+			case Channel::ChannelRequest::Method::ROUTER_CREATE_RECORDINGTRANSPORT:
+			{
+				const auto* body = request->data->body_as<FBS::Router::CreateRecordingTransportRequest>();
+				auto transportId = body->transportId()->str();
+
+				// This may throw.
+				CheckNoTransport(transportId);
+
+				// This may throw.
+				auto* recordingTransport =
+				  new RTC::RecordingTransport(this->shared, transportId, this, body->options());
+
+				// Insert into the map.
+				this->mapTransports[transportId] = recordingTransport;
+
+				MS_DEBUG_DEV("RecordingTransport created [transportId:%s]", transportId.c_str());
+
+				auto dumpOffset = recordingTransport->FillBuffer(request->GetBufferBuilder());
+
+				request->Accept(FBS::Response::Body::RecordingTransport_DumpResponse, dumpOffset);
+
+				break;
+			}
+
 			case Channel::ChannelRequest::Method::ROUTER_CREATE_ACTIVESPEAKEROBSERVER:
 			{
 				const auto* body = request->data->body_as<FBS::Router::CreateActiveSpeakerObserverRequest>();
@@ -396,13 +439,9 @@ namespace RTC
 				// notify us about their closures.
 				transport->CloseProducersAndConsumers();
 
-				// Remove it from the map.
-				this->mapTransports.erase(transport->id);
-
 				MS_DEBUG_DEV("Transport closed [transportId:%s]", transport->id.c_str());
 
-				// Delete it.
-				delete transport;
+				DeleteTransport(transport);
 
 				request->Accept();
 
@@ -461,6 +500,20 @@ namespace RTC
 		}
 	}
 
+	void Router::DeleteTransport(RTC::Transport* transport)
+	{
+		MS_TRACE();
+
+		// Keep the loop time of the Transport so the Router one never decreases.
+		this->closedTransportsCpuTimeNs += transport->GetCpuTimeNs();
+
+		// Remove it from the map.
+		this->mapTransports.erase(transport->id);
+
+		// Delete it.
+		delete transport;
+	}
+
 	RTC::Transport* Router::GetTransportById(const std::string& transportId) const
 	{
 		MS_TRACE();
@@ -651,9 +704,33 @@ namespace RTC
 	  RTC::Transport* /*transport*/, RTC::Producer* producer, RTC::RtpPacket* packet)
 	{
 		MS_TRACE();
+		MS_PROFILE_STAGE(ROUTER_FAN_OUT);
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		packet->logger.routerId = this->id;
 
+		// Whether RtpObservers let the packet be forwarded to Consumers.
+		bool forward{ true };
+
+		// NOTE: RtpObservers get the packet first so they can decide whether it
+		// must be forwarded.
+		auto it = this->mapProducerRtpObservers.find(producer);
+
+		if (it != this->mapProducerRtpObservers.end())
+		{
+			auto& rtpObservers = it->second;
+
+			for (auto* rtpObserver : rtpObservers)
+			{
+				rtpObserver->ReceiveRtpPacket(producer, packet);
+
+				if (!rtpObserver->IsForwarding(producer))
+				{
+					forward = false;
+				}
+			}
+		}
+
 		auto& consumers = this->mapProducerConsumers.at(producer);
 
 		if (!consumers.empty())
@@ -670,6 +747,13 @@ namespace RTC
 
 			for (auto* consumer : consumers)
 			{
+				if (!forward && consumer->SkipRtpPacket(packet))
+				{
+					continue;
+				}
+
+				MS_PROFILE_STAGE(CONSUMER_SEND);
+
 				// Update MID RTP extension value.
 				const auto& mid = consumer->GetRtpParameters().mid;
 
@@ -686,18 +770,6 @@ namespace RTC
 			DepLibUring::Submit();
 #endif
 		}
-
-		auto it = this->mapProducerRtpObservers.find(producer);
-
-		if (it != this->mapProducerRtpObservers.end())
-		{
-			auto& rtpObservers = it->second;
-
-			for (auto* rtpObserver : rtpObservers)
-			{
-				rtpObserver->ReceiveRtpPacket(producer, packet);
-			}
-		}
 	}
 
 	inline void Router::OnTransportNeedWorstRemoteFractionLost(
@@ -821,6 +893,70 @@ namespace RTC
 
 		auto* producer = this->mapConsumerProducer.at(consumer);
 
+		// If the Consumer has not sent anything yet, feed it with the cached key
+		// frame (and following frames) instead of asking the endpoint for a new
+		// key frame.
+		if (consumer->IsWaitingForFirstKeyFrame())
+		{
+			auto* keyFrameCache = producer->GetKeyFrameCache(mappedSsrc);
+			const auto* packets = keyFrameCache ? keyFrameCache->Lookup() : nullptr;
+
+			if (packets)
+			{
+				MS_DEBUG_TAG(
+				  rtp,
+				  "feeding Consumer with cached key frame [consumerId:%s, packets:%zu]",
+				  consumer->id.c_str(),
+				  packets->size());
+
+				const auto& mid = consumer->GetRtpParameters().mid;
+
+				// The cached frames are sent in a burst, so pack their timestamps right
+				// before the one of the newest cached frame. Otherwise the receiver
+				// would render them at their original pace, adding the age of the key
+				// frame as latency.
+				size_t numFrames{ 0u };
+				uint32_t lastTimestamp{ 0u };
+
+				for (const auto& cachedPacket : *packets)
+				{
+					if (numFrames == 0u || cachedPacket->GetTimestamp() != lastTimestamp)
+					{
+						++numFrames;
+						lastTimestamp = cachedPacket->GetTimestamp();
+					}
+				}
+
+				size_t frameIdx{ 0u };
+				uint32_t frameTimestamp{ packets->front()->GetTimestamp() };
+
+				for (const auto& cachedPacket : *packets)
+				{
+					if (cachedPacket->GetTimestamp() != frameTimestamp)
+					{
+						++frameIdx;
+						frameTimestamp = cachedPacket->GetTimestamp();
+					}
+
+					// NOTE: Cached packets are shared with every Consumer fed from the
+					// cache, so send a copy of them.
+					std::unique_ptr<RTC::RtpPacket> packet{ cachedPacket->Clone() };
+					std::shared_ptr<RTC::RtpPacket> sharedPacket;
+
+					packet->SetTimestamp(lastTimestamp - static_cast<uint32_t>(numFrames - 1 - frameIdx));
+
+					if (!mid.empty())
+					{
+						packet->UpdateMid(mid);
+					}
+
+					consumer->SendRtpPacket(packet.get(), sharedPacket);
+				}
+
+				return;
+			}
+		}
+
 		producer->RequestKeyFrame(mappedSsrc);
 	}
 
@@ -1042,11 +1178,7 @@ namespace RTC
 		// notify us about their closures.
 		transport->CloseProducersAndConsumers();
 
-		// Remove it from the map.
-		this->mapTransports.erase(transport->id);
-
-		// Delete it.
-		delete transport;
+		DeleteTransport(transport);
 	}
 
 	void Router::OnRtpObserverAddProducer(RTC::RtpObserver* rtpObserver, RTC::Producer* producer)
@@ -23,6 +23,7 @@ namespace RTC
 			{ RtpPacket::DropReason::PACKET_PREVIOUS_TO_SPATIAL_LAYER_SWITCH, "PacketPreviousToSpatialLayerSwitch" },
 			{ RtpPacket::DropReason::DROPPED_BY_CODEC,                        "DroppedByCodec"                     },
 			{ RtpPacket::DropReason::SEND_RTP_STREAM_DISCARDED,               "SendRtpStreamDiscarded"             },
+			{ RtpPacket::DropReason::NOT_FORWARDED,                           "NotForwarded"                       },
 		};
 		// clang-format on
 
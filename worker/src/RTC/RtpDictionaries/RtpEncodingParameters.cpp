@@ -42,6 +42,13 @@ namespace RTC
 			this->hasRtx = true;
 		}
 
+		// fec is optional.
+		if (flatbuffers::IsFieldPresent(data, FBS::RtpParameters::RtpEncodingParameters::VT_FEC))
+		{
+			this->fec    = RtpFecParameters(data->fec());
+			this->hasFec = true;
+		}
+
 		// maxBitrate is optional.
 		if (data->maxBitrate().has_value())
 		{
@@ -95,6 +102,9 @@ namespace RTC
 		                            : flatbuffers::nullopt,
 		  this->hasRtx ? this->rtx.FillBuffer(builder) : 0u,
 		  this->dtx,
-		  this->scalabilityMode.c_str());
+		  this->scalabilityMode.c_str(),
+		  this->maxBitrate != 0u ? flatbuffers::Optional<uint32_t>(this->maxBitrate)
+		                         : flatbuffers::nullopt,
+		  this->hasFec ? this->fec.FillBuffer(builder) : 0u);
 	}
 } // namespace RTC
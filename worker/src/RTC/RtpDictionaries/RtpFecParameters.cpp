@@ -0,0 +1,27 @@
+#define MS_CLASS "RTC::RtpFecParameters"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include "RTC/RtpDictionaries.hpp"
+
+namespace RTC
+{
+	/* Instance methods. */
+
+	RtpFecParameters::RtpFecParameters(const FBS::RtpParameters::Fec* data)
+	{
+		MS_TRACE();
+
+		this->ssrc = data->ssrc();
+	}
+
+	flatbuffers::Offset<FBS::RtpParameters::Fec> RtpFecParameters::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder) const
+	{
+		MS_TRACE();
+
+		return FBS::RtpParameters::CreateFec(builder, this->ssrc);
+	}
+} // namespace RTC
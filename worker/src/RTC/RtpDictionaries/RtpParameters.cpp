@@ -229,7 +229,27 @@ namespace RTC
 
 		for (const auto& codec : this->codecs)
 		{
-			if (codec.mimeType.IsFeatureCodec() && codec.parameters.GetInteger(AptString) == payloadType)
+			// clang-format off
+			if (
+				codec.mimeType.subtype == RTC::RtpCodecMimeType::Subtype::RTX &&
+				codec.parameters.GetInteger(AptString) == payloadType
+			)
+			// clang-format on
+			{
+				return std::addressof(codec);
+			}
+		}
+
+		return nullptr;
+	}
+
+	const RTC::RtpCodecParameters* RtpParameters::GetFecCodec() const
+	{
+		MS_TRACE();
+
+		for (const auto& codec : this->codecs)
+		{
+			if (codec.mimeType.subtype == RTC::RtpCodecMimeType::Subtype::FLEXFEC)
 			{
 				return std::addressof(codec);
 			}
@@ -341,6 +361,11 @@ namespace RTC
 				  "cannot use both simulcast and encodings with multiple SVC spatial layers");
 			}
 
+			if (encoding.hasFec && !GetFecCodec())
+			{
+				MS_THROW_TYPE_ERROR("encoding with fec but no FLEXFEC codec");
+			}
+
 			if (!encoding.hasCodecPayloadType)
 			{
 				encoding.codecPayloadType    = firstMediaPayloadType;
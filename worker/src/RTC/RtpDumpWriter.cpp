@@ -0,0 +1,422 @@
+#define MS_CLASS "RTC::RtpDumpWriter"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/RtpDumpWriter.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include "Utils.hpp"
+#include <fcntl.h> // O_WRONLY, O_CREAT, O_TRUNC
+#include <cstring> // std::memcpy()
+
+/* Static. */
+
+// Text line of the file header. Packets were not received from a network
+// address.
+static constexpr char FileHeaderLine[]{ "#!rtpplay1.0 0.0.0.0/0\n" };
+static constexpr size_t FileHeaderLineSize{ sizeof(FileHeaderLine) - 1u };
+
+// Extra room in batches so the packet that fills them does not reallocate.
+static constexpr size_t BatchHeadroom{ 2048u };
+// Size of the binary header following the text line of the file header.
+static constexpr size_t FileHeaderSize{ 16u };
+
+/* Static methods for UV callbacks. */
+
+inline static void onOpen(uv_fs_t* req)
+{
+	static_cast<RTC::RtpDumpWriter*>(req->data)->OnUvOpen(req->result);
+}
+
+inline static void onWrite(uv_fs_t* req)
+{
+	static_cast<RTC::RtpDumpWriter*>(req->data)->OnUvWrite(req->result);
+}
+
+inline static void onClose(uv_fs_t* req)
+{
+	static_cast<RTC::RtpDumpWriter*>(req->data)->OnUvClose();
+}
+
+namespace RTC
+{
+	/* Instance methods. */
+
+	RtpDumpWriter::RtpDumpWriter(const std::string& filePath) : filePath(filePath)
+	{
+		MS_TRACE();
+
+		this->startMs = DepLibUV::GetTimeMs();
+
+		this->batch.reserve(BatchSize + BatchHeadroom);
+
+		WriteFileHeader();
+
+		this->fsReq.data = static_cast<void*>(this);
+
+		const int err = uv_fs_open(
+		  DepLibUV::GetLoop(),
+		  std::addressof(this->fsReq),
+		  this->filePath.c_str(),
+		  O_WRONLY | O_CREAT | O_TRUNC,
+		  0644,
+		  static_cast<uv_fs_cb>(onOpen));
+
+		if (err != 0)
+		{
+			uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+			MS_THROW_ERROR("uv_fs_open() failed: %s", uv_strerror(err));
+		}
+
+		this->flushTimer = new TimerHandle(this);
+
+		this->flushTimer->Start(FlushInterval, FlushInterval);
+	}
+
+	RtpDumpWriter::~RtpDumpWriter()
+	{
+		MS_TRACE();
+
+		delete this->flushTimer;
+	}
+
+	void RtpDumpWriter::Close()
+	{
+		MS_TRACE();
+
+		this->closeRequested = true;
+
+		delete this->flushTimer;
+		this->flushTimer = nullptr;
+
+		switch (this->state)
+		{
+			case State::OPENING:
+			{
+				// Pending packets are written once the file is open.
+				Flush();
+
+				break;
+			}
+
+			case State::OPEN:
+			{
+				// This closes the file once everything has been written.
+				Flush();
+				WriteNextBatch();
+
+				break;
+			}
+
+			case State::FAILED:
+			{
+				if (this->fd >= 0)
+				{
+					CloseFile();
+				}
+				else
+				{
+					delete this;
+				}
+
+				break;
+			}
+
+			case State::CLOSING:
+			{
+				break;
+			}
+		}
+	}
+
+	flatbuffers::Offset<FBS::RecordingTransport::Recording> RtpDumpWriter::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder) const
+	{
+		MS_TRACE();
+
+		return FBS::RecordingTransport::CreateRecordingDirect(
+		  builder,
+		  this->filePath.c_str(),
+		  this->recordedRtpPackets,
+		  this->recordedRtcpPackets,
+		  this->droppedPackets,
+		  this->writtenBytes,
+		  this->pendingBytes,
+		  this->writeErrors);
+	}
+
+	void RtpDumpWriter::Write(const uint8_t* data, size_t len, bool isRtcp)
+	{
+		MS_TRACE();
+
+		const size_t recordLen = PacketHeaderSize + len;
+
+		if (
+		  this->state == State::FAILED || this->closeRequested || recordLen > UINT16_MAX ||
+		  this->pendingBytes + recordLen > MaxPendingSize)
+		{
+			++this->droppedPackets;
+
+			return;
+		}
+
+		const auto offset = this->batch.size();
+
+		this->batch.resize(offset + recordLen);
+
+		auto* record = this->batch.data() + offset;
+
+		// Length of the record, packet length (0 means RTCP) and offset in ms
+		// since the recording started.
+		Utils::Byte::Set2Bytes(record, 0, static_cast<uint16_t>(recordLen));
+		Utils::Byte::Set2Bytes(record, 2, isRtcp ? 0u : static_cast<uint16_t>(len));
+		Utils::Byte::Set4Bytes(record, 4, static_cast<uint32_t>(DepLibUV::GetTimeMs() - this->startMs));
+		std::memcpy(record + PacketHeaderSize, data, len);
+
+		this->pendingBytes += recordLen;
+
+		if (isRtcp)
+		{
+			++this->recordedRtcpPackets;
+		}
+		else
+		{
+			++this->recordedRtpPackets;
+		}
+
+		if (this->batch.size() >= BatchSize)
+		{
+			Flush();
+		}
+	}
+
+	void RtpDumpWriter::WriteFileHeader()
+	{
+		MS_TRACE();
+
+		uv_timeval64_t now{};
+
+		uv_gettimeofday(std::addressof(now));
+
+		this->batch.resize(FileHeaderLineSize + FileHeaderSize);
+
+		std::memcpy(this->batch.data(), FileHeaderLine, FileHeaderLineSize);
+
+		auto* header = this->batch.data() + FileHeaderLineSize;
+
+		// Start time (seconds and microseconds), source address and port, and
+		// padding.
+		Utils::Byte::Set4Bytes(header, 0, static_cast<uint32_t>(now.tv_sec));
+		Utils::Byte::Set4Bytes(header, 4, static_cast<uint32_t>(now.tv_usec));
+		Utils::Byte::Set4Bytes(header, 8, 0u);
+		Utils::Byte::Set2Bytes(header, 12, 0u);
+		Utils::Byte::Set2Bytes(header, 14, 0u);
+
+		this->pendingBytes += this->batch.size();
+	}
+
+	void RtpDumpWriter::Flush()
+	{
+		MS_TRACE();
+
+		if (this->batch.empty())
+		{
+			return;
+		}
+
+		this->batches.push_back(std::move(this->batch));
+
+		this->batch = std::vector<uint8_t>();
+
+		if (!this->closeRequested)
+		{
+			this->batch.reserve(BatchSize + BatchHeadroom);
+		}
+
+		WriteNextBatch();
+	}
+
+	void RtpDumpWriter::WriteNextBatch()
+	{
+		MS_TRACE();
+
+		if (this->state != State::OPEN || this->writing)
+		{
+			return;
+		}
+
+		if (this->batches.empty())
+		{
+			if (this->closeRequested)
+			{
+				CloseFile();
+			}
+
+			return;
+		}
+
+		auto& batch    = this->batches.front();
+		auto* data     = batch.data() + this->writtenInBatch;
+		const auto len = batch.size() - this->writtenInBatch;
+		auto buf       = uv_buf_init(reinterpret_cast<char*>(data), static_cast<unsigned int>(len));
+
+		this->fsReq.data = static_cast<void*>(this);
+
+		const int err = uv_fs_write(
+		  DepLibUV::GetLoop(),
+		  std::addressof(this->fsReq),
+		  this->fd,
+		  std::addressof(buf),
+		  1,
+		  /*offset*/ -1,
+		  static_cast<uv_fs_cb>(onWrite));
+
+		if (err != 0)
+		{
+			uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+			MS_ERROR("uv_fs_write() failed [filePath:%s]: %s", this->filePath.c_str(), uv_strerror(err));
+
+			++this->writeErrors;
+
+			Fail();
+
+			return;
+		}
+
+		this->writing = true;
+	}
+
+	void RtpDumpWriter::CloseFile()
+	{
+		MS_TRACE();
+
+		this->state = State::CLOSING;
+
+		this->fsReq.data = static_cast<void*>(this);
+
+		const int err = uv_fs_close(
+		  DepLibUV::GetLoop(), std::addressof(this->fsReq), this->fd, static_cast<uv_fs_cb>(onClose));
+
+		if (err != 0)
+		{
+			uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+			MS_ERROR("uv_fs_close() failed [filePath:%s]: %s", this->filePath.c_str(), uv_strerror(err));
+
+			delete this;
+		}
+	}
+
+	void RtpDumpWriter::Fail()
+	{
+		MS_TRACE();
+
+		this->state = State::FAILED;
+
+		// Pending packets are lost.
+		this->batch.clear();
+		this->batches.clear();
+		this->writtenInBatch = 0u;
+		this->pendingBytes   = 0u;
+
+		if (!this->closeRequested)
+		{
+			return;
+		}
+
+		if (this->fd >= 0)
+		{
+			CloseFile();
+		}
+		else
+		{
+			delete this;
+		}
+	}
+
+	inline void RtpDumpWriter::OnUvOpen(ssize_t result)
+	{
+		MS_TRACE();
+
+		uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+		if (result < 0)
+		{
+			MS_ERROR(
+			  "failed to open file [filePath:%s]: %s",
+			  this->filePath.c_str(),
+			  uv_strerror(static_cast<int>(result)));
+
+			++this->writeErrors;
+
+			Fail();
+
+			return;
+		}
+
+		MS_DEBUG_TAG(rtp, "recording into file [filePath:%s]", this->filePath.c_str());
+
+		this->fd    = static_cast<uv_file>(result);
+		this->state = State::OPEN;
+
+		WriteNextBatch();
+	}
+
+	inline void RtpDumpWriter::OnUvWrite(ssize_t result)
+	{
+		MS_TRACE();
+
+		uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+		this->writing = false;
+
+		if (result < 0)
+		{
+			MS_ERROR(
+			  "failed to write file [filePath:%s]: %s",
+			  this->filePath.c_str(),
+			  uv_strerror(static_cast<int>(result)));
+
+			++this->writeErrors;
+
+			Fail();
+
+			return;
+		}
+
+		const auto written = static_cast<size_t>(result);
+
+		this->writtenBytes += written;
+		this->writtenInBatch += written;
+		this->pendingBytes -= written;
+
+		// The batch may have been partially written, so go on with the rest.
+		if (this->writtenInBatch == this->batches.front().size())
+		{
+			this->batches.pop_front();
+			this->writtenInBatch = 0u;
+		}
+
+		WriteNextBatch();
+	}
+
+	inline void RtpDumpWriter::OnUvClose()
+	{
+		MS_TRACE();
+
+		uv_fs_req_cleanup(std::addressof(this->fsReq));
+
+		MS_DEBUG_TAG(rtp, "recording file closed [filePath:%s]", this->filePath.c_str());
+
+		delete this;
+	}
+
+	inline void RtpDumpWriter::OnTimer(TimerHandle* /*timer*/)
+	{
+		MS_TRACE();
+
+		Flush();
+	}
+} // namespace RTC
@@ -2,12 +2,20 @@
 // #define MS_LOG_DEV_LEVEL 3
 
 #include "RTC/RtpListener.hpp"
+#include "DepLibUV.hpp"
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
 #include "RTC/Producer.hpp"
 
 namespace RTC
 {
+	/* Static. */
+
+	// How long an SSRC that matched no Producer is remembered. During this
+	// period packets with such SSRC skip the MID/RID lookup and are not
+	// reported again.
+	static constexpr uint64_t UnknownSsrcTimeoutMs{ 1000u };
+
 	/* Instance methods. */
 
 	flatbuffers::Offset<FBS::Transport::RtpListener> RtpListener::FillBuffer(
@@ -60,6 +68,9 @@ namespace RTC
 
 		const auto& rtpParameters = producer->GetRtpParameters();
 
+		// The new Producer may match previously unknown SSRCs.
+		ClearUnknownSsrcs();
+
 		// Add entries into the ssrcTable.
 		for (const auto& encoding : rtpParameters.encodings)
 		{
@@ -147,41 +158,9 @@ namespace RTC
 
 		// Remove from the listener tables all entries pointing to the Producer.
 
-		for (auto it = this->ssrcTable.begin(); it != this->ssrcTable.end();)
-		{
-			if (it->second == producer)
-			{
-				it = this->ssrcTable.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-
-		for (auto it = this->midTable.begin(); it != this->midTable.end();)
-		{
-			if (it->second == producer)
-			{
-				it = this->midTable.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-
-		for (auto it = this->ridTable.begin(); it != this->ridTable.end();)
-		{
-			if (it->second == producer)
-			{
-				it = this->ridTable.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
+		absl::erase_if(this->ssrcTable, [producer](const auto& kv) { return kv.second == producer; });
+		absl::erase_if(this->midTable, [producer](const auto& kv) { return kv.second == producer; });
+		absl::erase_if(this->ridTable, [producer](const auto& kv) { return kv.second == producer; });
 	}
 
 	RTC::Producer* RtpListener::GetProducer(const RTC::RtpPacket* packet)
@@ -200,9 +179,15 @@ namespace RTC
 			}
 		}
 
+		// Skip the MID and RID lookups if this SSRC recently matched no Producer.
+		if (this->hasUnknownSsrcs && IsUnknownSsrc(packet->GetSsrc(), DepLibUV::GetTimeMs()))
+		{
+			return nullptr;
+		}
+
 		// Otherwise lookup into the MID table.
 		{
-			std::string mid;
+			absl::string_view mid;
 
 			if (packet->ReadMid(mid))
 			{
@@ -223,7 +208,7 @@ namespace RTC
 
 		// Otherwise lookup into the RID table.
 		{
-			std::string rid;
+			absl::string_view rid;
 
 			if (packet->ReadRid(rid))
 			{
@@ -261,4 +246,50 @@ namespace RTC
 
 		return nullptr;
 	}
+
+	bool RtpListener::AddUnknownSsrc(uint32_t ssrc, uint64_t nowMs)
+	{
+		MS_TRACE();
+
+		if (IsUnknownSsrc(ssrc, nowMs))
+		{
+			return false;
+		}
+
+		auto& entry = GetUnknownSsrcEntry(ssrc);
+
+		entry.ssrc        = ssrc;
+		entry.expiresAtMs = nowMs + UnknownSsrcTimeoutMs;
+
+		this->hasUnknownSsrcs = true;
+
+		return true;
+	}
+
+	inline RtpListener::UnknownSsrc& RtpListener::GetUnknownSsrcEntry(uint32_t ssrc)
+	{
+		// Fibonacci hashing into the cache slots.
+		return this->unknownSsrcs[(ssrc * 2654435769u) >> (32u - UnknownSsrcsCacheBits)];
+	}
+
+	inline bool RtpListener::IsUnknownSsrc(uint32_t ssrc, uint64_t nowMs)
+	{
+		const auto& entry = GetUnknownSsrcEntry(ssrc);
+
+		return entry.ssrc == ssrc && entry.expiresAtMs > nowMs;
+	}
+
+	void RtpListener::ClearUnknownSsrcs()
+	{
+		MS_TRACE();
+
+		if (!this->hasUnknownSsrcs)
+		{
+			return;
+		}
+
+		this->unknownSsrcs.fill(UnknownSsrc{});
+
+		this->hasUnknownSsrcs = false;
+	}
 } // namespace RTC
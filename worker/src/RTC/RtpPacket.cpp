@@ -4,6 +4,7 @@
 #include "RTC/RtpPacket.hpp"
 #include "DepLibUV.hpp"
 #include "Logger.hpp"
+#include "Profiler.hpp"
 #include <cstring>  // std::memcpy(), std::memmove(), std::memset()
 #include <iterator> // std::ostream_iterator
 #include <sstream>  // std::ostringstream
@@ -15,6 +16,7 @@ namespace RTC
 	RtpPacket* RtpPacket::Parse(const uint8_t* data, size_t len)
 	{
 		MS_TRACE();
+		MS_PROFILE_STAGE(RTP_PARSE);
 
 		if (!RtpPacket::IsRtp(data, len))
 		{
@@ -123,6 +125,35 @@ namespace RTC
 		return new RtpPacket(header, headerExtension, payload, payloadLength, payloadPadding, len);
 	}
 
+	/* HeaderExtensionRewritePlan instance methods. */
+
+	void RtpPacket::HeaderExtensionRewritePlan::AddZeroed(uint8_t id, uint8_t len)
+	{
+		MS_TRACE();
+
+		MS_ASSERT(this->numSteps < MaxSteps, "too many steps");
+		MS_ASSERT(id > 0u && id <= 14u, "invalid One-Byte extension id");
+		MS_ASSERT(len > 0u && len <= 16u, "invalid One-Byte extension length");
+
+		this->steps[this->numSteps++] = { id, 0u, len };
+	}
+
+	void RtpPacket::HeaderExtensionRewritePlan::AddProxied(uint8_t id, uint8_t sourceId)
+	{
+		MS_TRACE();
+
+		// The Producer does not use this extension so it's never present.
+		if (sourceId == 0u)
+		{
+			return;
+		}
+
+		MS_ASSERT(this->numSteps < MaxSteps, "too many steps");
+		MS_ASSERT(id > 0u && id <= 14u, "invalid One-Byte extension id");
+
+		this->steps[this->numSteps++] = { id, sourceId, 0u };
+	}
+
 	/* Instance methods. */
 
 	RtpPacket::RtpPacket(
@@ -555,6 +586,152 @@ namespace RTC
 		MS_ASSERT(ptr == this->payload, "wrong ptr calculation");
 	}
 
+	/**
+	 * Same as SetExtensions() with One-Byte type but driven by a precomputed
+	 * plan, so there is no need to build and validate a list of extensions for
+	 * each packet.
+	 */
+	void RtpPacket::RewriteHeaderExtensions(const HeaderExtensionRewritePlan& plan)
+	{
+		MS_TRACE();
+
+		constexpr size_t MaxSteps{ HeaderExtensionRewritePlan::MaxSteps };
+
+		// Values of the proxied extensions must be copied since they may be
+		// overwritten while writing the new ones.
+		uint8_t values[MaxSteps * 16];
+		uint8_t lens[MaxSteps];
+		uint8_t* valuesPtr{ values };
+		size_t extensionsTotalSize{ 0 };
+		const size_t numSteps = plan.GetNumSteps();
+
+		for (size_t i{ 0 }; i < numSteps; ++i)
+		{
+			const auto& step = plan.GetStep(i);
+
+			if (step.sourceId == 0u)
+			{
+				lens[i] = step.len;
+				extensionsTotalSize += (1 + step.len);
+
+				continue;
+			}
+
+			uint8_t len;
+			const uint8_t* value = GetExtension(step.sourceId, len);
+
+			if (!value || len == 0 || len > 16)
+			{
+				lens[i] = 0u;
+
+				continue;
+			}
+
+			std::memcpy(valuesPtr, value, len);
+			valuesPtr += len;
+
+			lens[i] = len;
+			extensionsTotalSize += (1 + len);
+		}
+
+		// Reset extension ids.
+		this->midExtensionId               = 0u;
+		this->ridExtensionId               = 0u;
+		this->rridExtensionId              = 0u;
+		this->absSendTimeExtensionId       = 0u;
+		this->transportWideCc01ExtensionId = 0u;
+		this->frameMarking07ExtensionId    = 0u;
+		this->frameMarkingExtensionId      = 0u;
+		this->ssrcAudioLevelExtensionId    = 0u;
+		this->videoOrientationExtensionId  = 0u;
+
+		// Clear the One-Byte and Two-Bytes extension elements maps.
+		std::fill(std::begin(this->oneByteExtensions), std::end(this->oneByteExtensions), nullptr);
+
+		if (!this->mapTwoBytesExtensions.empty())
+		{
+			this->mapTwoBytesExtensions.clear();
+		}
+
+		auto paddedExtensionsTotalSize =
+		  static_cast<size_t>(Utils::Byte::PadTo4Bytes(static_cast<uint16_t>(extensionsTotalSize)));
+		const size_t padding = paddedExtensionsTotalSize - extensionsTotalSize;
+
+		extensionsTotalSize = paddedExtensionsTotalSize;
+
+		int16_t shift{ 0 };
+
+		if (this->headerExtension)
+		{
+			shift = static_cast<int16_t>(extensionsTotalSize - GetHeaderExtensionLength());
+		}
+		else
+		{
+			shift = 4 + static_cast<int16_t>(extensionsTotalSize);
+
+			// Set the header extension bit.
+			this->header->extension = 1u;
+
+			// Set the header extension pointing to the current payload.
+			this->headerExtension = reinterpret_cast<HeaderExtension*>(this->payload);
+		}
+
+		if (shift != 0)
+		{
+			// Shift the payload.
+			std::memmove(this->payload + shift, this->payload, this->payloadLength + this->payloadPadding);
+			this->payload += shift;
+
+			// Update packet total size.
+			this->size += shift;
+		}
+
+		this->headerExtension->id     = uint16_t{ htons(0xBEDE) };
+		this->headerExtension->length = htons(extensionsTotalSize / 4);
+
+		// Write the new extensions into the header extension value.
+		uint8_t* ptr = this->headerExtension->value;
+
+		valuesPtr = values;
+
+		for (size_t i{ 0 }; i < numSteps; ++i)
+		{
+			const auto& step = plan.GetStep(i);
+			const uint8_t len{ lens[i] };
+
+			if (len == 0u)
+			{
+				continue;
+			}
+
+			// `-1` because we have 14 elements total 0..13 and `id` is in the range 1..14.
+			this->oneByteExtensions[step.id - 1] = reinterpret_cast<OneByteExtension*>(ptr);
+
+			*ptr = (step.id << 4) | ((len - 1) & 0x0F);
+			++ptr;
+
+			if (step.sourceId == 0u)
+			{
+				std::memset(ptr, 0, len);
+			}
+			else
+			{
+				std::memcpy(ptr, valuesPtr, len);
+				valuesPtr += len;
+			}
+
+			ptr += len;
+		}
+
+		for (size_t i = 0; i < padding; ++i)
+		{
+			*ptr = 0u;
+			++ptr;
+		}
+
+		MS_ASSERT(ptr == this->payload, "wrong ptr calculation");
+	}
+
 	void RtpPacket::UpdateMid(const std::string& mid)
 	{
 		MS_TRACE();
@@ -569,6 +746,13 @@ namespace RTC
 
 		const size_t midLen = mid.length();
 
+		// Nothing to do if the packet already has this MID (i.e. the packet was
+		// already sent to another Consumer with the same MID).
+		if (extenLen == midLen && std::memcmp(extenValue, mid.c_str(), midLen) == 0)
+		{
+			return;
+		}
+
 		// Here we assume that there is MidMaxLength available bytes, even if now
 		// they are padding bytes.
 		if (midLen > RTC::MidMaxLength)
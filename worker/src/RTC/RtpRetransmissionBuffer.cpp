@@ -51,6 +51,43 @@ namespace RTC
 		return this->buffer.at(idx);
 	}
 
+	/**
+	 * Returns the newest item, among the given number of newest ones, whose
+	 * packet is not bigger than the given size and that was not resent after
+	 * the given time.
+	 */
+	RtpRetransmissionBuffer::Item* RtpRetransmissionBuffer::GetNewestForPadding(
+	  size_t maxSize, uint64_t notResentSinceMs, size_t maxItems) const
+	{
+		MS_TRACE();
+
+		size_t count{ 0u };
+
+		for (auto it = this->buffer.rbegin(); it != this->buffer.rend() && count < maxItems;
+		     ++it, ++count)
+		{
+			auto* item = *it;
+
+			// Missing packet.
+			if (!item)
+			{
+				continue;
+			}
+			else if (item->packet->GetSize() > maxSize)
+			{
+				continue;
+			}
+			else if (item->resentAtMs != 0u && item->resentAtMs > notResentSinceMs)
+			{
+				continue;
+			}
+
+			return item;
+		}
+
+		return nullptr;
+	}
+
 	/**
 	 * This method tries to insert given packet into the buffer. Here we assume
 	 * that packet seq number is legitimate according to the content of the buffer.
@@ -17,19 +17,22 @@ namespace RTC
 
 	RtpStreamRecv::TransmissionCounter::TransmissionCounter(
 	  uint8_t spatialLayers, uint8_t temporalLayers, size_t windowSize)
+	  : spatialLayers(spatialLayers), temporalLayers(temporalLayers)
 	{
 		MS_TRACE();
 
+		const size_t numLayers = spatialLayers * temporalLayers;
+
 		// Reserve vectors capacity.
-		this->spatialLayerCounters = std::vector<std::vector<RTC::RtpDataCounter>>(spatialLayers);
+		this->layerCounters.reserve(numLayers);
 
-		for (auto& spatialLayerCounter : this->spatialLayerCounters)
+		for (size_t idx{ 0u }; idx < numLayers; ++idx)
 		{
-			for (uint8_t tIdx{ 0u }; tIdx < temporalLayers; ++tIdx)
-			{
-				spatialLayerCounter.emplace_back(RTC::RtpDataCounter(windowSize));
-			}
+			this->layerCounters.emplace_back(windowSize);
 		}
+
+		this->layerRates.resize(numLayers, 0u);
+		this->accumulatedRates.resize(numLayers, 0u);
 	}
 
 	void RtpStreamRecv::TransmissionCounter::Update(RTC::RtpPacket* packet)
@@ -40,37 +43,31 @@ namespace RTC
 		auto temporalLayer = packet->GetTemporalLayer();
 
 		// Sanity check. Do not allow spatial layers higher than defined.
-		if (spatialLayer > this->spatialLayerCounters.size() - 1)
+		if (spatialLayer > this->spatialLayers - 1)
 		{
-			spatialLayer = this->spatialLayerCounters.size() - 1;
+			spatialLayer = this->spatialLayers - 1;
 		}
 
 		// Sanity check. Do not allow temporal layers higher than defined.
-		if (temporalLayer > this->spatialLayerCounters[0].size() - 1)
+		if (temporalLayer > this->temporalLayers - 1)
 		{
-			temporalLayer = this->spatialLayerCounters[0].size() - 1;
+			temporalLayer = this->temporalLayers - 1;
 		}
 
-		auto& counter = this->spatialLayerCounters[spatialLayer][temporalLayer];
+		auto& counter = this->layerCounters[GetLayerIndex(spatialLayer, temporalLayer)];
 
 		counter.Update(packet);
+
+		this->ratesValid = false;
 	}
 
 	uint32_t RtpStreamRecv::TransmissionCounter::GetBitrate(uint64_t nowMs)
 	{
 		MS_TRACE();
 
-		uint32_t rate{ 0u };
-
-		for (auto& spatialLayerCounter : this->spatialLayerCounters)
-		{
-			for (auto& temporalLayerCounter : spatialLayerCounter)
-			{
-				rate += temporalLayerCounter.GetBitrate(nowMs);
-			}
-		}
+		UpdateRates(nowMs);
 
-		return rate;
+		return this->accumulatedRates.back();
 	}
 
 	uint32_t RtpStreamRecv::TransmissionCounter::GetBitrate(
@@ -78,61 +75,36 @@ namespace RTC
 	{
 		MS_TRACE();
 
-		MS_ASSERT(spatialLayer < this->spatialLayerCounters.size(), "spatialLayer too high");
-		MS_ASSERT(
-		  temporalLayer < this->spatialLayerCounters[spatialLayer].size(), "temporalLayer too high");
-
-		// Return 0 if specified layers are not being received.
-		auto& counter = this->spatialLayerCounters[spatialLayer][temporalLayer];
-
-		if (counter.GetBitrate(nowMs) == 0)
-		{
-			return 0u;
-		}
-
-		uint32_t rate{ 0u };
+		MS_ASSERT(spatialLayer < this->spatialLayers, "spatialLayer too high");
+		MS_ASSERT(temporalLayer < this->temporalLayers, "temporalLayer too high");
 
-		// Iterate all temporal layers of spatial layers previous to the given one.
-		for (uint8_t sIdx{ 0u }; sIdx < spatialLayer; ++sIdx)
-		{
-			for (size_t tIdx{ 0u }; tIdx < this->spatialLayerCounters[sIdx].size(); ++tIdx)
-			{
-				auto& temporalLayerCounter = this->spatialLayerCounters[sIdx][tIdx];
+		UpdateRates(nowMs);
 
-				rate += temporalLayerCounter.GetBitrate(nowMs);
-			}
-		}
+		const size_t idx = GetLayerIndex(spatialLayer, temporalLayer);
 
-		// Add the given spatial layer with up to the given temporal layer.
-		for (uint8_t tIdx{ 0u }; tIdx <= temporalLayer; ++tIdx)
+		// Return 0 if specified layers are not being received.
+		if (this->layerRates[idx] == 0)
 		{
-			auto& temporalLayerCounter = this->spatialLayerCounters[spatialLayer][tIdx];
-
-			rate += temporalLayerCounter.GetBitrate(nowMs);
+			return 0u;
 		}
 
-		return rate;
+		return this->accumulatedRates[idx];
 	}
 
 	uint32_t RtpStreamRecv::TransmissionCounter::GetSpatialLayerBitrate(uint64_t nowMs, uint8_t spatialLayer)
 	{
 		MS_TRACE();
 
-		MS_ASSERT(spatialLayer < this->spatialLayerCounters.size(), "spatialLayer too high");
+		MS_ASSERT(spatialLayer < this->spatialLayers, "spatialLayer too high");
 
-		uint32_t rate{ 0u };
+		UpdateRates(nowMs);
 
-		// clang-format off
-		for (
-			size_t tIdx{ 0u };
-			tIdx < this->spatialLayerCounters[spatialLayer].size();
-			++tIdx
-		)
-		// clang-format on
-		{
-			auto& temporalLayerCounter = this->spatialLayerCounters[spatialLayer][tIdx];
+		const size_t lastIdx = GetLayerIndex(spatialLayer, this->temporalLayers - 1);
+		uint32_t rate        = this->accumulatedRates[lastIdx];
 
-			rate += temporalLayerCounter.GetBitrate(nowMs);
+		if (spatialLayer > 0)
+		{
+			rate -= this->accumulatedRates[GetLayerIndex(spatialLayer - 1, this->temporalLayers - 1)];
 		}
 
 		return rate;
@@ -143,13 +115,12 @@ namespace RTC
 	{
 		MS_TRACE();
 
-		MS_ASSERT(spatialLayer < this->spatialLayerCounters.size(), "spatialLayer too high");
-		MS_ASSERT(
-		  temporalLayer < this->spatialLayerCounters[spatialLayer].size(), "temporalLayer too high");
+		MS_ASSERT(spatialLayer < this->spatialLayers, "spatialLayer too high");
+		MS_ASSERT(temporalLayer < this->temporalLayers, "temporalLayer too high");
 
-		auto& counter = this->spatialLayerCounters[spatialLayer][temporalLayer];
+		UpdateRates(nowMs);
 
-		return counter.GetBitrate(nowMs);
+		return this->layerRates[GetLayerIndex(spatialLayer, temporalLayer)];
 	}
 
 	size_t RtpStreamRecv::TransmissionCounter::GetPacketCount() const
@@ -158,12 +129,9 @@ namespace RTC
 
 		size_t packetCount{ 0u };
 
-		for (const auto& spatialLayerCounter : this->spatialLayerCounters)
+		for (const auto& counter : this->layerCounters)
 		{
-			for (const auto& temporalLayerCounter : spatialLayerCounter)
-			{
-				packetCount += temporalLayerCounter.GetPacketCount();
-			}
+			packetCount += counter.GetPacketCount();
 		}
 
 		return packetCount;
@@ -175,17 +143,40 @@ namespace RTC
 
 		size_t bytes{ 0u };
 
-		for (const auto& spatialLayerCounter : this->spatialLayerCounters)
+		for (const auto& counter : this->layerCounters)
 		{
-			for (const auto& temporalLayerCounter : spatialLayerCounter)
-			{
-				bytes += temporalLayerCounter.GetBytes();
-			}
+			bytes += counter.GetBytes();
 		}
 
 		return bytes;
 	}
 
+	void RtpStreamRecv::TransmissionCounter::UpdateRates(uint64_t nowMs)
+	{
+		MS_TRACE();
+
+		if (this->ratesValid && nowMs == this->ratesTimeMs)
+		{
+			return;
+		}
+
+		uint32_t accumulatedRate{ 0u };
+
+		// NOTE: Layers are stored in the order in which they accumulate.
+		for (size_t idx{ 0u }; idx < this->layerCounters.size(); ++idx)
+		{
+			const uint32_t rate = this->layerCounters[idx].GetBitrate(nowMs);
+
+			accumulatedRate += rate;
+
+			this->layerRates[idx]       = rate;
+			this->accumulatedRates[idx] = accumulatedRate;
+		}
+
+		this->ratesTimeMs = nowMs;
+		this->ratesValid  = true;
+	}
+
 	/* Instance methods. */
 
 	RtpStreamRecv::RtpStreamRecv(
@@ -259,7 +250,9 @@ namespace RTC
 		  this->transmissionCounter.GetPacketCount(),
 		  this->transmissionCounter.GetBytes(),
 		  this->transmissionCounter.GetBitrate(nowMs),
-		  &bitrateByLayer);
+		  &bitrateByLayer,
+		  this->keyFrameCache ? this->keyFrameCache->GetHits() : 0u,
+		  this->keyFrameCache ? this->keyFrameCache->GetMisses() : 0u);
 
 		return FBS::RtpStream::CreateStats(builder, FBS::RtpStream::StatsData::RecvStats, stats.Union());
 	}
@@ -21,6 +21,10 @@ namespace RTC
 	thread_local static std::vector<RTC::RtpRetransmissionBuffer::Item*> RetransmissionContainer(
 	  MaxRequestedPackets + 1);
 	static constexpr uint32_t DefaultRtt{ 100u };
+	// Number of newest stored packets considered for RTX padding.
+	static constexpr size_t MaxRtxPaddingItems{ 16u };
+	// Below this RTT NACK/RTX recovers losses fast enough, so no FEC is sent.
+	static constexpr float FecMinRttMs{ 250.0f };
 
 	/* Class Static. */
 
@@ -68,6 +72,10 @@ namespace RTC
 		// Delete retransmission buffer.
 		delete this->retransmissionBuffer;
 		this->retransmissionBuffer = nullptr;
+
+		// Delete FEC generator.
+		delete this->fecGenerator;
+		this->fecGenerator = nullptr;
 	}
 
 	flatbuffers::Offset<FBS::RtpStream::Stats> RtpStreamSend::FillBufferStats(
@@ -97,6 +105,43 @@ namespace RTC
 		this->rtxSeq = Utils::Crypto::GetRandomUInt(0u, 0xFFFF);
 	}
 
+	void RtpStreamSend::SetFec(uint8_t payloadType, uint32_t ssrc)
+	{
+		MS_TRACE();
+
+		MS_DEBUG_TAG(
+		  rtp, "FEC enabled [ssrc:%" PRIu32 ", payloadType:%" PRIu8 "]", ssrc, payloadType);
+
+		delete this->fecGenerator;
+
+		this->fecGenerator = new RTC::FecGenerator(payloadType, ssrc, this->params.ssrc);
+	}
+
+	void RtpStreamSend::SetFecMaxBitrate(uint32_t bitrate)
+	{
+		MS_TRACE();
+
+		this->fecMaxBitrate = bitrate;
+
+		UpdateFecProtection();
+	}
+
+	/**
+	 * Must be called once the packet is sent. Returns the FEC packet protecting
+	 * it and previous ones if it completed a FEC group.
+	 */
+	RTC::RtpPacket* RtpStreamSend::GetFecPacket(const RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		if (!this->fecGenerator)
+		{
+			return nullptr;
+		}
+
+		return this->fecGenerator->AddPacket(packet);
+	}
+
 	bool RtpStreamSend::ReceivePacket(RTC::RtpPacket* packet, std::shared_ptr<RTC::RtpPacket>& sharedPacket)
 	{
 		MS_TRACE();
@@ -179,6 +224,66 @@ namespace RTC
 #endif
 	}
 
+	/**
+	 * RTX encodes a recently sent packet that fits into the given size so it can
+	 * be sent as padding (so probation also protects against losses). Returns
+	 * nullptr if RTX is not used or there is no suitable packet.
+	 * RestoreRtxPaddingPacket() must be called once the packet is sent.
+	 */
+	RTC::RtpPacket* RtpStreamSend::GetRtxPaddingPacket(size_t size)
+	{
+		MS_TRACE();
+
+		// RTX adds 2 bytes.
+		if (!this->retransmissionBuffer || !HasRtx() || size <= 2u)
+		{
+			return nullptr;
+		}
+
+		const uint64_t nowMs            = DepLibUV::GetTimeMs();
+		const uint16_t rtt              = (this->rtt > 0.0f ? this->rtt : DefaultRtt);
+		const uint64_t notResentSinceMs = nowMs > rtt ? nowMs - rtt : 0u;
+
+		auto* item = this->retransmissionBuffer->GetNewestForPadding(
+		  size - 2u, notResentSinceMs, MaxRtxPaddingItems);
+
+		if (!item)
+		{
+			return nullptr;
+		}
+
+		auto* packet = item->packet.get();
+
+		// Put correct info into the packet.
+		packet->SetSsrc(item->ssrc);
+		packet->SetSequenceNumber(item->sequenceNumber);
+		packet->SetTimestamp(item->timestamp);
+
+		// Update MID RTP extension value.
+		if (!this->mid.empty())
+		{
+			packet->UpdateMid(mid);
+		}
+
+		// Increment RTX seq.
+		++this->rtxSeq;
+
+		packet->RtxEncode(this->params.rtxPayloadType, this->params.rtxSsrc, this->rtxSeq);
+
+		// Don't resend it again if requested by a NACK within the RTT.
+		item->resentAtMs = nowMs;
+		item->sentTimes++;
+
+		return packet;
+	}
+
+	void RtpStreamSend::RestoreRtxPaddingPacket(RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		packet->RtxDecode(RtpStream::GetPayloadType(), RtpStream::GetSsrc());
+	}
+
 	void RtpStreamSend::ReceiveKeyFrameRequest(RTC::RTCP::FeedbackPs::MessageType messageType)
 	{
 		MS_TRACE();
@@ -246,6 +351,9 @@ namespace RTC
 
 		// Update the score with the received RR.
 		UpdateScore(report);
+
+		// Adapt the FEC protection to the reported loss.
+		UpdateFecProtection();
 	}
 
 	void RtpStreamSend::ReceiveRtcpXrReceiverReferenceTime(RTC::RTCP::ReceiverReferenceTime* report)
@@ -641,6 +749,38 @@ namespace RTC
 		RtpStream::UpdateScore(score);
 	}
 
+	void RtpStreamSend::UpdateFecProtection()
+	{
+		MS_TRACE();
+
+		if (!this->fecGenerator)
+		{
+			return;
+		}
+
+		size_t groupSize{ 0u };
+
+		if (this->rtt >= FecMinRttMs)
+		{
+			groupSize = RTC::FecGenerator::ComputeGroupSize(
+			  this->fractionLost, GetBitrate(DepLibUV::GetTimeMs()), this->fecMaxBitrate);
+		}
+
+		if (groupSize != this->fecGenerator->GetGroupSize())
+		{
+			MS_DEBUG_TAG(
+			  rtp,
+			  "FEC group size changed [ssrc:%" PRIu32 ", groupSize:%zu, fractionLost:%" PRIu8
+			  ", rtt:%f]",
+			  GetSsrc(),
+			  groupSize,
+			  this->fractionLost,
+			  this->rtt);
+
+			this->fecGenerator->SetGroupSize(groupSize);
+		}
+	}
+
 	void RtpStreamSend::UserOnSequenceNumberReset()
 	{
 		MS_TRACE();
@@ -379,6 +379,9 @@ namespace RTC
 #endif
 
 		usrsctp_conninput(reinterpret_cast<void*>(this->id), data, len, 0);
+
+		// Received data may need to be acknowledged.
+		DepUsrSCTP::OnSctpActivity();
 	}
 
 	void SctpAssociation::SendSctpMessage(
@@ -0,0 +1,400 @@
+#define MS_CLASS "RTC::SendOffloadPool"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "RTC/SendOffloadPool.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+#include <cerrno>
+#include <cstring> // std::memcpy()
+#ifndef _WIN32
+#include <sys/socket.h> // sendto()
+#endif
+
+namespace RTC
+{
+	/* Static methods for UV callbacks. */
+
+	inline static void onAsync(uv_async_t* handle)
+	{
+		static_cast<SendOffloadPool*>(handle->data)->OnUvAsync();
+	}
+
+	inline static void onCloseAsync(uv_handle_t* handle)
+	{
+		delete reinterpret_cast<uv_async_t*>(handle);
+	}
+
+	/* Instance methods. */
+
+	SendOffloadPool::SendOffloadPool(size_t numThreads)
+	{
+		MS_TRACE();
+
+		MS_ASSERT(numThreads > 0u, "numThreads must be greater than 0");
+
+		this->uvAsyncHandle       = new uv_async_t;
+		this->uvAsyncHandle->data = static_cast<void*>(this);
+
+		const int err =
+		  uv_async_init(DepLibUV::GetLoop(), this->uvAsyncHandle, static_cast<uv_async_cb>(onAsync));
+
+		if (err != 0)
+		{
+			delete this->uvAsyncHandle;
+			this->uvAsyncHandle = nullptr;
+
+			MS_THROW_ERROR("uv_async_init() failed: %s", uv_strerror(err));
+		}
+
+		// The pool must not keep the loop alive.
+		uv_unref(reinterpret_cast<uv_handle_t*>(this->uvAsyncHandle));
+
+		this->shards.reserve(numThreads);
+
+		for (size_t i{ 0u }; i < numThreads; ++i)
+		{
+			auto* shard = new Shard();
+
+			this->shards.emplace_back(shard);
+
+			shard->thread = std::thread(&SendOffloadPool::RunShard, this, shard);
+		}
+	}
+
+	SendOffloadPool::~SendOffloadPool()
+	{
+		MS_TRACE();
+
+		for (size_t shardIdx{ 0u }; shardIdx < this->shards.size(); ++shardIdx)
+		{
+			Flush(shardIdx);
+
+			auto* shard = this->shards[shardIdx].get();
+
+			{
+				const std::lock_guard<std::mutex> lock(shard->mutex);
+
+				shard->stopping.store(true);
+			}
+
+			shard->cv.notify_one();
+			shard->thread.join();
+		}
+
+		this->shards.clear();
+
+		uv_close(reinterpret_cast<uv_handle_t*>(this->uvAsyncHandle), static_cast<uv_close_cb>(onCloseAsync));
+	}
+
+	flatbuffers::Offset<FBS::Worker::SendOffloadPoolDump> SendOffloadPool::FillBuffer(
+	  flatbuffers::FlatBufferBuilder& builder) const
+	{
+		MS_TRACE();
+
+		return FBS::Worker::CreateSendOffloadPoolDump(
+		  builder, static_cast<uint32_t>(this->shards.size()), this->sendFallbacks);
+	}
+
+	size_t SendOffloadPool::AssignShard()
+	{
+		MS_TRACE();
+
+		const size_t shardIdx = this->nextShardIdx;
+
+		this->nextShardIdx = (this->nextShardIdx + 1) % this->shards.size();
+
+		return shardIdx;
+	}
+
+	/**
+	 * Returns false if the packet cannot be handled by the pool (too big or no
+	 * room in the shard). In that case the caller must wait for the results of
+	 * its pending packets before using the SRTP session in the loop thread.
+	 */
+	bool SendOffloadPool::Send(
+	  size_t shardIdx,
+	  Listener* listener,
+	  void* userData,
+	  RTC::SrtpSession* srtpSession,
+	  uv_os_fd_t fd,
+	  const struct sockaddr* addr,
+	  const uint8_t* data,
+	  size_t len,
+	  bool isRtcp,
+	  onSendCallback* cb)
+	{
+		MS_TRACE();
+
+		if (len + SRTP_MAX_TRAILER_LEN > SlotDataSize)
+		{
+			return false;
+		}
+
+		auto* shard           = this->shards[shardIdx].get();
+		const size_t produced = shard->produced.load(std::memory_order_relaxed);
+
+		if (produced - shard->completed >= SlotsPerShard)
+		{
+			ProcessCompletions(shard);
+
+			if (produced - shard->completed >= SlotsPerShard)
+			{
+				MS_DEBUG_DEV("no room in shard %zu", shardIdx);
+
+				return false;
+			}
+		}
+
+		auto& slot = shard->slots[produced & (SlotsPerShard - 1)];
+
+		slot.listener    = listener;
+		slot.userData    = userData;
+		slot.srtpSession = srtpSession;
+		slot.fd          = fd;
+		slot.cb          = cb;
+		slot.len         = len;
+		slot.isRtcp      = isRtcp;
+		slot.sent        = false;
+		slot.wouldBlock  = false;
+		slot.srtpEvents  = 0u;
+
+		switch (addr->sa_family)
+		{
+			case AF_INET:
+			{
+				std::memcpy(std::addressof(slot.addr), addr, sizeof(struct sockaddr_in));
+
+				break;
+			}
+
+			case AF_INET6:
+			{
+				std::memcpy(std::addressof(slot.addr), addr, sizeof(struct sockaddr_in6));
+
+				break;
+			}
+
+			default:
+			{
+				return false;
+			}
+		}
+
+		std::memcpy(slot.data, data, len);
+
+		// NOTE: Sequentially consistent store and load so either the shard thread
+		// sees the new slot before going to sleep or we see it sleeping.
+		shard->produced.store(produced + 1);
+
+		if (shard->sleeping.load())
+		{
+			const std::lock_guard<std::mutex> lock(shard->mutex);
+
+			shard->cv.notify_one();
+		}
+
+		return true;
+	}
+
+	/**
+	 * Blocks until the given shard has processed all its pending slots and
+	 * delivers their results.
+	 */
+	void SendOffloadPool::Flush(size_t shardIdx)
+	{
+		MS_TRACE();
+
+		auto* shard           = this->shards[shardIdx].get();
+		const size_t produced = shard->produced.load(std::memory_order_relaxed);
+
+		if (shard->processed.load(std::memory_order_acquire) != produced)
+		{
+			std::unique_lock<std::mutex> lock(shard->mutex);
+
+			// NOTE: Sequentially consistent store and load so either the shard thread
+			// sees us flushing after publishing its progress or we see its progress.
+			shard->flushing.store(true);
+
+			shard->flushedCv.wait(
+			  lock, [shard, produced]() { return shard->processed.load() == produced; });
+
+			shard->flushing.store(false);
+		}
+
+		ProcessCompletions(shard);
+	}
+
+	/**
+	 * Delivers the results of the slots already processed by the given shard
+	 * without waiting for the pending ones.
+	 */
+	void SendOffloadPool::ProcessCompletions(size_t shardIdx)
+	{
+		MS_TRACE();
+
+		ProcessCompletions(this->shards[shardIdx].get());
+	}
+
+	void SendOffloadPool::ProcessCompletions(Shard* shard)
+	{
+		MS_TRACE();
+
+		const size_t processed = shard->processed.load(std::memory_order_acquire);
+
+		// NOTE: Use < since callbacks may complete further slots in a nested call.
+		while (shard->completed < processed)
+		{
+			auto& slot = shard->slots[shard->completed & (SlotsPerShard - 1)];
+
+			auto* listener        = slot.listener;
+			auto* userData        = slot.userData;
+			auto* cb              = slot.cb;
+			const auto len        = slot.len;
+			const auto srtpEvents = slot.srtpEvents;
+			const bool sent{ slot.sent };
+			const bool wouldBlock{ slot.wouldBlock };
+
+			slot.cb = nullptr;
+
+			// Release the slot before invoking callbacks since they may send new
+			// packets.
+			++shard->completed;
+
+			if (srtpEvents != 0u)
+			{
+				RTC::SrtpSession::LogEvents(srtpEvents);
+			}
+
+			if (wouldBlock)
+			{
+				++this->sendFallbacks;
+
+				// NOTE: The slot was released but it's not reused until the listener
+				// sends it (which reads its data before anything else is queued).
+				listener->OnSendOffloadPoolPacketWouldBlock(
+				  this,
+				  userData,
+				  slot.data,
+				  len,
+				  reinterpret_cast<const struct sockaddr*>(std::addressof(slot.addr)),
+				  cb);
+
+				continue;
+			}
+
+			listener->OnSendOffloadPoolPacketSent(this, userData, len, sent);
+
+			if (cb)
+			{
+				(*cb)(sent);
+				delete cb;
+			}
+		}
+	}
+
+	// NOTE: Runs in the shard thread so it must not log nor touch loop state.
+	void SendOffloadPool::RunShard(Shard* shard)
+	{
+		size_t processed = shard->processed.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			const size_t produced = shard->produced.load(std::memory_order_acquire);
+
+			if (processed == produced)
+			{
+				std::unique_lock<std::mutex> lock(shard->mutex);
+
+				shard->sleeping.store(true);
+
+				shard->cv.wait(
+				  lock,
+				  [shard, processed]()
+				  { return shard->stopping.load() || shard->produced.load() != processed; });
+
+				shard->sleeping.store(false);
+
+				if (shard->stopping.load() && shard->produced.load() == processed)
+				{
+					return;
+				}
+
+				continue;
+			}
+
+			for (size_t n{ 0u }; processed != produced && n < MaxSlotsPerRound; ++processed, ++n)
+			{
+				ProcessSlot(shard->slots[processed & (SlotsPerShard - 1)]);
+			}
+
+			// NOTE: Sequentially consistent store and load (see Flush()).
+			shard->processed.store(processed);
+
+			if (shard->flushing.load())
+			{
+				const std::lock_guard<std::mutex> lock(shard->mutex);
+
+				shard->flushedCv.notify_one();
+			}
+
+			uv_async_send(this->uvAsyncHandle);
+		}
+	}
+
+	// NOTE: Runs in the shard thread so it must not log nor touch loop state.
+	void SendOffloadPool::ProcessSlot(Slot& slot)
+	{
+		auto intLen = static_cast<int>(slot.len);
+
+		// libsrtp events are logged by the loop thread once the slot completes.
+		RTC::SrtpSession::DeferEvents(std::addressof(slot.srtpEvents));
+
+		const bool ok = slot.isRtcp ? slot.srtpSession->ProtectRtcp(slot.data, &intLen)
+		                            : slot.srtpSession->ProtectRtp(slot.data, &intLen);
+
+		RTC::SrtpSession::DeferEvents(nullptr);
+
+		if (!ok)
+		{
+			slot.len  = 0u;
+			slot.sent = false;
+
+			return;
+		}
+
+		slot.len = static_cast<size_t>(intLen);
+
+		const auto* addr = reinterpret_cast<const struct sockaddr*>(std::addressof(slot.addr));
+		const socklen_t addrLen =
+		  addr->sa_family == AF_INET ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
+
+#ifdef _WIN32
+		const auto sent = ::sendto(
+		  reinterpret_cast<SOCKET>(slot.fd),
+		  reinterpret_cast<const char*>(slot.data),
+		  static_cast<int>(slot.len),
+		  0,
+		  addr,
+		  addrLen);
+
+		slot.wouldBlock = sent == SOCKET_ERROR && ::WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+		const auto sent = ::sendto(slot.fd, slot.data, slot.len, 0, addr, addrLen);
+
+		slot.wouldBlock = sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+#endif
+
+		slot.sent = sent == static_cast<decltype(sent)>(slot.len);
+	}
+
+	inline void SendOffloadPool::OnUvAsync()
+	{
+		MS_TRACE();
+
+		for (auto& shard : this->shards)
+		{
+			ProcessCompletions(shard.get());
+		}
+	}
+} // namespace RTC
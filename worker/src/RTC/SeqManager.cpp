@@ -3,7 +3,7 @@
 
 #include "RTC/SeqManager.hpp"
 #include "Logger.hpp"
-#include <iterator>
+#include "Utils.hpp"
 
 namespace RTC
 {
@@ -45,11 +45,12 @@ namespace RTC
 		// Update base.
 		this->base = (this->maxOutput - input) & MaxValue;
 
-		// Update maxInput.
-		this->maxInput = input;
+		// Clear dropped inputs.
+		ResetDropped();
 
-		// Clear dropped set.
-		this->dropped.clear();
+		// Update maxInput.
+		this->maxInput    = input;
+		this->maxInputExt = ExtendedBase + input;
 	}
 
 	template<typename T, uint8_t N>
@@ -58,13 +59,38 @@ namespace RTC
 		// Mark as dropped if 'input' is higher than anyone already processed.
 		if (SeqManager<T, N>::IsSeqHigherThan(input, this->maxInput))
 		{
-			this->maxInput = input;
-			// Insert input in the last position.
-			// Explicitly indicate insert() to add the input at the end, which is
-			// more performant.
-			this->dropped.insert(this->dropped.end(), input);
+			SetMaxInput(input);
 
-			ClearDropped();
+			const uint64_t ext = this->maxInputExt;
+
+			// Usual case, the dropped input goes after the existing ones.
+			if (this->droppedCount == 0 || ext > this->newestDroppedExt)
+			{
+				// The newest dropped input is more than half the range behind, so
+				// the existing dropped inputs are considered higher than this one
+				// and they are kept for the next cycle instead of being removed.
+				if (
+				  FullDroppedWindow && this->droppedCount != 0 &&
+				  !IsSeqLowerThan(static_cast<T>(this->newestDroppedExt & MaxValue), input))
+				{
+					MoveDroppedToNextCycle();
+				}
+				// NOTE: Cleanup before inserting so the slot of the new dropped input
+				// is guaranteed to be free.
+				else
+				{
+					ClearDropped();
+				}
+
+				InsertDropped(ext);
+			}
+			// Some dropped inputs belong to the next cycle or the first Input()
+			// moved maxInput backwards.
+			else
+			{
+				InsertDropped(ext);
+				ClearDropped();
+			}
 		}
 	}
 
@@ -74,7 +100,7 @@ namespace RTC
 		auto base = this->base;
 
 		// No dropped inputs to consider.
-		if (this->dropped.empty())
+		if (this->droppedCount == 0)
 		{
 			goto done;
 		}
@@ -84,7 +110,7 @@ namespace RTC
 			// Set 'maxInput' here if needed before calling ClearDropped().
 			if (this->started && IsSeqHigherThan(input, this->maxInput))
 			{
-				this->maxInput = input;
+				SetMaxInput(input);
 			}
 
 			ClearDropped();
@@ -93,27 +119,24 @@ namespace RTC
 		}
 
 		// No dropped inputs to consider after cleanup.
-		if (this->dropped.empty())
+		if (this->droppedCount == 0)
 		{
 			goto done;
 		}
-		// This input was dropped.
-		else if (this->dropped.find(input) != this->dropped.end())
-		{
-			MS_DEBUG_DEV("trying to send a dropped input");
-
-			return false;
-		}
-		// There are dropped inputs, calculate 'base' for this input.
 		else
 		{
-			auto droppedCount = this->dropped.size();
+			const uint64_t ext = GetExtendedInput(input);
+
+			// This input was dropped.
+			if (IsDropped(ext))
+			{
+				MS_DEBUG_DEV("trying to send a dropped input");
 
-			// Get the first dropped input which is higher than or equal 'input'.
-			auto it = this->dropped.lower_bound(input);
+				return false;
+			}
 
-			droppedCount -= std::distance(it, this->dropped.end());
-			base = (this->base - droppedCount) & MaxValue;
+			// There are dropped inputs, calculate 'base' for this input.
+			base = (this->base - CountDroppedLowerThan(ext)) & MaxValue;
 		}
 
 	done:
@@ -123,7 +146,7 @@ namespace RTC
 		{
 			this->started = true;
 
-			this->maxInput  = input;
+			SetMaxInput(input);
 			this->maxOutput = output;
 		}
 		else
@@ -131,7 +154,7 @@ namespace RTC
 			// New input is higher than the maximum seen.
 			if (IsSeqHigherThan(input, this->maxInput))
 			{
-				this->maxInput = input;
+				SetMaxInput(input);
 			}
 
 			// New output is higher than the maximum seen.
@@ -156,6 +179,166 @@ namespace RTC
 		return this->maxOutput;
 	}
 
+	template<typename T, uint8_t N>
+	void SeqManager<T, N>::SetMaxInput(T input)
+	{
+		this->maxInputExt = GetExtendedInput(input);
+		this->maxInput    = input;
+	}
+
+	/*
+	 * Extended value of the given input relative to the current maxInput.
+	 */
+	template<typename T, uint8_t N>
+	uint64_t SeqManager<T, N>::GetExtendedInput(T input) const
+	{
+		if (IsSeqHigherThan(input, this->maxInput))
+		{
+			return this->maxInputExt + static_cast<uint64_t>((input - this->maxInput) & MaxValue);
+		}
+		else
+		{
+			return this->maxInputExt - static_cast<uint64_t>((this->maxInput - input) & MaxValue);
+		}
+	}
+
+	template<typename T, uint8_t N>
+	void SeqManager<T, N>::InsertDropped(uint64_t ext)
+	{
+		auto& word      = this->droppedBitmap[(ext / 64) % DroppedWords];
+		const auto mask = uint64_t{ 1 } << (ext % 64);
+
+		if (this->droppedCount == 0)
+		{
+			this->oldestDroppedExt = ext;
+			this->newestDroppedExt = ext;
+		}
+		// Already present.
+		else if (ext >= this->oldestDroppedExt && ext <= this->newestDroppedExt && (word & mask) != 0)
+		{
+			return;
+		}
+		else if (ext < this->oldestDroppedExt)
+		{
+			this->oldestDroppedExt = ext;
+		}
+		else if (ext > this->newestDroppedExt)
+		{
+			this->newestDroppedExt = ext;
+		}
+
+		word |= mask;
+		++this->droppedCount;
+	}
+
+	template<typename T, uint8_t N>
+	bool SeqManager<T, N>::IsDropped(uint64_t ext) const
+	{
+		if (ext < this->oldestDroppedExt || ext > this->newestDroppedExt)
+		{
+			return false;
+		}
+
+		return (this->droppedBitmap[(ext / 64) % DroppedWords] & (uint64_t{ 1 } << (ext % 64))) != 0;
+	}
+
+	/*
+	 * Number of dropped inputs lower than the given one. Inputs are usually
+	 * close to maxInput so count from the closest end.
+	 */
+	template<typename T, uint8_t N>
+	size_t SeqManager<T, N>::CountDroppedLowerThan(uint64_t ext) const
+	{
+		if (ext <= this->oldestDroppedExt)
+		{
+			return 0u;
+		}
+		else if (ext > this->newestDroppedExt)
+		{
+			return this->droppedCount;
+		}
+		else if (ext - this->oldestDroppedExt <= this->newestDroppedExt - ext)
+		{
+			return CountDroppedInRange(this->oldestDroppedExt, ext);
+		}
+		else
+		{
+			return this->droppedCount - CountDroppedInRange(ext, this->newestDroppedExt + 1);
+		}
+	}
+
+	/*
+	 * Number of dropped inputs in [from, to).
+	 */
+	template<typename T, uint8_t N>
+	size_t SeqManager<T, N>::CountDroppedInRange(uint64_t from, uint64_t to) const
+	{
+		size_t count{ 0u };
+
+		while (from < to)
+		{
+			const auto bit      = static_cast<size_t>(from % 64);
+			const uint64_t bits = std::min<uint64_t>(64 - bit, to - from);
+			uint64_t word       = this->droppedBitmap[(from / 64) % DroppedWords] >> bit;
+
+			if (bits < 64)
+			{
+				word &= (uint64_t{ 1 } << bits) - 1;
+			}
+
+			count += Utils::Bits::CountSetBits(word);
+			from += bits;
+		}
+
+		return count;
+	}
+
+	/*
+	 * First dropped input equal or higher than the given one. There must be
+	 * one.
+	 */
+	template<typename T, uint8_t N>
+	uint64_t SeqManager<T, N>::GetNextDropped(const DroppedBitmap& bitmap, uint64_t ext)
+	{
+		uint64_t wordExt = ext - (ext % 64);
+		uint64_t word    = bitmap[(ext / 64) % DroppedWords] & (~uint64_t{ 0 } << (ext % 64));
+
+		while (word == 0)
+		{
+			wordExt += 64;
+			word = bitmap[(wordExt / 64) % DroppedWords];
+		}
+
+		return wordExt + Utils::Bits::CountTrailingZeros(word);
+	}
+
+	/*
+	 * Move all dropped inputs one cycle forward. It rarely happens so just
+	 * rebuild the bitmap.
+	 */
+	template<typename T, uint8_t N>
+	void SeqManager<T, N>::MoveDroppedToNextCycle()
+	{
+		const DroppedBitmap bitmap = this->droppedBitmap;
+		const uint64_t oldestExt   = this->oldestDroppedExt;
+		const uint64_t newestExt   = this->newestDroppedExt;
+		const size_t count         = this->droppedCount;
+
+		ResetDropped();
+
+		for (uint64_t ext = oldestExt;; ext = GetNextDropped(bitmap, ext + 1))
+		{
+			InsertDropped(ext + uint64_t{ MaxValue } + 1);
+
+			if (ext == newestExt)
+			{
+				break;
+			}
+		}
+
+		MS_ASSERT(this->droppedCount == count, "wrong number of dropped inputs");
+	}
+
 	/*
 	 * Delete droped inputs greater than maxInput, which belong to a previous
 	 * cycle.
@@ -164,29 +347,57 @@ namespace RTC
 	void SeqManager<T, N>::ClearDropped()
 	{
 		// Cleanup dropped values.
-		if (this->dropped.empty())
+		if (this->droppedCount == 0)
 		{
 			return;
 		}
 
-		const size_t previousDroppedSize = this->dropped.size();
+		size_t removed{ 0u };
 
-		for (auto it = this->dropped.begin(); it != this->dropped.end();)
+		while (this->droppedCount != 0)
 		{
-			auto value = *it;
+			const uint64_t ext = this->oldestDroppedExt;
+			const T value      = static_cast<T>(ext & MaxValue);
+
+			// NOTE: Only happens for 32 bits types, whose window is capped.
+			const bool outOfWindow =
+			  this->maxInputExt > ext && this->maxInputExt - ext >= DroppedSlots;
 
-			if (isSeqHigherThan(value, this->maxInput))
+			if (!outOfWindow && !isSeqHigherThan(value, this->maxInput))
 			{
-				it = this->dropped.erase(it);
+				break;
 			}
-			else
+
+			this->droppedBitmap[(ext / 64) % DroppedWords] &= ~(uint64_t{ 1 } << (ext % 64));
+			--this->droppedCount;
+			++removed;
+
+			if (this->droppedCount != 0)
 			{
-				break;
+				this->oldestDroppedExt = GetNextDropped(this->droppedBitmap, ext + 1);
 			}
 		}
 
 		// Adapt base.
-		this->base = (this->base - (previousDroppedSize - this->dropped.size())) & MaxValue;
+		this->base = (this->base - removed) & MaxValue;
+	}
+
+	template<typename T, uint8_t N>
+	void SeqManager<T, N>::ResetDropped()
+	{
+		if (this->droppedCount == 0)
+		{
+			return;
+		}
+
+		const uint64_t lastWord = this->newestDroppedExt / 64;
+
+		for (uint64_t word = this->oldestDroppedExt / 64; word <= lastWord; ++word)
+		{
+			this->droppedBitmap[word % DroppedWords] = 0;
+		}
+
+		this->droppedCount = 0u;
 	}
 
 	// Explicit instantiation to have all SeqManager definitions in this file.
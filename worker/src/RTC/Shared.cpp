@@ -3,12 +3,18 @@
 
 #include "RTC/Shared.hpp"
 #include "Logger.hpp"
+#include "RTC/EgressBitrateScheduler.hpp"
+#include "RTC/SendOffloadPool.hpp"
 
 namespace RTC
 {
 	Shared::Shared(
-	  ChannelMessageRegistrator* channelMessageRegistrator, Channel::ChannelNotifier* channelNotifier)
-	  : channelMessageRegistrator(channelMessageRegistrator), channelNotifier(channelNotifier)
+	  ChannelMessageRegistrator* channelMessageRegistrator,
+	  Channel::ChannelNotifier* channelNotifier,
+	  RTC::SendOffloadPool* sendOffloadPool,
+	  RTC::EgressBitrateScheduler* egressBitrateScheduler)
+	  : channelMessageRegistrator(channelMessageRegistrator), channelNotifier(channelNotifier),
+	    sendOffloadPool(sendOffloadPool), egressBitrateScheduler(egressBitrateScheduler)
 	{
 		MS_TRACE();
 	}
@@ -19,5 +25,7 @@ namespace RTC
 
 		delete this->channelMessageRegistrator;
 		delete this->channelNotifier;
+		delete this->sendOffloadPool;
+		delete this->egressBitrateScheduler;
 	}
 } // namespace RTC
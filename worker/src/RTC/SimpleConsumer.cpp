@@ -400,6 +400,14 @@ namespace RTC
 			// Send the packet.
 			this->listener->OnConsumerSendRtpPacket(this, packet);
 
+			// Send the FEC packet if this one completed a FEC group.
+			auto* fecPacket = this->rtpStream->GetFecPacket(packet);
+
+			if (fecPacket)
+			{
+				this->listener->OnConsumerSendRtpPacket(this, fecPacket);
+			}
+
 			// May emit 'trace' event.
 			EmitTraceEventRtpAndKeyFrameTypes(packet);
 		}
@@ -420,6 +428,21 @@ namespace RTC
 		packet->SetSequenceNumber(origSeq);
 	}
 
+	bool SimpleConsumer::SkipRtpPacket(RTC::RtpPacket* packet)
+	{
+		MS_TRACE();
+
+		packet->logger.consumerId = this->id;
+
+		packet->logger.Dropped(RtcLogger::RtpPacket::DropReason::NOT_FORWARDED);
+
+		// Sync the sequence number with the next sent packet so the remote
+		// doesn't see skipped packets as lost.
+		this->syncRequired = true;
+
+		return true;
+	}
+
 	bool SimpleConsumer::GetRtcp(RTC::RTCP::CompoundPacket* packet, uint64_t nowMs)
 	{
 		MS_TRACE();
@@ -674,6 +697,13 @@ namespace RTC
 		{
 			this->rtpStream->SetRtx(rtxCodec->payloadType, encoding.rtx.ssrc);
 		}
+
+		const auto* fecCodec = this->rtpParameters.GetFecCodec();
+
+		if (fecCodec && encoding.hasFec)
+		{
+			this->rtpStream->SetFec(fecCodec->payloadType, encoding.fec.ssrc);
+		}
 	}
 
 	void SimpleConsumer::RequestKeyFrame()
@@ -8,6 +8,7 @@
 #endif
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include <cstring> // std::memset(), std::memcpy()
 
 namespace RTC
@@ -17,6 +18,10 @@ namespace RTC
 	static constexpr size_t EncryptBufferSize{ 65536 };
 	thread_local static uint8_t EncryptBuffer[EncryptBufferSize];
 
+	/* Class variables. */
+
+	thread_local uint32_t* SrtpSession::deferredEvents{ nullptr };
+
 	/* Class methods. */
 
 	void SrtpSession::ClassInit()
@@ -67,11 +72,40 @@ namespace RTC
 		}
 	}
 
+	void SrtpSession::LogEvents(uint32_t events)
+	{
+		MS_TRACE();
+
+		for (uint32_t event{ 0u }; events != 0u; ++event, events >>= 1)
+		{
+			if (events & 1u)
+			{
+				LogEvent(static_cast<srtp_event_t>(event));
+			}
+		}
+	}
+
 	void SrtpSession::OnSrtpEvent(srtp_event_data_t* data)
+	{
+		// NOTE: This may run in a thread other than the loop thread (see
+		// RTC::SendOffloadPool) so check this before anything logs.
+		if (SrtpSession::deferredEvents)
+		{
+			*SrtpSession::deferredEvents |= 1u << data->event;
+
+			return;
+		}
+
+		MS_TRACE();
+
+		LogEvent(data->event);
+	}
+
+	void SrtpSession::LogEvent(srtp_event_t event)
 	{
 		MS_TRACE();
 
-		switch (data->event)
+		switch (event)
 		{
 			case event_ssrc_collision:
 				MS_WARN_TAG(srtp, "SSRC collision occurred");
@@ -192,6 +226,7 @@ namespace RTC
 	bool SrtpSession::EncryptRtp(const uint8_t** data, int* len)
 	{
 		MS_TRACE();
+		MS_PROFILE_STAGE(SRTP_ENCRYPT);
 
 		// Ensure that the resulting SRTP packet fits into the encrypt buffer.
 		if (static_cast<size_t>(*len) + SRTP_MAX_TRAILER_LEN > EncryptBufferSize)
@@ -210,6 +245,12 @@ namespace RTC
 				goto protect;
 			}
 
+			// Big packets (such as aggregated ones) don't fit into send buffers.
+			if (static_cast<size_t>(*len) + SRTP_MAX_TRAILER_LEN > DepLibUring::SendBufferSize)
+			{
+				goto protect;
+			}
+
 			// Use a preallocated buffer, if available.
 			auto* sendBuffer = DepLibUring::GetSendBuffer();
 
@@ -242,6 +283,7 @@ namespace RTC
 	bool SrtpSession::DecryptSrtp(uint8_t* data, int* len)
 	{
 		MS_TRACE();
+		MS_PROFILE_STAGE(SRTP_DECRYPT);
 
 		const srtp_err_status_t err = srtp_unprotect(this->session, static_cast<void*>(data), len);
 
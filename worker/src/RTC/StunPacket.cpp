@@ -440,6 +440,24 @@ namespace RTC
 	{
 		MS_TRACE();
 
+		return CheckAuthentication(localUsername, std::addressof(localPassword), nullptr);
+	}
+
+	StunPacket::Authentication StunPacket::CheckAuthentication(
+	  const std::string& localUsername, Utils::Crypto::HmacSha1* localHmacSha1)
+	{
+		MS_TRACE();
+
+		return CheckAuthentication(localUsername, nullptr, localHmacSha1);
+	}
+
+	StunPacket::Authentication StunPacket::CheckAuthentication(
+	  const std::string& localUsername,
+	  const std::string* localPassword,
+	  Utils::Crypto::HmacSha1* localHmacSha1)
+	{
+		MS_TRACE();
+
 		switch (this->klass)
 		{
 			case Class::REQUEST:
@@ -483,8 +501,10 @@ namespace RTC
 		}
 
 		// Calculate the HMAC-SHA1 of the message according to MESSAGE-INTEGRITY rules.
-		const uint8_t* computedMessageIntegrity = Utils::Crypto::GetHmacSha1(
-		  localPassword, this->data, (this->messageIntegrity - 4) - this->data);
+		const size_t len = (this->messageIntegrity - 4) - this->data;
+		const uint8_t* computedMessageIntegrity =
+		  localHmacSha1 ? localHmacSha1->Compute(this->data, len)
+		                : Utils::Crypto::GetHmacSha1(*localPassword, this->data, len);
 
 		Authentication result;
 
@@ -545,6 +565,21 @@ namespace RTC
 		}
 
 		this->password = password;
+		this->hmacSha1 = nullptr;
+	}
+
+	void StunPacket::Authenticate(Utils::Crypto::HmacSha1* hmacSha1)
+	{
+		// Just for Request, Indication and SuccessResponse messages.
+		if (this->klass == Class::ERROR_RESPONSE)
+		{
+			MS_ERROR("cannot set password for ErrorResponse messages");
+
+			return;
+		}
+
+		this->password.clear();
+		this->hmacSha1 = hmacSha1;
 	}
 
 	void StunPacket::Serialize(uint8_t* buffer)
@@ -559,7 +594,7 @@ namespace RTC
 		   this->klass == Class::SUCCESS_RESPONSE);
 		const bool addErrorCode = ((this->errorCode != 0u) && this->klass == Class::ERROR_RESPONSE);
 		const bool addMessageIntegrity =
-		  (this->klass != Class::ERROR_RESPONSE && !this->password.empty());
+		  (this->klass != Class::ERROR_RESPONSE && (!this->password.empty() || this->hmacSha1));
 		const bool addFingerprint{ true }; // Do always.
 
 		// Update data pointer.
@@ -809,7 +844,8 @@ namespace RTC
 
 			// Calculate the HMAC-SHA1 of the packet according to MESSAGE-INTEGRITY rules.
 			const uint8_t* computedMessageIntegrity =
-			  Utils::Crypto::GetHmacSha1(this->password, buffer, pos);
+			  this->hmacSha1 ? this->hmacSha1->Compute(buffer, pos)
+			                 : Utils::Crypto::GetHmacSha1(this->password, buffer, pos);
 
 			Utils::Byte::Set2Bytes(buffer, pos, static_cast<uint16_t>(Attribute::MESSAGE_INTEGRITY));
 			Utils::Byte::Set2Bytes(buffer, pos + 2, 20);
@@ -751,6 +751,14 @@ namespace RTC
 			// Send the packet.
 			this->listener->OnConsumerSendRtpPacket(this, packet);
 
+			// Send the FEC packet if this one completed a FEC group.
+			auto* fecPacket = this->rtpStream->GetFecPacket(packet);
+
+			if (fecPacket)
+			{
+				this->listener->OnConsumerSendRtpPacket(this, fecPacket);
+			}
+
 			// May emit 'trace' event.
 			EmitTraceEventRtpAndKeyFrameTypes(packet);
 		}
@@ -1038,6 +1046,13 @@ namespace RTC
 		{
 			this->rtpStream->SetRtx(rtxCodec->payloadType, encoding.rtx.ssrc);
 		}
+
+		const auto* fecCodec = this->rtpParameters.GetFecCodec();
+
+		if (fecCodec && encoding.hasFec)
+		{
+			this->rtpStream->SetFec(fecCodec->payloadType, encoding.fec.ssrc);
+		}
 	}
 
 	void SvcConsumer::RequestKeyFrame()
@@ -41,7 +41,8 @@ namespace RTC
 	  RTC::Transport::Listener* listener,
 	  const FBS::Transport::Options* options)
 	  : id(id), shared(shared), listener(listener), recvRtxTransmission(1000u),
-	    sendRtxTransmission(1000u), sendProbationTransmission(100u)
+	    sendRtxTransmission(1000u), sendProbationTransmission(100u),
+	    sendRtxProbationTransmission(100u)
 	{
 		MS_TRACE();
 
@@ -60,6 +61,8 @@ namespace RTC
 			this->initialAvailableOutgoingBitrate = options->initialAvailableOutgoingBitrate().value();
 		}
 
+		this->probeWithRtx = options->probeWithRtx();
+
 		if (options->enableSctp())
 		{
 			if (this->direct)
@@ -110,6 +113,11 @@ namespace RTC
 
 		// Create the RTCP timer.
 		this->rtcpTimer = new TimerHandle(this);
+
+		if (this->shared->egressBitrateScheduler)
+		{
+			this->shared->egressBitrateScheduler->AddListener(this);
+		}
 	}
 
 	Transport::~Transport()
@@ -118,6 +126,11 @@ namespace RTC
 
 		// The destructor must delete and clear everything silently.
 
+		if (this->shared->egressBitrateScheduler)
+		{
+			this->shared->egressBitrateScheduler->RemoveListener(this);
+		}
+
 		// Delete all Producers.
 		for (auto& kv : this->mapProducers)
 		{
@@ -401,7 +414,8 @@ namespace RTC
 		  this->sctpAssociation ? flatbuffers::Optional<FBS::SctpAssociation::SctpState>(sctpState)
 		                        : flatbuffers::nullopt,
 		  sctpListener,
-		  &traceEventTypes);
+		  &traceEventTypes,
+		  this->shared->channelMessageRegistrator->GetHandle(this->id));
 	}
 
 	flatbuffers::Offset<FBS::Transport::Stats> Transport::FillBufferStats(
@@ -508,7 +522,13 @@ namespace RTC
 		                  : flatbuffers::nullopt,
 		  // packetLossSent.
 		  this->tccClient ? flatbuffers::Optional<double>(this->tccClient->GetPacketLoss())
-		                  : flatbuffers::nullopt);
+		                  : flatbuffers::nullopt,
+		  // rtxProbationBytesSent.
+		  this->sendRtxProbationTransmission.GetBytes(),
+		  // rtxProbationSendBitrate.
+		  this->sendRtxProbationTransmission.GetBitrate(nowMs),
+		  // cpuTimeUs.
+		  this->cpuTimeCounter.GetTimeNs() / 1000u);
 	}
 
 	void Transport::HandleRequest(Channel::ChannelRequest* request)
@@ -693,7 +713,9 @@ namespace RTC
 
 				// Create status response.
 				auto responseOffset = FBS::Transport::CreateProduceResponse(
-				  request->GetBufferBuilder(), FBS::RtpParameters::Type(producer->GetType()));
+				  request->GetBufferBuilder(),
+				  FBS::RtpParameters::Type(producer->GetType()),
+				  this->shared->channelMessageRegistrator->GetHandle(producer->id));
 
 				request->Accept(FBS::Response::Body::Transport_ProduceResponse, responseOffset);
 
@@ -872,7 +894,8 @@ namespace RTC
 				  consumer->IsPaused(),
 				  consumer->IsProducerPaused(),
 				  scoreOffset,
-				  preferredLayersOffset);
+				  preferredLayersOffset,
+				  this->shared->channelMessageRegistrator->GetHandle(consumer->id));
 
 				request->Accept(FBS::Response::Body::Transport_ConsumeResponse, responseOffset);
 
@@ -1545,6 +1568,7 @@ namespace RTC
 	void Transport::ReceiveRtpPacket(RTC::RtpPacket* packet)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		packet->logger.recvTransportId = this->id;
 
@@ -1570,14 +1594,19 @@ namespace RTC
 		{
 			packet->logger.Dropped(RtcLogger::RtpPacket::DropReason::PRODUCER_NOT_FOUND);
 
-			MS_WARN_TAG(
-			  rtp,
-			  "no suitable Producer for received RTP packet [ssrc:%" PRIu32 ", payloadType:%" PRIu8 "]",
-			  packet->GetSsrc(),
-			  packet->GetPayloadType());
+			// Just report the unknown SSRC once in a while rather than for every
+			// packet (i.e. stale streams after a renegotiation).
+			if (this->rtpListener.AddUnknownSsrc(packet->GetSsrc(), nowMs))
+			{
+				MS_WARN_TAG(
+				  rtp,
+				  "no suitable Producer for received RTP packet [ssrc:%" PRIu32 ", payloadType:%" PRIu8 "]",
+				  packet->GetSsrc(),
+				  packet->GetPayloadType());
 
-			// Tell the child class to remove this SSRC.
-			RecvStreamClosed(packet->GetSsrc());
+				// Tell the child class to remove this SSRC.
+				RecvStreamClosed(packet->GetSsrc());
+			}
 
 			delete packet;
 
@@ -1614,6 +1643,7 @@ namespace RTC
 	void Transport::ReceiveRtcpPacket(RTC::RTCP::Packet* packet)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		// Handle each RTCP packet.
 		while (packet)
@@ -2238,6 +2268,12 @@ namespace RTC
 		bool baseAllocation       = true;
 		uint32_t availableBitrate = this->tccClient->GetAvailableBitrate();
 
+		// Never go beyond the cap given by the EgressBitrateScheduler.
+		if (this->egressBitrateCap > 0u)
+		{
+			availableBitrate = std::min(availableBitrate, this->egressBitrateCap);
+		}
+
 		this->tccClient->RescheduleNextAvailableBitrateEvent();
 
 		MS_DEBUG_DEV("before layer-by-layer iterations [availableBitrate:%" PRIu32 "]", availableBitrate);
@@ -2286,6 +2322,28 @@ namespace RTC
 
 		MS_DEBUG_DEV("after layer-by-layer iterations [availableBitrate:%" PRIu32 "]", availableBitrate);
 
+		// Split the bitrate left among the streams sending FEC, so their FEC
+		// protection does not go beyond the BWE.
+		std::vector<RTC::RtpStreamSend*> fecRtpStreams;
+
+		for (auto it = multimapPriorityConsumer.rbegin(); it != multimapPriorityConsumer.rend(); ++it)
+		{
+			auto* consumer = it->second;
+
+			for (auto* rtpStream : consumer->GetRtpStreams())
+			{
+				if (rtpStream->HasFec())
+				{
+					fecRtpStreams.push_back(rtpStream);
+				}
+			}
+		}
+
+		for (auto* rtpStream : fecRtpStreams)
+		{
+			rtpStream->SetFecMaxBitrate(availableBitrate / fecRtpStreams.size());
+		}
+
 		// Finally instruct Consumers to apply their computed layers.
 		for (auto it = multimapPriorityConsumer.rbegin(); it != multimapPriorityConsumer.rend(); ++it)
 		{
@@ -2313,6 +2371,12 @@ namespace RTC
 
 		MS_DEBUG_DEV("total desired bitrate: %" PRIu32, totalDesiredBitrate);
 
+		// Don't probe beyond the cap given by the EgressBitrateScheduler.
+		if (this->egressBitrateCap > 0u)
+		{
+			totalDesiredBitrate = std::min(totalDesiredBitrate, this->egressBitrateCap);
+		}
+
 		this->tccClient->SetDesiredBitrate(totalDesiredBitrate, forceBitrate);
 	}
 
@@ -2441,6 +2505,7 @@ namespace RTC
 	inline void Transport::OnConsumerSendRtpPacket(RTC::Consumer* consumer, RTC::RtpPacket* packet)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		packet->logger.sendTransportId = this->id;
 		packet->logger.Sent();
@@ -2487,7 +2552,7 @@ namespace RTC
 			sentInfo.sendingAtMs = DepLibUV::GetTimeMs();
 
 			auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo, senderBweWeakPtr, &sentInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo, senderBweWeakPtr, sentInfo](bool sent) mutable
 			  {
 				  if (sent)
 				  {
@@ -2511,7 +2576,7 @@ namespace RTC
 			SendRtpPacket(consumer, packet, cb);
 #else
 			const auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo](bool sent)
 			  {
 				  if (sent)
 				  {
@@ -2538,6 +2603,7 @@ namespace RTC
 	inline void Transport::OnConsumerRetransmitRtpPacket(RTC::Consumer* consumer, RTC::RtpPacket* packet)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		// Update abs-send-time if present.
 		packet->UpdateAbsSendTime(DepLibUV::GetTimeMs());
@@ -2576,7 +2642,7 @@ namespace RTC
 			sentInfo.sendingAtMs = DepLibUV::GetTimeMs();
 
 			auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo, senderBweWeakPtr, &sentInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo, senderBweWeakPtr, sentInfo](bool sent) mutable
 			  {
 				  if (sent)
 				  {
@@ -2600,7 +2666,7 @@ namespace RTC
 			SendRtpPacket(consumer, packet, cb);
 #else
 			const auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo](bool sent)
 			  {
 				  if (sent)
 				  {
@@ -2914,6 +2980,66 @@ namespace RTC
 		}
 	}
 
+	inline uint32_t Transport::GetEgressSendBitrate(uint64_t nowMs)
+	{
+		MS_TRACE();
+
+		return this->sendTransmission.GetRate(nowMs);
+	}
+
+	inline uint32_t Transport::GetEgressDesiredBitrate() const
+	{
+		MS_TRACE();
+
+		uint32_t totalDesiredBitrate{ 0u };
+
+		for (const auto& kv : this->mapConsumers)
+		{
+			auto* consumer = kv.second;
+
+			totalDesiredBitrate += consumer->GetDesiredBitrate();
+		}
+
+		return totalDesiredBitrate;
+	}
+
+	/**
+	 * The priority of the Transport is the highest bitrate priority of its
+	 * Consumers.
+	 */
+	inline uint8_t Transport::GetEgressPriority() const
+	{
+		MS_TRACE();
+
+		uint8_t priority{ 0u };
+
+		for (const auto& kv : this->mapConsumers)
+		{
+			auto* consumer = kv.second;
+
+			priority = std::max(priority, consumer->GetBitratePriority());
+		}
+
+		return priority;
+	}
+
+	inline void Transport::OnEgressBitrateCapChanged(
+	  RTC::EgressBitrateScheduler* /*egressBitrateScheduler*/, uint32_t cap)
+	{
+		MS_TRACE();
+
+		MS_DEBUG_DEV("egress bitrate cap changed [cap:%" PRIu32 "]", cap);
+
+		this->egressBitrateCap = cap;
+
+		// Only Transports with bandwidth estimation can be capped.
+		if (this->tccClient)
+		{
+			DistributeAvailableOutgoingBitrate();
+			ComputeOutgoingDesiredBitrate();
+		}
+	}
+
 	inline void Transport::OnTransportCongestionControlClientBitrates(
 	  RTC::TransportCongestionControlClient* /*tccClient*/,
 	  RTC::TransportCongestionControlClient::Bitrates& bitrates)
@@ -2936,6 +3062,9 @@ namespace RTC
 	{
 		MS_TRACE();
 
+		// Consumer of the packet if it's RTX padding.
+		auto* consumer = this->rtxPaddingConsumer;
+
 		// Update abs-send-time if present.
 		packet->UpdateAbsSendTime(DepLibUV::GetTimeMs());
 
@@ -2976,7 +3105,7 @@ namespace RTC
 			sentInfo.sendingAtMs = DepLibUV::GetTimeMs();
 
 			auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo, senderBweWeakPtr, &sentInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo, senderBweWeakPtr, sentInfo](bool sent) mutable
 			  {
 				  if (sent)
 				  {
@@ -2997,10 +3126,10 @@ namespace RTC
 				  }
 			  });
 
-			SendRtpPacket(nullptr, packet, cb);
+			SendRtpPacket(consumer, packet, cb);
 #else
 			const auto* cb = new onSendCallback(
-			  [tccClientWeakPtr, &packetInfo](bool sent)
+			  [tccClientWeakPtr, packetInfo](bool sent)
 			  {
 				  if (sent)
 				  {
@@ -3013,7 +3142,7 @@ namespace RTC
 				  }
 			  });
 
-			SendRtpPacket(nullptr, packet, cb);
+			SendRtpPacket(consumer, packet, cb);
 #endif
 		}
 		else
@@ -3021,7 +3150,7 @@ namespace RTC
 			// May emit 'trace' event.
 			EmitTraceEventProbationType(packet);
 
-			SendRtpPacket(nullptr, packet);
+			SendRtpPacket(consumer, packet);
 		}
 
 		this->sendProbationTransmission.Update(packet);
@@ -3032,6 +3161,57 @@ namespace RTC
 		  this->transportWideCcSeq,
 		  packet->GetSize(),
 		  this->sendProbationTransmission.GetBitrate(DepLibUV::GetTimeMs()));
+
+		if (this->rtxPaddingStream)
+		{
+			this->sendRtxProbationTransmission.Update(packet);
+
+			// Restore the packet.
+			this->rtxPaddingStream->RestoreRtxPaddingPacket(packet);
+
+			this->rtxPaddingConsumer = nullptr;
+			this->rtxPaddingStream   = nullptr;
+		}
+	}
+
+	/**
+	 * Probe with RTX of recently sent packets if enabled, so probation also
+	 * protects against losses.
+	 */
+	inline RTC::RtpPacket* Transport::OnTransportCongestionControlClientGeneratePadding(
+	  RTC::TransportCongestionControlClient* /*tccClient*/, size_t size)
+	{
+		MS_TRACE();
+
+		if (!this->probeWithRtx)
+		{
+			return nullptr;
+		}
+
+		for (auto& kv : this->mapConsumers)
+		{
+			auto* consumer = kv.second;
+
+			if (!consumer->IsActive())
+			{
+				continue;
+			}
+
+			for (auto* rtpStream : consumer->GetRtpStreams())
+			{
+				auto* packet = rtpStream->GetRtxPaddingPacket(size);
+
+				if (packet)
+				{
+					this->rtxPaddingConsumer = consumer;
+					this->rtxPaddingStream   = rtpStream;
+
+					return packet;
+				}
+			}
+		}
+
+		return nullptr;
 	}
 
 	inline void Transport::OnTransportCongestionControlServerSendRtcpPacket(
@@ -3063,9 +3243,10 @@ namespace RTC
 	}
 #endif
 
-	inline void Transport::OnTimer(TimerHandle* timer)
+	void Transport::OnTimer(TimerHandle* timer)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		// RTCP timer.
 		if (timer == this->rtcpTimer)
@@ -553,6 +553,13 @@ namespace RTC
 		MS_TRACE();
 		MS_ASSERT(this->probationGenerator, "probation generator not initialized")
 
+		auto* packet = this->listener->OnTransportCongestionControlClientGeneratePadding(this, size);
+
+		if (packet)
+		{
+			return packet;
+		}
+
 		return this->probationGenerator->GetNextPacket(size);
 	}
 
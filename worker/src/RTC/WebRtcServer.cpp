@@ -156,6 +156,12 @@ namespace RTC
 
 		this->shared->channelMessageRegistrator->UnregisterHandler(this->id);
 
+		// Packets being sent in other threads refer to our UDP sockets.
+		for (auto* webRtcTransport : this->webRtcTransports)
+		{
+			webRtcTransport->FlushSendOffload();
+		}
+
 		for (auto& item : this->udpSocketOrTcpServers)
 		{
 			delete item.udpSocket;
@@ -261,6 +261,10 @@ namespace RTC
 		// parent's destructor. See comment in Transport::OnSctpAssociationSendData().
 		Destroying();
 
+		// Wait for packets of this transport being protected and sent in other
+		// threads.
+		FlushSendOffload();
+
 		this->shared->channelMessageRegistrator->UnregisterHandler(this->id);
 
 		// Must delete the DTLS transport first since it will generate a DTLS alert
@@ -702,6 +706,11 @@ namespace RTC
 			return;
 		}
 
+		if (MaySendOffloaded(packet->GetData(), packet->GetSize(), /*isRtcp*/ false, cb))
+		{
+			return;
+		}
+
 		const uint8_t* data = packet->GetData();
 		auto intLen         = static_cast<int>(packet->GetSize());
 
@@ -744,6 +753,11 @@ namespace RTC
 			return;
 		}
 
+		if (MaySendOffloaded(data, static_cast<size_t>(intLen), /*isRtcp*/ true))
+		{
+			return;
+		}
+
 		if (!this->srtpSendSession->EncryptRtcp(&data, &intLen))
 		{
 			return;
@@ -779,6 +793,11 @@ namespace RTC
 			return;
 		}
 
+		if (MaySendOffloaded(data, static_cast<size_t>(intLen), /*isRtcp*/ true))
+		{
+			return;
+		}
+
 		if (!this->srtpSendSession->EncryptRtcp(&data, &intLen))
 		{
 			return;
@@ -831,6 +850,8 @@ namespace RTC
 
 		if (this->srtpSendSession)
 		{
+			FlushSendOffload();
+
 			this->srtpSendSession->RemoveStream(ssrc);
 		}
 	}
@@ -839,6 +860,7 @@ namespace RTC
 	  RTC::TransportTuple* tuple, const uint8_t* data, size_t len)
 	{
 		MS_TRACE();
+		const RTC::CpuTimeCounter::Scope cpuTimeScope(this->cpuTimeCounter);
 
 		// Increase receive transmission.
 		RTC::Transport::DataReceived(len);
@@ -1043,6 +1065,73 @@ namespace RTC
 		RTC::Transport::ReceiveRtcpPacket(packet);
 	}
 
+	/**
+	 * Hands the packet to the SendOffloadPool (if any) so it's SRTP protected
+	 * and sent in another thread. Returns false if the caller must protect and
+	 * send it in the loop thread.
+	 */
+	inline bool WebRtcTransport::MaySendOffloaded(
+	  const uint8_t* data, size_t len, bool isRtcp, RTC::Transport::onSendCallback* cb)
+	{
+		MS_TRACE();
+
+		auto* sendOffloadPool = this->shared->sendOffloadPool;
+
+		if (!sendOffloadPool)
+		{
+			return false;
+		}
+
+		auto* tuple = this->iceServer->GetSelectedTuple();
+
+		// Only UDP is sent off the loop thread. TCP framing and write queues
+		// belong to the loop thread.
+		if (tuple->GetProtocol() == RTC::TransportTuple::Protocol::UDP && !tuple->IsClosed())
+		{
+			if (sendOffloadPool->Send(
+			      this->sendOffloadShard,
+			      this,
+			      tuple->GetUdpSocket(),
+			      this->srtpSendSession,
+			      tuple->GetUdpSocketFd(),
+			      tuple->GetRemoteAddress(),
+			      data,
+			      len,
+			      isRtcp,
+			      cb))
+			{
+				++this->sendOffloadPending;
+
+				return true;
+			}
+		}
+
+		// The packet is sent in the loop thread (also if the shard is full) so
+		// the SRTP session can only be used once our pending packets are done.
+		FlushSendOffload();
+
+		return false;
+	}
+
+	/**
+	 * Waits for the packets of this transport in the SendOffloadPool (if any).
+	 */
+	void WebRtcTransport::FlushSendOffload()
+	{
+		MS_TRACE();
+
+		if (this->sendOffloadPending == 0u)
+		{
+			return;
+		}
+
+		// Our pending packets are in the shard before anything queued later, so
+		// waiting for what is queued so far is enough.
+		this->shared->sendOffloadPool->Flush(this->sendOffloadShard);
+
+		MS_ASSERT(this->sendOffloadPending == 0u, "packets still pending after flushing the shard");
+	}
+
 	inline void WebRtcTransport::OnUdpSocketPacketReceived(
 	  RTC::UdpSocket* socket, const uint8_t* data, size_t len, const struct sockaddr* remoteAddr)
 	{
@@ -1272,6 +1361,8 @@ namespace RTC
 		MS_DEBUG_TAG(dtls, "DTLS connected");
 
 		// Close it if it was already set and update it.
+		FlushSendOffload();
+
 		delete this->srtpSendSession;
 		this->srtpSendSession = nullptr;
 
@@ -1282,6 +1373,11 @@ namespace RTC
 		{
 			this->srtpSendSession = new RTC::SrtpSession(
 			  RTC::SrtpSession::Type::OUTBOUND, srtpCryptoSuite, srtpLocalKey, srtpLocalKeyLen);
+
+			if (this->shared->sendOffloadPool)
+			{
+				this->sendOffloadShard = this->shared->sendOffloadPool->AssignShard();
+			}
 		}
 		catch (const MediaSoupError& error)
 		{
@@ -1380,4 +1476,44 @@ namespace RTC
 		// Pass it to the parent transport.
 		RTC::Transport::ReceiveSctpData(data, len);
 	}
+
+	inline void WebRtcTransport::OnSendOffloadPoolPacketSent(
+	  RTC::SendOffloadPool* /*pool*/, void* userData, size_t len, bool sent)
+	{
+		MS_TRACE();
+
+		--this->sendOffloadPending;
+
+		// Increase send transmission (as done when sending in the loop thread
+		// unless the packet could not be protected).
+		if (len != 0u)
+		{
+			RTC::Transport::DataSent(len);
+		}
+
+		// Update sent bytes of the UDP socket (as its Send() does).
+		if (sent)
+		{
+			static_cast<RTC::UdpSocket*>(userData)->AddSentBytes(len);
+		}
+	}
+
+	inline void WebRtcTransport::OnSendOffloadPoolPacketWouldBlock(
+	  RTC::SendOffloadPool* /*pool*/,
+	  void* userData,
+	  const uint8_t* data,
+	  size_t len,
+	  const struct sockaddr* addr,
+	  RTC::SendOffloadPool::onSendCallback* cb)
+	{
+		MS_TRACE();
+
+		--this->sendOffloadPending;
+
+		// The socket buffer was full so let the UDP socket queue it in libuv.
+		static_cast<RTC::UdpSocket*>(userData)->Send(data, len, addr, cb);
+
+		// Increase send transmission.
+		RTC::Transport::DataSent(len);
+	}
 } // namespace RTC
@@ -60,6 +60,9 @@ void Settings::SetConfiguration(int argc, char* argv[])
 		{ "dtlsCertificateFile",  optional_argument, nullptr, 'c' },
 		{ "dtlsPrivateKeyFile",   optional_argument, nullptr, 'p' },
 		{ "libwebrtcFieldTrials", optional_argument, nullptr, 'W' },
+		{ "sendThreads",          optional_argument, nullptr, 's' },
+		{ "egressBitrateBudget",  optional_argument, nullptr, 'e' },
+		{ "udpSocketPoolSize",    optional_argument, nullptr, 'u' },
 		{ nullptr, 0, nullptr, 0 }
 	};
 	// clang-format on
@@ -158,6 +161,75 @@ void Settings::SetConfiguration(int argc, char* argv[])
 				break;
 			}
 
+			case 's':
+			{
+				int sendThreads;
+
+				try
+				{
+					sendThreads = std::stoi(optarg);
+				}
+				catch (const std::exception& error)
+				{
+					MS_THROW_TYPE_ERROR("%s", error.what());
+				}
+
+				if (sendThreads < 0 || sendThreads > 64)
+				{
+					MS_THROW_TYPE_ERROR("sendThreads must be between 0 and 64");
+				}
+
+				Settings::configuration.sendThreads = static_cast<uint8_t>(sendThreads);
+
+				break;
+			}
+
+			case 'e':
+			{
+				int64_t egressBitrateBudget;
+
+				try
+				{
+					egressBitrateBudget = std::stoll(optarg);
+				}
+				catch (const std::exception& error)
+				{
+					MS_THROW_TYPE_ERROR("%s", error.what());
+				}
+
+				if (egressBitrateBudget < 0 || egressBitrateBudget > UINT32_MAX)
+				{
+					MS_THROW_TYPE_ERROR("egressBitrateBudget must be between 0 and %" PRIu32, UINT32_MAX);
+				}
+
+				Settings::configuration.egressBitrateBudget = static_cast<uint32_t>(egressBitrateBudget);
+
+				break;
+			}
+
+			case 'u':
+			{
+				int udpSocketPoolSize;
+
+				try
+				{
+					udpSocketPoolSize = std::stoi(optarg);
+				}
+				catch (const std::exception& error)
+				{
+					MS_THROW_TYPE_ERROR("%s", error.what());
+				}
+
+				if (udpSocketPoolSize < 0 || udpSocketPoolSize > 1024)
+				{
+					MS_THROW_TYPE_ERROR("udpSocketPoolSize must be between 0 and 1024");
+				}
+
+				Settings::configuration.udpSocketPoolSize = static_cast<uint16_t>(udpSocketPoolSize);
+
+				break;
+			}
+
 			// Invalid option.
 			case '?':
 			{
@@ -292,6 +364,23 @@ void Settings::PrintConfiguration()
 		  info, "  libwebrtcFieldTrials : %s", Settings::configuration.libwebrtcFieldTrials.c_str());
 	}
 
+	if (Settings::configuration.sendThreads > 0u)
+	{
+		MS_DEBUG_TAG(info, "  sendThreads          : %" PRIu8, Settings::configuration.sendThreads);
+	}
+
+	if (Settings::configuration.egressBitrateBudget > 0u)
+	{
+		MS_DEBUG_TAG(
+		  info, "  egressBitrateBudget  : %" PRIu32, Settings::configuration.egressBitrateBudget);
+	}
+
+	if (Settings::configuration.udpSocketPoolSize > 0u)
+	{
+		MS_DEBUG_TAG(
+		  info, "  udpSocketPoolSize    : %" PRIu16, Settings::configuration.udpSocketPoolSize);
+	}
+
 	MS_DEBUG_TAG(info, "</configuration>");
 }
 
@@ -10,10 +10,14 @@
 #include "DepUsrSCTP.hpp"
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include "Settings.hpp"
 #include "Channel/ChannelNotifier.hpp"
 #include "FBS/response.h"
 #include "FBS/worker.h"
+#include "RTC/EgressBitrateScheduler.hpp"
+#include "RTC/PortManager.hpp"
+#include "RTC/SendOffloadPool.hpp"
 
 /* Instance methods. */
 
@@ -30,7 +34,15 @@ Worker::Worker(::Channel::ChannelSocket* channel) : channel(channel)
 	// Set up the RTC::Shared singleton.
 	this->shared = new RTC::Shared(
 	  /*channelMessageRegistrator*/ new ChannelMessageRegistrator(),
-	  /*channelNotifier*/ new Channel::ChannelNotifier(this->channel));
+	  /*channelNotifier*/ new Channel::ChannelNotifier(this->channel),
+	  /*sendOffloadPool*/
+	  Settings::configuration.sendThreads > 0u
+	    ? new RTC::SendOffloadPool(Settings::configuration.sendThreads)
+	    : nullptr,
+	  /*egressBitrateScheduler*/
+	  Settings::configuration.egressBitrateBudget > 0u
+	    ? new RTC::EgressBitrateScheduler(Settings::configuration.egressBitrateBudget)
+	    : nullptr);
 
 #ifdef MS_EXECUTABLE
 	{
@@ -43,6 +55,9 @@ Worker::Worker(::Channel::ChannelSocket* channel) : channel(channel)
 	// Create the Checker instance in DepUsrSCTP.
 	DepUsrSCTP::CreateChecker();
 
+	// Create the UDP socket pool in PortManager (if enabled).
+	RTC::PortManager::CreateUdpSocketPool();
+
 #ifdef MS_LIBURING_SUPPORTED
 	// Start polling CQEs, which will create a uv_pool_t handle.
 	DepLibUring::StartPollingCQEs();
@@ -105,6 +120,9 @@ void Worker::Close()
 	// Close the Checker instance in DepUsrSCTP.
 	DepUsrSCTP::CloseChecker();
 
+	// Close the UDP socket pool in PortManager, which closes its sockets.
+	RTC::PortManager::CloseUdpSocketPool();
+
 #ifdef MS_LIBURING_SUPPORTED
 	// Stop polling CQEs, which will close the uv_pool_t handle.
 	DepLibUring::StopPollingCQEs();
@@ -146,12 +164,15 @@ flatbuffers::Offset<FBS::Worker::DumpResponse> Worker::FillBuffer(
 	  Logger::pid,
 	  &webRtcServerIds,
 	  &routerIds,
-	  channelMessageHandlers
+	  channelMessageHandlers,
 #ifdef MS_LIBURING_SUPPORTED
-	  ,
-	  DepLibUring::FillBuffer(builder)
+	  DepLibUring::FillBuffer(builder),
+#else
+	  0,
 #endif
-	);
+	  DepUsrSCTP::FillBuffer(builder),
+	  RTC::PortManager::FillBuffer(builder),
+	  this->shared->sendOffloadPool ? this->shared->sendOffloadPool->FillBuffer(builder) : 0);
 }
 
 flatbuffers::Offset<FBS::Worker::ResourceUsageResponse> Worker::FillBufferResourceUsage(
@@ -299,6 +320,21 @@ inline void Worker::HandleRequest(Channel::ChannelRequest* request)
 			break;
 		}
 
+		case Channel::ChannelRequest::Method::WORKER_GET_PROFILE:
+		{
+			const auto* body   = request->data->body_as<FBS::Worker::GetProfileRequest>();
+			auto profileOffset = Profiler::FillBuffer(request->GetBufferBuilder());
+
+			if (body && body->reset())
+			{
+				Profiler::Reset();
+			}
+
+			request->Accept(FBS::Response::Body::Worker_ProfileResponse, profileOffset);
+
+			break;
+		}
+
 		case Channel::ChannelRequest::Method::WORKER_UPDATE_SETTINGS:
 		{
 			Settings::HandleRequest(request);
@@ -386,7 +422,11 @@ inline void Worker::HandleRequest(Channel::ChannelRequest* request)
 
 			MS_DEBUG_DEV("Router created [routerId:%s]", routerId.c_str());
 
-			request->Accept();
+			auto responseOffset = FBS::Worker::CreateCreateRouterResponse(
+			  request->GetBufferBuilder(),
+			  this->shared->channelMessageRegistrator->GetHandle(routerId));
+
+			request->Accept(FBS::Response::Body::Worker_CreateRouterResponse, responseOffset);
 
 			break;
 		}
@@ -420,17 +460,80 @@ inline void Worker::HandleRequest(Channel::ChannelRequest* request)
 			break;
 		}
 
+		case Channel::ChannelRequest::Method::WORKER_BATCH:
+		{
+			if (request->IsBatched())
+			{
+				MS_THROW_TYPE_ERROR("nested batch request [method:%s]", request->methodCStr);
+			}
+
+			const auto* body = request->data->body_as<FBS::Request::BatchRequest>();
+
+			for (const auto* data : *body->requests())
+			{
+				Channel::ChannelRequest* subRequest{ nullptr };
+
+				try
+				{
+					subRequest = new Channel::ChannelRequest(this->channel, data, request);
+
+					if (
+					  subRequest->method == Channel::ChannelRequest::Method::WORKER_CLOSE ||
+					  subRequest->method == Channel::ChannelRequest::Method::WORKER_BATCH)
+					{
+						MS_THROW_TYPE_ERROR("method not allowed in batch request");
+					}
+
+					HandleRequest(subRequest);
+				}
+				catch (const MediaSoupTypeError& error)
+				{
+					if (subRequest && !subRequest->replied)
+					{
+						subRequest->TypeError(error.what());
+					}
+				}
+				catch (const MediaSoupError& error)
+				{
+					if (subRequest && !subRequest->replied)
+					{
+						subRequest->Error(error.what());
+					}
+				}
+
+				delete subRequest;
+			}
+
+			request->AcceptBatch();
+
+			break;
+		}
+
 		// Any other request must be delivered to the corresponding Router.
 		default:
 		{
 			try
 			{
-				auto* handler =
-				  this->shared->channelMessageRegistrator->GetChannelRequestHandler(request->handlerId);
+				Channel::ChannelSocket::RequestHandler* handler{ nullptr };
+
+				if (request->handlerHandle != ChannelMessageRegistrator::NoHandle)
+				{
+					handler = this->shared->channelMessageRegistrator->GetChannelRequestHandler(
+					  request->handlerHandle,
+					  std::string_view(request->handlerId->c_str(), request->handlerId->size()));
+				}
+
+				// No handle or a stale or mismatching one, look up the id.
+				if (handler == nullptr)
+				{
+					handler = this->shared->channelMessageRegistrator->GetChannelRequestHandler(
+					  request->handlerId->str());
+				}
 
 				if (handler == nullptr)
 				{
-					MS_THROW_ERROR("Channel request handler with ID %s not found", request->handlerId.c_str());
+					MS_THROW_ERROR(
+					  "Channel request handler with ID %s not found", request->handlerId->c_str());
 				}
 
 				handler->HandleRequest(request);
@@ -457,13 +560,26 @@ inline void Worker::HandleNotification(Channel::ChannelNotification* notificatio
 
 	try
 	{
-		auto* handler =
-		  this->shared->channelMessageRegistrator->GetChannelNotificationHandler(notification->handlerId);
+		Channel::ChannelSocket::NotificationHandler* handler{ nullptr };
+
+		if (notification->handlerHandle != ChannelMessageRegistrator::NoHandle)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelNotificationHandler(
+			  notification->handlerHandle,
+			  std::string_view(notification->handlerId->c_str(), notification->handlerId->size()));
+		}
+
+		// No handle or a stale or mismatching one, look up the id.
+		if (handler == nullptr)
+		{
+			handler = this->shared->channelMessageRegistrator->GetChannelNotificationHandler(
+			  notification->handlerId->str());
+		}
 
 		if (handler == nullptr)
 		{
 			MS_THROW_ERROR(
-			  "Channel notification handler with ID %s not found", notification->handlerId.c_str());
+			  "Channel notification handler with ID %s not found", notification->handlerId->c_str());
 		}
 
 		handler->HandleNotification(notification);
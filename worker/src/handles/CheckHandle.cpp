@@ -0,0 +1,146 @@
+#define MS_CLASS "CheckHandle"
+// #define MS_LOG_DEV_LEVEL 3
+
+#include "handles/CheckHandle.hpp"
+#include "DepLibUV.hpp"
+#include "Logger.hpp"
+#include "MediaSoupErrors.hpp"
+
+/* Static methods for UV callbacks. */
+
+inline static void onCheck(uv_check_t* handle)
+{
+	static_cast<CheckHandle*>(handle->data)->OnUvCheck();
+}
+
+inline static void onIdle(uv_idle_t* /*handle*/)
+{
+	// Nothing to do. An active idle handle just prevents the loop from blocking.
+}
+
+inline static void onCloseCheck(uv_handle_t* handle)
+{
+	delete reinterpret_cast<uv_check_t*>(handle);
+}
+
+inline static void onCloseIdle(uv_handle_t* handle)
+{
+	delete reinterpret_cast<uv_idle_t*>(handle);
+}
+
+/* Instance methods. */
+
+CheckHandle::CheckHandle(Listener* listener) : listener(listener)
+{
+	MS_TRACE();
+
+	this->uvCheckHandle       = new uv_check_t;
+	this->uvCheckHandle->data = static_cast<void*>(this);
+
+	int err = uv_check_init(DepLibUV::GetLoop(), this->uvCheckHandle);
+
+	if (err != 0)
+	{
+		delete this->uvCheckHandle;
+		this->uvCheckHandle = nullptr;
+
+		MS_THROW_ERROR("uv_check_init() failed: %s", uv_strerror(err));
+	}
+
+	this->uvIdleHandle       = new uv_idle_t;
+	this->uvIdleHandle->data = static_cast<void*>(this);
+
+	err = uv_idle_init(DepLibUV::GetLoop(), this->uvIdleHandle);
+
+	if (err != 0)
+	{
+		delete this->uvIdleHandle;
+		this->uvIdleHandle = nullptr;
+
+		uv_close(
+		  reinterpret_cast<uv_handle_t*>(this->uvCheckHandle), static_cast<uv_close_cb>(onCloseCheck));
+
+		MS_THROW_ERROR("uv_idle_init() failed: %s", uv_strerror(err));
+	}
+}
+
+CheckHandle::~CheckHandle()
+{
+	MS_TRACE();
+
+	if (!this->closed)
+	{
+		Close();
+	}
+}
+
+void CheckHandle::Close()
+{
+	MS_TRACE();
+
+	if (this->closed)
+	{
+		return;
+	}
+
+	this->closed = true;
+
+	uv_close(
+	  reinterpret_cast<uv_handle_t*>(this->uvCheckHandle), static_cast<uv_close_cb>(onCloseCheck));
+	uv_close(reinterpret_cast<uv_handle_t*>(this->uvIdleHandle), static_cast<uv_close_cb>(onCloseIdle));
+}
+
+void CheckHandle::Start()
+{
+	MS_TRACE();
+
+	if (this->closed)
+	{
+		MS_THROW_ERROR("closed");
+	}
+
+	if (IsActive())
+	{
+		return;
+	}
+
+	int err = uv_check_start(this->uvCheckHandle, static_cast<uv_check_cb>(onCheck));
+
+	if (err != 0)
+	{
+		MS_THROW_ERROR("uv_check_start() failed: %s", uv_strerror(err));
+	}
+
+	err = uv_idle_start(this->uvIdleHandle, static_cast<uv_idle_cb>(onIdle));
+
+	if (err != 0)
+	{
+		uv_check_stop(this->uvCheckHandle);
+
+		MS_THROW_ERROR("uv_idle_start() failed: %s", uv_strerror(err));
+	}
+}
+
+void CheckHandle::Stop()
+{
+	MS_TRACE();
+
+	if (this->closed)
+	{
+		MS_THROW_ERROR("closed");
+	}
+
+	uv_check_stop(this->uvCheckHandle);
+	uv_idle_stop(this->uvIdleHandle);
+}
+
+inline void CheckHandle::OnUvCheck()
+{
+	MS_TRACE();
+
+	// A check handle is called on every loop iteration until stopped.
+	Stop();
+
+	// Notify the listener.
+	this->listener->OnCheck(this);
+}
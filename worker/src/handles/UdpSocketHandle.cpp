@@ -7,6 +7,7 @@
 #endif
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include "Utils.hpp"
 #include <cstring> // std::memcpy()
 
@@ -146,6 +147,7 @@ void UdpSocketHandle::Send(
   const uint8_t* data, size_t len, const struct sockaddr* addr, UdpSocketHandle::onSendCallback* cb)
 {
 	MS_TRACE();
+	MS_PROFILE_STAGE(UDP_SEND);
 
 	if (this->closed)
 	{
@@ -267,6 +269,28 @@ send_libuv:
 	}
 }
 
+/**
+ * Used to send datagrams from a thread other than the loop thread (see
+ * RTC::SendOffloadPool).
+ */
+uv_os_fd_t UdpSocketHandle::GetFd() const
+{
+	MS_TRACE();
+
+#ifdef MS_LIBURING_SUPPORTED
+	return this->fd;
+#else
+	uv_os_fd_t fd;
+
+	const int err =
+	  uv_fileno(reinterpret_cast<const uv_handle_t*>(this->uvHandle), std::addressof(fd));
+
+	MS_ASSERT(err == 0, "uv_fileno() failed: %s", uv_strerror(err));
+
+	return fd;
+#endif
+}
+
 uint32_t UdpSocketHandle::GetSendBufferSize() const
 {
 	MS_TRACE();
@@ -394,6 +418,8 @@ inline void UdpSocketHandle::OnUvRecv(
 	// Data received.
 	if (nread > 0)
 	{
+		MS_PROFILE_STAGE(UDP_RECV);
+
 		// Update received bytes.
 		this->recvBytes += nread;
 
@@ -12,6 +12,7 @@
 #include "DepUsrSCTP.hpp"
 #include "Logger.hpp"
 #include "MediaSoupErrors.hpp"
+#include "Profiler.hpp"
 #include "Settings.hpp"
 #include "Utils.hpp"
 #include "Worker.hpp"
@@ -134,6 +135,7 @@ extern "C" int mediasoup_worker_run(
 		Utils::Crypto::ClassInit();
 		RTC::DtlsTransport::ClassInit();
 		RTC::SrtpSession::ClassInit();
+		Profiler::ClassInit();
 
 #ifdef MS_EXECUTABLE
 		// Ignore some signals.
@@ -151,6 +153,7 @@ extern "C" int mediasoup_worker_run(
 		DepLibUring::ClassDestroy();
 #endif
 		RTC::DtlsTransport::ClassDestroy();
+		Profiler::ClassDestroy();
 		DepUsrSCTP::ClassDestroy();
 		DepLibUV::ClassDestroy();
 
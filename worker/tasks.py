@@ -532,6 +532,68 @@ def fuzzer_run_all(ctx):
         );
 
 
+@task(pre=[setup, flatc])
+def bench(ctx):
+    """
+    Build and run the mediasoup-worker-bench binary
+    """
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{MESON}" compile -C "{BUILD_DIR}" -j {NUM_CORES} mediasoup-worker-bench',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{MESON}" install -C "{BUILD_DIR}" --no-rebuild --tags mediasoup-worker-bench',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+
+    mediasoup_bench_args = os.getenv('MEDIASOUP_BENCH_ARGS') or '';
+
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{BUILD_DIR}/mediasoup-worker-bench" {mediasoup_bench_args}',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+
+
+@task(pre=[setup, flatc])
+def loadgen(ctx):
+    """
+    Build mediasoup-worker and run the mediasoup-worker-loadgen binary against it
+    """
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{MESON}" compile -C "{BUILD_DIR}" -j {NUM_CORES} mediasoup-worker mediasoup-worker-loadgen',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{MESON}" install -C "{BUILD_DIR}" --no-rebuild --tags mediasoup-worker,mediasoup-worker-loadgen',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+
+    mediasoup_loadgen_args = os.getenv('MEDIASOUP_LOADGEN_ARGS') or '';
+
+    with ctx.cd(WORKER_DIR):
+        ctx.run(
+            f'"{BUILD_DIR}/mediasoup-worker-loadgen" --worker="{BUILD_DIR}/mediasoup-worker" {mediasoup_loadgen_args}',
+            echo=True,
+            pty=PTY_SUPPORTED,
+            shell=SHELL
+        );
+
+
 @task
 def docker(ctx):
     """
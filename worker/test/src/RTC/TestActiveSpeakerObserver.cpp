@@ -0,0 +1,266 @@
+#include "common.hpp"
+#include "RTC/ActiveSpeakerObserver.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace RTC;
+
+// Straightforward implementation of the speaker activity evaluation (as it
+// was before using precomputed score tables) used as reference.
+class ReferenceSpeaker
+{
+private:
+	static constexpr uint32_t N1{ 13u };
+	static constexpr uint32_t N2{ 5u };
+	static constexpr uint32_t N3{ 10u };
+	static constexpr uint32_t MaxLevel{ 127u };
+	static constexpr uint32_t MinLevel{ 0u };
+	static constexpr uint32_t MinLevelWindowLen{ 15 * 1000 / 20 };
+	static constexpr uint32_t MediumThreshold{ 7u };
+	static constexpr uint32_t LongThreashold{ 4u };
+	static constexpr uint32_t SubunitLengthN1{ (MaxLevel - MinLevel + N1 - 1) / N1 };
+	static constexpr uint32_t LevelsBuffLen{ 50u };
+	static constexpr double MinActivityScore{ 0.0000000001 };
+
+public:
+	explicit ReferenceSpeaker(uint64_t now) : lastLevelChangeTime(now)
+	{
+	}
+
+	void EvalActivityScores()
+	{
+		if (ComputeImmediates())
+		{
+			this->scores[0] = ComputeActivityScore(this->immediates[0], N1, 0.5, 0.78);
+
+			if (ComputeBigs(this->immediates, this->mediums, MediumThreshold))
+			{
+				this->scores[1] = ComputeActivityScore(this->mediums[0], N2, 0.5, 24);
+
+				if (ComputeBigs(this->mediums, this->longs, LongThreashold))
+				{
+					this->scores[2] = ComputeActivityScore(this->longs[0], N3, 0.5, 47);
+				}
+			}
+		}
+	}
+
+	void LevelChanged(uint32_t level, uint64_t now)
+	{
+		if (this->lastLevelChangeTime > now)
+		{
+			return;
+		}
+
+		const uint64_t elapsed = now - this->lastLevelChangeTime;
+
+		this->lastLevelChangeTime = now;
+
+		const int8_t b = level > MaxLevel ? MaxLevel : level;
+		const uint32_t intervalsUpdated =
+		  std::min(std::max(static_cast<uint32_t>(elapsed / 20), 1U), LevelsBuffLen);
+
+		for (uint32_t i{ 0u }; i < intervalsUpdated; ++i)
+		{
+			this->levels[this->nextLevelIndex] = b;
+			this->nextLevelIndex               = (this->nextLevelIndex + 1) % LevelsBuffLen;
+		}
+
+		UpdateMinLevel(b);
+	}
+
+private:
+	static double ComputeActivityScore(uint8_t vL, uint32_t nR, double p, double lambda)
+	{
+		int64_t r = vL;
+
+		if (r < static_cast<int64_t>(nR) - r)
+		{
+			r = nR - r;
+		}
+
+		int64_t t{ 1 };
+
+		for (int64_t i = nR, j = 1; i > r; i--, ++j)
+		{
+			t = t * i / j;
+		}
+
+		const double activityScore = std::log(t) + vL * std::log(p) + (nR - vL) * std::log(1 - p) -
+		                             std::log(lambda) + lambda * vL;
+
+		return activityScore < MinActivityScore ? MinActivityScore : activityScore;
+	}
+
+	static bool ComputeBigs(
+	  const std::vector<uint8_t>& littles, std::vector<uint8_t>& bigs, uint8_t threashold)
+	{
+		const size_t littleLenPerBig = littles.size() / bigs.size();
+		bool changed{ false };
+
+		for (size_t b = 0u, l = 0u; b < bigs.size(); ++b)
+		{
+			uint8_t sum{ 0u };
+
+			for (const size_t lEnd = l + littleLenPerBig; l < lEnd; ++l)
+			{
+				if (littles[l] > threashold)
+				{
+					++sum;
+				}
+			}
+
+			if (bigs[b] != sum)
+			{
+				bigs[b] = sum;
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+
+	bool ComputeImmediates()
+	{
+		const int8_t minLevel = this->minLevel + SubunitLengthN1;
+		bool changed{ false };
+
+		for (size_t i = 0; i < this->immediates.size(); ++i)
+		{
+			const size_t levelIndex = this->nextLevelIndex >= (i + 1)
+			                            ? this->nextLevelIndex - i - 1
+			                            : this->nextLevelIndex + LevelsBuffLen - i - 1;
+			uint8_t level           = this->levels[levelIndex];
+
+			if (level < minLevel)
+			{
+				level = MinLevel;
+			}
+
+			const uint8_t immediate = level / SubunitLengthN1;
+
+			if (this->immediates[i] != immediate)
+			{
+				this->immediates[i] = immediate;
+				changed             = true;
+			}
+		}
+
+		return changed;
+	}
+
+	void UpdateMinLevel(int8_t level)
+	{
+		if (level == MinLevel)
+		{
+			return;
+		}
+
+		if (this->minLevel == MinLevel || this->minLevel > level)
+		{
+			this->minLevel              = level;
+			this->nextMinLevel          = MinLevel;
+			this->nextMinLevelWindowLen = 0;
+		}
+		else if (this->nextMinLevel == MinLevel)
+		{
+			this->nextMinLevel          = level;
+			this->nextMinLevelWindowLen = 1;
+		}
+		else
+		{
+			if (this->nextMinLevel > level)
+			{
+				this->nextMinLevel = level;
+			}
+
+			if (++this->nextMinLevelWindowLen >= MinLevelWindowLen)
+			{
+				double newMinLevel = std::sqrt(static_cast<double>(this->minLevel * this->nextMinLevel));
+
+				newMinLevel = std::min(std::max(newMinLevel, 0.0), static_cast<double>(MaxLevel));
+
+				this->minLevel              = static_cast<int8_t>(newMinLevel);
+				this->nextMinLevel          = MinLevel;
+				this->nextMinLevelWindowLen = 0;
+			}
+		}
+	}
+
+public:
+	double scores[3]{ MinActivityScore, MinActivityScore, MinActivityScore };
+
+private:
+	uint64_t lastLevelChangeTime;
+	uint8_t minLevel{ 0u };
+	uint8_t nextMinLevel{ 0u };
+	uint32_t nextMinLevelWindowLen{ 0u };
+	std::vector<uint8_t> immediates = std::vector<uint8_t>(50u, 0u);
+	std::vector<uint8_t> mediums    = std::vector<uint8_t>(10u, 0u);
+	std::vector<uint8_t> longs      = std::vector<uint8_t>(1u, 0u);
+	std::vector<uint8_t> levels     = std::vector<uint8_t>(LevelsBuffLen, 0u);
+	size_t nextLevelIndex{ 0u };
+};
+
+SCENARIO("ActiveSpeakerObserver", "[rtc][ActiveSpeakerObserver]")
+{
+	SECTION("speaker activity scores match reference implementation")
+	{
+		constexpr size_t NumSpeakers{ 32u };
+
+		std::mt19937 rng(1234u);
+		std::uniform_int_distribution<uint32_t> levelDist(0u, 127u);
+		std::uniform_int_distribution<uint32_t> gapDist(0u, 20u);
+
+		std::vector<ActiveSpeakerObserver::Speaker> speakers(NumSpeakers);
+		std::vector<ReferenceSpeaker> referenceSpeakers;
+		uint64_t now{ 0u };
+
+		for (const auto& speaker : speakers)
+		{
+			referenceSpeakers.emplace_back(speaker.lastLevelChangeTime);
+			now = std::max(now, speaker.lastLevelChangeTime);
+		}
+
+		for (size_t tick{ 0u }; tick < 2000u; ++tick)
+		{
+			now += 20u;
+
+			for (size_t i{ 0u }; i < NumSpeakers; ++i)
+			{
+				// Some speakers are mostly silent, others talk or have gaps (DTX).
+				const uint32_t level = (i % 4u == 0u) ? levelDist(rng) / 8u : levelDist(rng);
+
+				if (gapDist(rng) == 0u)
+				{
+					continue;
+				}
+
+				speakers[i].LevelChanged(level, now);
+				referenceSpeakers[i].LevelChanged(level, now);
+			}
+
+			// Evaluate every 300 ms as the observer does by default.
+			if (tick % 15u != 0u)
+			{
+				continue;
+			}
+
+			for (size_t i{ 0u }; i < NumSpeakers; ++i)
+			{
+				speakers[i].EvalActivityScores();
+				referenceSpeakers[i].EvalActivityScores();
+
+				for (uint8_t interval{ 0u }; interval < 3u; ++interval)
+				{
+					REQUIRE(speakers[i].GetActivityScore(interval) == referenceSpeakers[i].scores[interval]);
+					REQUIRE(
+					  speakers[i].GetRelativeActivityScore(interval, std::addressof(speakers[0])) ==
+					  std::log(referenceSpeakers[i].scores[interval] / referenceSpeakers[0].scores[interval]));
+				}
+			}
+		}
+	}
+}
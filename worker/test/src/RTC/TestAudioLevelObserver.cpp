@@ -0,0 +1,323 @@
+#include "common.hpp"
+#include "ChannelMessageRegistrator.hpp"
+#include "Channel/ChannelNotifier.hpp"
+#include "Channel/ChannelSocket.hpp"
+#include "FBS/audioLevelObserver.h"
+#include "FBS/transport.h"
+#include "RTC/AudioLevelObserver.hpp"
+#include "RTC/Producer.hpp"
+#include "RTC/RtpPacket.hpp"
+#include "RTC/Shared.hpp"
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+
+using namespace RTC;
+
+class TestAudioLevelObserverProducerListener : public Producer::Listener
+{
+public:
+	void OnProducerReceiveData(Producer* /*producer*/, size_t /*len*/) override
+	{
+	}
+	void OnProducerReceiveRtpPacket(Producer* /*producer*/, RtpPacket* /*packet*/) override
+	{
+	}
+	void OnProducerPaused(Producer* /*producer*/) override
+	{
+	}
+	void OnProducerResumed(Producer* /*producer*/) override
+	{
+	}
+	void OnProducerNewRtpStream(
+	  Producer* /*producer*/, RtpStreamRecv* /*rtpStream*/, uint32_t /*mappedSsrc*/) override
+	{
+	}
+	void OnProducerRtpStreamScore(
+	  Producer* /*producer*/,
+	  RtpStreamRecv* /*rtpStream*/,
+	  uint8_t /*score*/,
+	  uint8_t /*previousScore*/) override
+	{
+	}
+	void OnProducerRtcpSenderReport(
+	  Producer* /*producer*/, RtpStreamRecv* /*rtpStream*/, bool /*first*/) override
+	{
+	}
+	void OnProducerRtpPacketReceived(Producer* /*producer*/, RtpPacket* /*packet*/) override
+	{
+	}
+	void OnProducerSendRtcpPacket(Producer* /*producer*/, RTCP::Packet* /*packet*/) override
+	{
+	}
+	void OnProducerNeedWorstRemoteFractionLost(
+	  Producer* /*producer*/, uint32_t /*mappedSsrc*/, uint8_t& /*worstRemoteFractionLost*/) override
+	{
+	}
+};
+
+class TestAudioLevelObserverListener : public RtpObserver::Listener
+{
+public:
+	Producer* RtpObserverGetProducer(
+	  RtpObserver* /*rtpObserver*/, const std::string& /*id*/) override
+	{
+		return nullptr;
+	}
+	void OnRtpObserverAddProducer(RtpObserver* /*rtpObserver*/, Producer* /*producer*/) override
+	{
+	}
+	void OnRtpObserverRemoveProducer(RtpObserver* /*rtpObserver*/, Producer* /*producer*/) override
+	{
+	}
+};
+
+// Notifications emitted by the AudioLevelObserver are discarded.
+static ChannelReadFreeFn ChannelRead(
+  uint8_t** /*message*/,
+  uint32_t* /*messageLen*/,
+  size_t* /*messageCtx*/,
+  const void* /*handle*/,
+  ChannelReadCtx /*ctx*/)
+{
+	return nullptr;
+}
+
+static void ChannelWrite(
+  const uint8_t* /*message*/, uint32_t /*messageLen*/, ChannelWriteCtx /*ctx*/)
+{
+}
+
+// Creates an Opus Producer with a single encoding with the given SSRC.
+static Producer* CreateProducer(
+  Shared* shared, Producer::Listener* listener, const std::string& id, uint32_t ssrc)
+{
+	flatbuffers::FlatBufferBuilder builder;
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpCodecParameters>> codecs{
+		FBS::RtpParameters::CreateRtpCodecParametersDirect(builder, "audio/opus", 100, 48000, 2)
+	};
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpHeaderExtensionParameters>>
+	  headerExtensions;
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>> encodings{
+		FBS::RtpParameters::CreateRtpEncodingParametersDirect(builder, ssrc)
+	};
+	auto rtcp = FBS::RtpParameters::CreateRtcpParametersDirect(builder, "cname");
+	auto rtpParameters = FBS::RtpParameters::CreateRtpParametersDirect(
+	  builder, nullptr, &codecs, &headerExtensions, &encodings, rtcp);
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::CodecMapping>> codecMappings{
+		FBS::RtpParameters::CreateCodecMapping(builder, 100, 100)
+	};
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::EncodingMapping>> encodingMappings{
+		FBS::RtpParameters::CreateEncodingMappingDirect(builder, nullptr, ssrc, nullptr, ssrc)
+	};
+	auto rtpMapping =
+	  FBS::RtpParameters::CreateRtpMappingDirect(builder, &codecMappings, &encodingMappings);
+
+	builder.Finish(FBS::Transport::CreateProduceRequestDirect(
+	  builder, id.c_str(), FBS::RtpParameters::MediaKind::AUDIO, rtpParameters, rtpMapping));
+
+	const auto* data =
+	  flatbuffers::GetRoot<FBS::Transport::ProduceRequest>(builder.GetBufferPointer());
+
+	return new Producer(shared, id, listener, data);
+}
+
+static AudioLevelObserver* CreateAudioLevelObserver(
+  Shared* shared, RtpObserver::Listener* listener, uint16_t lastN)
+{
+	flatbuffers::FlatBufferBuilder builder;
+
+	builder.Finish(FBS::AudioLevelObserver::CreateAudioLevelObserverOptions(
+	  builder, /*maxEntries*/ 10, /*threshold*/ -127, /*interval*/ 1000, lastN));
+
+	const auto* options = flatbuffers::GetRoot<FBS::AudioLevelObserver::AudioLevelObserverOptions>(
+	  builder.GetBufferPointer());
+
+	return new AudioLevelObserver(shared, "audioLevelObserver", listener, options);
+}
+
+// Feeds the AudioLevelObserver with enough packets of the given Producer to
+// compute its average dBov.
+static void ReceiveAudioLevel(AudioLevelObserver* observer, Producer* producer, uint8_t dBov)
+{
+	// RTP packet with a ssrc-audio-level extension (id 1).
+	// clang-format off
+	uint8_t buffer[] =
+	{
+		0x90, 0x64, 0x00, 0x01, // V:2, X:1, PT:100, Seq:1
+		0x00, 0x00, 0x00, 0x04, // Timestamp:4
+		0x00, 0x00, 0x15, 0xB3, // SSRC:5555
+		0xBE, 0xDE, 0x00, 0x01, // Header Extension (One-Byte), length:1
+		0x10, 0x80, 0x00, 0x00, // id:1, len:1, V:1, level:0, padding
+		0x11, 0x22, 0x33, 0x44  // Payload
+	};
+	// clang-format on
+
+	buffer[17] |= dBov;
+
+	std::unique_ptr<RtpPacket> packet{ RtpPacket::Parse(buffer, sizeof(buffer)) };
+
+	REQUIRE(packet);
+
+	packet->SetSsrcAudioLevelExtensionId(1);
+
+	for (size_t i{ 0u }; i < 10u; ++i)
+	{
+		observer->ReceiveRtpPacket(producer, packet.get());
+	}
+}
+
+// Runs the periodic update as the interval timer does.
+static void Update(AudioLevelObserver* observer)
+{
+	static_cast<TimerHandle::Listener*>(observer)->OnTimer(nullptr);
+}
+
+SCENARIO("AudioLevelObserver last N", "[rtc][audiolevelobserver]")
+{
+	Channel::ChannelSocket channelSocket(ChannelRead, nullptr, ChannelWrite, nullptr);
+	Shared shared(new ChannelMessageRegistrator(), new Channel::ChannelNotifier(&channelSocket));
+	TestAudioLevelObserverProducerListener producerListener;
+	TestAudioLevelObserverListener observerListener;
+
+	std::unique_ptr<Producer> producerA{ CreateProducer(&shared, &producerListener, "A", 1111) };
+	std::unique_ptr<Producer> producerB{ CreateProducer(&shared, &producerListener, "B", 2222) };
+	std::unique_ptr<Producer> producerC{ CreateProducer(&shared, &producerListener, "C", 3333) };
+
+	SECTION("all Producers are forwarded if last N is 0")
+	{
+		std::unique_ptr<AudioLevelObserver> observer{ CreateAudioLevelObserver(
+		  &shared, &observerListener, 0) };
+
+		observer->AddProducer(producerA.get());
+		observer->AddProducer(producerB.get());
+		observer->AddProducer(producerC.get());
+
+		ReceiveAudioLevel(observer.get(), producerC.get(), 10);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(observer->IsForwarding(producerB.get()));
+		REQUIRE(observer->IsForwarding(producerC.get()));
+	}
+
+	SECTION("Producers are forwarded until last N is reached")
+	{
+		std::unique_ptr<AudioLevelObserver> observer{ CreateAudioLevelObserver(
+		  &shared, &observerListener, 2) };
+
+		observer->AddProducer(producerA.get());
+		observer->AddProducer(producerB.get());
+		observer->AddProducer(producerC.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(observer->IsForwarding(producerB.get()));
+		REQUIRE(!observer->IsForwarding(producerC.get()));
+
+		// A removed Producer leaves room for the loudest candidate.
+		observer->RemoveProducer(producerA.get());
+
+		REQUIRE(!observer->IsForwarding(producerA.get()));
+		REQUIRE(!observer->IsForwarding(producerC.get()));
+
+		ReceiveAudioLevel(observer.get(), producerC.get(), 90);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerB.get()));
+		REQUIRE(observer->IsForwarding(producerC.get()));
+	}
+
+	SECTION("a candidate must be louder than a forwarded Producer by 6 dBov")
+	{
+		std::unique_ptr<AudioLevelObserver> observer{ CreateAudioLevelObserver(
+		  &shared, &observerListener, 2) };
+
+		observer->AddProducer(producerA.get());
+		observer->AddProducer(producerB.get());
+		observer->AddProducer(producerC.get());
+
+		// C is 6 dBov louder than B (the quietest forwarded one).
+		ReceiveAudioLevel(observer.get(), producerA.get(), 40);
+		ReceiveAudioLevel(observer.get(), producerB.get(), 50);
+		ReceiveAudioLevel(observer.get(), producerC.get(), 44);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(observer->IsForwarding(producerB.get()));
+		REQUIRE(!observer->IsForwarding(producerC.get()));
+
+		// C is 7 dBov louder than B.
+		ReceiveAudioLevel(observer.get(), producerA.get(), 40);
+		ReceiveAudioLevel(observer.get(), producerB.get(), 50);
+		ReceiveAudioLevel(observer.get(), producerC.get(), 43);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(!observer->IsForwarding(producerB.get()));
+		REQUIRE(observer->IsForwarding(producerC.get()));
+
+		// A forwarded Producer without enough packets (DTX) counts as silent, so
+		// even a quiet candidate replaces it.
+		ReceiveAudioLevel(observer.get(), producerA.get(), 40);
+		ReceiveAudioLevel(observer.get(), producerB.get(), 120);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(observer->IsForwarding(producerB.get()));
+		REQUIRE(!observer->IsForwarding(producerC.get()));
+	}
+
+	SECTION("paused Producers are not forwarded and take a free slot once resumed")
+	{
+		std::unique_ptr<AudioLevelObserver> observer{ CreateAudioLevelObserver(
+		  &shared, &observerListener, 2) };
+
+		observer->AddProducer(producerA.get());
+		observer->AddProducer(producerB.get());
+		observer->AddProducer(producerC.get());
+
+		observer->ProducerPaused(producerA.get());
+
+		REQUIRE(!observer->IsForwarding(producerA.get()));
+
+		ReceiveAudioLevel(observer.get(), producerC.get(), 60);
+		Update(observer.get());
+
+		REQUIRE(observer->IsForwarding(producerC.get()));
+
+		// No room left.
+		observer->ProducerResumed(producerA.get());
+
+		REQUIRE(!observer->IsForwarding(producerA.get()));
+
+		observer->ProducerPaused(producerB.get());
+		observer->ProducerPaused(producerA.get());
+		observer->ProducerResumed(producerA.get());
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(!observer->IsForwarding(producerB.get()));
+		REQUIRE(observer->IsForwarding(producerC.get()));
+	}
+
+	SECTION("all Producers are forwarded while the AudioLevelObserver is paused")
+	{
+		std::unique_ptr<AudioLevelObserver> observer{ CreateAudioLevelObserver(
+		  &shared, &observerListener, 1) };
+
+		observer->AddProducer(producerA.get());
+		observer->AddProducer(producerB.get());
+
+		REQUIRE(!observer->IsForwarding(producerB.get()));
+
+		observer->Pause();
+
+		REQUIRE(observer->IsForwarding(producerA.get()));
+		REQUIRE(observer->IsForwarding(producerB.get()));
+
+		observer->Resume();
+
+		REQUIRE(!observer->IsForwarding(producerB.get()));
+	}
+}
@@ -0,0 +1,180 @@
+#include "common.hpp"
+#include "RTC/CpuTimeCounter.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm> // std::max()
+#include <uv.h>
+
+using namespace RTC;
+
+static void busyWait(uint64_t ns)
+{
+	const uint64_t startNs = uv_hrtime();
+
+	while (uv_hrtime() - startNs < ns)
+	{
+	}
+}
+
+SCENARIO("CpuTimeCounter", "[rtc][cputimecounter]")
+{
+	constexpr uint64_t WaitNs{ 1000000u }; // 1 ms.
+	constexpr uint64_t SampleInterval{ CpuTimeCounter::SampleInterval };
+
+	// NOTE: Just one in every SampleInterval call paths is measured, so every
+	// section runs SampleInterval of them and exactly one is accounted
+	// SampleInterval times.
+
+	SECTION("time of a scope is counted")
+	{
+		CpuTimeCounter counter;
+
+		REQUIRE(counter.GetTimeNs() == 0u);
+
+		for (size_t i{ 0u }; i < SampleInterval; ++i)
+		{
+			const CpuTimeCounter::Scope scope(counter);
+
+			busyWait(WaitNs);
+		}
+
+		REQUIRE(counter.GetTimeNs() >= SampleInterval * WaitNs);
+
+		const auto timeNs = counter.GetTimeNs();
+
+		// Time out of scopes is not counted.
+		busyWait(WaitNs);
+
+		REQUIRE(counter.GetTimeNs() == timeNs);
+	}
+
+	SECTION("outer scope is paused while an inner scope is open")
+	{
+		CpuTimeCounter outer;
+		CpuTimeCounter inner;
+		uint64_t maxElapsedNs{ 0u };
+
+		for (size_t i{ 0u }; i < SampleInterval; ++i)
+		{
+			const uint64_t startNs = uv_hrtime();
+
+			{
+				const CpuTimeCounter::Scope outerScope(outer);
+
+				busyWait(WaitNs);
+
+				{
+					const CpuTimeCounter::Scope innerScope(inner);
+
+					busyWait(2u * WaitNs);
+				}
+
+				busyWait(WaitNs);
+			}
+
+			maxElapsedNs = std::max(maxElapsedNs, uv_hrtime() - startNs);
+		}
+
+		// The inner scope is measured along with the outer one.
+		REQUIRE(inner.GetTimeNs() >= SampleInterval * 2u * WaitNs);
+		REQUIRE(outer.GetTimeNs() >= SampleInterval * 2u * WaitNs);
+		// Nothing is counted twice.
+		REQUIRE(outer.GetTimeNs() + inner.GetTimeNs() <= SampleInterval * maxElapsedNs);
+	}
+
+	SECTION("nested scopes of the same counter")
+	{
+		CpuTimeCounter counter;
+		uint64_t maxElapsedNs{ 0u };
+
+		for (size_t i{ 0u }; i < SampleInterval; ++i)
+		{
+			const uint64_t startNs = uv_hrtime();
+
+			{
+				const CpuTimeCounter::Scope scope1(counter);
+
+				busyWait(WaitNs);
+
+				{
+					const CpuTimeCounter::Scope scope2(counter);
+
+					busyWait(WaitNs);
+				}
+			}
+
+			maxElapsedNs = std::max(maxElapsedNs, uv_hrtime() - startNs);
+		}
+
+		REQUIRE(counter.GetTimeNs() >= SampleInterval * 2u * WaitNs);
+		REQUIRE(counter.GetTimeNs() <= SampleInterval * maxElapsedNs);
+	}
+
+	SECTION("just one in every SampleInterval call paths is measured")
+	{
+		CpuTimeCounter counter;
+		uint64_t lastTimeNs{ 0u };
+		size_t measured{ 0u };
+
+		for (size_t i{ 0u }; i < 4u * SampleInterval; ++i)
+		{
+			{
+				const CpuTimeCounter::Scope scope(counter);
+
+				busyWait(WaitNs / 10u);
+			}
+
+			if (counter.GetTimeNs() != lastTimeNs)
+			{
+				++measured;
+				lastTimeNs = counter.GetTimeNs();
+			}
+		}
+
+		REQUIRE(measured == 4u);
+	}
+
+	SECTION("entities interleaved in a fixed order are all measured")
+	{
+		CpuTimeCounter counter1;
+		CpuTimeCounter counter2;
+		uint64_t lastTimeNs1{ 0u };
+		uint64_t lastTimeNs2{ 0u };
+		size_t measured1{ 0u };
+		size_t measured2{ 0u };
+
+		// NOTE: An even number of entities whose packets arrive one after the
+		// other, so a phase shared by all of them would always measure the same
+		// entity.
+		for (size_t i{ 0u }; i < 4u * SampleInterval; ++i)
+		{
+			{
+				const CpuTimeCounter::Scope scope(counter1);
+
+				busyWait(WaitNs / 10u);
+			}
+
+			{
+				const CpuTimeCounter::Scope scope(counter2);
+
+				busyWait(WaitNs / 10u);
+			}
+
+			if (counter1.GetTimeNs() != lastTimeNs1)
+			{
+				++measured1;
+				lastTimeNs1 = counter1.GetTimeNs();
+			}
+
+			if (counter2.GetTimeNs() != lastTimeNs2)
+			{
+				++measured2;
+				lastTimeNs2 = counter2.GetTimeNs();
+			}
+		}
+
+		REQUIRE(measured1 == 4u);
+		REQUIRE(measured2 == 4u);
+		REQUIRE(counter1.GetTimeNs() >= 4u * SampleInterval * (WaitNs / 10u));
+		REQUIRE(counter2.GetTimeNs() >= 4u * SampleInterval * (WaitNs / 10u));
+	}
+}
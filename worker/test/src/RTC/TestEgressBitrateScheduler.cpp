@@ -0,0 +1,132 @@
+#include "common.hpp"
+#include "RTC/EgressBitrateScheduler.hpp"
+#include <catch2/catch.hpp>
+#include <vector>
+
+using namespace RTC;
+
+class TestEgressBitrateSchedulerListener : public EgressBitrateScheduler::Listener
+{
+public:
+	TestEgressBitrateSchedulerListener(uint8_t priority, uint32_t sendBitrate, uint32_t desiredBitrate)
+	  : priority(priority), sendBitrate(sendBitrate), desiredBitrate(desiredBitrate){};
+	~TestEgressBitrateSchedulerListener() override = default;
+	uint32_t GetEgressSendBitrate(uint64_t /*nowMs*/) override
+	{
+		return this->sendBitrate;
+	};
+	uint32_t GetEgressDesiredBitrate() const override
+	{
+		return this->desiredBitrate;
+	};
+	uint8_t GetEgressPriority() const override
+	{
+		return this->priority;
+	};
+	void OnEgressBitrateCapChanged(EgressBitrateScheduler* /*scheduler*/, uint32_t cap) override
+	{
+		this->cap = cap;
+		++this->capChanges;
+	};
+
+public:
+	uint8_t priority{ 0u };
+	uint32_t sendBitrate{ 0u };
+	uint32_t desiredBitrate{ 0u };
+	uint32_t cap{ 0u };
+	size_t capChanges{ 0u };
+};
+
+SCENARIO("EgressBitrateScheduler", "[rtp][EgressBitrateScheduler]")
+{
+	auto demand = [](uint8_t priority, uint32_t bitrate)
+	{
+		EgressBitrateScheduler::Demand demand;
+
+		demand.priority = priority;
+		demand.bitrate  = bitrate;
+
+		return demand;
+	};
+
+	SECTION("nobody is capped if the budget is not exceeded")
+	{
+		std::vector<EgressBitrateScheduler::Demand> demands{ demand(1, 500000), demand(2, 500000) };
+
+		EgressBitrateScheduler::AllocateCaps(1000000, demands);
+
+		REQUIRE(demands[0].cap == 0);
+		REQUIRE(demands[1].cap == 0);
+	}
+
+	SECTION("higher priorities keep their bitrate")
+	{
+		std::vector<EgressBitrateScheduler::Demand> demands{
+			demand(1, 600000), demand(3, 500000), demand(2, 300000)
+		};
+
+		EgressBitrateScheduler::AllocateCaps(1000000, demands);
+
+		REQUIRE(demands[1].cap == 500000);
+		REQUIRE(demands[2].cap == 300000);
+		REQUIRE(demands[0].cap == 200000);
+	}
+
+	SECTION("the budget is split proportionally within the same priority")
+	{
+		std::vector<EgressBitrateScheduler::Demand> demands{
+			demand(1, 1500000), demand(1, 500000), demand(2, 200000)
+		};
+
+		EgressBitrateScheduler::AllocateCaps(1000000, demands);
+
+		REQUIRE(demands[2].cap == 200000);
+		REQUIRE(demands[0].cap == 600000);
+		REQUIRE(demands[1].cap == 200000);
+	}
+
+	SECTION("caps are never below the minimum")
+	{
+		std::vector<EgressBitrateScheduler::Demand> demands{ demand(2, 1000000), demand(1, 500000) };
+
+		EgressBitrateScheduler::AllocateCaps(1000000, demands);
+
+		REQUIRE(demands[0].cap == 1000000);
+		REQUIRE(demands[1].cap == EgressBitrateScheduler::MinBitrateCap);
+	}
+
+	SECTION("listeners are notified only when their cap changes")
+	{
+		EgressBitrateScheduler scheduler(1000000);
+		TestEgressBitrateSchedulerListener high(2, 700000, 800000);
+		TestEgressBitrateSchedulerListener low(1, 400000, 0);
+
+		scheduler.AddListener(std::addressof(high));
+		scheduler.AddListener(std::addressof(low));
+
+		scheduler.OnTimer(nullptr);
+
+		REQUIRE(scheduler.GetSendBitrate() == 1100000);
+		REQUIRE(high.cap == 800000);
+		REQUIRE(high.capChanges == 1);
+		REQUIRE(low.cap == 200000);
+		REQUIRE(low.capChanges == 1);
+
+		scheduler.OnTimer(nullptr);
+
+		REQUIRE(high.capChanges == 1);
+		REQUIRE(low.capChanges == 1);
+
+		low.sendBitrate = 100000;
+
+		scheduler.OnTimer(nullptr);
+
+		REQUIRE(high.cap == 0);
+		REQUIRE(high.capChanges == 2);
+		REQUIRE(low.cap == 0);
+		REQUIRE(low.capChanges == 2);
+
+		scheduler.RemoveListener(std::addressof(high));
+		scheduler.RemoveListener(std::addressof(low));
+	}
+}
@@ -0,0 +1,201 @@
+#include "common.hpp"
+#include "Utils.hpp"
+#include "RTC/FecGenerator.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcpy()
+#include <vector>
+
+using namespace RTC;
+
+static constexpr uint32_t MediaSsrc{ 1111u };
+static constexpr uint32_t FecSsrc{ 2222u };
+static constexpr uint8_t FecPayloadType{ 110u };
+
+// Creates a RTP packet with a CSRC and the given payload length.
+static RtpPacket* createPacket(uint8_t* buffer, uint16_t seq, size_t payloadLength)
+{
+	// clang-format off
+	uint8_t rtpHeader[] =
+	{
+		0b10000001, 0b01100100, 0, 0,
+		0, 0, 0, 0,
+		0, 0, 0, 0,
+		0, 0, 0, 5
+	};
+	// clang-format on
+
+	std::memcpy(buffer, rtpHeader, sizeof(rtpHeader));
+
+	for (size_t idx{ 0u }; idx < payloadLength; ++idx)
+	{
+		buffer[sizeof(rtpHeader) + idx] = static_cast<uint8_t>(seq * 7 + idx);
+	}
+
+	auto* packet = RtpPacket::Parse(buffer, sizeof(rtpHeader) + payloadLength);
+
+	packet->SetSequenceNumber(seq);
+	packet->SetTimestamp(seq * 3000u);
+	packet->SetSsrc(MediaSsrc);
+	packet->SetMarker(seq % 2 == 0);
+
+	return packet;
+}
+
+SCENARIO("FecGenerator", "[rtp][fec]")
+{
+	SECTION("XorBytes() matches a byte by byte XOR for every length")
+	{
+		uint8_t src[100];
+		uint8_t dst[100];
+		uint8_t expected[100];
+
+		for (size_t len{ 0u }; len <= sizeof(src); ++len)
+		{
+			for (size_t idx{ 0u }; idx < sizeof(src); ++idx)
+			{
+				src[idx]      = static_cast<uint8_t>(idx * 13 + len);
+				dst[idx]      = static_cast<uint8_t>(idx * 31 + 7);
+				expected[idx] = idx < len ? (src[idx] ^ dst[idx]) : dst[idx];
+			}
+
+			FecGenerator::XorBytes(dst, src, len);
+
+			REQUIRE(std::memcmp(dst, expected, sizeof(dst)) == 0);
+		}
+	}
+
+	SECTION("ComputeGroupSize() adapts to the loss and the available bitrate")
+	{
+		// No loss, no FEC.
+		REQUIRE(FecGenerator::ComputeGroupSize(0, 1000000, 1000000) == 0);
+		// 5% loss.
+		REQUIRE(FecGenerator::ComputeGroupSize(13, 1000000, 1000000) == 9);
+		// Huge loss, smallest groups.
+		REQUIRE(FecGenerator::ComputeGroupSize(200, 1000000, 1000000) == FecGenerator::MinGroupSize);
+		// Tiny loss, biggest groups.
+		REQUIRE(FecGenerator::ComputeGroupSize(1, 1000000, 1000000) == FecGenerator::MaxGroupSize);
+		// Groups enlarged to fit into the available bitrate.
+		REQUIRE(FecGenerator::ComputeGroupSize(13, 1000000, 100000) == 10);
+		// Not enough available bitrate.
+		REQUIRE(FecGenerator::ComputeGroupSize(13, 1000000, 50000) == 0);
+		REQUIRE(FecGenerator::ComputeGroupSize(13, 1000000, 0) == 0);
+	}
+
+	SECTION("a lost packet is recovered from the repair packet")
+	{
+		FecGenerator fecGenerator(FecPayloadType, FecSsrc, MediaSsrc);
+		std::vector<std::vector<uint8_t>> buffers(4, std::vector<uint8_t>(1500));
+		std::vector<RtpPacket*> packets;
+		RtpPacket* fecPacket{ nullptr };
+
+		fecGenerator.SetGroupSize(4);
+
+		for (uint16_t idx{ 0u }; idx < 4; ++idx)
+		{
+			auto* packet = createPacket(buffers[idx].data(), 65534 + idx, 100 + idx * 33);
+
+			packets.push_back(packet);
+
+			fecPacket = fecGenerator.AddPacket(packet);
+
+			if (idx < 3)
+			{
+				REQUIRE(!fecPacket);
+			}
+		}
+
+		REQUIRE(fecPacket);
+		REQUIRE(fecPacket->GetSsrc() == FecSsrc);
+		REQUIRE(fecPacket->GetPayloadType() == FecPayloadType);
+		REQUIRE(fecPacket->GetTimestamp() == packets[3]->GetTimestamp());
+		REQUIRE(fecGenerator.GetPacketCount() == 1);
+
+		const uint8_t* fecHeader = fecPacket->GetPayload();
+
+		// R=0, F=0.
+		REQUIRE((fecHeader[0] & 0b11000000) == 0);
+		// SN base.
+		REQUIRE(Utils::Byte::Get2Bytes(fecHeader, 8) == 65534);
+		// k=1 and 4 packets in the mask.
+		REQUIRE(Utils::Byte::Get2Bytes(fecHeader, 10) == 0b1111100000000000);
+
+		// Recover packets[2] by XORing the repair packet with the others.
+		uint8_t recoveryHeader[8];
+		uint8_t recoveryPayload[1500]{};
+
+		std::memcpy(recoveryHeader, fecHeader, 8);
+		std::memcpy(
+		  recoveryPayload,
+		  fecHeader + FecGenerator::FecHeaderSize,
+		  fecPacket->GetPayloadLength() - FecGenerator::FecHeaderSize);
+
+		for (size_t idx : { 0u, 1u, 3u })
+		{
+			const auto* packet  = packets[idx];
+			const size_t length = packet->GetSize() - RtpPacket::HeaderSize;
+			uint8_t bitString[8];
+
+			std::memcpy(bitString, packet->GetData(), 8);
+			Utils::Byte::Set2Bytes(bitString, 2, static_cast<uint16_t>(length));
+
+			FecGenerator::XorBytes(recoveryHeader, bitString, 8);
+			FecGenerator::XorBytes(recoveryPayload, packet->GetData() + RtpPacket::HeaderSize, length);
+		}
+
+		const auto* lostPacket    = packets[2];
+		const uint16_t lostLength = Utils::Byte::Get2Bytes(recoveryHeader, 2);
+
+		REQUIRE(lostLength == lostPacket->GetSize() - RtpPacket::HeaderSize);
+		// Version is not recovered (it holds R and F).
+		REQUIRE((recoveryHeader[0] & 0b00111111) == (lostPacket->GetData()[0] & 0b00111111));
+		REQUIRE(recoveryHeader[1] == lostPacket->GetData()[1]);
+		REQUIRE(Utils::Byte::Get4Bytes(recoveryHeader, 4) == lostPacket->GetTimestamp());
+		REQUIRE(
+		  std::memcmp(recoveryPayload, lostPacket->GetData() + RtpPacket::HeaderSize, lostLength) == 0);
+
+		for (auto* packet : packets)
+		{
+			delete packet;
+		}
+	}
+
+	SECTION("a gap in the sequence numbers discards the current group")
+	{
+		FecGenerator fecGenerator(FecPayloadType, FecSsrc, MediaSsrc);
+		std::vector<std::vector<uint8_t>> buffers(3, std::vector<uint8_t>(1500));
+		std::vector<uint16_t> seqs{ 1000, 1002, 1003 };
+		std::vector<RtpPacket*> packets;
+		RtpPacket* fecPacket{ nullptr };
+
+		fecGenerator.SetGroupSize(2);
+
+		for (size_t idx{ 0u }; idx < seqs.size(); ++idx)
+		{
+			auto* packet = createPacket(buffers[idx].data(), seqs[idx], 200);
+
+			packets.push_back(packet);
+
+			fecPacket = fecGenerator.AddPacket(packet);
+
+			if (idx < 2)
+			{
+				REQUIRE(!fecPacket);
+			}
+		}
+
+		REQUIRE(fecPacket);
+		REQUIRE(Utils::Byte::Get2Bytes(fecPacket->GetPayload(), 8) == 1002);
+		REQUIRE(fecGenerator.GetPacketCount() == 1);
+
+		// Disabling takes effect with the next group.
+		fecGenerator.SetGroupSize(0);
+
+		REQUIRE(fecGenerator.GetGroupSize() == 0);
+
+		for (auto* packet : packets)
+		{
+			delete packet;
+		}
+	}
+}
@@ -0,0 +1,252 @@
+#include "common.hpp"
+#include "RTC/Codecs/PayloadDescriptorHandler.hpp"
+#include "RTC/KeyFrameCache.hpp"
+#include "RTC/RtpPacket.hpp"
+#include <catch2/catch.hpp>
+#include <memory>
+
+using namespace RTC;
+
+class TestKeyFrameCachePayloadDescriptorHandler : public Codecs::PayloadDescriptorHandler
+{
+public:
+	explicit TestKeyFrameCachePayloadDescriptorHandler(bool isKeyFrame) : isKeyFrame(isKeyFrame){};
+	~TestKeyFrameCachePayloadDescriptorHandler() override = default;
+	void Dump() const override
+	{
+		return;
+	};
+	bool Process(Codecs::EncodingContext* /*context*/, uint8_t* /*data*/, bool& /*marker*/) override
+	{
+		return true;
+	};
+	void Restore(uint8_t* /*data*/) override
+	{
+		return;
+	};
+	uint8_t GetSpatialLayer() const override
+	{
+		return 0;
+	};
+	uint8_t GetTemporalLayer() const override
+	{
+		return 0;
+	};
+	bool IsKeyFrame() const override
+	{
+		return this->isKeyFrame;
+	};
+
+private:
+	bool isKeyFrame{ false };
+};
+
+SCENARIO("KeyFrameCache", "[rtp][KeyFrameCache]")
+{
+	// clang-format off
+	uint8_t buffer[] =
+	{
+		0x80, 0x7b, 0x52, 0x0e,
+		0x5b, 0x6b, 0xca, 0xb5,
+		0x00, 0x00, 0x00, 0x02
+	};
+	// clang-format on
+
+	std::unique_ptr<RtpPacket> packet{ RtpPacket::Parse(buffer, sizeof(buffer)) };
+
+	REQUIRE(packet);
+
+	auto insert = [&packet](KeyFrameCache& cache, uint16_t seq, uint32_t timestamp, bool isKeyFrame)
+	{
+		packet->SetPayloadDescriptorHandler(new TestKeyFrameCachePayloadDescriptorHandler(isKeyFrame));
+		packet->SetSequenceNumber(seq);
+		packet->SetTimestamp(timestamp);
+
+		cache.Insert(packet.get());
+	};
+
+	SECTION("cache is not valid until a key frame is received")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, false);
+		insert(cache, 1001, 1000, false);
+
+		REQUIRE(!cache.IsValid());
+		REQUIRE(cache.GetSize() == 0);
+		REQUIRE(cache.Lookup() == nullptr);
+		REQUIRE(cache.GetHits() == 0);
+		REQUIRE(cache.GetMisses() == 1);
+	}
+
+	SECTION("key frame and following packets are cached in order")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, true);
+		insert(cache, 1001, 1000, false);
+		insert(cache, 1002, 4000, false);
+		insert(cache, 1003, 7000, false);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 4);
+
+		const auto* packets = cache.Lookup();
+
+		REQUIRE(packets != nullptr);
+		REQUIRE(packets->size() == 4);
+		REQUIRE((*packets)[0]->GetSequenceNumber() == 1000);
+		REQUIRE((*packets)[0]->GetTimestamp() == 1000);
+		REQUIRE((*packets)[3]->GetSequenceNumber() == 1003);
+		REQUIRE((*packets)[3]->GetTimestamp() == 7000);
+		REQUIRE(cache.GetHits() == 1);
+		REQUIRE(cache.GetMisses() == 0);
+	}
+
+	SECTION("packets of the same key frame flagged as key frame are appended")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, true);
+		insert(cache, 1001, 1000, true);
+		insert(cache, 1002, 1000, true);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 3);
+	}
+
+	SECTION("duplicated and old packets are ignored")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, true);
+		insert(cache, 1001, 1000, false);
+		insert(cache, 1001, 1000, false);
+		insert(cache, 999, 1000, false);
+		insert(cache, 1002, 4000, false);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 3);
+	}
+
+	SECTION("missing packet invalidates the cache until next key frame")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 65534, 1000, true);
+		insert(cache, 65535, 1000, false);
+		insert(cache, 0, 4000, false);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 3);
+
+		// Packet 1 is missing and 10 is beyond the reorder window.
+		insert(cache, 10, 7000, false);
+
+		REQUIRE(!cache.IsValid());
+		REQUIRE(cache.GetSize() == 0);
+
+		insert(cache, 11, 7000, false);
+
+		REQUIRE(!cache.IsValid());
+		REQUIRE(cache.Lookup() == nullptr);
+
+		insert(cache, 12, 10000, true);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 1);
+		REQUIRE(cache.Lookup() != nullptr);
+		REQUIRE(cache.GetHits() == 1);
+		REQUIRE(cache.GetMisses() == 1);
+	}
+
+	SECTION("packets reordered within the window are cached in order")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 65534, 1000, true);
+		insert(cache, 0, 4000, false);
+		insert(cache, 2, 7000, false);
+		insert(cache, 1, 4000, false);
+		insert(cache, 2, 7000, false);
+
+		// Packet 65535 is still missing.
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 1);
+		REQUIRE(cache.Lookup() == nullptr);
+		REQUIRE(cache.GetMisses() == 1);
+
+		insert(cache, 65535, 1000, false);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 5);
+
+		const auto* packets = cache.Lookup();
+
+		REQUIRE(packets != nullptr);
+		REQUIRE((*packets)[0]->GetSequenceNumber() == 65534);
+		REQUIRE((*packets)[1]->GetSequenceNumber() == 65535);
+		REQUIRE((*packets)[2]->GetSequenceNumber() == 0);
+		REQUIRE((*packets)[3]->GetSequenceNumber() == 1);
+		REQUIRE((*packets)[4]->GetSequenceNumber() == 2);
+		REQUIRE(cache.GetHits() == 1);
+
+		insert(cache, 3, 10000, false);
+
+		REQUIRE(cache.GetSize() == 6);
+	}
+
+	SECTION("too many packets waiting for a missing one invalidate the cache")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, true);
+
+		// Packet 1001 is missing.
+		for (uint16_t seq{ 1002 }; seq < 1002 + KeyFrameCache::ReorderWindow - 1; ++seq)
+		{
+			insert(cache, seq, 4000, false);
+		}
+
+		REQUIRE(cache.IsValid());
+
+		insert(cache, 1002 + KeyFrameCache::ReorderWindow - 1, 4000, false);
+
+		REQUIRE(!cache.IsValid());
+		REQUIRE(cache.GetSize() == 0);
+
+		insert(cache, 1001, 1000, false);
+
+		REQUIRE(!cache.IsValid());
+	}
+
+	SECTION("new key frame replaces cached packets")
+	{
+		KeyFrameCache cache;
+
+		insert(cache, 1000, 1000, true);
+		insert(cache, 1001, 4000, false);
+		insert(cache, 1002, 7000, true);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 1);
+		REQUIRE((*cache.Lookup())[0]->GetSequenceNumber() == 1002);
+	}
+
+	SECTION("cache is invalidated when full")
+	{
+		KeyFrameCache cache(3u);
+
+		insert(cache, 1000, 1000, true);
+		insert(cache, 1001, 4000, false);
+		insert(cache, 1002, 7000, false);
+
+		REQUIRE(cache.IsValid());
+		REQUIRE(cache.GetSize() == 3);
+
+		insert(cache, 1003, 10000, false);
+
+		REQUIRE(!cache.IsValid());
+		REQUIRE(cache.GetSize() == 0);
+	}
+}
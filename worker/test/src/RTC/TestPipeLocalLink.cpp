@@ -0,0 +1,196 @@
+#include "common.hpp"
+#include "DepLibUV.hpp"
+#include "MediaSoupErrors.hpp"
+#include "RTC/PipeLocalLink.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcmp()
+#include <thread>
+#include <vector>
+
+using namespace RTC;
+
+class TestPipeLocalLinkListener : public PipeLocalLink::Listener
+{
+public:
+	void OnPipeLocalLinkRtpPacketReceived(PipeLocalLink* /*link*/, RtpPacket* packet) override
+	{
+		this->ssrcs.push_back(packet->GetSsrc());
+		this->seqs.push_back(packet->GetSequenceNumber());
+
+		delete packet;
+	}
+
+	void OnPipeLocalLinkRtcpDataReceived(PipeLocalLink* /*link*/, const uint8_t* data, size_t len) override
+	{
+		this->rtcp.emplace_back(data, data + len);
+	}
+
+public:
+	std::vector<uint32_t> ssrcs;
+	std::vector<uint16_t> seqs;
+	std::vector<std::vector<uint8_t>> rtcp;
+};
+
+// Runs the loop until the listener gets the given number of RTP packets.
+static void waitForRtpPackets(TestPipeLocalLinkListener& listener, size_t numPackets)
+{
+	// Links don't keep the loop alive so use another handle for that.
+	uv_idle_t idle;
+
+	uv_idle_init(DepLibUV::GetLoop(), &idle);
+	uv_idle_start(&idle, [](uv_idle_t* /*handle*/) {});
+
+	for (size_t i{ 0u }; i < 10000u && listener.seqs.size() < numPackets; ++i)
+	{
+		uv_run(DepLibUV::GetLoop(), UV_RUN_NOWAIT);
+
+		std::this_thread::yield();
+	}
+
+	uv_close(reinterpret_cast<uv_handle_t*>(&idle), nullptr);
+	uv_run(DepLibUV::GetLoop(), UV_RUN_NOWAIT);
+}
+
+SCENARIO("PipeLocalLink", "[rtc][PipeLocalLink]")
+{
+	// clang-format off
+	alignas(4) uint8_t buffer[] =
+	{
+		0x80, 0x01, 0x00, 0x08,
+		0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x05,
+		0x11, 0x22, 0x33, 0x44
+	};
+	// clang-format on
+
+	std::unique_ptr<RtpPacket> packet{ RtpPacket::Parse(buffer, sizeof(buffer)) };
+
+	REQUIRE(packet);
+
+	SECTION("RTP packets and RTCP data are received by the peer in order")
+	{
+		TestPipeLocalLinkListener listener1;
+		TestPipeLocalLinkListener listener2;
+		PipeLocalLink link1(&listener1);
+		PipeLocalLink link2(&listener2);
+
+		REQUIRE(!link1.IsConnected());
+		REQUIRE(!link1.SendRtpPacket(packet.get()));
+
+		link1.Connect(link2.GetName());
+
+		REQUIRE(link1.IsConnected());
+
+		for (uint16_t seq{ 0u }; seq < 10u; ++seq)
+		{
+			packet->SetSequenceNumber(seq);
+
+			REQUIRE(link1.SendRtpPacket(packet.get()));
+		}
+
+		uint8_t rtcp[]{ 0x81, 0xCD, 0x00, 0x01, 0x11, 0x22, 0x33, 0x44 };
+
+		REQUIRE(link1.SendRtcp(rtcp, sizeof(rtcp)));
+
+		waitForRtpPackets(listener2, 10u);
+
+		REQUIRE(listener1.seqs.empty());
+		REQUIRE(listener2.seqs.size() == 10u);
+
+		for (uint16_t seq{ 0u }; seq < 10u; ++seq)
+		{
+			REQUIRE(listener2.seqs[seq] == seq);
+			REQUIRE(listener2.ssrcs[seq] == 5u);
+		}
+
+		REQUIRE(listener2.rtcp.size() == 1u);
+		REQUIRE(listener2.rtcp[0].size() == sizeof(rtcp));
+		REQUIRE(std::memcmp(listener2.rtcp[0].data(), rtcp, sizeof(rtcp)) == 0);
+	}
+
+	SECTION("packets sent by several threads are all received")
+	{
+		constexpr size_t NumThreads{ 4u };
+		constexpr uint16_t NumPackets{ 1000u };
+
+		TestPipeLocalLinkListener listener;
+		PipeLocalLink receiver(&listener);
+		std::vector<std::unique_ptr<TestPipeLocalLinkListener>> senderListeners;
+		std::vector<std::unique_ptr<PipeLocalLink>> senders;
+		std::vector<std::unique_ptr<RtpPacket>> packets;
+		std::vector<std::thread> threads;
+
+		for (size_t i{ 0u }; i < NumThreads; ++i)
+		{
+			senderListeners.emplace_back(new TestPipeLocalLinkListener());
+			senders.emplace_back(new PipeLocalLink(senderListeners.back().get()));
+			senders.back()->Connect(receiver.GetName());
+			packets.emplace_back(packet->Clone());
+			packets.back()->SetSsrc(static_cast<uint32_t>(i));
+		}
+
+		for (size_t i{ 0u }; i < NumThreads; ++i)
+		{
+			threads.emplace_back(
+			  [&senders, &packets, i]()
+			  {
+				  for (uint16_t seq{ 0u }; seq < NumPackets; ++seq)
+				  {
+					  packets[i]->SetSequenceNumber(seq);
+					  senders[i]->SendRtpPacket(packets[i].get());
+				  }
+			  });
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		waitForRtpPackets(listener, NumThreads * NumPackets);
+
+		REQUIRE(listener.seqs.size() == NumThreads * NumPackets);
+
+		// Packets of each sender keep their order.
+		std::vector<uint16_t> nextSeqs(NumThreads, 0u);
+
+		for (size_t i{ 0u }; i < listener.seqs.size(); ++i)
+		{
+			auto& nextSeq = nextSeqs[listener.ssrcs[i]];
+
+			REQUIRE(listener.seqs[i] == nextSeq);
+
+			++nextSeq;
+		}
+	}
+
+	SECTION("cannot connect to unknown links")
+	{
+		TestPipeLocalLinkListener listener;
+		PipeLocalLink link(&listener);
+
+		REQUIRE_THROWS_AS(link.Connect("foo"), MediaSoupTypeError);
+		REQUIRE_THROWS_AS(link.Connect(link.GetName()), MediaSoupTypeError);
+	}
+
+	SECTION("peer stops being connected once closed")
+	{
+		TestPipeLocalLinkListener listener1;
+		TestPipeLocalLinkListener listener2;
+		PipeLocalLink link1(&listener1);
+
+		{
+			PipeLocalLink link2(&listener2);
+
+			link1.Connect(link2.GetName());
+
+			REQUIRE(link1.SendRtpPacket(packet.get()));
+		}
+
+		REQUIRE(!link1.IsConnected());
+		REQUIRE(!link1.SendRtpPacket(packet.get()));
+
+		// Let the loop close the handles.
+		uv_run(DepLibUV::GetLoop(), UV_RUN_NOWAIT);
+	}
+}
@@ -0,0 +1,148 @@
+#include "common.hpp"
+#include "MediaSoupErrors.hpp"
+#include "RTC/PipeShmRing.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcmp()
+#include <vector>
+
+using namespace RTC;
+
+#ifndef _WIN32
+SCENARIO("PipeShmRing", "[rtc][PipeShmRing]")
+{
+	SECTION("packets written by the producer are read by the consumer in order")
+	{
+		PipeShmRing producer;
+		PipeShmRing consumer(producer.GetName());
+		std::vector<std::vector<uint8_t>> packets;
+
+		REQUIRE(producer.IsConsumerAttached());
+
+		for (size_t i{ 0u }; i < 10u; ++i)
+		{
+			packets.emplace_back(100u + i, static_cast<uint8_t>(i));
+
+			REQUIRE(producer.Write(packets.back().data(), packets.back().size()));
+		}
+
+		size_t idx{ 0u };
+
+		const PipeShmRing::onDataCallback onData = [&packets, &idx](uint8_t* data, size_t len)
+		{
+			REQUIRE(len == packets[idx].size());
+			REQUIRE(std::memcmp(data, packets[idx].data(), len) == 0);
+
+			++idx;
+		};
+
+		REQUIRE(consumer.Read(onData) == 10u);
+		REQUIRE(idx == 10u);
+		REQUIRE(consumer.Read(onData) == 0u);
+	}
+
+	SECTION("consumer is woken up just once until it sleeps again")
+	{
+		PipeShmRing producer;
+		PipeShmRing consumer(producer.GetName());
+		uint8_t data[100]{};
+
+		const PipeShmRing::onDataCallback onData = [](uint8_t* /*data*/, size_t /*len*/) {};
+
+		// The consumer starts sleeping.
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(producer.ShouldWakeUpConsumer());
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(!producer.ShouldWakeUpConsumer());
+
+		REQUIRE(consumer.Read(onData) == 2u);
+		REQUIRE(consumer.Sleep());
+
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(producer.ShouldWakeUpConsumer());
+
+		// New data written before sleeping so it must read again.
+		REQUIRE(!consumer.Sleep());
+		REQUIRE(consumer.Read(onData) == 1u);
+		REQUIRE(consumer.Sleep());
+	}
+
+	SECTION("producer detects a consumer that does not read (lost doorbell)")
+	{
+		PipeShmRing producer;
+		PipeShmRing consumer(producer.GetName());
+		uint8_t data[100]{};
+
+		const PipeShmRing::onDataCallback onData = [](uint8_t* /*data*/, size_t /*len*/) {};
+
+		REQUIRE(!producer.HasUnreadPackets());
+		REQUIRE(!producer.IsConsumerStalled());
+
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(producer.ShouldWakeUpConsumer());
+		REQUIRE(producer.HasUnreadPackets());
+
+		// The doorbell is lost so the consumer does not read.
+		REQUIRE(producer.IsConsumerStalled());
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(!producer.ShouldWakeUpConsumer());
+		REQUIRE(producer.IsConsumerStalled());
+
+		// The consumer reads once the doorbell is sent again.
+		REQUIRE(consumer.Read(onData) == 2u);
+		REQUIRE(consumer.Sleep());
+		REQUIRE(!producer.HasUnreadPackets());
+		REQUIRE(!producer.IsConsumerStalled());
+
+		// Not stalled if it reads something between calls.
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(producer.IsConsumerStalled());
+
+		REQUIRE(consumer.Read(onData) == 2u);
+		REQUIRE(producer.Write(data, sizeof(data)));
+		REQUIRE(!producer.IsConsumerStalled());
+		REQUIRE(producer.IsConsumerStalled());
+	}
+
+	SECTION("write fails if the ring is full or the packet is too big")
+	{
+		PipeShmRing producer;
+		PipeShmRing consumer(producer.GetName());
+		std::vector<uint8_t> data(RTC::MtuSize + 1u, 0u);
+
+		REQUIRE(!producer.Write(data.data(), data.size()));
+
+		for (size_t i{ 0u }; i < PipeShmRing::NumSlots; ++i)
+		{
+			REQUIRE(producer.Write(data.data(), 100u));
+		}
+
+		REQUIRE(!producer.Write(data.data(), 100u));
+
+		const PipeShmRing::onDataCallback onData = [](uint8_t* /*data*/, size_t /*len*/) {};
+
+		REQUIRE(consumer.Read(onData) == PipeShmRing::NumSlots);
+		REQUIRE(producer.Write(data.data(), 100u));
+	}
+
+	SECTION("producer knows when the consumer is gone")
+	{
+		PipeShmRing producer;
+
+		REQUIRE(!producer.IsConsumerAttached());
+
+		{
+			PipeShmRing consumer(producer.GetName());
+
+			REQUIRE(producer.IsConsumerAttached());
+		}
+
+		REQUIRE(!producer.IsConsumerAttached());
+	}
+
+	SECTION("opening an unknown ring throws")
+	{
+		REQUIRE_THROWS_AS(PipeShmRing("/mediasoup-foo"), MediaSoupError);
+	}
+}
+#endif
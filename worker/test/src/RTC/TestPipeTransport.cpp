@@ -0,0 +1,108 @@
+#include "common.hpp"
+#include "RTC/PipeTransport.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcmp()
+#include <vector>
+
+using namespace RTC;
+
+SCENARIO("PipeTransport aggregated RTP data", "[rtc][PipeTransport]")
+{
+	// clang-format off
+	// Header of an aggregated RTP datagram (SSRC "MSAG", payload type 127).
+	std::vector<uint8_t> datagram =
+	{
+		0x80, 0x7F, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00,
+		0x4D, 0x53, 0x41, 0x47
+	};
+	// clang-format on
+
+	auto append = [&datagram](uint16_t len, uint8_t value)
+	{
+		datagram.push_back(static_cast<uint8_t>(len >> 8));
+		datagram.push_back(static_cast<uint8_t>(len & 0xFF));
+		datagram.insert(datagram.end(), len, value);
+	};
+
+	std::vector<std::vector<uint8_t>> packets;
+
+	const PipeTransport::onAggregatedRtpPacket onPacket = [&packets](const uint8_t* data, size_t len)
+	{ packets.emplace_back(data, data + len); };
+
+	SECTION("every entry is passed in order")
+	{
+		append(20u, 0x01);
+		append(1u, 0x02);
+		append(RTC::MtuSize, 0x03);
+
+		REQUIRE(PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.size() == 3);
+		REQUIRE(packets[0] == std::vector<uint8_t>(20u, 0x01));
+		REQUIRE(packets[1] == std::vector<uint8_t>(1u, 0x02));
+		REQUIRE(packets[2] == std::vector<uint8_t>(RTC::MtuSize, 0x03));
+	}
+
+	SECTION("datagram without entries is valid")
+	{
+		REQUIRE(PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.empty());
+	}
+
+	SECTION("datagram shorter than the header is invalid")
+	{
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), 11u, onPacket));
+		REQUIRE(packets.empty());
+	}
+
+	SECTION("truncated length prefix is invalid")
+	{
+		append(20u, 0x01);
+		datagram.push_back(0x00);
+
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.size() == 1);
+	}
+
+	SECTION("length prefix beyond the end of the datagram is invalid")
+	{
+		append(20u, 0x01);
+		append(20u, 0x02);
+
+		// Remove the last byte.
+		datagram.pop_back();
+
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.size() == 1);
+		REQUIRE(packets[0] == std::vector<uint8_t>(20u, 0x01));
+	}
+
+	SECTION("zero length entry is invalid")
+	{
+		append(20u, 0x01);
+		append(0u, 0x00);
+		append(20u, 0x02);
+
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.size() == 1);
+	}
+
+	SECTION("entry bigger than the MTU is invalid")
+	{
+		append(RTC::MtuSize + 1, 0x01);
+
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.empty());
+	}
+
+	SECTION("trailing bytes after the last entry are invalid")
+	{
+		append(20u, 0x01);
+		datagram.push_back(0x00);
+		datagram.push_back(0x05);
+		datagram.push_back(0x00);
+
+		REQUIRE(!PipeTransport::ParseAggregatedRtpData(datagram.data(), datagram.size(), onPacket));
+		REQUIRE(packets.size() == 1);
+	}
+}
@@ -0,0 +1,78 @@
+#include "common.hpp"
+#include "RTC/PortManager.hpp"
+#include <catch2/catch.hpp>
+#include <set>
+
+using FreePorts = RTC::PortManager::FreePorts;
+
+SCENARIO("PortManager::FreePorts", "[rtc][portmanager]")
+{
+	SECTION("all ports are initially available")
+	{
+		FreePorts ports(10u);
+
+		REQUIRE(ports.GetSize() == 10u);
+
+		std::set<size_t> portIdxs;
+
+		for (size_t pos{ 0u }; pos < ports.GetSize(); ++pos)
+		{
+			portIdxs.insert(ports.Get(pos));
+		}
+
+		REQUIRE(portIdxs.size() == 10u);
+		REQUIRE(*portIdxs.begin() == 0u);
+		REQUIRE(*portIdxs.rbegin() == 9u);
+	}
+
+	SECTION("taken ports are not available until released")
+	{
+		FreePorts ports(10u);
+
+		ports.Take(3u);
+		ports.Take(9u);
+		ports.Take(0u);
+		// Taking it twice has no effect.
+		ports.Take(3u);
+
+		REQUIRE(ports.GetSize() == 7u);
+		REQUIRE(!ports.IsFree(0u));
+		REQUIRE(!ports.IsFree(3u));
+		REQUIRE(!ports.IsFree(9u));
+		REQUIRE(ports.IsFree(5u));
+
+		for (size_t pos{ 0u }; pos < ports.GetSize(); ++pos)
+		{
+			REQUIRE(ports.Get(pos) != 0u);
+			REQUIRE(ports.Get(pos) != 3u);
+			REQUIRE(ports.Get(pos) != 9u);
+		}
+
+		ports.Release(3u);
+		// Releasing it twice has no effect.
+		ports.Release(3u);
+
+		REQUIRE(ports.GetSize() == 8u);
+		REQUIRE(ports.IsFree(3u));
+	}
+
+	SECTION("taking every port leaves none available")
+	{
+		FreePorts ports(100u);
+
+		while (ports.GetSize() > 0u)
+		{
+			ports.Take(ports.Get(ports.GetSize() / 2u));
+		}
+
+		for (size_t portIdx{ 0u }; portIdx < 100u; ++portIdx)
+		{
+			REQUIRE(!ports.IsFree(portIdx));
+		}
+
+		ports.Release(42u);
+
+		REQUIRE(ports.GetSize() == 1u);
+		REQUIRE(ports.Get(0u) == 42u);
+	}
+}
@@ -139,4 +139,22 @@ SCENARIO("Bitrate calculator", "[rtp][bitrate]")
 
 		validate(rate, nowMs, input);
 	}
+
+	SECTION("old items removed when there is no room for new ones")
+	{
+		// window: 1000ms, items: 5 (granularity: 200ms)
+		RateCalculator rate(1000, 8000, 5);
+
+		// More items than the window can hold, without asking for the rate.
+		for (uint64_t offset{ 0u }; offset < 4000; offset += 200)
+		{
+			rate.Update(1, nowMs + offset);
+		}
+
+		// Only items within the last 1000ms.
+		REQUIRE(rate.GetRate(nowMs + 3800) == 5 * 8);
+		REQUIRE(rate.GetBytes() == 20);
+		REQUIRE(rate.GetRate(nowMs + 4799) == 1 * 8);
+		REQUIRE(rate.GetRate(nowMs + 4800) == 0);
+	}
 }
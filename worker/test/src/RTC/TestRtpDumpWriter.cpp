@@ -0,0 +1,134 @@
+#include "common.hpp"
+#include "DepLibUV.hpp"
+#include "Utils.hpp"
+#include "RTC/RtpDumpWriter.hpp"
+#include <catch2/catch.hpp>
+#include <cstdio>  // std::remove()
+#include <cstring> // std::memcmp()
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace RTC;
+
+static std::vector<uint8_t> readFile(const std::string& filePath)
+{
+	std::ifstream file(filePath, std::ios::binary);
+
+	return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+SCENARIO("RtpDumpWriter", "[rtp][rtpdumpwriter]")
+{
+	char tmpDir[1024];
+	size_t tmpDirLen = sizeof(tmpDir);
+
+	REQUIRE(uv_os_tmpdir(tmpDir, &tmpDirLen) == 0);
+
+	const std::string filePath = std::string(tmpDir, tmpDirLen) + "/mediasoup-test-" +
+	                             Utils::Crypto::GetRandomString(8) + ".rtpdump";
+
+	SECTION("writes file header and packets in order")
+	{
+		// clang-format off
+		uint8_t rtp1[] =
+		{
+			0x80, 0x01, 0x00, 0x08,
+			0x00, 0x00, 0x00, 0x04,
+			0x00, 0x00, 0x00, 0x05,
+			0x11, 0x22
+		};
+		uint8_t rtp2[] =
+		{
+			0x80, 0x01, 0x00, 0x09,
+			0x00, 0x00, 0x00, 0x04,
+			0x00, 0x00, 0x00, 0x05
+		};
+		uint8_t rtcp[] =
+		{
+			0x81, 0xca, 0x00, 0x01,
+			0x00, 0x00, 0x00, 0x05
+		};
+		// clang-format on
+
+		auto* writer = new RtpDumpWriter(filePath);
+
+		writer->WriteRtp(rtp1, sizeof(rtp1));
+		writer->WriteRtcp(rtcp, sizeof(rtcp));
+		writer->WriteRtp(rtp2, sizeof(rtp2));
+
+		// Packets are written in background and the writer deletes itself once
+		// the file is closed.
+		writer->Close();
+
+		DepLibUV::RunLoop();
+
+		const auto data = readFile(filePath);
+		const std::string headerLine{ "#!rtpplay1.0 0.0.0.0/0\n" };
+		const size_t headerSize{ headerLine.size() + 16u };
+
+		REQUIRE(
+		  data.size() == headerSize + (3 * RtpDumpWriter::PacketHeaderSize) + sizeof(rtp1) +
+		                   sizeof(rtcp) + sizeof(rtp2));
+		REQUIRE(std::string(data.begin(), data.begin() + headerLine.size()) == headerLine);
+
+		const auto* record = data.data() + headerSize;
+
+		// First RTP packet.
+		REQUIRE(Utils::Byte::Get2Bytes(record, 0) == RtpDumpWriter::PacketHeaderSize + sizeof(rtp1));
+		REQUIRE(Utils::Byte::Get2Bytes(record, 2) == sizeof(rtp1));
+		REQUIRE(std::memcmp(record + RtpDumpWriter::PacketHeaderSize, rtp1, sizeof(rtp1)) == 0);
+
+		record += RtpDumpWriter::PacketHeaderSize + sizeof(rtp1);
+
+		// RTCP packet (packet length is 0).
+		REQUIRE(Utils::Byte::Get2Bytes(record, 0) == RtpDumpWriter::PacketHeaderSize + sizeof(rtcp));
+		REQUIRE(Utils::Byte::Get2Bytes(record, 2) == 0u);
+		REQUIRE(std::memcmp(record + RtpDumpWriter::PacketHeaderSize, rtcp, sizeof(rtcp)) == 0);
+
+		record += RtpDumpWriter::PacketHeaderSize + sizeof(rtcp);
+
+		// Second RTP packet.
+		REQUIRE(Utils::Byte::Get2Bytes(record, 0) == RtpDumpWriter::PacketHeaderSize + sizeof(rtp2));
+		REQUIRE(Utils::Byte::Get2Bytes(record, 2) == sizeof(rtp2));
+		REQUIRE(std::memcmp(record + RtpDumpWriter::PacketHeaderSize, rtp2, sizeof(rtp2)) == 0);
+
+		std::remove(filePath.c_str());
+	}
+
+	SECTION("writes packets exceeding a batch")
+	{
+		std::vector<uint8_t> packet(1200u, 0xAA);
+		const size_t numPackets = (2u * RtpDumpWriter::BatchSize / packet.size()) + 1u;
+
+		auto* writer = new RtpDumpWriter(filePath);
+
+		for (size_t i{ 0u }; i < numPackets; ++i)
+		{
+			writer->WriteRtp(packet.data(), packet.size());
+		}
+
+		writer->Close();
+
+		DepLibUV::RunLoop();
+
+		const auto data = readFile(filePath);
+		const size_t headerSize{ std::string("#!rtpplay1.0 0.0.0.0/0\n").size() + 16u };
+
+		REQUIRE(
+		  data.size() == headerSize + (numPackets * (RtpDumpWriter::PacketHeaderSize + packet.size())));
+
+		std::remove(filePath.c_str());
+	}
+
+	SECTION("closing a writer that cannot open its file does not crash")
+	{
+		auto* writer = new RtpDumpWriter("/non-existing-dir/file.rtpdump");
+
+		writer->WriteRtp(std::vector<uint8_t>(100u, 0).data(), 100u);
+		writer->Close();
+
+		DepLibUV::RunLoop();
+	}
+}
@@ -0,0 +1,181 @@
+#include "common.hpp"
+#include "ChannelMessageRegistrator.hpp"
+#include "DepLibUV.hpp"
+#include "FBS/transport.h"
+#include "RTC/Producer.hpp"
+#include "RTC/RtpListener.hpp"
+#include "RTC/RtpPacket.hpp"
+#include "RTC/Shared.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcpy()
+#include <memory>
+#include <vector>
+
+using namespace RTC;
+
+class TestRtpListenerProducerListener : public Producer::Listener
+{
+public:
+	void OnProducerReceiveData(Producer* /*producer*/, size_t /*len*/) override
+	{
+	}
+	void OnProducerReceiveRtpPacket(Producer* /*producer*/, RtpPacket* /*packet*/) override
+	{
+	}
+	void OnProducerPaused(Producer* /*producer*/) override
+	{
+	}
+	void OnProducerResumed(Producer* /*producer*/) override
+	{
+	}
+	void OnProducerNewRtpStream(
+	  Producer* /*producer*/, RtpStreamRecv* /*rtpStream*/, uint32_t /*mappedSsrc*/) override
+	{
+	}
+	void OnProducerRtpStreamScore(
+	  Producer* /*producer*/,
+	  RtpStreamRecv* /*rtpStream*/,
+	  uint8_t /*score*/,
+	  uint8_t /*previousScore*/) override
+	{
+	}
+	void OnProducerRtcpSenderReport(
+	  Producer* /*producer*/, RtpStreamRecv* /*rtpStream*/, bool /*first*/) override
+	{
+	}
+	void OnProducerRtpPacketReceived(Producer* /*producer*/, RtpPacket* /*packet*/) override
+	{
+	}
+	void OnProducerSendRtcpPacket(Producer* /*producer*/, RTCP::Packet* /*packet*/) override
+	{
+	}
+	void OnProducerNeedWorstRemoteFractionLost(
+	  Producer* /*producer*/, uint32_t /*mappedSsrc*/, uint8_t& /*worstRemoteFractionLost*/) override
+	{
+	}
+};
+
+// Creates an Opus Producer with the given MID and a single encoding with the
+// given SSRC.
+static Producer* CreateProducer(
+  Shared* shared,
+  Producer::Listener* listener,
+  const std::string& id,
+  const std::string& mid,
+  uint32_t ssrc)
+{
+	flatbuffers::FlatBufferBuilder builder;
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpCodecParameters>> codecs{
+		FBS::RtpParameters::CreateRtpCodecParametersDirect(builder, "audio/opus", 100, 48000, 2)
+	};
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpHeaderExtensionParameters>>
+	  headerExtensions;
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>> encodings{
+		FBS::RtpParameters::CreateRtpEncodingParametersDirect(builder, ssrc)
+	};
+	auto rtcp = FBS::RtpParameters::CreateRtcpParametersDirect(builder, "cname");
+	auto rtpParameters = FBS::RtpParameters::CreateRtpParametersDirect(
+	  builder, mid.c_str(), &codecs, &headerExtensions, &encodings, rtcp);
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::CodecMapping>> codecMappings{
+		FBS::RtpParameters::CreateCodecMapping(builder, 100, 100)
+	};
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::EncodingMapping>> encodingMappings{
+		FBS::RtpParameters::CreateEncodingMappingDirect(builder, nullptr, ssrc, nullptr, ssrc)
+	};
+	auto rtpMapping =
+	  FBS::RtpParameters::CreateRtpMappingDirect(builder, &codecMappings, &encodingMappings);
+
+	builder.Finish(FBS::Transport::CreateProduceRequestDirect(
+	  builder, id.c_str(), FBS::RtpParameters::MediaKind::AUDIO, rtpParameters, rtpMapping));
+
+	const auto* data =
+	  flatbuffers::GetRoot<FBS::Transport::ProduceRequest>(builder.GetBufferPointer());
+
+	return new Producer(shared, id, listener, data);
+}
+
+SCENARIO("RtpListener unknown SSRCs cache", "[rtp][rtplistener]")
+{
+	// RTP packet with SSRC 5555 and a MID extension (id 1, value "a").
+	// clang-format off
+	uint8_t bufferA[] =
+	{
+		0x90, 0x64, 0x00, 0x01, // V:2, X:1, PT:100, Seq:1
+		0x00, 0x00, 0x00, 0x04, // Timestamp:4
+		0x00, 0x00, 0x15, 0xB3, // SSRC:5555
+		0xBE, 0xDE, 0x00, 0x01, // Header Extension (One-Byte), length:1
+		0x10, 0x61, 0x00, 0x00, // id:1, len:1, "a", padding
+		0x11, 0x22, 0x33, 0x44  // Payload
+	};
+	// clang-format on
+
+	// Same packet with MID "b".
+	uint8_t bufferB[sizeof(bufferA)];
+
+	std::memcpy(bufferB, bufferA, sizeof(bufferA));
+	bufferB[17] = 0x62;
+
+	std::unique_ptr<RtpPacket> packetA{ RtpPacket::Parse(bufferA, sizeof(bufferA)) };
+	std::unique_ptr<RtpPacket> packetB{ RtpPacket::Parse(bufferB, sizeof(bufferB)) };
+
+	REQUIRE(packetA);
+	REQUIRE(packetB);
+
+	packetA->SetMidExtensionId(1);
+	packetB->SetMidExtensionId(1);
+
+	Shared shared(new ChannelMessageRegistrator(), nullptr);
+	TestRtpListenerProducerListener producerListener;
+	RtpListener rtpListener;
+
+	std::unique_ptr<Producer> producerA{ CreateProducer(
+	  &shared, &producerListener, "producerA", "a", 1111) };
+
+	rtpListener.AddProducer(producerA.get());
+
+	SECTION("a remembered SSRC skips the MID lookup")
+	{
+		const auto nowMs = DepLibUV::GetTimeMs();
+
+		REQUIRE(rtpListener.AddUnknownSsrc(5555, nowMs) == true);
+		// Already remembered, so not reported again.
+		REQUIRE(rtpListener.AddUnknownSsrc(5555, nowMs + 999) == false);
+
+		// Even if its MID matches a Producer.
+		REQUIRE(rtpListener.GetProducer(packetA.get()) == nullptr);
+		REQUIRE(rtpListener.GetProducer(5555) == nullptr);
+
+		// Reported again once expired.
+		REQUIRE(rtpListener.AddUnknownSsrc(5555, nowMs + 1000) == true);
+	}
+
+	SECTION("a remembered SSRC expires after 1 second")
+	{
+		// Remembered 1 second ago.
+		REQUIRE(rtpListener.AddUnknownSsrc(5555, DepLibUV::GetTimeMs() - 1000) == true);
+
+		REQUIRE(rtpListener.GetProducer(packetA.get()) == producerA.get());
+		// The MID lookup filled the SSRC table.
+		REQUIRE(rtpListener.GetProducer(5555) == producerA.get());
+	}
+
+	SECTION("AddProducer() makes a new Producer reachable immediately")
+	{
+		REQUIRE(rtpListener.AddUnknownSsrc(5555, DepLibUV::GetTimeMs()) == true);
+		REQUIRE(rtpListener.GetProducer(packetB.get()) == nullptr);
+
+		std::unique_ptr<Producer> producerB{ CreateProducer(
+		  &shared, &producerListener, "producerB", "b", 2222) };
+
+		rtpListener.AddProducer(producerB.get());
+
+		REQUIRE(rtpListener.GetProducer(packetB.get()) == producerB.get());
+		REQUIRE(rtpListener.GetProducer(5555) == producerB.get());
+
+		rtpListener.RemoveProducer(producerB.get());
+	}
+
+	rtpListener.RemoveProducer(producerA.get());
+}
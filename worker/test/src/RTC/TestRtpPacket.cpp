@@ -3,6 +3,7 @@
 #include "RTC/RtpPacket.hpp"
 #include <catch2/catch.hpp>
 #include <cstring> // std::memset()
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -870,4 +871,164 @@ SCENARIO("parse RTP packets", "[parser][rtp]")
 
 		delete packet;
 	}
+
+	SECTION("rewrite header extensions with a precomputed plan")
+	{
+		// Same as RewriteHeaderExtensions() but building a list of extensions for
+		// SetExtensions().
+		auto rewriteWithSetExtensions =
+		  [](RtpPacket* packet, const RtpPacket::HeaderExtensionRewritePlan& plan)
+		{
+			uint8_t values[RtpPacket::HeaderExtensionRewritePlan::MaxSteps * 16];
+			uint8_t* valuesPtr{ values };
+			std::vector<RTC::RtpPacket::GenericExtension> extensions;
+
+			for (size_t i{ 0 }; i < plan.GetNumSteps(); ++i)
+			{
+				const auto& step = plan.GetStep(i);
+
+				if (step.sourceId == 0u)
+				{
+					std::memset(valuesPtr, 0, step.len);
+					extensions.emplace_back(step.id, step.len, valuesPtr);
+					valuesPtr += step.len;
+
+					continue;
+				}
+
+				uint8_t extenLen;
+				uint8_t* extenValue = packet->GetExtension(step.sourceId, extenLen);
+
+				if (extenValue)
+				{
+					std::memcpy(valuesPtr, extenValue, extenLen);
+					extensions.emplace_back(step.id, extenLen, valuesPtr);
+					valuesPtr += extenLen;
+				}
+			}
+
+			packet->SetExtensions(1, extensions);
+		};
+
+		// clang-format off
+		uint8_t rtpBuffer[] =
+		{
+			0x80, 0x01, 0x00, 0x08,
+			0x00, 0x00, 0x00, 0x04,
+			0x00, 0x00, 0x00, 0x05,
+			0x11, 0x22, 0x33, 0x44, // Payload
+			0x55, 0x66, 0x77, 0x88,
+			0x99, 0xAA, 0xBB, 0xCC
+		};
+		// clang-format on
+
+		uint8_t value1[] = { 0x01 };
+		uint8_t value2[] = { 0x01, 0x02 };
+		uint8_t value3[] = { 0x01, 0x02, 0x03 };
+		uint8_t mid[]    = { '0' };
+		uint8_t rid[]    = { 'h', 'i' };
+
+		struct Input
+		{
+			uint8_t type;
+			std::vector<RTC::RtpPacket::GenericExtension> extensions;
+		};
+
+		// clang-format off
+		std::vector<Input> inputs =
+		{
+			// No header extension.
+			{ 1, {} },
+			// Chrome video: toffset, abs-send-time, tcc, video-orientation, mid, rid.
+			{
+				1,
+				{
+					{ 14, 3, value3 },
+					{ 2, 3, value3 },
+					{ 3, 2, value2 },
+					{ 13, 1, value1 },
+					{ 4, 1, mid },
+					{ 10, 2, rid }
+				}
+			},
+			// Firefox audio: ssrc-audio-level, mid.
+			{ 1, { { 1, 1, value1 }, { 3, 1, mid } } },
+			// Two-Bytes header extensions.
+			{ 2, { { 1, 1, value1 }, { 3, 1, mid }, { 20, 3, value3 } } }
+		};
+		// clang-format on
+
+		RtpPacket::HeaderExtensionRewritePlan videoPlan;
+
+		videoPlan.AddZeroed(1, RTC::MidMaxLength);
+		videoPlan.AddProxied(13, 0);
+		videoPlan.AddZeroed(4, 3);
+		videoPlan.AddZeroed(5, 2);
+		videoPlan.AddProxied(11, 13);
+		videoPlan.AddProxied(12, 14);
+
+		RtpPacket::HeaderExtensionRewritePlan audioPlan;
+
+		audioPlan.AddZeroed(1, RTC::MidMaxLength);
+		audioPlan.AddProxied(10, 1);
+		audioPlan.AddProxied(13, 20);
+
+		REQUIRE(videoPlan.GetNumSteps() == 5);
+		REQUIRE(audioPlan.GetNumSteps() == 3);
+
+		for (const auto& input : inputs)
+		{
+			for (const auto* plan : { &videoPlan, &audioPlan })
+			{
+				uint8_t buffer1[256];
+				uint8_t buffer2[256];
+
+				std::memset(buffer1, 0, sizeof(buffer1));
+				std::memcpy(buffer1, rtpBuffer, sizeof(rtpBuffer));
+
+				std::unique_ptr<RtpPacket> base{ RtpPacket::Parse(buffer1, sizeof(rtpBuffer)) };
+
+				REQUIRE(base);
+
+				if (!input.extensions.empty())
+				{
+					base->SetExtensions(input.type, input.extensions);
+				}
+
+				std::memcpy(buffer2, buffer1, sizeof(buffer2));
+
+				std::unique_ptr<RtpPacket> packet1{ RtpPacket::Parse(buffer1, base->GetSize()) };
+				std::unique_ptr<RtpPacket> packet2{ RtpPacket::Parse(buffer2, base->GetSize()) };
+
+				REQUIRE(packet1);
+				REQUIRE(packet2);
+
+				rewriteWithSetExtensions(packet1.get(), *plan);
+				packet2->RewriteHeaderExtensions(*plan);
+
+				REQUIRE(packet2->GetSize() == packet1->GetSize());
+				REQUIRE(std::memcmp(packet2->GetData(), packet1->GetData(), packet1->GetSize()) == 0);
+				REQUIRE(packet2->GetPayloadLength() == 12);
+				REQUIRE(packet2->GetPayload()[0] == 0x11);
+				REQUIRE(packet2->HasOneByteExtensions());
+
+				for (uint8_t id{ 1 }; id <= 14; ++id)
+				{
+					uint8_t extenLen1{ 0 };
+					uint8_t extenLen2{ 0 };
+					const uint8_t* extenValue1 = packet1->GetExtension(id, extenLen1);
+					const uint8_t* extenValue2 = packet2->GetExtension(id, extenLen2);
+
+					REQUIRE((extenValue1 == nullptr) == (extenValue2 == nullptr));
+					REQUIRE(extenLen1 == extenLen2);
+				}
+
+				// Parsing the rewritten packet gives the same result.
+				std::unique_ptr<RtpPacket> packet3{ RtpPacket::Parse(buffer2, packet2->GetSize()) };
+
+				REQUIRE(packet3);
+				REQUIRE(packet3->GetSize() == packet2->GetSize());
+			}
+		}
+	}
 }
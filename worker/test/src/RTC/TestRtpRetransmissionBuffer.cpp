@@ -314,4 +314,41 @@ SCENARIO("RtpRetransmissionBuffer", "[rtp][rtx]")
 		myRetransmissionBuffer.Insert(33998, 2228092928);
 		myRetransmissionBuffer.Insert(33998, 2228092928);
 	}
+
+	SECTION("newest packet for padding")
+	{
+		uint16_t maxItems{ 4 };
+		uint32_t maxRetransmissionDelayMs{ 2000u };
+		uint32_t clockRate{ 90000 };
+
+		RtpMyRetransmissionBuffer myRetransmissionBuffer(maxItems, maxRetransmissionDelayMs, clockRate);
+
+		myRetransmissionBuffer.Insert(10001, 1000000000);
+		myRetransmissionBuffer.Insert(10002, 1000000000);
+		myRetransmissionBuffer.Insert(10004, 1000000200);
+
+		auto* item = myRetransmissionBuffer.GetNewestForPadding(1500, 0, 4);
+
+		REQUIRE(item);
+		REQUIRE(item->sequenceNumber == 10004);
+
+		item->resentAtMs = 1000;
+
+		// 10004 was resent later and 10003 is missing.
+		item = myRetransmissionBuffer.GetNewestForPadding(1500, 500, 4);
+
+		REQUIRE(item);
+		REQUIRE(item->sequenceNumber == 10002);
+
+		item = myRetransmissionBuffer.GetNewestForPadding(1500, 1000, 4);
+
+		REQUIRE(item);
+		REQUIRE(item->sequenceNumber == 10004);
+
+		// Just the newest items are considered.
+		REQUIRE(!myRetransmissionBuffer.GetNewestForPadding(1500, 500, 2));
+
+		// Packets are bigger than the given size.
+		REQUIRE(!myRetransmissionBuffer.GetNewestForPadding(11, 0, 4));
+	}
 }
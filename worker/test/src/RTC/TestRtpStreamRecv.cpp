@@ -1,9 +1,11 @@
 #include "common.hpp"
 #include "DepLibUV.hpp"
+#include "RTC/Codecs/PayloadDescriptorHandler.hpp"
 #include "RTC/RtpPacket.hpp"
 #include "RTC/RtpStream.hpp"
 #include "RTC/RtpStreamRecv.hpp"
 #include <catch2/catch.hpp>
+#include <memory>
 #include <vector>
 
 using namespace RTC;
@@ -213,3 +215,110 @@ SCENARIO("receive RTP packets and trigger NACK", "[rtp][rtpstream]")
 
 	delete packet;
 }
+
+class TestRtpStreamRecvPayloadDescriptorHandler : public Codecs::PayloadDescriptorHandler
+{
+public:
+	TestRtpStreamRecvPayloadDescriptorHandler(uint8_t spatialLayer, uint8_t temporalLayer)
+	  : spatialLayer(spatialLayer), temporalLayer(temporalLayer){};
+	~TestRtpStreamRecvPayloadDescriptorHandler() override = default;
+	void Dump() const override
+	{
+		return;
+	};
+	bool Process(Codecs::EncodingContext* /*context*/, uint8_t* /*data*/, bool& /*marker*/) override
+	{
+		return true;
+	};
+	void Restore(uint8_t* /*data*/) override
+	{
+		return;
+	};
+	uint8_t GetSpatialLayer() const override
+	{
+		return this->spatialLayer;
+	};
+	uint8_t GetTemporalLayer() const override
+	{
+		return this->temporalLayer;
+	};
+	bool IsKeyFrame() const override
+	{
+		return false;
+	};
+
+private:
+	uint8_t spatialLayer{ 0u };
+	uint8_t temporalLayer{ 0u };
+};
+
+SCENARIO("TransmissionCounter layer bitrates", "[rtp][rtpstream]")
+{
+	// clang-format off
+	uint8_t buffer[] =
+	{
+		0x80, 0x7b, 0x52, 0x0e,
+		0x5b, 0x6b, 0xca, 0xb5,
+		0x00, 0x00, 0x00, 0x02,
+		0x01, 0x02, 0x03, 0x04
+	};
+	// clang-format on
+
+	std::unique_ptr<RtpPacket> packet{ RtpPacket::Parse(buffer, sizeof(buffer)) };
+
+	REQUIRE(packet);
+
+	RtpStreamRecv::TransmissionCounter counter(2, 3, 2500);
+
+	auto update = [&packet, &counter](uint8_t spatialLayer, uint8_t temporalLayer, size_t times)
+	{
+		packet->SetPayloadDescriptorHandler(
+		  new TestRtpStreamRecvPayloadDescriptorHandler(spatialLayer, temporalLayer));
+
+		for (size_t i{ 0u }; i < times; ++i)
+		{
+			counter.Update(packet.get());
+		}
+	};
+
+	update(0, 0, 10);
+	update(0, 1, 20);
+	update(1, 0, 40);
+	// Higher than defined temporal layer, counted in the highest one.
+	update(1, 5, 5);
+
+	const uint64_t nowMs = DepLibUV::GetTimeMs();
+
+	const auto rate00 = counter.GetLayerBitrate(nowMs, 0, 0);
+	const auto rate01 = counter.GetLayerBitrate(nowMs, 0, 1);
+	const auto rate10 = counter.GetLayerBitrate(nowMs, 1, 0);
+	const auto rate12 = counter.GetLayerBitrate(nowMs, 1, 2);
+
+	REQUIRE(rate00 > 0);
+	REQUIRE(rate01 > rate00);
+	REQUIRE(rate10 > rate01);
+	REQUIRE(rate12 > 0);
+	REQUIRE(counter.GetLayerBitrate(nowMs, 0, 2) == 0);
+	REQUIRE(counter.GetLayerBitrate(nowMs, 1, 1) == 0);
+
+	REQUIRE(counter.GetBitrate(nowMs) == rate00 + rate01 + rate10 + rate12);
+	REQUIRE(counter.GetBitrate(nowMs, 0, 0) == rate00);
+	REQUIRE(counter.GetBitrate(nowMs, 0, 1) == rate00 + rate01);
+	// Layers not being received.
+	REQUIRE(counter.GetBitrate(nowMs, 0, 2) == 0);
+	REQUIRE(counter.GetBitrate(nowMs, 1, 1) == 0);
+	REQUIRE(counter.GetBitrate(nowMs, 1, 0) == rate00 + rate01 + rate10);
+	REQUIRE(counter.GetBitrate(nowMs, 1, 2) == rate00 + rate01 + rate10 + rate12);
+	REQUIRE(counter.GetSpatialLayerBitrate(nowMs, 0) == rate00 + rate01);
+	REQUIRE(counter.GetSpatialLayerBitrate(nowMs, 1) == rate10 + rate12);
+	REQUIRE(counter.GetPacketCount() == 75);
+	REQUIRE(counter.GetBytes() == 75 * sizeof(buffer));
+
+	// New packets must be taken into account within the same time.
+	update(0, 2, 10);
+
+	REQUIRE(counter.GetLayerBitrate(nowMs, 0, 2) > 0);
+	REQUIRE(
+	  counter.GetBitrate(nowMs, 1, 0) ==
+	  rate00 + rate01 + counter.GetLayerBitrate(nowMs, 0, 2) + rate10);
+}
@@ -0,0 +1,197 @@
+#include "common.hpp"
+#include "RTC/SendOffloadPool.hpp"
+#include "RTC/SrtpSession.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcpy(), std::memcmp()
+#include <vector>
+#ifndef _WIN32
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+using namespace RTC;
+
+#ifndef _WIN32
+class TestSendOffloadPoolListener : public SendOffloadPool::Listener
+{
+public:
+	void OnSendOffloadPoolPacketSent(
+	  SendOffloadPool* /*pool*/, void* userData, size_t len, bool sent) override
+	{
+		this->userDatas.push_back(userData);
+		this->lens.push_back(len);
+
+		if (sent)
+		{
+			++this->numSent;
+		}
+	}
+
+public:
+	std::vector<void*> userDatas;
+	std::vector<size_t> lens;
+	size_t numSent{ 0u };
+};
+
+static int createUdpSocket(struct sockaddr_in& addr)
+{
+	const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+	REQUIRE(fd >= 0);
+
+	std::memset(std::addressof(addr), 0, sizeof(addr));
+
+	addr.sin_family      = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port        = 0;
+
+	REQUIRE(bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0);
+
+	socklen_t addrLen = sizeof(addr);
+
+	REQUIRE(getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &addrLen) == 0);
+
+	struct timeval timeout{ 1, 0 };
+
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	return fd;
+}
+
+SCENARIO("SendOffloadPool", "[rtc][SendOffloadPool]")
+{
+	// clang-format off
+	uint8_t key[] =
+	{
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+		0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+		0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+		0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E
+	};
+	// clang-format on
+
+	SECTION("packets are protected and sent in order")
+	{
+		constexpr size_t NumPackets{ 100u };
+		constexpr size_t PacketLen{ 112u };
+		// AES_CM_128_HMAC_SHA1_80 authentication tag length.
+		constexpr size_t TagLen{ 10u };
+
+		SrtpSession sendSession(
+		  SrtpSession::Type::OUTBOUND, SrtpSession::CryptoSuite::AES_CM_128_HMAC_SHA1_80, key, sizeof(key));
+		SrtpSession recvSession(
+		  SrtpSession::Type::INBOUND, SrtpSession::CryptoSuite::AES_CM_128_HMAC_SHA1_80, key, sizeof(key));
+
+		struct sockaddr_in sendAddr;
+		struct sockaddr_in recvAddr;
+		const int sendFd = createUdpSocket(sendAddr);
+		const int recvFd = createUdpSocket(recvAddr);
+
+		TestSendOffloadPoolListener listener;
+		SendOffloadPool pool(2u);
+		const size_t shardIdx = pool.AssignShard();
+		size_t numCallbacks{ 0u };
+		std::vector<std::vector<uint8_t>> packets;
+
+		for (size_t i{ 0u }; i < NumPackets; ++i)
+		{
+			std::vector<uint8_t> packet(PacketLen, static_cast<uint8_t>(i));
+
+			// RTP header with seq i and SSRC 0x11223344.
+			packet[0]  = 0x80;
+			packet[1]  = 111;
+			packet[2]  = static_cast<uint8_t>(i >> 8);
+			packet[3]  = static_cast<uint8_t>(i);
+			packet[8]  = 0x11;
+			packet[9]  = 0x22;
+			packet[10] = 0x33;
+			packet[11] = 0x44;
+
+			const auto* cb = new SendOffloadPool::onSendCallback(
+			  [&numCallbacks](bool sent)
+			  {
+				  if (sent)
+				  {
+					  ++numCallbacks;
+				  }
+			  });
+
+			REQUIRE(pool.Send(
+			  shardIdx,
+			  &listener,
+			  &packets,
+			  &sendSession,
+			  sendFd,
+			  reinterpret_cast<const struct sockaddr*>(&recvAddr),
+			  packet.data(),
+			  packet.size(),
+			  /*isRtcp*/ false,
+			  cb));
+
+			packets.push_back(std::move(packet));
+		}
+
+		pool.Flush(shardIdx);
+
+		REQUIRE(listener.lens.size() == NumPackets);
+		REQUIRE(listener.numSent == NumPackets);
+		REQUIRE(numCallbacks == NumPackets);
+
+		for (auto len : listener.lens)
+		{
+			REQUIRE(len == PacketLen + TagLen);
+		}
+
+		for (auto* userData : listener.userDatas)
+		{
+			REQUIRE(userData == &packets);
+		}
+
+		for (size_t i{ 0u }; i < NumPackets; ++i)
+		{
+			uint8_t buffer[1500];
+			const auto received = recv(recvFd, buffer, sizeof(buffer), 0);
+
+			REQUIRE(received == static_cast<ssize_t>(PacketLen + TagLen));
+
+			auto len = static_cast<int>(received);
+
+			REQUIRE(recvSession.DecryptSrtp(buffer, &len));
+			REQUIRE(len == static_cast<int>(PacketLen));
+			REQUIRE(std::memcmp(buffer, packets[i].data(), PacketLen) == 0);
+		}
+
+		close(sendFd);
+		close(recvFd);
+	}
+
+	SECTION("too big packets are rejected")
+	{
+		SrtpSession sendSession(
+		  SrtpSession::Type::OUTBOUND, SrtpSession::CryptoSuite::AES_CM_128_HMAC_SHA1_80, key, sizeof(key));
+
+		struct sockaddr_in addr;
+		const int fd = createUdpSocket(addr);
+
+		TestSendOffloadPoolListener listener;
+		SendOffloadPool pool(1u);
+		std::vector<uint8_t> packet(RTC::MtuSize + 1u, 0u);
+
+		REQUIRE(!pool.Send(
+		  pool.AssignShard(),
+		  &listener,
+		  nullptr,
+		  &sendSession,
+		  fd,
+		  reinterpret_cast<const struct sockaddr*>(&addr),
+		  packet.data(),
+		  packet.size(),
+		  /*isRtcp*/ false,
+		  nullptr));
+
+		close(fd);
+	}
+}
+#endif
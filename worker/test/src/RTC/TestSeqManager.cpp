@@ -606,6 +606,37 @@ SCENARIO("SeqManager", "[rtc][SeqMananger]")
 		validate(seqManager, inputs);
 	}
 
+	SECTION("drop every other input during multiple roll overs")
+	{
+		std::vector<TestSeqManagerInput<uint16_t>> inputs;
+		std::vector<TestSeqManagerInput<uint16_t>> inputs2;
+		uint16_t output{ 0 };
+
+		for (uint32_t i = 0; i < 3 * 65536; ++i)
+		{
+			const auto input = static_cast<uint16_t>(i);
+
+			if (i % 2 == 1)
+			{
+				inputs.emplace_back(input, 0, false, true);
+				inputs2.emplace_back(input & kMaxNumberFor15Bits, 0, false, true);
+			}
+			else
+			{
+				inputs.emplace_back(input, output, false, false, input);
+				inputs2.emplace_back(
+				  input & kMaxNumberFor15Bits, output & kMaxNumberFor15Bits, false, false, input & kMaxNumberFor15Bits);
+
+				++output;
+			}
+		}
+
+		SeqManager<uint16_t> seqManager;
+		SeqManager<uint16_t, 15> seqManager2;
+		validate(seqManager, inputs);
+		validate(seqManager2, inputs2);
+	}
+
 	SECTION("should produce same output for same old input before drop (15 bits range)")
 	{
 		// clang-format off
@@ -0,0 +1,151 @@
+#include "common.hpp"
+#include "ChannelMessageRegistrator.hpp"
+#include "FBS/transport.h"
+#include "RTC/RtpPacket.hpp"
+#include "RTC/Shared.hpp"
+#include "RTC/SimpleConsumer.hpp"
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+
+using namespace RTC;
+
+class TestSimpleConsumerListener : public Consumer::Listener
+{
+public:
+	void OnConsumerSendRtpPacket(Consumer* /*consumer*/, RtpPacket* packet) override
+	{
+		this->sentSeqs.push_back(packet->GetSequenceNumber());
+	}
+	void OnConsumerRetransmitRtpPacket(Consumer* /*consumer*/, RtpPacket* /*packet*/) override
+	{
+	}
+	void OnConsumerKeyFrameRequested(Consumer* /*consumer*/, uint32_t /*mappedSsrc*/) override
+	{
+	}
+	void OnConsumerNeedBitrateChange(Consumer* /*consumer*/) override
+	{
+	}
+	void OnConsumerNeedZeroBitrate(Consumer* /*consumer*/) override
+	{
+	}
+	void OnConsumerProducerClosed(Consumer* /*consumer*/) override
+	{
+	}
+
+public:
+	std::vector<uint16_t> sentSeqs;
+};
+
+// Creates an Opus SimpleConsumer that consumes SSRC 1111 and sends SSRC 2222.
+static SimpleConsumer* CreateSimpleConsumer(Shared* shared, Consumer::Listener* listener)
+{
+	flatbuffers::FlatBufferBuilder builder;
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpCodecParameters>> codecs{
+		FBS::RtpParameters::CreateRtpCodecParametersDirect(builder, "audio/opus", 100, 48000, 2)
+	};
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpHeaderExtensionParameters>>
+	  headerExtensions;
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>> encodings{
+		FBS::RtpParameters::CreateRtpEncodingParametersDirect(builder, 2222)
+	};
+	auto rtcp = FBS::RtpParameters::CreateRtcpParametersDirect(builder, "cname");
+	auto rtpParameters = FBS::RtpParameters::CreateRtpParametersDirect(
+	  builder, nullptr, &codecs, &headerExtensions, &encodings, rtcp);
+
+	std::vector<flatbuffers::Offset<FBS::RtpParameters::RtpEncodingParameters>>
+	  consumableRtpEncodings{ FBS::RtpParameters::CreateRtpEncodingParametersDirect(builder, 1111) };
+
+	builder.Finish(FBS::Transport::CreateConsumeRequestDirect(
+	  builder,
+	  "consumer",
+	  "producer",
+	  FBS::RtpParameters::MediaKind::AUDIO,
+	  rtpParameters,
+	  FBS::RtpParameters::Type::SIMPLE,
+	  &consumableRtpEncodings));
+
+	const auto* data =
+	  flatbuffers::GetRoot<FBS::Transport::ConsumeRequest>(builder.GetBufferPointer());
+
+	return new SimpleConsumer(shared, "consumer", "producer", listener, data);
+}
+
+SCENARIO("SimpleConsumer skipped packets", "[rtc][simpleconsumer]")
+{
+	// clang-format off
+	uint8_t buffer[] =
+	{
+		0x80, 0x64, 0x00, 0x00, // V:2, PT:100, Seq:0
+		0x00, 0x00, 0x00, 0x04, // Timestamp:4
+		0x00, 0x00, 0x04, 0x57, // SSRC:1111
+		0x11, 0x22, 0x33, 0x44  // Payload
+	};
+	// clang-format on
+
+	std::unique_ptr<RtpPacket> packet{ RtpPacket::Parse(buffer, sizeof(buffer)) };
+
+	REQUIRE(packet);
+
+	Shared shared(new ChannelMessageRegistrator(), nullptr);
+	TestSimpleConsumerListener listener;
+	std::unique_ptr<SimpleConsumer> consumer{ CreateSimpleConsumer(&shared, &listener) };
+	std::shared_ptr<RtpPacket> sharedPacket;
+
+	consumer->TransportConnected();
+
+	auto send = [&](uint16_t seq)
+	{
+		packet->SetSequenceNumber(seq);
+		consumer->SendRtpPacket(packet.get(), sharedPacket);
+
+		// The original sequence number is restored.
+		REQUIRE(packet->GetSequenceNumber() == seq);
+	};
+
+	auto skip = [&](uint16_t seq)
+	{
+		packet->SetSequenceNumber(seq);
+
+		REQUIRE(consumer->SkipRtpPacket(packet.get()));
+	};
+
+	SECTION("skipped packets do not leave gaps in sent sequence numbers")
+	{
+		send(1000);
+		send(1001);
+		skip(1002);
+		send(1003);
+		skip(1004);
+		skip(1005);
+		skip(1006);
+		send(1007);
+		send(1008);
+
+		REQUIRE(listener.sentSeqs.size() == 5);
+
+		for (size_t i{ 1u }; i < listener.sentSeqs.size(); ++i)
+		{
+			REQUIRE(listener.sentSeqs[i] == static_cast<uint16_t>(listener.sentSeqs[i - 1] + 1));
+		}
+	}
+
+	SECTION("sequence numbers keep growing after a re-sync")
+	{
+		send(1000);
+		skip(1001);
+		// Re-sync with a packet far from the skipped one.
+		send(30000);
+		// A packet lost after the re-sync still leaves a gap.
+		send(30002);
+		// Wrap around.
+		skip(65535);
+		send(0);
+
+		REQUIRE(listener.sentSeqs.size() == 4);
+		REQUIRE(listener.sentSeqs[1] == static_cast<uint16_t>(listener.sentSeqs[0] + 1));
+		REQUIRE(listener.sentSeqs[2] == static_cast<uint16_t>(listener.sentSeqs[1] + 2));
+		REQUIRE(listener.sentSeqs[3] == static_cast<uint16_t>(listener.sentSeqs[2] + 1));
+	}
+}
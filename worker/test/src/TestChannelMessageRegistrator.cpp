@@ -0,0 +1,100 @@
+#include "common.hpp"
+#include "ChannelMessageRegistrator.hpp"
+#include "MediaSoupErrors.hpp"
+#include <catch2/catch.hpp>
+
+class TestChannelMessageHandler : public Channel::ChannelSocket::RequestHandler,
+                                  public Channel::ChannelSocket::NotificationHandler
+{
+public:
+	void HandleRequest(Channel::ChannelRequest* /*request*/) override
+	{
+	}
+	void HandleNotification(Channel::ChannelNotification* /*notification*/) override
+	{
+	}
+};
+
+SCENARIO("ChannelMessageRegistrator", "[channel][channelmessageregistrator]")
+{
+	ChannelMessageRegistrator registrator;
+	TestChannelMessageHandler handler1;
+	TestChannelMessageHandler handler2;
+
+	SECTION("handles resolve to the registered handlers")
+	{
+		const auto handle1 = registrator.RegisterHandler("id1", &handler1, &handler1);
+		const auto handle2 = registrator.RegisterHandler("id2", &handler2, nullptr);
+
+		REQUIRE(handle1 != ChannelMessageRegistrator::NoHandle);
+		REQUIRE(handle2 != ChannelMessageRegistrator::NoHandle);
+		REQUIRE(handle1 != handle2);
+		REQUIRE(registrator.GetHandle("id1") == handle1);
+		REQUIRE(registrator.GetHandle("id2") == handle2);
+		REQUIRE(registrator.GetHandle("id3") == ChannelMessageRegistrator::NoHandle);
+
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id1") == &handler1);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle1, "id1") == &handler1);
+		REQUIRE(registrator.GetChannelRequestHandler(handle2, "id2") == &handler2);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle2, "id2") == nullptr);
+		REQUIRE(
+		  registrator.GetChannelRequestHandler(ChannelMessageRegistrator::NoHandle, "") == nullptr);
+	}
+
+	SECTION("registering an existing id throws and keeps the existing handle")
+	{
+		const auto handle1 = registrator.RegisterHandler("id1", &handler1, &handler1);
+
+		REQUIRE_THROWS_AS(registrator.RegisterHandler("id1", &handler2, &handler2), MediaSoupError);
+		REQUIRE(registrator.GetHandle("id1") == handle1);
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id1") == &handler1);
+	}
+
+	SECTION("slots are reused with a new generation and stale handles are rejected")
+	{
+		const auto handle1 = registrator.RegisterHandler("id1", &handler1, &handler1);
+
+		registrator.UnregisterHandler("id1");
+
+		REQUIRE(registrator.GetHandle("id1") == ChannelMessageRegistrator::NoHandle);
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id1") == nullptr);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle1, "id1") == nullptr);
+
+		const auto handle2 = registrator.RegisterHandler("id2", &handler2, &handler2);
+
+		// Same slot (lower bits) but different generation.
+		REQUIRE(handle2 != handle1);
+		REQUIRE((handle2 & 0xFFFFFu) == (handle1 & 0xFFFFFu));
+
+		// The stale handle does not resolve to the entity reusing its slot.
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id1") == nullptr);
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id2") == nullptr);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle1, "id1") == nullptr);
+		REQUIRE(registrator.GetChannelRequestHandler(handle2, "id2") == &handler2);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle2, "id2") == &handler2);
+
+		// Unregistering an unknown id does not release the reused slot.
+		registrator.UnregisterHandler("id1");
+
+		REQUIRE(registrator.GetChannelRequestHandler(handle2, "id2") == &handler2);
+	}
+
+	SECTION("handles with an out of range index are rejected")
+	{
+		const auto handle1 = registrator.RegisterHandler("id1", &handler1, &handler1);
+
+		REQUIRE(registrator.GetChannelRequestHandler(handle1 + 1u, "id1") == nullptr);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle1 + 1u, "id1") == nullptr);
+	}
+
+	SECTION("handles addressed with another id are rejected")
+	{
+		const auto handle1 = registrator.RegisterHandler("id1", &handler1, &handler1);
+		const auto handle2 = registrator.RegisterHandler("id2", &handler2, &handler2);
+
+		REQUIRE(registrator.GetChannelRequestHandler(handle1, "id2") == nullptr);
+		REQUIRE(registrator.GetChannelNotificationHandler(handle1, "id2") == nullptr);
+		REQUIRE(registrator.GetChannelRequestHandler(handle2, "id") == nullptr);
+		REQUIRE(registrator.GetChannelRequestHandler(handle2, "id22") == nullptr);
+	}
+}
@@ -0,0 +1,69 @@
+#include "common.hpp"
+#include "DepUsrSCTP.hpp"
+#include <catch2/catch.hpp>
+
+SCENARIO("DepUsrSCTP Checker interval", "[usrsctp][checker]")
+{
+	constexpr uint64_t MinInterval{ DepUsrSCTP::CheckerMinInterval };
+	constexpr uint64_t MaxInterval{ DepUsrSCTP::CheckerMaxInterval };
+	constexpr uint64_t IdleTimeout{ DepUsrSCTP::CheckerIdleTimeout };
+	// Min SCTP RTO (RTO.Min in RFC 9260).
+	constexpr uint64_t MinRto{ 1000u };
+
+	SECTION("activity resets the interval")
+	{
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(MaxInterval, true, 0u, true) == MinInterval);
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(MinInterval, true, 0u, false) == MinInterval);
+	}
+
+	SECTION("interval backs off without activity up to the max")
+	{
+		uint64_t interval{ MinInterval };
+
+		interval = DepUsrSCTP::GetCheckerInterval(interval, false, 10u, true);
+
+		REQUIRE(interval == 2 * MinInterval);
+
+		for (size_t i{ 0u }; i < 10u; ++i)
+		{
+			interval = DepUsrSCTP::GetCheckerInterval(interval, false, 10u, true);
+		}
+
+		REQUIRE(interval == MaxInterval);
+	}
+
+	SECTION("idle Checker keeps ticking while a SctpAssociation is active")
+	{
+		uint64_t interval{ MinInterval };
+		uint64_t idleMs{ 0u };
+
+		// Ten minutes without SCTP activity, so usrsctp timers such as HEARTBEAT
+		// (30 seconds) and T3-rtx (RTO) are just handled by the Checker.
+		while (idleMs < 10u * 60u * 1000u)
+		{
+			interval = DepUsrSCTP::GetCheckerInterval(interval, false, idleMs, true);
+
+			REQUIRE(interval != 0u);
+			REQUIRE(interval <= MaxInterval);
+			// So usrsctp timers fire less than the min RTO late.
+			REQUIRE(interval < MinRto);
+
+			idleMs += interval;
+		}
+
+		REQUIRE(interval == MaxInterval);
+	}
+
+	SECTION("idle Checker stops without active SctpAssociations")
+	{
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(MinInterval, false, IdleTimeout - 1u, false) != 0u);
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(MaxInterval, false, IdleTimeout, false) == 0u);
+		// Activity wakes it up again.
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(0u, true, 0u, false) == MinInterval);
+	}
+
+	SECTION("stopped Checker restarts with the min interval")
+	{
+		REQUIRE(DepUsrSCTP::GetCheckerInterval(0u, false, 0u, true) == MinInterval);
+	}
+}
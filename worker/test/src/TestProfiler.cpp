@@ -0,0 +1,82 @@
+#include "common.hpp"
+#include "Profiler.hpp"
+#include <catch2/catch.hpp>
+
+using Histogram = Profiler::Histogram;
+
+SCENARIO("Profiler::Histogram", "[profiler]")
+{
+	SECTION("bucket indexes are contiguous and keep values within their bounds")
+	{
+		REQUIRE(Histogram::GetBucketIndex(0u) == 0u);
+		REQUIRE(Histogram::GetBucketIndex(31u) == 31u);
+		REQUIRE(Histogram::GetBucketIndex(32u) == 32u);
+		REQUIRE(Histogram::GetBucketIndex(33u) == 32u);
+		REQUIRE(Histogram::GetBucketIndex(34u) == 33u);
+		REQUIRE(Histogram::GetBucketIndex(Histogram::MaxValue) == Histogram::NumBuckets - 1u);
+		REQUIRE(Histogram::GetBucketIndex(UINT64_MAX) == Histogram::NumBuckets - 1u);
+
+		for (size_t idx{ 1u }; idx < Histogram::NumBuckets; ++idx)
+		{
+			REQUIRE(
+			  Histogram::GetBucketLowerBound(idx) == Histogram::GetBucketUpperBound(idx - 1u) + 1u);
+			REQUIRE(Histogram::GetBucketIndex(Histogram::GetBucketLowerBound(idx)) == idx);
+			REQUIRE(Histogram::GetBucketIndex(Histogram::GetBucketUpperBound(idx)) == idx);
+		}
+
+		REQUIRE(Histogram::GetBucketUpperBound(Histogram::NumBuckets - 1u) == Histogram::MaxValue);
+	}
+
+	SECTION("relative error of bucket bounds is lower than 1/16")
+	{
+		for (size_t idx{ Histogram::SubBucketCount }; idx < Histogram::NumBuckets; ++idx)
+		{
+			const auto lower = Histogram::GetBucketLowerBound(idx);
+			const auto upper = Histogram::GetBucketUpperBound(idx);
+
+			REQUIRE((upper - lower) * 16u < lower);
+		}
+	}
+
+	SECTION("empty histogram")
+	{
+		Histogram histogram;
+
+		REQUIRE(histogram.GetCount() == 0u);
+		REQUIRE(histogram.GetMin() == 0u);
+		REQUIRE(histogram.GetMax() == 0u);
+		REQUIRE(histogram.GetMean() == 0u);
+		REQUIRE(histogram.GetValueAtPercentile(0.99) == 0u);
+	}
+
+	SECTION("percentiles")
+	{
+		Histogram histogram;
+
+		// 1..1000 us.
+		for (uint64_t value{ 1u }; value <= 1000u; ++value)
+		{
+			histogram.Record(value * 1000u);
+		}
+
+		REQUIRE(histogram.GetCount() == 1000u);
+		REQUIRE(histogram.GetMin() == 1000u);
+		REQUIRE(histogram.GetMax() == 1000000u);
+		REQUIRE(histogram.GetMean() == 500500u);
+
+		const auto p50 = histogram.GetValueAtPercentile(0.50);
+		const auto p99 = histogram.GetValueAtPercentile(0.99);
+
+		REQUIRE(p50 >= 500000u);
+		REQUIRE(p50 <= 500000u + (500000u / 16u));
+		REQUIRE(p99 >= 990000u);
+		REQUIRE(p99 <= 990000u + (990000u / 16u));
+		REQUIRE(histogram.GetValueAtPercentile(1.0) == 1000000u);
+
+		histogram.Reset();
+
+		REQUIRE(histogram.GetCount() == 0u);
+		REQUIRE(histogram.GetMax() == 0u);
+		REQUIRE(histogram.GetValueAtPercentile(0.50) == 0u);
+	}
+}
@@ -18,3 +18,31 @@ SCENARIO("Utils::Bits::CountSetBits()")
 	mask = 0b1111111111111111;
 	REQUIRE(Utils::Bits::CountSetBits(mask) == 16);
 }
+
+SCENARIO("Utils::Bits::CountSetBits() with 64 bits mask")
+{
+	uint64_t mask;
+
+	mask = 0;
+	REQUIRE(Utils::Bits::CountSetBits(mask) == 0);
+
+	mask = 0x8000000000000001;
+	REQUIRE(Utils::Bits::CountSetBits(mask) == 2);
+
+	mask = 0xFFFFFFFFFFFFFFFF;
+	REQUIRE(Utils::Bits::CountSetBits(mask) == 64);
+}
+
+SCENARIO("Utils::Bits::CountTrailingZeros()")
+{
+	REQUIRE(Utils::Bits::CountTrailingZeros(0x0000000000000001) == 0);
+	REQUIRE(Utils::Bits::CountTrailingZeros(0x0000000000000100) == 8);
+	REQUIRE(Utils::Bits::CountTrailingZeros(0x8000000000000000) == 63);
+}
+
+SCENARIO("Utils::Bits::CountLeadingZeros()")
+{
+	REQUIRE(Utils::Bits::CountLeadingZeros(0x0000000000000001) == 63);
+	REQUIRE(Utils::Bits::CountLeadingZeros(0x0000000000000100) == 55);
+	REQUIRE(Utils::Bits::CountLeadingZeros(0x8000000000000000) == 0);
+}
@@ -0,0 +1,114 @@
+#include "common.hpp"
+#include "Utils.hpp"
+#include <catch2/catch.hpp>
+#include <cstring> // std::memcmp()
+#include <string>
+#include <vector>
+
+// Plain bitwise CRC32 to compare against.
+static uint32_t getBitwiseCRC32(const uint8_t* data, size_t size)
+{
+	uint32_t crc{ 0xFFFFFFFF };
+
+	for (size_t i{ 0u }; i < size; ++i)
+	{
+		crc ^= data[i];
+
+		for (int bit{ 0 }; bit < 8; ++bit)
+		{
+			crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+		}
+	}
+
+	return crc ^ ~0U;
+}
+
+SCENARIO("Utils::Crypto")
+{
+	SECTION("Utils::Crypto::GetCRC32()")
+	{
+		const std::string check{ "123456789" };
+
+		REQUIRE(
+		  Utils::Crypto::GetCRC32(reinterpret_cast<const uint8_t*>(check.data()), check.size()) ==
+		  0xCBF43926);
+
+		REQUIRE(Utils::Crypto::GetCRC32(nullptr, 0) == 0u);
+
+		std::vector<uint8_t> data(1500);
+
+		for (auto& byte : data)
+		{
+			byte = static_cast<uint8_t>(Utils::Crypto::GetRandomUInt(0u, 255u));
+		}
+
+		// Cover every length below 64 plus some bigger ones, starting at every
+		// offset so unaligned reads are checked too.
+		for (size_t offset{ 0u }; offset < 8u; ++offset)
+		{
+			for (size_t len{ 0u }; len < 64u; ++len)
+			{
+				REQUIRE(
+				  Utils::Crypto::GetCRC32(data.data() + offset, len) ==
+				  getBitwiseCRC32(data.data() + offset, len));
+			}
+
+			for (size_t len : { 100u, 255u, 1024u, 1492u })
+			{
+				REQUIRE(
+				  Utils::Crypto::GetCRC32(data.data() + offset, len) ==
+				  getBitwiseCRC32(data.data() + offset, len));
+			}
+		}
+	}
+
+	SECTION("Utils::Crypto::HmacSha1")
+	{
+		// RFC 2202 test case 2.
+		const std::string key{ "Jefe" };
+		const std::string text{ "what do ya want for nothing?" };
+
+		// clang-format off
+		const uint8_t expected[] =
+		{
+			0xEF, 0xFC, 0xDF, 0x6A, 0xE5, 0xEB, 0x2F, 0xA2,
+			0xD2, 0x74, 0x16, 0xD5, 0xF1, 0x84, 0xDF, 0x9C,
+			0x25, 0x9A, 0x7C, 0x79
+		};
+		// clang-format on
+
+		Utils::Crypto::HmacSha1 hmacSha1(key);
+
+		// Computing several times must give the same result.
+		for (int i{ 0 }; i < 3; ++i)
+		{
+			const uint8_t* result =
+			  hmacSha1.Compute(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+
+			REQUIRE(std::memcmp(result, expected, sizeof(expected)) == 0);
+		}
+
+		// Must match GetHmacSha1() with any key and data.
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			const std::string randomKey = Utils::Crypto::GetRandomString(22);
+			std::vector<uint8_t> randomData(Utils::Crypto::GetRandomUInt(1u, 512u));
+			uint8_t computed[20];
+
+			for (auto& byte : randomData)
+			{
+				byte = static_cast<uint8_t>(Utils::Crypto::GetRandomUInt(0u, 255u));
+			}
+
+			Utils::Crypto::HmacSha1 randomHmacSha1(randomKey);
+
+			std::memcpy(
+			  computed, randomHmacSha1.Compute(randomData.data(), randomData.size()), sizeof(computed));
+
+			const uint8_t* result =
+			  Utils::Crypto::GetHmacSha1(randomKey, randomData.data(), randomData.size());
+
+			REQUIRE(std::memcmp(result, computed, sizeof(computed)) == 0);
+		}
+	}
+}
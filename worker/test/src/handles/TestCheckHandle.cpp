@@ -0,0 +1,120 @@
+#include "common.hpp"
+#include "DepLibUV.hpp"
+#include "handles/CheckHandle.hpp"
+#include "handles/TimerHandle.hpp"
+#include <catch2/catch.hpp>
+#include <vector>
+
+// Queues items and flushes them once at the end of the loop iteration, the
+// way PipeTransport aggregates RTP packets.
+class TestCheckHandleAggregator : public CheckHandle::Listener
+{
+public:
+	TestCheckHandleAggregator() : checkHandle(this)
+	{
+	}
+
+public:
+	void Add(int item)
+	{
+		this->items.push_back(item);
+
+		this->checkHandle.Start();
+	}
+
+	void OnCheck(CheckHandle* /*check*/) override
+	{
+		this->flushes.push_back(this->items);
+		this->items.clear();
+	}
+
+public:
+	CheckHandle checkHandle;
+	std::vector<int> items;
+	std::vector<std::vector<int>> flushes;
+};
+
+// Adds items to the aggregator from a timer callback, so they are added within
+// a loop iteration.
+class TestCheckHandleTimerListener : public TimerHandle::Listener
+{
+public:
+	explicit TestCheckHandleTimerListener(TestCheckHandleAggregator* aggregator)
+	  : aggregator(aggregator)
+	{
+	}
+
+public:
+	void OnTimer(TimerHandle* /*timer*/) override
+	{
+		++this->calls;
+
+		this->aggregator->Add(this->calls * 10);
+		this->aggregator->Add((this->calls * 10) + 1);
+
+		// Nothing is flushed until the loop iteration ends.
+		REQUIRE(this->aggregator->checkHandle.IsActive());
+		REQUIRE(this->aggregator->flushes.size() == static_cast<size_t>(this->calls - 1));
+	}
+
+public:
+	TestCheckHandleAggregator* aggregator{ nullptr };
+	int calls{ 0 };
+};
+
+SCENARIO("CheckHandle", "[handles][CheckHandle]")
+{
+	SECTION("items added before running the loop are flushed once")
+	{
+		TestCheckHandleAggregator aggregator;
+
+		aggregator.Add(1);
+		aggregator.Add(2);
+		aggregator.Add(3);
+
+		REQUIRE(aggregator.checkHandle.IsActive());
+		REQUIRE(aggregator.flushes.empty());
+
+		DepLibUV::RunLoop();
+
+		REQUIRE(!aggregator.checkHandle.IsActive());
+		REQUIRE(aggregator.flushes.size() == 1);
+		REQUIRE(aggregator.flushes[0] == std::vector<int>{ 1, 2, 3 });
+	}
+
+	SECTION("items added in different loop iterations are flushed separately")
+	{
+		TestCheckHandleAggregator aggregator;
+		TestCheckHandleTimerListener timerListener(&aggregator);
+		TimerHandle timer(&timerListener);
+
+		timer.Start(1u, 1u);
+
+		while (timerListener.calls < 3)
+		{
+			uv_run(DepLibUV::GetLoop(), UV_RUN_ONCE);
+		}
+
+		timer.Stop();
+
+		DepLibUV::RunLoop();
+
+		REQUIRE(aggregator.flushes.size() == 3);
+		REQUIRE(aggregator.flushes[0] == std::vector<int>{ 10, 11 });
+		REQUIRE(aggregator.flushes[1] == std::vector<int>{ 20, 21 });
+		REQUIRE(aggregator.flushes[2] == std::vector<int>{ 30, 31 });
+	}
+
+	SECTION("stopped handle does not flush")
+	{
+		TestCheckHandleAggregator aggregator;
+
+		aggregator.Add(1);
+		aggregator.checkHandle.Stop();
+
+		DepLibUV::RunLoop();
+
+		REQUIRE(aggregator.flushes.empty());
+		REQUIRE(aggregator.items == std::vector<int>{ 1 });
+	}
+}